@@ -44,6 +44,14 @@
 #define USE_BF_DEC
 #endif
 
+#if defined(USE_FFT_MUL) && !defined(_WIN32) && !defined(EMSCRIPTEN) && \
+    !defined(__wasi__)
+/* enable the multi-threaded NTT multiplication (see
+   bf_context_t.ntt_threads) */
+#define USE_NTT_THREADS
+#include <pthread.h>
+#endif
+
 //#define inline __attribute__((always_inline))
 
 #ifdef __AVX2__
@@ -7887,93 +7895,132 @@ void fft_clear_cache(bf_context_t *s1)
 
 #define STRIP_LEN 16
 
-/* dst = buf1, src = buf2 */
-static int ntt_fft_partial(BFNTTState *s, NTTLimb *buf1,
-                           int k1, int k2, limb_t n1, limb_t n2, int inverse,
-                           limb_t m_idx)
+/* return the log2 of the size of the first FFT pass of ntt_conv() */
+static int ntt_conv_k1(int k)
+{
+    if (k <= NTT_TRIG_K_MAX)
+        return k;
+    else
+        return bf_min(k / 2, NTT_TRIG_K_MAX); /* recursive split of the FFT */
+}
+
+static limb_t ntt_conv_tmp_len(int k);
+
+/* return the number of elements of the temporary buffer of
+   ntt_conv() when the first pass has size 2^k1 and k2 != 0 */
+static limb_t ntt_conv_split_tmp_len(int k1, int k2)
+{
+    limb_t len;
+
+    len = ((limb_t)1 << k1) * (STRIP_LEN + 1);
+    return bf_max(len, ntt_conv_tmp_len(k2));
+}
+
+/* return the number of elements of the temporary buffer of
+   ntt_conv() */
+static limb_t ntt_conv_tmp_len(int k)
+{
+    int k1, k2;
+
+    k1 = ntt_conv_k1(k);
+    k2 = k - k1;
+    if (k2 == 0)
+        return (limb_t)1 << k1;
+    return ntt_conv_split_tmp_len(k1, k2);
+}
+
+/* FFTs of size n1 of the columns j_start to j_end - 1 of buf1 seen as
+   a n1 x n2 matrix. j_start and j_end are multiples of STRIP_LEN, so
+   the columns of different ranges can be computed in parallel. tmp =
+   tmp_buf */
+static int ntt_fft_strips(BFNTTState *s, NTTLimb *buf1,
+                          int k1, int k2, limb_t j_start, limb_t j_end,
+                          int inverse, limb_t m_idx, NTTLimb *tmp_buf)
 {
-    limb_t i, j, c_mul, c0, m, m_inv, strip_len, l;
+    limb_t i, j, c_mul, c0, c, e, m, m_inv, strip_len, l, n1, n2;
     NTTLimb *buf2, *buf3;
 
-    buf2 = NULL;
-    buf3 = ntt_malloc(s, sizeof(NTTLimb) * n1);
-    if (!buf3)
-        goto fail;
-    if (k2 == 0) {
-        if (ntt_fft(s, buf1, buf1, buf3, k1, inverse, m_idx))
-            goto fail;
-    } else {
-        strip_len = STRIP_LEN;
-        buf2 = ntt_malloc(s, sizeof(NTTLimb) * n1 * strip_len);
-        if (!buf2)
-            goto fail;
-        m = ntt_mods[m_idx];
-        m_inv = s->ntt_mods_div[m_idx];
-        c0 = s->ntt_proot_pow[m_idx][inverse][k1 + k2];
-        c_mul = 1;
-        assert((n2 % strip_len) == 0);
-        for(j = 0; j < n2; j += strip_len) {
-            for(i = 0; i < n1; i++) {
-                for(l = 0; l < strip_len; l++) {
-                    buf2[i + l * n1] = buf1[i * n2 + (j + l)];
-                }
-            }
+    n1 = (limb_t)1 << k1;
+    n2 = (limb_t)1 << k2;
+    strip_len = STRIP_LEN;
+    buf3 = tmp_buf;
+    buf2 = tmp_buf + n1;
+    m = ntt_mods[m_idx];
+    m_inv = s->ntt_mods_div[m_idx];
+    c0 = s->ntt_proot_pow[m_idx][inverse][k1 + k2];
+    assert((n2 % strip_len) == 0 && (j_start % strip_len) == 0);
+    /* c_mul = c0^j_start */
+    c_mul = 1;
+    c = c0;
+    for(e = j_start; e != 0; e >>= 1) {
+        if (e & 1)
+            c_mul = mul_mod_fast(c_mul, c, m, m_inv);
+        c = mul_mod_fast(c, c, m, m_inv);
+    }
+    for(j = j_start; j < j_end; j += strip_len) {
+        for(i = 0; i < n1; i++) {
             for(l = 0; l < strip_len; l++) {
-                if (inverse)
-                    mul_trig(buf2 + l * n1, n1, c_mul, m, m_inv);
-                if (ntt_fft(s, buf2 + l * n1, buf2 + l * n1, buf3, k1, inverse, m_idx))
-                    goto fail;
-                if (!inverse)
-                    mul_trig(buf2 + l * n1, n1, c_mul, m, m_inv);
-                c_mul = mul_mod_fast(c_mul, c0, m, m_inv);
+                buf2[i + l * n1] = buf1[i * n2 + (j + l)];
             }
+        }
+        for(l = 0; l < strip_len; l++) {
+            if (inverse)
+                mul_trig(buf2 + l * n1, n1, c_mul, m, m_inv);
+            if (ntt_fft(s, buf2 + l * n1, buf2 + l * n1, buf3, k1, inverse, m_idx))
+                return -1;
+            if (!inverse)
+                mul_trig(buf2 + l * n1, n1, c_mul, m, m_inv);
+            c_mul = mul_mod_fast(c_mul, c0, m, m_inv);
+        }
 
-            for(i = 0; i < n1; i++) {
-                for(l = 0; l < strip_len; l++) {
-                    buf1[i * n2 + (j + l)] = buf2[i + l *n1];
-                }
+        for(i = 0; i < n1; i++) {
+            for(l = 0; l < strip_len; l++) {
+                buf1[i * n2 + (j + l)] = buf2[i + l *n1];
             }
         }
-        ntt_free(s, buf2);
     }
-    ntt_free(s, buf3);
     return 0;
- fail:
-    ntt_free(s, buf2);
-    ntt_free(s, buf3);
-    return -1;
+}
+
+/* dst = buf1, tmp = tmp_buf */
+static int ntt_fft_partial(BFNTTState *s, NTTLimb *buf1,
+                           int k1, int k2, limb_t n1, limb_t n2, int inverse,
+                           limb_t m_idx, NTTLimb *tmp_buf)
+{
+    if (k2 == 0)
+        return ntt_fft(s, buf1, buf1, tmp_buf, k1, inverse, m_idx);
+    else
+        return ntt_fft_strips(s, buf1, k1, k2, 0, n2, inverse, m_idx, tmp_buf);
 }
 
 
-/* dst = buf1, src = buf2, tmp = buf3 */
+/* dst = buf1, src = buf2, tmp = tmp_buf (ntt_conv_tmp_len(k)
+   elements) */
 static int ntt_conv(BFNTTState *s, NTTLimb *buf1, NTTLimb *buf2,
-                    int k, int k_tot, limb_t m_idx)
+                    int k, int k_tot, limb_t m_idx, NTTLimb *tmp_buf)
 {
     limb_t n1, n2, i;
     int k1, k2;
 
-    if (k <= NTT_TRIG_K_MAX) {
-        k1 = k;
-    } else {
-        /* recursive split of the FFT */
-        k1 = bf_min(k / 2, NTT_TRIG_K_MAX);
-    }
+    k1 = ntt_conv_k1(k);
     k2 = k - k1;
     n1 = (limb_t)1 << k1;
     n2 = (limb_t)1 << k2;
 
-    if (ntt_fft_partial(s, buf1, k1, k2, n1, n2, 0, m_idx))
+    if (ntt_fft_partial(s, buf1, k1, k2, n1, n2, 0, m_idx, tmp_buf))
         return -1;
-    if (ntt_fft_partial(s, buf2, k1, k2, n1, n2, 0, m_idx))
+    if (ntt_fft_partial(s, buf2, k1, k2, n1, n2, 0, m_idx, tmp_buf))
         return -1;
     if (k2 == 0) {
         ntt_vec_mul(s, buf1, buf2, k, k_tot, m_idx);
     } else {
         for(i = 0; i < n1; i++) {
-            ntt_conv(s, buf1 + i * n2, buf2 + i * n2, k2, k_tot, m_idx);
+            if (ntt_conv(s, buf1 + i * n2, buf2 + i * n2, k2, k_tot, m_idx,
+                         tmp_buf))
+                return -1;
         }
     }
-    if (ntt_fft_partial(s, buf1, k1, k2, n1, n2, 1, m_idx))
+    if (ntt_fft_partial(s, buf1, k1, k2, n1, n2, 1, m_idx, tmp_buf))
         return -1;
     return 0;
 }
@@ -8363,15 +8410,270 @@ int bf_get_fft_size(int *pdpl, int *pnb_mods, limb_t len)
     return fft_len_log2_found;
 }
 
+/* maximum number of tasks of a multiplication */
+#define NTT_TASKS_MAX 16
+
+enum {
+    NTT_PHASE_FORWARD, /* forward FFTs of the columns of buf1 and buf2 */
+    NTT_PHASE_ROWS, /* convolutions of the rows */
+    NTT_PHASE_INVERSE, /* inverse FFTs of the columns of buf1 */
+};
+
+/* part of the convolution of one modulus. buf1 and buf2 are seen as
+   2^k1 x 2^k2 matrices (see ntt_conv()) and the task handles the
+   columns or the rows start to end - 1 */
+typedef struct NTTConvTask {
+    BFNTTState *s;
+    NTTLimb *buf1;
+    NTTLimb *buf2;
+    NTTLimb *tmp_buf; /* ntt_conv_split_tmp_len(k1, k2) elements */
+    int k1, k2, m_idx;
+    int phase; /* NTT_PHASE_x */
+    limb_t start, end;
+    int ret;
+    int state; /* NTT_TASK_x, protected by ntt_pool_mutex */
+    struct NTTConvTask *next; /* in the queue of the thread pool */
+} NTTConvTask;
+
+static void ntt_conv_task(NTTConvTask *t)
+{
+    limb_t n2, i;
+
+    n2 = (limb_t)1 << t->k2;
+    t->ret = 0;
+    switch(t->phase) {
+    case NTT_PHASE_FORWARD:
+        if (ntt_fft_strips(t->s, t->buf1, t->k1, t->k2, t->start, t->end,
+                           0, t->m_idx, t->tmp_buf) ||
+            ntt_fft_strips(t->s, t->buf2, t->k1, t->k2, t->start, t->end,
+                           0, t->m_idx, t->tmp_buf))
+            t->ret = -1;
+        break;
+    case NTT_PHASE_ROWS:
+        for(i = t->start; i < t->end; i++) {
+            if (ntt_conv(t->s, t->buf1 + i * n2, t->buf2 + i * n2, t->k2,
+                         t->k1 + t->k2, t->m_idx, t->tmp_buf)) {
+                t->ret = -1;
+                break;
+            }
+        }
+        break;
+    default:
+        if (ntt_fft_strips(t->s, t->buf1, t->k1, t->k2, t->start, t->end,
+                           1, t->m_idx, t->tmp_buf))
+            t->ret = -1;
+        break;
+    }
+}
+
+/* The tasks running in other threads must not modify the BFNTTState
+   nor call the memory allocator which is not assumed to be thread
+   safe, so the trigonometric tables are computed before starting
+   them. */
+static int ntt_trig_init(BFNTTState *s, int fft_len_log2, int nb_mods)
+{
+    int j, inverse, k, k_max;
+
+    k_max = bf_min(fft_len_log2, NTT_TRIG_K_MAX);
+    for(j = NB_MODS - nb_mods; j < NB_MODS; j++) {
+        for(inverse = 0; inverse < 2; inverse++) {
+            for(k = 1; k <= k_max; k++) {
+                if (!get_trig(s, k, inverse, j))
+                    return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+#ifdef USE_NTT_THREADS
+
+/* minimum FFT size for which the convolutions are done in parallel */
+#define NTT_THREADS_LEN_LOG2_MIN 16
+/* maximum number of threads of the process wide pool */
+#define NTT_POOL_THREADS_MAX (NTT_TASKS_MAX - 1)
+
+enum {
+    NTT_TASK_QUEUED,
+    NTT_TASK_RUNNING,
+    NTT_TASK_DONE,
+};
+
+/* The helper threads are created on demand and never exit, so that
+   a multiplication does not pay for the thread creation. They are
+   shared by all the bf contexts of the process. */
+static pthread_mutex_t ntt_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ntt_pool_cond = PTHREAD_COND_INITIALIZER; /* new task */
+static pthread_cond_t ntt_done_cond = PTHREAD_COND_INITIALIZER; /* task done */
+static NTTConvTask *ntt_pool_first, **ntt_pool_plast = &ntt_pool_first;
+static int ntt_pool_thread_count, ntt_pool_idle_count;
+
+static void *ntt_pool_thread(void *opaque)
+{
+    NTTConvTask *t;
+
+    pthread_mutex_lock(&ntt_pool_mutex);
+    for(;;) {
+        while (!ntt_pool_first) {
+            ntt_pool_idle_count++;
+            pthread_cond_wait(&ntt_pool_cond, &ntt_pool_mutex);
+            ntt_pool_idle_count--;
+        }
+        t = ntt_pool_first;
+        ntt_pool_first = t->next;
+        if (!ntt_pool_first)
+            ntt_pool_plast = &ntt_pool_first;
+        t->state = NTT_TASK_RUNNING;
+        pthread_mutex_unlock(&ntt_pool_mutex);
+        ntt_conv_task(t);
+        pthread_mutex_lock(&ntt_pool_mutex);
+        t->state = NTT_TASK_DONE;
+        pthread_cond_broadcast(&ntt_done_cond);
+    }
+    return NULL;
+}
+
+/* remove 't' from the queue. Must be called with ntt_pool_mutex
+   locked. */
+static void ntt_pool_unlink(NTTConvTask *t)
+{
+    NTTConvTask **pt;
+
+    for(pt = &ntt_pool_first; *pt != t; pt = &(*pt)->next)
+        continue;
+    *pt = t->next;
+    if (!*pt)
+        ntt_pool_plast = pt;
+}
+
+/* The first task is run in the current thread. The queued tasks
+   which are not taken by a pool thread are also run in the current
+   thread, so the result does not depend on the pool availability. */
+static int ntt_run_tasks(NTTConvTask *tasks, int nb_tasks)
+{
+    pthread_t tid;
+    pthread_attr_t attr;
+    int i, ret, n;
+
+    pthread_mutex_lock(&ntt_pool_mutex);
+    for(i = 1; i < nb_tasks; i++) {
+        tasks[i].state = NTT_TASK_QUEUED;
+        tasks[i].next = NULL;
+        *ntt_pool_plast = &tasks[i];
+        ntt_pool_plast = &tasks[i].next;
+    }
+    /* start the missing threads */
+    n = bf_min(nb_tasks - 1 - ntt_pool_idle_count,
+               NTT_POOL_THREADS_MAX - ntt_pool_thread_count);
+    if (n > 0) {
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        for(i = 0; i < n; i++) {
+            if (pthread_create(&tid, &attr, ntt_pool_thread, NULL) != 0)
+                break;
+            ntt_pool_thread_count++;
+        }
+        pthread_attr_destroy(&attr);
+    }
+    pthread_cond_broadcast(&ntt_pool_cond);
+    pthread_mutex_unlock(&ntt_pool_mutex);
+
+    ntt_conv_task(&tasks[0]);
+    ret = tasks[0].ret;
+
+    pthread_mutex_lock(&ntt_pool_mutex);
+    for(i = 1; i < nb_tasks; i++) {
+        NTTConvTask *t = &tasks[i];
+        if (t->state == NTT_TASK_QUEUED) {
+            ntt_pool_unlink(t);
+            t->state = NTT_TASK_RUNNING;
+            pthread_mutex_unlock(&ntt_pool_mutex);
+            ntt_conv_task(t);
+            pthread_mutex_lock(&ntt_pool_mutex);
+            t->state = NTT_TASK_DONE;
+        }
+    }
+    for(i = 1; i < nb_tasks; i++) {
+        while (tasks[i].state != NTT_TASK_DONE)
+            pthread_cond_wait(&ntt_done_cond, &ntt_pool_mutex);
+        ret |= tasks[i].ret;
+    }
+    pthread_mutex_unlock(&ntt_pool_mutex);
+    return ret;
+}
+
+#else
+
+static int ntt_run_tasks(NTTConvTask *tasks, int nb_tasks)
+{
+    int i, ret;
+
+    ret = 0;
+    for(i = 0; i < nb_tasks; i++) {
+        ntt_conv_task(&tasks[i]);
+        ret |= tasks[i].ret;
+    }
+    return ret;
+}
+
+#endif /* !USE_NTT_THREADS */
+
+/* return the log2 of the size of the first FFT pass of
+   ntt_conv_parallel() */
+static int ntt_conv_split_k1(int k)
+{
+    return bf_min(k / 2, NTT_TRIG_K_MAX);
+}
+
+/* same as ntt_conv(buf1, buf2, k, k, m_idx) with the work split
+   between 'nb_tasks' tasks. The FFT is always done in two passes so
+   that the tasks work on independent columns, then on independent
+   rows, then on independent columns again. The buffers of the tasks
+   are already allocated. */
+static int ntt_conv_parallel(NTTConvTask *tasks, int nb_tasks,
+                             NTTLimb *buf1, NTTLimb *buf2, int k, int m_idx)
+{
+    limb_t n, nb_strips;
+    int k1, k2, i, phase;
+
+    k1 = ntt_conv_split_k1(k);
+    k2 = k - k1;
+    nb_strips = ((limb_t)1 << k2) / STRIP_LEN;
+    for(phase = NTT_PHASE_FORWARD; phase <= NTT_PHASE_INVERSE; phase++) {
+        for(i = 0; i < nb_tasks; i++) {
+            NTTConvTask *t = &tasks[i];
+            t->buf1 = buf1;
+            t->buf2 = buf2;
+            t->k1 = k1;
+            t->k2 = k2;
+            t->m_idx = m_idx;
+            t->phase = phase;
+            if (phase == NTT_PHASE_ROWS) {
+                n = (limb_t)1 << k1;
+                t->start = n * i / nb_tasks;
+                t->end = n * (i + 1) / nb_tasks;
+            } else {
+                t->start = nb_strips * i / nb_tasks * STRIP_LEN;
+                t->end = nb_strips * (i + 1) / nb_tasks * STRIP_LEN;
+            }
+        }
+        if (ntt_run_tasks(tasks, nb_tasks))
+            return -1;
+    }
+    return 0;
+}
+
 /* return 0 if OK, -1 if memory error */
 static no_inline int fft_mul(bf_context_t *s1,
                              bf_t *res, limb_t *a_tab, limb_t a_len,
                              limb_t *b_tab, limb_t b_len, int mul_flags)
 {
     BFNTTState *s;
-    int dpl, fft_len_log2, j, nb_mods, reduced_mem;
+    int dpl, fft_len_log2, i, j, nb_mods, reduced_mem, nb_tasks, k1, m_idx;
     slimb_t len, fft_len;
+    limb_t tmp_len;
     NTTLimb *buf1, *buf2, *ptr;
+    NTTConvTask tasks[NTT_TASKS_MAX];
 #if defined(USE_MUL_CHECK)
     limb_t ha, hb, hr, h_ref;
 #endif
@@ -8402,6 +8704,13 @@ static no_inline int fft_mul(bf_context_t *s1,
         a_len = b_len;
         b_len = tmp_len;
     }
+    nb_tasks = 1;
+#ifdef USE_NTT_THREADS
+    if (fft_len_log2 >= NTT_THREADS_LEN_LOG2_MIN)
+        nb_tasks = bf_max(1, bf_min(s1->ntt_threads, NTT_TASKS_MAX));
+#endif
+    memset(tasks, 0, sizeof(tasks));
+    buf2 = NULL;
     buf1 = ntt_malloc(s, sizeof(NTTLimb) * fft_len * nb_mods);
     if (!buf1)
         return -1;
@@ -8426,6 +8735,20 @@ static no_inline int fft_mul(bf_context_t *s1,
         if (!buf2)
             goto fail;
     }
+    if (nb_tasks > 1) {
+        k1 = ntt_conv_split_k1(fft_len_log2);
+        tmp_len = ntt_conv_split_tmp_len(k1, fft_len_log2 - k1);
+    } else {
+        tmp_len = ntt_conv_tmp_len(fft_len_log2);
+    }
+    for(i = 0; i < nb_tasks; i++) {
+        tasks[i].s = s;
+        tasks[i].tmp_buf = ntt_malloc(s, sizeof(NTTLimb) * tmp_len);
+        if (!tasks[i].tmp_buf)
+            goto fail;
+    }
+    if (nb_tasks > 1 && ntt_trig_init(s, fft_len_log2, nb_mods))
+        goto fail;
     for(j = 0; j < nb_mods; j++) {
         if (reduced_mem) {
             limb_to_ntt(s, buf2, fft_len, b_tab, b_len, dpl,
@@ -8434,17 +8757,26 @@ static no_inline int fft_mul(bf_context_t *s1,
         } else {
             ptr = buf2 + fft_len * j;
         }
-        if (ntt_conv(s, buf1 + fft_len * j, ptr,
-                     fft_len_log2, fft_len_log2, j + NB_MODS - nb_mods))
-            goto fail;
+        m_idx = j + NB_MODS - nb_mods;
+        if (nb_tasks > 1) {
+            if (ntt_conv_parallel(tasks, nb_tasks, buf1 + fft_len * j, ptr,
+                                  fft_len_log2, m_idx))
+                goto fail;
+        } else {
+            if (ntt_conv(s, buf1 + fft_len * j, ptr, fft_len_log2,
+                         fft_len_log2, m_idx, tasks[0].tmp_buf))
+                goto fail;
+        }
     }
     if (!(mul_flags & FFT_MUL_R_NORESIZE))
         bf_resize(res, 0); /* in case res == b and reduced mem */
+    for(i = 0; i < nb_tasks; i++)
+        ntt_free(s, tasks[i].tmp_buf);
     ntt_free(s, buf2);
     buf2 = NULL;
     if (!(mul_flags & FFT_MUL_R_NORESIZE)) {
         if (bf_resize(res, len))
-            goto fail;
+            goto fail1;
     }
     ntt_to_limb(s, res->tab, len, buf1, fft_len_log2, dpl, nb_mods);
     ntt_free(s, buf1);
@@ -8460,8 +8792,11 @@ static no_inline int fft_mul(bf_context_t *s1,
 #endif
     return 0;
  fail:
-    ntt_free(s, buf1);
+    for(i = 0; i < nb_tasks; i++)
+        ntt_free(s, tasks[i].tmp_buf);
     ntt_free(s, buf2);
+ fail1:
+    ntt_free(s, buf1);
     return -1;
 }
 
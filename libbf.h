@@ -147,6 +147,10 @@ typedef struct bf_context_t {
     BFConstCache log2_cache;
     BFConstCache pi_cache;
     struct BFNTTState *ntt_state;
+    /* maximum number of threads used by the NTT multiplication of
+       large operands (<= 1 means single threaded, at most 16 are
+       used) */
+    int ntt_threads;
 } bf_context_t;
 
 static inline int bf_get_exp_bits(bf_flags_t flags)
@@ -102,8 +102,18 @@ static const REOpCode reopcode_info[REOP_COUNT] = {
 #define RE_HEADER_CAPTURE_COUNT 1
 #define RE_HEADER_STACK_SIZE    2
 #define RE_HEADER_BYTECODE_LEN  3
+#define RE_HEADER_PREFIX        7
 
-#define RE_HEADER_LEN 7
+#define RE_HEADER_LEN 8
+
+/* RE_HEADER_PREFIX values: a match must start with RE_HEADER_PREFIX
+   literal characters or with a character matched by a REOP_range */
+#define RE_PREFIX_NONE    0
+#define RE_PREFIX_MAX_LEN 64
+#define RE_PREFIX_RANGE   255
+
+/* length of the loop thru all the start positions (see lre_compile()) */
+#define RE_SEARCH_LOOP_LEN (5 + 1 + 5)
 
 static inline int is_digit(int c) {
     return c >= '0' && c <= '9';
@@ -203,8 +213,9 @@ static __maybe_unused void lre_dump_bytecode(const uint8_t *buf,
     re_flags = lre_get_flags(buf);
     bc_len = get_u32(buf + RE_HEADER_BYTECODE_LEN);
     assert(bc_len + RE_HEADER_LEN <= buf_len);
-    printf("flags: 0x%x capture_count=%d stack_size=%d\n",
-           re_flags, buf[RE_HEADER_CAPTURE_COUNT], buf[RE_HEADER_STACK_SIZE]);
+    printf("flags: 0x%x capture_count=%d stack_size=%d prefix=%d\n",
+           re_flags, buf[RE_HEADER_CAPTURE_COUNT], buf[RE_HEADER_STACK_SIZE],
+           buf[RE_HEADER_PREFIX]);
     if (re_flags & LRE_FLAG_NAMED_GROUPS) {
         const char *p;
         p = (char *)buf + RE_HEADER_LEN + bc_len;
@@ -1712,6 +1723,62 @@ static int compute_stack_size(const uint8_t *bc_buf, int bc_buf_len)
     return stack_size_max;
 }
 
+/* Return the RE_HEADER_PREFIX value: the number of literal characters
+   which must start a match, or RE_PREFIX_RANGE if the first character
+   is matched by a character class. It lets lre_exec() skip the
+   positions where no match can start. */
+static int compute_prefix(const uint8_t *bc_buf, int bc_buf_len)
+{
+    int re_flags, pos, opcode, n;
+    uint32_t c;
+
+    re_flags = bc_buf[RE_HEADER_FLAGS];
+    if (re_flags & (LRE_FLAG_STICKY | LRE_FLAG_IGNORECASE))
+        return RE_PREFIX_NONE;
+    n = 0;
+    pos = RE_HEADER_LEN + RE_SEARCH_LOOP_LEN;
+    while (pos < bc_buf_len) {
+        opcode = bc_buf[pos];
+        switch(opcode) {
+        case REOP_save_start:
+        case REOP_save_end:
+        case REOP_save_reset:
+            break;
+        case REOP_char:
+            c = get_u16(bc_buf + pos + 1);
+            /* in unicode mode, a surrogate only matches an isolated
+               surrogate */
+            if ((re_flags & LRE_FLAG_UNICODE) && is_surrogate(c))
+                return n;
+            if (n == RE_PREFIX_MAX_LEN)
+                return n;
+            n++;
+            break;
+        case REOP_range:
+            if (n == 0)
+                return RE_PREFIX_RANGE;
+            return n;
+        case REOP_simple_greedy_quant:
+            /* at least one iteration: use the first character */
+            if (n == 0 && get_u32(bc_buf + pos + 5) != 0) {
+                opcode = bc_buf[pos + 17];
+                if (opcode == REOP_range)
+                    return RE_PREFIX_RANGE;
+                if (opcode == REOP_char) {
+                    c = get_u16(bc_buf + pos + 17 + 1);
+                    if (!(re_flags & LRE_FLAG_UNICODE) || !is_surrogate(c))
+                        return 1;
+                }
+            }
+            return n;
+        default:
+            return n;
+        }
+        pos += reopcode_info[opcode].size;
+    }
+    return n;
+}
+
 /* 'buf' must be a zero terminated UTF-8 string of length buf_len.
    Return NULL if error and allocate an error message in *perror_msg,
    otherwise the compiled bytecode and its length in plen.
@@ -1745,6 +1812,7 @@ uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
     dbuf_putc(&s->byte_code, 0); /* second element is the number of captures */
     dbuf_putc(&s->byte_code, 0); /* stack size */
     dbuf_put_u32(&s->byte_code, 0); /* bytecode length */
+    dbuf_putc(&s->byte_code, RE_PREFIX_NONE); /* prefix */
 
     if (!is_sticky) {
         /* iterate thru all positions (about the same as .*?( ... ) )
@@ -1790,6 +1858,8 @@ uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
     s->byte_code.buf[RE_HEADER_STACK_SIZE] = stack_size;
     put_u32(s->byte_code.buf + RE_HEADER_BYTECODE_LEN,
             s->byte_code.size - RE_HEADER_LEN);
+    s->byte_code.buf[RE_HEADER_PREFIX] =
+        compute_prefix(s->byte_code.buf, s->byte_code.size);
 
     /* add the named groups if needed */
     if (s->group_names.size > (s->capture_count - 1)) {
@@ -2386,13 +2456,121 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
 /* Return 1 if match, 0 if not match or -1 if error. cindex is the
    starting position of the match and must be such as 0 <= cindex <=
    clen. */
+typedef struct {
+    int len; /* number of literal characters, 0 for a character class */
+    uint16_t chars[RE_PREFIX_MAX_LEN];
+    BOOL has_high; /* character class: characters >= 256 may match */
+    uint32_t bitmap[256 / 32]; /* character class: characters < 256 */
+} REPrefix;
+
+/* return FALSE if no match is possible */
+static BOOL re_prefix_init(REPrefix *pf, const uint8_t *bc_buf, int cbuf_type)
+{
+    const uint8_t *pc;
+    uint32_t low, high, c;
+    int n, i;
+
+    pc = bc_buf + RE_HEADER_LEN + RE_SEARCH_LOOP_LEN;
+    if (bc_buf[RE_HEADER_PREFIX] == RE_PREFIX_RANGE) {
+        pf->len = 0;
+        pf->has_high = FALSE;
+        memset(pf->bitmap, 0, sizeof(pf->bitmap));
+        /* skip the save opcodes and the REOP_simple_greedy_quant header */
+        while (*pc != REOP_range)
+            pc += reopcode_info[*pc].size;
+        n = get_u16(pc + 1);
+        pc += 3;
+        for(i = 0; i < n; i++) {
+            low = get_u16(pc + i * 4);
+            high = get_u16(pc + i * 4 + 2);
+            if (high >= 256)
+                pf->has_high = TRUE;
+            for(c = low; c <= high && c < 256; c++)
+                pf->bitmap[c >> 5] |= 1U << (c & 31);
+        }
+        return TRUE;
+    } else {
+        n = bc_buf[RE_HEADER_PREFIX];
+        pf->len = 0;
+        while (pf->len < n) {
+            if (*pc == REOP_char) {
+                c = get_u16(pc + 1);
+            } else if (*pc == REOP_simple_greedy_quant) {
+                /* first character of the quantified atom (n = 1) */
+                c = get_u16(pc + 17 + 1);
+            } else {
+                pc += reopcode_info[*pc].size;
+                continue;
+            }
+            if (cbuf_type == 0 && c >= 256)
+                return FALSE;
+            pf->chars[pf->len++] = c;
+            pc += reopcode_info[*pc].size;
+        }
+        return TRUE;
+    }
+}
+
+/* return the first position >= pos where a match may start or -1 */
+static int re_prefix_find(const REPrefix *pf, const uint8_t *cbuf,
+                          int cbuf_type, int pos, int clen)
+{
+    const uint16_t *cbuf16 = (const uint16_t *)cbuf;
+    const uint8_t *p;
+    uint32_t c;
+    int i;
+
+    if (pf->len == 0) {
+        for(; pos < clen; pos++) {
+            if (cbuf_type == 0)
+                c = cbuf[pos];
+            else
+                c = cbuf16[pos];
+            if (c < 256) {
+                if (pf->bitmap[c >> 5] & (1U << (c & 31)))
+                    return pos;
+            } else if (pf->has_high) {
+                return pos;
+            }
+        }
+    } else if (cbuf_type == 0) {
+        while (pos <= clen - pf->len) {
+            /* memchr() is usually vectorized */
+            p = memchr(cbuf + pos, pf->chars[0], clen - pf->len + 1 - pos);
+            if (!p)
+                break;
+            pos = p - cbuf;
+            for(i = 1; i < pf->len; i++) {
+                if (cbuf[pos + i] != pf->chars[i])
+                    break;
+            }
+            if (i == pf->len)
+                return pos;
+            pos++;
+        }
+    } else {
+        for(; pos <= clen - pf->len; pos++) {
+            if (cbuf16[pos] == pf->chars[0]) {
+                for(i = 1; i < pf->len; i++) {
+                    if (cbuf16[pos + i] != pf->chars[i])
+                        break;
+                }
+                if (i == pf->len)
+                    return pos;
+            }
+        }
+    }
+    return -1;
+}
+
 int lre_exec(uint8_t **capture,
              const uint8_t *bc_buf, const uint8_t *cbuf, int cindex, int clen,
              int cbuf_type, void *opaque)
 {
     REExecContext s_s, *s = &s_s;
-    int re_flags, i, alloca_size, ret;
+    int re_flags, i, alloca_size, ret, start_index;
     StackInt *stack_buf;
+    REPrefix pf;
 
     re_flags = lre_get_flags(bc_buf);
     s->multi_line = (re_flags & LRE_FLAG_MULTILINE) != 0;
@@ -2418,8 +2596,38 @@ int lre_exec(uint8_t **capture,
         capture[i] = NULL;
     alloca_size = s->stack_size_max * sizeof(stack_buf[0]);
     stack_buf = alloca(alloca_size);
-    ret = lre_exec_backtrack(s, capture, stack_buf, 0, bc_buf + RE_HEADER_LEN,
-                             cbuf + (cindex << cbuf_type), FALSE);
+    if (bc_buf[RE_HEADER_PREFIX] == RE_PREFIX_NONE) {
+        ret = lre_exec_backtrack(s, capture, stack_buf, 0, bc_buf + RE_HEADER_LEN,
+                                 cbuf + (cindex << cbuf_type), FALSE);
+    } else {
+        /* skip the search loop and only try the positions where the
+           prefix matches */
+        ret = 0;
+        start_index = cindex;
+        if (re_prefix_init(&pf, bc_buf, cbuf_type)) {
+            for(;;) {
+                cindex = re_prefix_find(&pf, cbuf, cbuf_type, cindex, clen);
+                if (cindex < 0)
+                    break;
+                /* in unicode mode, the search loop does not start a
+                   match in the middle of a surrogate pair */
+                if (s->cbuf_type == 2 && cindex > start_index &&
+                    is_lo_surrogate(((const uint16_t *)cbuf)[cindex]) &&
+                    is_hi_surrogate(((const uint16_t *)cbuf)[cindex - 1])) {
+                    cindex++;
+                    continue;
+                }
+                ret = lre_exec_backtrack(s, capture, stack_buf, 0,
+                                         bc_buf + RE_HEADER_LEN + RE_SEARCH_LOOP_LEN,
+                                         cbuf + (cindex << cbuf_type), FALSE);
+                if (ret != 0)
+                    break;
+                for(i = 0; i < s->capture_count * 2; i++)
+                    capture[i] = NULL;
+                cindex++;
+            }
+        }
+    }
     lre_realloc(s->opaque, s->state_stack, 0);
     return ret;
 }
@@ -82,6 +82,23 @@ static inline int list_empty(struct list_head *el)
     return el->next == el;
 }
 
+/* move all the elements of 'src' at the end of the list 'head'. 'src'
+   becomes empty. */
+static inline void list_splice_tail(struct list_head *src,
+                                    struct list_head *head)
+{
+    struct list_head *first, *last;
+    if (list_empty(src))
+        return;
+    first = src->next;
+    last = src->prev;
+    first->prev = head->prev;
+    head->prev->next = first;
+    last->next = head;
+    head->prev = last;
+    init_list_head(src);
+}
+
 #define list_for_each(el, head) \
   for(el = (head)->next; el != (head); el = el->next)
 
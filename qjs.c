@@ -272,6 +272,42 @@ static const JSMallocFunctions trace_mf = {
 
 #define PROG_NAME "qjs"
 
+/* CPU profiler sampling interval */
+#define CPU_PROFILE_INTERVAL_US 1000
+/* heap profiler: one allocation site is recorded every
+   HEAP_PROFILE_SAMPLE_INTERVAL objects */
+#define HEAP_PROFILE_SAMPLE_INTERVAL 64
+
+static void write_cpu_profile(JSRuntime *rt, const char *filename)
+{
+    FILE *f;
+    f = fopen(filename, "w");
+    if (!f) {
+        perror(filename);
+        return;
+    }
+    if (JS_WriteProfile(rt, f) < 0)
+        fprintf(stderr, "qjs: could not write the CPU profile to '%s'\n",
+                filename);
+    fclose(f);
+}
+
+static void write_heap_profile(JSRuntime *rt, const char *filename)
+{
+    FILE *f;
+    /* only report the reachable objects */
+    JS_RunGC(rt);
+    f = fopen(filename, "w");
+    if (!f) {
+        perror(filename);
+        return;
+    }
+    if (JS_WriteHeapProfile(rt, f) < 0)
+        fprintf(stderr, "qjs: could not write the heap profile to '%s'\n",
+                filename);
+    fclose(f);
+}
+
 void help(void)
 {
     printf("QuickJS version " CONFIG_VERSION "\n"
@@ -283,12 +319,16 @@ void help(void)
            "    --script       load as ES6 script (default=autodetect)\n"
            "-I  --include file include an additional file\n"
            "    --std          make 'std' and 'os' available to the loaded script\n"
+           "    --lazy         compile the inner functions on their first call\n"
 #ifdef CONFIG_BIGNUM
            "    --bignum       enable the bignum extensions (BigFloat, BigDecimal)\n"
            "    --qjscalc      load the QJSCalc runtime (default if invoked as qjscalc)\n"
 #endif
            "-T  --trace        trace memory allocation\n"
+           "    --slab         use the slab memory allocator\n"
            "-d  --dump         dump the memory usage stats\n"
+           "    --cpu-profile file     write a sampled CPU profile in collapsed stack format\n"
+           "    --heap-profile file    write the live objects by class and allocation site\n"
            "    --memory-limit n       limit the memory usage to 'n' bytes\n"
            "    --stack-size n         limit the stack size to 'n' bytes\n"
            "    --unhandled-rejection  dump unhandled promise rejections\n"
@@ -306,9 +346,13 @@ int main(int argc, char **argv)
     int interactive = 0;
     int dump_memory = 0;
     int trace_memory = 0;
+    int slab_memory = 0;
     int empty_run = 0;
     int module = -1;
     int load_std = 0;
+    int lazy_functions = 0;
+    const char *cpu_profile = NULL;
+    const char *heap_profile = NULL;
     int dump_unhandled_promise_rejection = 0;
     size_t memory_limit = 0;
     char *include_list[32];
@@ -399,10 +443,18 @@ int main(int argc, char **argv)
                 trace_memory++;
                 continue;
             }
+            if (!strcmp(longopt, "slab")) {
+                slab_memory = 1;
+                continue;
+            }
             if (!strcmp(longopt, "std")) {
                 load_std = 1;
                 continue;
             }
+            if (!strcmp(longopt, "lazy")) {
+                lazy_functions = 1;
+                continue;
+            }
             if (!strcmp(longopt, "unhandled-rejection")) {
                 dump_unhandled_promise_rejection = 1;
                 continue;
@@ -429,6 +481,22 @@ int main(int argc, char **argv)
                 memory_limit = (size_t)strtod(argv[optind++], NULL);
                 continue;
             }
+            if (!strcmp(longopt, "cpu-profile")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                cpu_profile = argv[optind++];
+                continue;
+            }
+            if (!strcmp(longopt, "heap-profile")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting filename");
+                    exit(1);
+                }
+                heap_profile = argv[optind++];
+                continue;
+            }
             if (!strcmp(longopt, "stack-size")) {
                 if (optind >= argc) {
                     fprintf(stderr, "expecting stack size");
@@ -454,6 +522,8 @@ int main(int argc, char **argv)
     if (trace_memory) {
         js_trace_malloc_init(&trace_data);
         rt = JS_NewRuntime2(&trace_mf, &trace_data);
+    } else if (slab_memory) {
+        rt = JS_NewSlabRuntime();
     } else {
         rt = JS_NewRuntime();
     }
@@ -465,6 +535,17 @@ int main(int argc, char **argv)
         JS_SetMemoryLimit(rt, memory_limit);
     if (stack_size != 0)
         JS_SetMaxStackSize(rt, stack_size);
+    if (lazy_functions)
+        JS_SetLazyFunctions(rt, TRUE);
+    if (cpu_profile && JS_StartProfiler(rt, CPU_PROFILE_INTERVAL_US)) {
+        fprintf(stderr, "qjs: cannot start the CPU profiler\n");
+        exit(2);
+    }
+    if (heap_profile &&
+        JS_StartHeapProfiler(rt, HEAP_PROFILE_SAMPLE_INTERVAL)) {
+        fprintf(stderr, "qjs: cannot start the heap profiler\n");
+        exit(2);
+    }
     js_std_set_worker_new_context_func(JS_NewCustomContext);
     js_std_init_handlers(rt);
     ctx = JS_NewCustomContext(rt);
@@ -527,6 +608,11 @@ int main(int argc, char **argv)
         JS_ComputeMemoryUsage(rt, &stats);
         JS_DumpMemoryUsage(stdout, &stats, rt);
     }
+    if (cpu_profile)
+        write_cpu_profile(rt, cpu_profile);
+    if (heap_profile)
+        write_heap_profile(rt, heap_profile);
+    JS_DumpOpcodeStats(rt, stderr);
     js_std_free_handlers(rt);
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
@@ -537,7 +623,10 @@ int main(int argc, char **argv)
         int i, j;
         for (i = 0; i < 100; i++) {
             t[0] = clock();
-            rt = JS_NewRuntime();
+            if (slab_memory)
+                rt = JS_NewSlabRuntime();
+            else
+                rt = JS_NewRuntime();
             t[1] = clock();
             ctx = JS_NewContext(rt);
             t[2] = clock();
@@ -557,6 +646,10 @@ int main(int argc, char **argv)
     }
     return 0;
  fail:
+    if (cpu_profile)
+        write_cpu_profile(rt, cpu_profile);
+    if (heap_profile)
+        write_heap_profile(rt, heap_profile);
     js_std_free_handlers(rt);
     JS_FreeContext(ctx);
     JS_FreeRuntime(rt);
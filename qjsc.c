@@ -51,6 +51,7 @@ typedef struct namelist_t {
 typedef struct {
     const char *option_name;
     const char *init_name;
+    void (*init_func)(JSContext *ctx);
 } FeatureEntry;
 
 static namelist_t cname_list;
@@ -59,24 +60,25 @@ static namelist_t init_module_list;
 static uint64_t feature_bitmap;
 static FILE *outfile;
 static BOOL byte_swap;
+static BOOL aot_output;
 static BOOL dynamic_export;
 static const char *c_ident_prefix = "qjsc_";
 
 #define FE_ALL (-1)
 
 static const FeatureEntry feature_list[] = {
-    { "date", "Date" },
-    { "eval", "Eval" },
-    { "string-normalize", "StringNormalize" },
-    { "regexp", "RegExp" },
-    { "json", "JSON" },
-    { "proxy", "Proxy" },
-    { "map", "MapSet" },
-    { "typedarray", "TypedArrays" },
-    { "promise", "Promise" },
+    { "date", "Date", JS_AddIntrinsicDate },
+    { "eval", "Eval", JS_AddIntrinsicEval },
+    { "string-normalize", "StringNormalize", JS_AddIntrinsicStringNormalize },
+    { "regexp", "RegExp", JS_AddIntrinsicRegExp },
+    { "json", "JSON", JS_AddIntrinsicJSON },
+    { "proxy", "Proxy", JS_AddIntrinsicProxy },
+    { "map", "MapSet", JS_AddIntrinsicMapSet },
+    { "typedarray", "TypedArrays", JS_AddIntrinsicTypedArrays },
+    { "promise", "Promise", JS_AddIntrinsicPromise },
 #define FE_MODULE_LOADER 9
-    { "module-loader", NULL },
-    { "bigint", "BigInt" },
+    { "module-loader", NULL, NULL },
+    { "bigint", "BigInt", JS_AddIntrinsicBigInt },
 };
 
 void namelist_add(namelist_t *lp, const char *name, const char *short_name,
@@ -196,6 +198,30 @@ static void output_object_code(JSContext *ctx,
     fprintf(fo, "};\n\n");
 
     js_free(ctx, out_buf);
+
+    if (aot_output) {
+        char *aot_buf;
+        size_t aot_buf_len;
+        aot_buf = JS_WriteAOTFunctions(ctx, &aot_buf_len, obj, c_name);
+        if (!aot_buf) {
+            js_std_dump_error(ctx);
+            exit(1);
+        }
+        fwrite(aot_buf, 1, aot_buf_len, fo);
+        fprintf(fo, "\n");
+        js_free(ctx, aot_buf);
+    }
+}
+
+static void output_eval_binary(FILE *fo, const char *c_name, int load_only)
+{
+    if (aot_output) {
+        fprintf(fo, "  js_std_eval_binary2(ctx, %s, %s_size, %d, %s_aot, %s_aot_count);\n",
+                c_name, c_name, load_only, c_name, c_name);
+    } else {
+        fprintf(fo, "  js_std_eval_binary(ctx, %s, %s_size, %d);\n",
+                c_name, c_name, load_only);
+    }
 }
 
 static int js_module_dummy_init(JSContext *ctx, JSModuleDef *m)
@@ -318,6 +344,86 @@ static void compile_file(JSContext *ctx, FILE *fo,
     JS_FreeValue(ctx, obj);
 }
 
+/* The init scripts are evaluated in a context initialized as the
+   one of the generated main(). The changes they do to the context are
+   saved in a snapshot which is loaded at startup. */
+static void output_snapshot(FILE *fo, namelist_t *init_script_list,
+                            BOOL bignum_ext)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    uint8_t *buf, *out_buf;
+    size_t buf_len, out_buf_len;
+    char c_name[1024];
+    JSValue val;
+    int i;
+
+    rt = JS_NewRuntime();
+    js_std_init_handlers(rt);
+    ctx = JS_NewContextRaw(rt);
+    JS_AddIntrinsicBaseObjects(ctx);
+    for(i = 0; i < countof(feature_list); i++) {
+        if ((feature_bitmap & ((uint64_t)1 << i)) &&
+            feature_list[i].init_func) {
+            feature_list[i].init_func(ctx);
+        }
+    }
+#ifdef CONFIG_BIGNUM
+    if (bignum_ext) {
+        JS_AddIntrinsicBigFloat(ctx);
+        JS_AddIntrinsicBigDecimal(ctx);
+        JS_AddIntrinsicOperators(ctx);
+        JS_EnableBignumExt(ctx, TRUE);
+    }
+#endif
+    js_std_add_helpers(ctx, 0, NULL);
+    if (JS_SetSnapshotBase(ctx) < 0)
+        goto exception;
+
+    for(i = 0; i < init_script_list->count; i++) {
+        const char *filename = init_script_list->array[i].name;
+        buf = js_load_file(ctx, &buf_len, filename);
+        if (!buf) {
+            fprintf(stderr, "Could not load '%s'\n", filename);
+            exit(1);
+        }
+        if (JS_DetectModule((const char *)buf, buf_len)) {
+            fprintf(stderr, "%s: modules are not supported in init scripts\n",
+                    filename);
+            exit(1);
+        }
+        val = JS_Eval(ctx, (const char *)buf, buf_len, filename,
+                      JS_EVAL_TYPE_GLOBAL);
+        js_free(ctx, buf);
+        if (JS_IsException(val))
+            goto exception;
+        JS_FreeValue(ctx, val);
+    }
+    /* run the pending jobs and timers */
+    js_std_loop(ctx);
+
+    out_buf = JS_WriteSnapshot(ctx, &out_buf_len);
+    if (!out_buf)
+        goto exception;
+
+    snprintf(c_name, sizeof(c_name), "%ssnapshot", c_ident_prefix);
+    fprintf(fo, "const uint32_t %s_size = %u;\n\n",
+            c_name, (unsigned int)out_buf_len);
+    fprintf(fo, "const uint8_t %s[%u] = {\n",
+            c_name, (unsigned int)out_buf_len);
+    dump_hex(fo, out_buf, out_buf_len);
+    fprintf(fo, "};\n\n");
+    js_free(ctx, out_buf);
+
+    js_std_free_handlers(rt);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+    return;
+ exception:
+    js_std_dump_error(ctx);
+    exit(1);
+}
+
 static const char main_c_template1[] =
     "int main(int argc, char **argv)\n"
     "{\n"
@@ -353,7 +459,10 @@ void help(void)
            "-M module_name[,cname] add initialization code for an external C module\n"
            "-x          byte swapped output\n"
            "-p prefix   set the prefix of the generated C names\n"
-           "-S n        set the maximum stack size to 'n' bytes (default=%d)\n",
+           "-S n        set the maximum stack size to 'n' bytes (default=%d)\n"
+           "-a          translate the numeric functions to C (ahead of time compilation)\n"
+           "-s file     evaluate the script 'file' at compile time and save the\n"
+           "            resulting state of the context in a snapshot\n",
            JS_DEFAULT_STACK_SIZE);
 #ifdef CONFIG_LTO
     {
@@ -496,6 +605,7 @@ int main(int argc, char **argv)
     BOOL bignum_ext = FALSE;
 #endif
     namelist_t dynamic_module_list;
+    namelist_t init_script_list;
 
     out_filename = NULL;
     output_type = OUTPUT_EXECUTABLE;
@@ -507,13 +617,14 @@ int main(int argc, char **argv)
     use_lto = FALSE;
     stack_size = 0;
     memset(&dynamic_module_list, 0, sizeof(dynamic_module_list));
+    memset(&init_script_list, 0, sizeof(init_script_list));
 
     /* add system modules */
     namelist_add(&cmodule_list, "std", "std", 0);
     namelist_add(&cmodule_list, "os", "os", 0);
 
     for(;;) {
-        c = getopt(argc, argv, "ho:cN:f:mxevM:p:S:D:");
+        c = getopt(argc, argv, "ho:cN:f:mxevM:p:S:D:s:a");
         if (c == -1)
             break;
         switch(c) {
@@ -594,6 +705,12 @@ int main(int argc, char **argv)
         case 'S':
             stack_size = (size_t)strtod(optarg, NULL);
             break;
+        case 's':
+            namelist_add(&init_script_list, optarg, NULL, 0);
+            break;
+        case 'a':
+            aot_output = TRUE;
+            break;
         default:
             break;
         }
@@ -650,11 +767,20 @@ int main(int argc, char **argv)
         fprintf(fo, "#include \"quickjs-libc.h\"\n"
                 "\n"
                 );
+    } else if (aot_output) {
+        fprintf(fo, "#include <inttypes.h>\n"
+                "#include \"quickjs.h\"\n"
+                "\n"
+                );
     } else {
         fprintf(fo, "#include <inttypes.h>\n"
                 "\n"
                 );
     }
+    if (aot_output) {
+        fprintf(fo, "#include <math.h>\n"
+                "\n");
+    }
 
     for(i = optind; i < argc; i++) {
         const char *filename = argv[i];
@@ -662,6 +788,14 @@ int main(int argc, char **argv)
         cname = NULL;
     }
 
+    if (init_script_list.count != 0) {
+#ifdef CONFIG_BIGNUM
+        output_snapshot(fo, &init_script_list, bignum_ext);
+#else
+        output_snapshot(fo, &init_script_list, FALSE);
+#endif
+    }
+
     for(i = 0; i < dynamic_module_list.count; i++) {
         if (!jsc_module_loader(ctx, dynamic_module_list.array[i].name, NULL)) {
             fprintf(stderr, "Could not load dynamic module '%s'\n",
@@ -710,10 +844,8 @@ int main(int argc, char **argv)
         }
         for(i = 0; i < cname_list.count; i++) {
             namelist_entry_t *e = &cname_list.array[i];
-            if (e->flags) {
-                fprintf(fo, "  js_std_eval_binary(ctx, %s, %s_size, 1);\n",
-                        e->name, e->name);
-            }
+            if (e->flags)
+                output_eval_binary(fo, e->name, 1);
         }
         fprintf(fo,
                 "  return ctx;\n"
@@ -735,12 +867,15 @@ int main(int argc, char **argv)
                 "  ctx = JS_NewCustomContext(rt);\n"
                 "  js_std_add_helpers(ctx, argc, argv);\n");
 
+        if (init_script_list.count != 0) {
+            fprintf(fo, "  js_std_read_snapshot(ctx, %ssnapshot, %ssnapshot_size);\n",
+                    c_ident_prefix, c_ident_prefix);
+        }
+
         for(i = 0; i < cname_list.count; i++) {
             namelist_entry_t *e = &cname_list.array[i];
-            if (!e->flags) {
-                fprintf(fo, "  js_std_eval_binary(ctx, %s, %s_size, 0);\n",
-                        e->name, e->name);
-            }
+            if (!e->flags)
+                output_eval_binary(fo, e->name, 0);
         }
         fputs(main_c_template2, fo);
     }
@@ -757,5 +892,6 @@ int main(int argc, char **argv)
     namelist_free(&cname_list);
     namelist_free(&cmodule_list);
     namelist_free(&init_module_list);
+    namelist_free(&init_script_list);
     return 0;
 }
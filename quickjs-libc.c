@@ -46,6 +46,15 @@
 #include <termios.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#define USE_EPOLL
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+#include <sys/event.h>
+#define USE_KQUEUE
+#endif
 
 #if defined(__FreeBSD__)
 extern char **environ;
@@ -69,6 +78,12 @@ typedef sig_t sighandler_t;
 #define USE_WORKER
 #endif
 
+#if defined(USE_EPOLL) || defined(USE_KQUEUE)
+/* the read/write handlers are registered in a kernel event queue
+   instead of being passed to select() at each iteration */
+#define USE_POLL_FD
+#endif
+
 #ifdef USE_WORKER
 #include <pthread.h>
 #include <stdatomic.h>
@@ -86,6 +101,9 @@ typedef struct {
     struct list_head link;
     int fd;
     JSValue rw_func[2];
+    /* readAsync() and writeAsync() requests waiting for the file
+       descriptor to be ready (list of JSOSAsyncRequest.link) */
+    struct list_head async_requests[2];
 } JSOSRWHandler;
 
 typedef struct {
@@ -94,10 +112,12 @@ typedef struct {
     JSValue func;
 } JSOSSignalHandler;
 
-typedef struct {
-    struct list_head link;
-    int timer_id;
+typedef struct JSOSTimer {
+    int heap_index; /* index in JSThreadState.timers */
+    int timer_id; /* > 0 if the timer is in JSThreadState.timer_hash */
+    struct JSOSTimer *hash_next; /* timer with the same timer_id hash */
     int64_t timeout;
+    uint64_t seq; /* timers with the same timeout are run in creation order */
     JSValue func;
 } JSOSTimer;
 
@@ -108,6 +128,9 @@ typedef struct {
     /* list of SharedArrayBuffers, necessary to free the message */
     uint8_t **sab_tab;
     size_t sab_tab_len;
+    /* data of the transferred ArrayBuffers (allocated with malloc) */
+    uint8_t **transfer_tab;
+    int transfer_len;
 } JSWorkerMessage;
 
 typedef struct {
@@ -126,15 +149,49 @@ typedef struct {
     JSValue on_message_func;
 } JSWorkerMessageHandler;
 
+/* completion queue of the asynchronous file I/O requests of a
+   thread. It is referenced by the thread and by each request being
+   executed. */
+typedef struct {
+    int ref_count;
+#ifdef USE_WORKER
+    pthread_mutex_t mutex;
+#endif
+    BOOL closed; /* the thread state was freed */
+    struct list_head done_list; /* list of JSOSAsyncRequest.link */
+    int read_fd;
+    int write_fd;
+} JSOSAsyncQueue;
+
 typedef struct JSThreadState {
     struct list_head os_rw_handlers; /* list of JSOSRWHandler.link */
     struct list_head os_signal_handlers; /* list JSOSSignalHandler.link */
-    struct list_head os_timers; /* list of JSOSTimer.link */
+    /* read/write handlers indexed by file descriptor */
+    JSOSRWHandler **rw_handler_tab;
+    int rw_handler_tab_size;
+    /* binary min-heap of the timers ordered by (timeout, seq) */
+    JSOSTimer **timers;
+    int timer_count;
+    int timer_size;
+    uint64_t next_timer_seq;
+    /* hash table of the timers by timer_id, for clearTimeout() */
+    JSOSTimer **timer_hash;
+    int timer_hash_size; /* power of two */
+    int timer_hash_count;
     struct list_head port_list; /* list of JSWorkerMessageHandler.link */
     int eval_script_recurse; /* only used in the main thread */
     int next_timer_id; /* for setTimeout() */
+#ifdef USE_POLL_FD
+    int poll_fd; /* epoll or kqueue descriptor, -1 to use select() */
+#endif
+    /* asynchronous file I/O */
+    JSOSAsyncQueue *async_queue; /* NULL if no request was made */
+    struct list_head async_requests; /* list of JSOSAsyncRequest.pending_link */
     /* not used in the main thread */
     JSWorkerMessagePipe *recv_pipe, *send_pipe;
+    /* only used in the worker pool threads */
+    struct JSWorkerPoolThread *pool_thread;
+    JSValue task_func; /* set by os.setTaskHandler() */
 } JSThreadState;
 
 static uint64_t os_pending_signals;
@@ -730,6 +787,28 @@ static JSValue js_std_gc(JSContext *ctx, JSValueConst this_val,
     return JS_UNDEFINED;
 }
 
+static JSValue js_std_writeHeapProfile(JSContext *ctx, JSValueConst this_val,
+                                       int argc, JSValueConst *argv)
+{
+    const char *filename;
+    FILE *f;
+    int ret;
+
+    filename = JS_ToCString(ctx, argv[0]);
+    if (!filename)
+        return JS_EXCEPTION;
+    f = fopen(filename, "w");
+    JS_FreeCString(ctx, filename);
+    if (!f)
+        return JS_NewInt32(ctx, -errno);
+    ret = 0;
+    if (JS_WriteHeapProfile(JS_GetRuntime(ctx), f) < 0)
+        ret = ferror(f) ? -errno : -ENOMEM;
+    if (fclose(f) && ret == 0)
+        ret = -errno;
+    return JS_NewInt32(ctx, ret);
+}
+
 static int interrupt_handler(JSRuntime *rt, void *opaque)
 {
     return (os_pending_signals >> SIGINT) & 1;
@@ -916,6 +995,90 @@ static JSValue js_std_open(JSContext *ctx, JSValueConst this_val,
     return JS_EXCEPTION;
 }
 
+#if !defined(_WIN32)
+static void js_std_unmap_file(JSRuntime *rt, void *opaque, void *ptr)
+{
+    munmap(ptr, (size_t)(uintptr_t)opaque);
+}
+
+/* map a file in memory and return it as an ArrayBuffer. With the "r"
+   mode, the modifications of the ArrayBuffer are private
+   (copy-on-write). With the "r+" mode, they are written to the
+   file. */
+static JSValue js_std_mapFile(JSContext *ctx, JSValueConst this_val,
+                              int argc, JSValueConst *argv)
+{
+    const char *filename, *mode = NULL;
+    struct stat st;
+    BOOL shared;
+    int fd, err;
+    size_t len;
+    void *ptr;
+    JSValue ret;
+
+    filename = JS_ToCString(ctx, argv[0]);
+    if (!filename)
+        goto fail;
+    shared = FALSE;
+    if (argc >= 2 && !JS_IsUndefined(argv[1])) {
+        mode = JS_ToCString(ctx, argv[1]);
+        if (!mode)
+            goto fail;
+        if (!strcmp(mode, "r+")) {
+            shared = TRUE;
+        } else if (strcmp(mode, "r") != 0) {
+            JS_ThrowTypeError(ctx, "invalid file mode");
+            goto fail;
+        }
+    }
+
+    err = 0;
+    len = 0;
+    ptr = NULL;
+    fd = open(filename, shared ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+        err = errno;
+    } else {
+        if (fstat(fd, &st) < 0) {
+            err = errno;
+        } else if (!S_ISREG(st.st_mode)) {
+            err = EINVAL;
+        } else if (st.st_size > INT32_MAX) {
+            /* maximum ArrayBuffer length */
+            err = EFBIG;
+        } else {
+            len = st.st_size;
+            if (len != 0) {
+                ptr = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                           shared ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+                if (ptr == MAP_FAILED) {
+                    err = errno;
+                    ptr = NULL;
+                }
+            }
+        }
+        close(fd);
+    }
+    if (argc >= 3)
+        js_set_error_object(ctx, argv[2], err);
+    JS_FreeCString(ctx, filename);
+    JS_FreeCString(ctx, mode);
+    if (err)
+        return JS_NULL;
+    if (len == 0)
+        return JS_NewArrayBufferCopy(ctx, NULL, 0);
+    ret = JS_NewArrayBuffer(ctx, ptr, len, js_std_unmap_file,
+                            (void *)(uintptr_t)len, FALSE);
+    if (JS_IsException(ret))
+        munmap(ptr, len);
+    return ret;
+ fail:
+    JS_FreeCString(ctx, filename);
+    JS_FreeCString(ctx, mode);
+    return JS_EXCEPTION;
+}
+#endif /* !_WIN32 */
+
 static JSValue js_std_popen(JSContext *ctx, JSValueConst this_val,
                             int argc, JSValueConst *argv)
 {
@@ -1507,6 +1670,7 @@ static const JSCFunctionListEntry js_std_error_props[] = {
 static const JSCFunctionListEntry js_std_funcs[] = {
     JS_CFUNC_DEF("exit", 1, js_std_exit ),
     JS_CFUNC_DEF("gc", 0, js_std_gc ),
+    JS_CFUNC_DEF("writeHeapProfile", 1, js_std_writeHeapProfile ),
     JS_CFUNC_DEF("evalScript", 1, js_evalScript ),
     JS_CFUNC_DEF("loadScript", 1, js_loadScript ),
     JS_CFUNC_DEF("getenv", 1, js_std_getenv ),
@@ -1515,6 +1679,9 @@ static const JSCFunctionListEntry js_std_funcs[] = {
     JS_CFUNC_DEF("getenviron", 1, js_std_getenviron ),
     JS_CFUNC_DEF("urlGet", 1, js_std_urlGet ),
     JS_CFUNC_DEF("loadFile", 1, js_std_loadFile ),
+#if !defined(_WIN32)
+    JS_CFUNC_DEF("mapFile", 1, js_std_mapFile ),
+#endif
     JS_CFUNC_DEF("strerror", 1, js_std_strerror ),
     JS_CFUNC_DEF("parseExtJSON", 1, js_std_parseExtJSON ),
 
@@ -1844,39 +2011,170 @@ static JSValue js_os_rename(JSContext *ctx, JSValueConst this_val,
 static BOOL is_main_thread(JSRuntime *rt)
 {
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    return !ts->recv_pipe;
+    return !ts->recv_pipe && !ts->pool_thread;
 }
 
-static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
+/* mask of the events waited for a file descriptor */
+#define OS_POLL_READ  (1 << 0)
+#define OS_POLL_WRITE (1 << 1)
+
+/* kind of the file descriptors registered in the event queue */
+#define OS_POLL_KIND_RW    0 /* JSOSRWHandler */
+#define OS_POLL_KIND_PORT  1 /* JSWorkerMessageHandler */
+#define OS_POLL_KIND_ASYNC 2 /* JSOSAsyncQueue */
+
+#ifdef USE_POLL_FD
+
+static void os_poll_fd_close(JSThreadState *ts)
 {
-    JSOSRWHandler *rh;
-    struct list_head *el;
+    if (ts->poll_fd >= 0) {
+        close(ts->poll_fd);
+        ts->poll_fd = -1;
+    }
+}
 
-    list_for_each(el, &ts->os_rw_handlers) {
-        rh = list_entry(el, JSOSRWHandler, link);
-        if (rh->fd == fd)
-            return rh;
+/* Update the events waited for 'fd' from 'old_events' to
+   'new_events'. The registration is always renewed when 'new_events'
+   is not zero because the file descriptor may have been closed and
+   reopened since. If the kernel refuses it (e.g. epoll does not
+   accept regular files), the event queue is closed and select() is
+   used from now on. */
+static void os_poll_update(JSThreadState *ts, int fd, int kind,
+                           int old_events, int new_events)
+{
+    int ret;
+
+    if (ts->poll_fd < 0)
+        return;
+#if defined(USE_EPOLL)
+    {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        if (new_events & OS_POLL_READ)
+            ev.events |= EPOLLIN;
+        if (new_events & OS_POLL_WRITE)
+            ev.events |= EPOLLOUT;
+        ev.data.u64 = ((uint64_t)kind << 32) | (uint32_t)fd;
+        if (new_events == 0) {
+            ret = epoll_ctl(ts->poll_fd, EPOLL_CTL_DEL, fd, &ev);
+        } else {
+            ret = epoll_ctl(ts->poll_fd, EPOLL_CTL_MOD, fd, &ev);
+            if (ret < 0 && errno == ENOENT)
+                ret = epoll_ctl(ts->poll_fd, EPOLL_CTL_ADD, fd, &ev);
+        }
     }
-    return NULL;
+#else
+    {
+        struct kevent ev[2];
+        int n = 0;
+        if (new_events & OS_POLL_READ) {
+            EV_SET(&ev[n++], fd, EVFILT_READ, EV_ADD, 0, 0,
+                   (void *)(uintptr_t)kind);
+        } else if (old_events & OS_POLL_READ) {
+            EV_SET(&ev[n++], fd, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+        }
+        if (new_events & OS_POLL_WRITE) {
+            EV_SET(&ev[n++], fd, EVFILT_WRITE, EV_ADD, 0, 0,
+                   (void *)(uintptr_t)kind);
+        } else if (old_events & OS_POLL_WRITE) {
+            EV_SET(&ev[n++], fd, EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+        }
+        ret = kevent(ts->poll_fd, ev, n, NULL, 0, NULL);
+    }
+#endif
+    if (ret < 0 && new_events != 0)
+        os_poll_fd_close(ts);
+}
+
+#else
+
+static void os_poll_update(JSThreadState *ts, int fd, int kind,
+                           int old_events, int new_events)
+{
+}
+
+#endif /* !USE_POLL_FD */
+
+static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
+{
+    if (fd < 0 || fd >= ts->rw_handler_tab_size)
+        return NULL;
+    return ts->rw_handler_tab[fd];
+}
+
+static int rh_get_events(JSOSRWHandler *rh)
+{
+    int events = 0;
+    if (!JS_IsNull(rh->rw_func[0]) || !list_empty(&rh->async_requests[0]))
+        events |= OS_POLL_READ;
+    if (!JS_IsNull(rh->rw_func[1]) || !list_empty(&rh->async_requests[1]))
+        events |= OS_POLL_WRITE;
+    return events;
 }
 
+#ifdef USE_WORKER
+static void os_async_fd_free(JSRuntime *rt, JSOSRWHandler *rh);
+static void os_async_fd_ready(JSContext *ctx, JSOSRWHandler *rh, int magic);
+#endif
+
 static void free_rw_handler(JSRuntime *rt, JSOSRWHandler *rh)
 {
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int i;
+#ifdef USE_WORKER
+    os_async_fd_free(rt, rh);
+#endif
     list_del(&rh->link);
+    ts->rw_handler_tab[rh->fd] = NULL;
     for(i = 0; i < 2; i++) {
         JS_FreeValueRT(rt, rh->rw_func[i]);
     }
     js_free_rt(rt, rh);
 }
 
+/* return the handler of 'fd', creating it if necessary. Return NULL
+   if exception. */
+static JSOSRWHandler *get_rh(JSContext *ctx, JSThreadState *ts, int fd)
+{
+    JSOSRWHandler *rh;
+
+    rh = find_rh(ts, fd);
+    if (!rh) {
+        if (fd >= ts->rw_handler_tab_size) {
+            JSOSRWHandler **tab;
+            int new_size;
+            new_size = max_int(fd + 1, ts->rw_handler_tab_size * 3 / 2);
+            new_size = max_int(new_size, 16);
+            tab = js_realloc(ctx, ts->rw_handler_tab,
+                             sizeof(tab[0]) * new_size);
+            if (!tab)
+                return NULL;
+            memset(tab + ts->rw_handler_tab_size, 0,
+                   sizeof(tab[0]) * (new_size - ts->rw_handler_tab_size));
+            ts->rw_handler_tab = tab;
+            ts->rw_handler_tab_size = new_size;
+        }
+        rh = js_mallocz(ctx, sizeof(*rh));
+        if (!rh)
+            return NULL;
+        rh->fd = fd;
+        rh->rw_func[0] = JS_NULL;
+        rh->rw_func[1] = JS_NULL;
+        init_list_head(&rh->async_requests[0]);
+        init_list_head(&rh->async_requests[1]);
+        list_add_tail(&rh->link, &ts->os_rw_handlers);
+        ts->rw_handler_tab[fd] = rh;
+    }
+    return rh;
+}
+
 static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
                                     int argc, JSValueConst *argv, int magic)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     JSOSRWHandler *rh;
-    int fd;
+    int fd, old_events;
     JSValueConst func;
 
     if (JS_ToInt32(ctx, &fd, argv[0]))
@@ -1885,10 +2183,12 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
     if (JS_IsNull(func)) {
         rh = find_rh(ts, fd);
         if (rh) {
+            old_events = rh_get_events(rh);
             JS_FreeValue(ctx, rh->rw_func[magic]);
             rh->rw_func[magic] = JS_NULL;
-            if (JS_IsNull(rh->rw_func[0]) &&
-                JS_IsNull(rh->rw_func[1])) {
+            os_poll_update(ts, fd, OS_POLL_KIND_RW,
+                           old_events, rh_get_events(rh));
+            if (rh_get_events(rh) == 0) {
                 /* remove the entry */
                 free_rw_handler(JS_GetRuntime(ctx), rh);
             }
@@ -1896,18 +2196,16 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
     } else {
         if (!JS_IsFunction(ctx, func))
             return JS_ThrowTypeError(ctx, "not a function");
-        rh = find_rh(ts, fd);
-        if (!rh) {
-            rh = js_mallocz(ctx, sizeof(*rh));
-            if (!rh)
-                return JS_EXCEPTION;
-            rh->fd = fd;
-            rh->rw_func[0] = JS_NULL;
-            rh->rw_func[1] = JS_NULL;
-            list_add_tail(&rh->link, &ts->os_rw_handlers);
-        }
+        if (fd < 0)
+            return JS_ThrowRangeError(ctx, "invalid file descriptor");
+        rh = get_rh(ctx, ts, fd);
+        if (!rh)
+            return JS_EXCEPTION;
+        old_events = rh_get_events(rh);
         JS_FreeValue(ctx, rh->rw_func[magic]);
         rh->rw_func[magic] = JS_DupValue(ctx, func);
+        os_poll_update(ts, fd, OS_POLL_KIND_RW,
+                       old_events, rh_get_events(rh));
     }
     return JS_UNDEFINED;
 }
@@ -2024,9 +2322,124 @@ static JSValue js_os_now(JSContext *ctx, JSValue this_val,
     return JS_NewFloat64(ctx, (double)get_time_ns() / 1e6);
 }
 
+static BOOL timer_lt(const JSOSTimer *a, const JSOSTimer *b)
+{
+    return a->timeout < b->timeout ||
+        (a->timeout == b->timeout && a->seq < b->seq);
+}
+
+static void timer_heap_set(JSThreadState *ts, int i, JSOSTimer *th)
+{
+    ts->timers[i] = th;
+    th->heap_index = i;
+}
+
+/* move the timer at index 'i' to its place in the heap */
+static void timer_heap_update(JSThreadState *ts, int i)
+{
+    JSOSTimer *th = ts->timers[i];
+    int parent, child;
+
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (!timer_lt(th, ts->timers[parent]))
+            break;
+        timer_heap_set(ts, i, ts->timers[parent]);
+        i = parent;
+    }
+    for(;;) {
+        child = 2 * i + 1;
+        if (child >= ts->timer_count)
+            break;
+        if (child + 1 < ts->timer_count &&
+            timer_lt(ts->timers[child + 1], ts->timers[child]))
+            child++;
+        if (!timer_lt(ts->timers[child], th))
+            break;
+        timer_heap_set(ts, i, ts->timers[child]);
+        i = child;
+    }
+    timer_heap_set(ts, i, th);
+}
+
+static int add_timer(JSContext *ctx, JSThreadState *ts, JSOSTimer *th)
+{
+    if (ts->timer_count >= ts->timer_size) {
+        JSOSTimer **tab;
+        int new_size;
+        new_size = max_int(16, ts->timer_size * 3 / 2);
+        tab = js_realloc(ctx, ts->timers, sizeof(tab[0]) * new_size);
+        if (!tab)
+            return -1;
+        ts->timers = tab;
+        ts->timer_size = new_size;
+    }
+    th->seq = ts->next_timer_seq++;
+    timer_heap_set(ts, ts->timer_count++, th);
+    timer_heap_update(ts, th->heap_index);
+    return 0;
+}
+
+/* the timer ids are consecutive, so their low bits are a good hash */
+static inline int timer_hash_index(JSThreadState *ts, int timer_id)
+{
+    return timer_id & (ts->timer_hash_size - 1);
+}
+
+static int timer_hash_add(JSContext *ctx, JSThreadState *ts, JSOSTimer *th)
+{
+    int h;
+
+    if (ts->timer_hash_count >= ts->timer_hash_size) {
+        JSOSTimer **tab, *th1, *th_next;
+        int new_size, i;
+        new_size = max_int(16, ts->timer_hash_size * 2);
+        tab = js_mallocz(ctx, sizeof(tab[0]) * new_size);
+        if (!tab)
+            return -1;
+        for(i = 0; i < ts->timer_hash_size; i++) {
+            for(th1 = ts->timer_hash[i]; th1 != NULL; th1 = th_next) {
+                th_next = th1->hash_next;
+                h = th1->timer_id & (new_size - 1);
+                th1->hash_next = tab[h];
+                tab[h] = th1;
+            }
+        }
+        js_free(ctx, ts->timer_hash);
+        ts->timer_hash = tab;
+        ts->timer_hash_size = new_size;
+    }
+    h = timer_hash_index(ts, th->timer_id);
+    th->hash_next = ts->timer_hash[h];
+    ts->timer_hash[h] = th;
+    ts->timer_hash_count++;
+    return 0;
+}
+
+static void timer_hash_remove(JSThreadState *ts, JSOSTimer *th)
+{
+    JSOSTimer **pth;
+
+    pth = &ts->timer_hash[timer_hash_index(ts, th->timer_id)];
+    while (*pth != th)
+        pth = &(*pth)->hash_next;
+    *pth = th->hash_next;
+    ts->timer_hash_count--;
+}
+
 static void free_timer(JSRuntime *rt, JSOSTimer *th)
 {
-    list_del(&th->link);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    int i = th->heap_index;
+
+    if (th->timer_id > 0)
+        timer_hash_remove(ts, th);
+
+    ts->timer_count--;
+    if (i != ts->timer_count) {
+        timer_heap_set(ts, i, ts->timers[ts->timer_count]);
+        timer_heap_update(ts, i);
+    }
     JS_FreeValueRT(rt, th->func);
     js_free_rt(rt, th);
 }
@@ -2049,23 +2462,31 @@ static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
     if (!th)
         return JS_EXCEPTION;
     th->timer_id = ts->next_timer_id;
+    th->timeout = get_time_ms() + delay;
+    if (timer_hash_add(ctx, ts, th)) {
+        js_free(ctx, th);
+        return JS_EXCEPTION;
+    }
+    if (add_timer(ctx, ts, th)) {
+        timer_hash_remove(ts, th);
+        js_free(ctx, th);
+        return JS_EXCEPTION;
+    }
     if (ts->next_timer_id == INT32_MAX)
         ts->next_timer_id = 1;
     else
         ts->next_timer_id++;
-    th->timeout = get_time_ms() + delay;
     th->func = JS_DupValue(ctx, func);
-    list_add_tail(&th->link, &ts->os_timers);
     return JS_NewInt32(ctx, th->timer_id);
 }
 
 static JSOSTimer *find_timer_by_id(JSThreadState *ts, int timer_id)
 {
-    struct list_head *el;
-    if (timer_id <= 0)
+    JSOSTimer *th;
+    if (timer_id <= 0 || ts->timer_hash_count == 0)
         return NULL;
-    list_for_each(el, &ts->os_timers) {
-        JSOSTimer *th = list_entry(el, JSOSTimer, link);
+    for(th = ts->timer_hash[timer_hash_index(ts, timer_id)]; th != NULL;
+        th = th->hash_next) {
         if (th->timer_id == timer_id)
             return th;
     }
@@ -2114,8 +2535,14 @@ static JSValue js_os_sleepAsync(JSContext *ctx, JSValueConst this_val,
     }
     th->timer_id = -1;
     th->timeout = get_time_ms() + delay;
+    if (add_timer(ctx, ts, th)) {
+        js_free(ctx, th);
+        JS_FreeValue(ctx, promise);
+        JS_FreeValue(ctx, resolving_funcs[0]);
+        JS_FreeValue(ctx, resolving_funcs[1]);
+        return JS_EXCEPTION;
+    }
     th->func = JS_DupValue(ctx, resolving_funcs[0]);
-    list_add_tail(&th->link, &ts->os_timers);
     JS_FreeValue(ctx, resolving_funcs[0]);
     JS_FreeValue(ctx, resolving_funcs[1]);
     return promise;
@@ -2134,6 +2561,38 @@ static void call_handler(JSContext *ctx, JSValueConst func)
     JS_FreeValue(ctx, ret);
 }
 
+/* Run the first expired timer and return TRUE if there is one.
+   Otherwise return in '*pmin_delay' the maximum time to wait in ms
+   before the next call or -1 if there are no timers. */
+static BOOL js_os_run_timer(JSContext *ctx, int *pmin_delay)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer *th;
+    JSValue func;
+    int64_t delay;
+
+    if (ts->timer_count == 0) {
+        *pmin_delay = -1;
+        return FALSE;
+    }
+    th = ts->timers[0];
+    delay = th->timeout - get_time_ms();
+    if (delay <= 0) {
+        /* the timer expired */
+        func = th->func;
+        th->func = JS_UNDEFINED;
+        free_timer(rt, th);
+        call_handler(ctx, func);
+        JS_FreeValue(ctx, func);
+        return TRUE;
+    }
+    if (delay > 10000)
+        delay = 10000;
+    *pmin_delay = delay;
+    return FALSE;
+}
+
 #if defined(_WIN32)
 
 static int js_os_poll(JSContext *ctx)
@@ -2141,38 +2600,17 @@ static int js_os_poll(JSContext *ctx)
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int min_delay, console_fd;
-    int64_t cur_time, delay;
     JSOSRWHandler *rh;
     struct list_head *el;
 
     /* XXX: handle signals if useful */
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers))
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0)
         return -1; /* no more events */
 
     /* XXX: only timers and basic console input are supported */
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
-    } else {
-        min_delay = -1;
-    }
+    if (js_os_run_timer(ctx, &min_delay))
+        return 0;
 
     console_fd = -1;
     list_for_each(el, &ts->os_rw_handlers) {
@@ -2212,6 +2650,8 @@ static int js_os_poll(JSContext *ctx)
 #ifdef USE_WORKER
 
 static void js_free_message(JSWorkerMessage *msg);
+static JSValue js_read_message(JSContext *ctx, JSWorkerMessage *msg);
+static void os_async_handle_done(JSContext *ctx);
 
 /* return 1 if a message was handled, 0 if no message */
 static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
@@ -2245,8 +2685,7 @@ static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
 
         pthread_mutex_unlock(&ps->mutex);
 
-        data_obj = JS_ReadObject(ctx, msg->data, msg->data_len,
-                                 JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE);
+        data_obj = js_read_message(ctx, msg);
 
         js_free_message(msg);
 
@@ -2284,14 +2723,120 @@ static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
 {
     return 0;
 }
+
+static void os_async_handle_done(JSContext *ctx)
+{
+}
+#endif
+
+/* handle the readiness of 'rh' for reading (magic = 0) or writing
+   (magic = 1). The pending asynchronous requests are served before
+   the handler. Return TRUE if something was done. */
+static BOOL handle_rw_event(JSContext *ctx, JSOSRWHandler *rh, int magic)
+{
+#ifdef USE_WORKER
+    if (!list_empty(&rh->async_requests[magic])) {
+        os_async_fd_ready(ctx, rh, magic);
+        return TRUE;
+    }
+#endif
+    if (!JS_IsNull(rh->rw_func[magic])) {
+        call_handler(ctx, rh->rw_func[magic]);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+#ifdef USE_POLL_FD
+
+static JSWorkerMessageHandler *find_port(JSThreadState *ts, int fd)
+{
+    struct list_head *el;
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        if (port->recv_pipe->read_fd == fd)
+            return port;
+    }
+    return NULL;
+}
+
+/* call the handler of the file descriptor 'fd' which is ready for
+   'events' */
+static void handle_poll_event(JSContext *ctx, int fd, int kind, int events)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSRWHandler *rh;
+    JSWorkerMessageHandler *port;
+
+    if (kind == OS_POLL_KIND_PORT) {
+        port = find_port(ts, fd);
+        if (port && !JS_IsNull(port->on_message_func))
+            handle_posted_message(rt, ctx, port);
+    } else if (kind == OS_POLL_KIND_ASYNC) {
+        os_async_handle_done(ctx);
+    } else {
+        rh = find_rh(ts, fd);
+        if (!rh)
+            return;
+        if (!((events & OS_POLL_READ) && handle_rw_event(ctx, rh, 0)) &&
+            (events & OS_POLL_WRITE))
+            handle_rw_event(ctx, rh, 1);
+    }
+}
+
+/* wait for at most 'min_delay' ms (-1 = infinite) and handle one
+   event. The event queue reports the ready descriptors in a round
+   robin way so that none is starved. */
+static void os_poll_wait(JSContext *ctx, int min_delay)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    int ret, fd, kind, events;
+#if defined(USE_EPOLL)
+    struct epoll_event ev;
+
+    ret = epoll_wait(ts->poll_fd, &ev, 1, min_delay);
+    if (ret <= 0)
+        return;
+    fd = (uint32_t)ev.data.u64;
+    kind = ev.data.u64 >> 32;
+    events = 0;
+    /* as with select(), errors are reported as readiness */
+    if (ev.events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        events |= OS_POLL_READ;
+    if (ev.events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+        events |= OS_POLL_WRITE;
+#else
+    struct kevent ev;
+    struct timespec tv, *tvp;
+
+    if (min_delay >= 0) {
+        tv.tv_sec = min_delay / 1000;
+        tv.tv_nsec = (min_delay % 1000) * 1000000;
+        tvp = &tv;
+    } else {
+        tvp = NULL;
+    }
+    ret = kevent(ts->poll_fd, NULL, 0, &ev, 1, tvp);
+    if (ret <= 0)
+        return;
+    fd = ev.ident;
+    kind = (uintptr_t)ev.udata;
+    if (ev.filter == EVFILT_READ)
+        events = OS_POLL_READ;
+    else
+        events = OS_POLL_WRITE;
 #endif
+    handle_poll_event(ctx, fd, kind, events);
+}
+
+#endif /* USE_POLL_FD */
 
 static int js_os_poll(JSContext *ctx)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int ret, fd_max, min_delay;
-    int64_t cur_time, delay;
+    int ret, fd_max, min_delay, events;
     fd_set rfds, wfds;
     JSOSRWHandler *rh;
     struct list_head *el;
@@ -2314,29 +2859,21 @@ static int js_os_poll(JSContext *ctx)
         }
     }
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers) &&
-        list_empty(&ts->port_list))
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0 &&
+        list_empty(&ts->port_list) && list_empty(&ts->async_requests))
         return -1; /* no more events */
 
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
+    if (js_os_run_timer(ctx, &min_delay))
+        return 0;
+
+#ifdef USE_POLL_FD
+    if (ts->poll_fd >= 0) {
+        os_poll_wait(ctx, min_delay);
+        return 0;
+    }
+#endif
+
+    if (min_delay >= 0) {
         tv.tv_sec = min_delay / 1000;
         tv.tv_usec = (min_delay % 1000) * 1000;
         tvp = &tv;
@@ -2350,9 +2887,10 @@ static int js_os_poll(JSContext *ctx)
     list_for_each(el, &ts->os_rw_handlers) {
         rh = list_entry(el, JSOSRWHandler, link);
         fd_max = max_int(fd_max, rh->fd);
-        if (!JS_IsNull(rh->rw_func[0]))
+        events = rh_get_events(rh);
+        if (events & OS_POLL_READ)
             FD_SET(rh->fd, &rfds);
-        if (!JS_IsNull(rh->rw_func[1]))
+        if (events & OS_POLL_WRITE)
             FD_SET(rh->fd, &wfds);
     }
 
@@ -2365,22 +2903,25 @@ static int js_os_poll(JSContext *ctx)
         }
     }
 
+    if (ts->async_queue && !list_empty(&ts->async_requests)) {
+        fd_max = max_int(fd_max, ts->async_queue->read_fd);
+        FD_SET(ts->async_queue->read_fd, &rfds);
+    }
+
     ret = select(fd_max + 1, &rfds, &wfds, NULL, tvp);
     if (ret > 0) {
         list_for_each(el, &ts->os_rw_handlers) {
             rh = list_entry(el, JSOSRWHandler, link);
-            if (!JS_IsNull(rh->rw_func[0]) &&
-                FD_ISSET(rh->fd, &rfds)) {
-                call_handler(ctx, rh->rw_func[0]);
-                /* must stop because the list may have been modified */
+            /* must stop because the list may have been modified */
+            if (FD_ISSET(rh->fd, &rfds) && handle_rw_event(ctx, rh, 0))
                 goto done;
-            }
-            if (!JS_IsNull(rh->rw_func[1]) &&
-                FD_ISSET(rh->fd, &wfds)) {
-                call_handler(ctx, rh->rw_func[1]);
-                /* must stop because the list may have been modified */
+            if (FD_ISSET(rh->fd, &wfds) && handle_rw_event(ctx, rh, 1))
                 goto done;
-            }
+        }
+
+        if (ts->async_queue && FD_ISSET(ts->async_queue->read_fd, &rfds)) {
+            os_async_handle_done(ctx);
+            goto done;
         }
 
         list_for_each(el, &ts->port_list) {
@@ -2529,6 +3070,76 @@ static int64_t timespec_to_ms(const struct timespec *tv)
 }
 #endif
 
+static JSValue js_os_stat_obj(JSContext *ctx, const struct stat *st)
+{
+    JSValue obj;
+
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_DefinePropertyValueStr(ctx, obj, "dev",
+                              JS_NewInt64(ctx, st->st_dev),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "ino",
+                              JS_NewInt64(ctx, st->st_ino),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mode",
+                              JS_NewInt32(ctx, st->st_mode),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "nlink",
+                              JS_NewInt64(ctx, st->st_nlink),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "uid",
+                              JS_NewInt64(ctx, st->st_uid),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "gid",
+                              JS_NewInt64(ctx, st->st_gid),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "rdev",
+                              JS_NewInt64(ctx, st->st_rdev),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "size",
+                              JS_NewInt64(ctx, st->st_size),
+                              JS_PROP_C_W_E);
+#if !defined(_WIN32)
+    JS_DefinePropertyValueStr(ctx, obj, "blocks",
+                              JS_NewInt64(ctx, st->st_blocks),
+                              JS_PROP_C_W_E);
+#endif
+#if defined(_WIN32)
+    JS_DefinePropertyValueStr(ctx, obj, "atime",
+                              JS_NewInt64(ctx, (int64_t)st->st_atime * 1000),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mtime",
+                              JS_NewInt64(ctx, (int64_t)st->st_mtime * 1000),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "ctime",
+                              JS_NewInt64(ctx, (int64_t)st->st_ctime * 1000),
+                              JS_PROP_C_W_E);
+#elif defined(__APPLE__)
+    JS_DefinePropertyValueStr(ctx, obj, "atime",
+                              JS_NewInt64(ctx, timespec_to_ms(&st->st_atimespec)),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mtime",
+                              JS_NewInt64(ctx, timespec_to_ms(&st->st_mtimespec)),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "ctime",
+                              JS_NewInt64(ctx, timespec_to_ms(&st->st_ctimespec)),
+                              JS_PROP_C_W_E);
+#else
+    JS_DefinePropertyValueStr(ctx, obj, "atime",
+                              JS_NewInt64(ctx, timespec_to_ms(&st->st_atim)),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "mtime",
+                              JS_NewInt64(ctx, timespec_to_ms(&st->st_mtim)),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "ctime",
+                              JS_NewInt64(ctx, timespec_to_ms(&st->st_ctim)),
+                              JS_PROP_C_W_E);
+#endif
+    return obj;
+}
+
 /* return [obj, errcode] */
 static JSValue js_os_stat(JSContext *ctx, JSValueConst this_val,
                           int argc, JSValueConst *argv, int is_lstat)
@@ -2557,69 +3168,7 @@ static JSValue js_os_stat(JSContext *ctx, JSValueConst this_val,
     if (res < 0) {
         obj = JS_NULL;
     } else {
-        obj = JS_NewObject(ctx);
-        if (JS_IsException(obj))
-            return JS_EXCEPTION;
-        JS_DefinePropertyValueStr(ctx, obj, "dev",
-                                  JS_NewInt64(ctx, st.st_dev),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ino",
-                                  JS_NewInt64(ctx, st.st_ino),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mode",
-                                  JS_NewInt32(ctx, st.st_mode),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "nlink",
-                                  JS_NewInt64(ctx, st.st_nlink),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "uid",
-                                  JS_NewInt64(ctx, st.st_uid),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "gid",
-                                  JS_NewInt64(ctx, st.st_gid),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "rdev",
-                                  JS_NewInt64(ctx, st.st_rdev),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "size",
-                                  JS_NewInt64(ctx, st.st_size),
-                                  JS_PROP_C_W_E);
-#if !defined(_WIN32)
-        JS_DefinePropertyValueStr(ctx, obj, "blocks",
-                                  JS_NewInt64(ctx, st.st_blocks),
-                                  JS_PROP_C_W_E);
-#endif
-#if defined(_WIN32)
-        JS_DefinePropertyValueStr(ctx, obj, "atime",
-                                  JS_NewInt64(ctx, (int64_t)st.st_atime * 1000),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mtime",
-                                  JS_NewInt64(ctx, (int64_t)st.st_mtime * 1000),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ctime",
-                                  JS_NewInt64(ctx, (int64_t)st.st_ctime * 1000),
-                                  JS_PROP_C_W_E);
-#elif defined(__APPLE__)
-        JS_DefinePropertyValueStr(ctx, obj, "atime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_atimespec)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mtime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_mtimespec)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ctime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_ctimespec)),
-                                  JS_PROP_C_W_E);
-#else
-        JS_DefinePropertyValueStr(ctx, obj, "atime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_atim)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mtime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_mtim)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ctime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_ctim)),
-                                  JS_PROP_C_W_E);
-#endif
+        obj = js_os_stat_obj(ctx, &st);
     }
     return make_obj_error(ctx, obj, err);
 }
@@ -3297,10 +3846,24 @@ static void js_free_message(JSWorkerMessage *msg)
         js_sab_free(NULL, msg->sab_tab[i]);
     }
     free(msg->sab_tab);
+    /* free the transferred ArrayBuffers which were not used */
+    for(i = 0; i < msg->transfer_len; i++) {
+        free(msg->transfer_tab[i]);
+    }
+    free(msg->transfer_tab);
     free(msg->data);
     free(msg);
 }
 
+/* deserialize a message created by js_new_message(). The transferred
+   ArrayBuffers which are used are removed from the message. */
+static JSValue js_read_message(JSContext *ctx, JSWorkerMessage *msg)
+{
+    return JS_ReadObject2(ctx, msg->data, msg->data_len,
+                          JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE,
+                          msg->transfer_tab, msg->transfer_len);
+}
+
 static void js_free_message_pipe(JSWorkerMessagePipe *ps)
 {
     struct list_head *el, *el1;
@@ -3326,7 +3889,12 @@ static void js_free_message_pipe(JSWorkerMessagePipe *ps)
 
 static void js_free_port(JSRuntime *rt, JSWorkerMessageHandler *port)
 {
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     if (port) {
+        if (ts) {
+            os_poll_update(ts, port->recv_pipe->read_fd, OS_POLL_KIND_PORT,
+                           OS_POLL_READ, 0);
+        }
         js_free_message_pipe(port->recv_pipe);
         JS_FreeValueRT(rt, port->on_message_func);
         list_del(&port->link);
@@ -3513,30 +4081,78 @@ static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
     return JS_EXCEPTION;
 }
 
-static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
-                                     int argc, JSValueConst *argv)
+/* serialize 'val' into a message which can be read by another
+   runtime. 'transfer' is undefined or an array of ArrayBuffers which
+   are detached and moved to the message without copy. Return NULL if
+   exception. */
+static JSWorkerMessage *js_new_message(JSContext *ctx, JSValueConst val,
+                                       JSValueConst transfer)
 {
-    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
-    JSWorkerMessagePipe *ps;
     size_t data_len, sab_tab_len, i;
     uint8_t *data;
     JSWorkerMessage *msg;
     uint8_t **sab_tab;
+    JSValue *transfer_list;
+    uint32_t transfer_len;
+    JSValue len_val;
+
+    transfer_list = NULL;
+    transfer_len = 0;
+    if (!JS_IsUndefined(transfer)) {
+        len_val = JS_GetPropertyStr(ctx, transfer, "length");
+        if (JS_IsException(len_val))
+            return NULL;
+        if (JS_ToUint32(ctx, &transfer_len, len_val)) {
+            JS_FreeValue(ctx, len_val);
+            return NULL;
+        }
+        JS_FreeValue(ctx, len_val);
+        /* arbitrary limit to avoid overflow */
+        if (transfer_len > 65535) {
+            JS_ThrowRangeError(ctx, "too many transferred objects");
+            return NULL;
+        }
+        transfer_list = js_mallocz(ctx, sizeof(transfer_list[0]) *
+                                   max_int(transfer_len, 1));
+        if (!transfer_list)
+            return NULL;
+        for(i = 0; i < transfer_len; i++) {
+            transfer_list[i] = JS_GetPropertyUint32(ctx, transfer, i);
+            if (JS_IsException(transfer_list[i]))
+                goto fail_transfer;
+        }
+    }
 
-    if (!worker)
-        return JS_EXCEPTION;
+    msg = malloc(sizeof(*msg));
+    if (!msg) {
+        JS_ThrowOutOfMemory(ctx);
+        goto fail_transfer;
+    }
+    memset(msg, 0, sizeof(*msg));
+    if (transfer_len > 0) {
+        msg->transfer_tab = malloc(sizeof(msg->transfer_tab[0]) * transfer_len);
+        if (!msg->transfer_tab) {
+            free(msg);
+            JS_ThrowOutOfMemory(ctx);
+            goto fail_transfer;
+        }
+    }
 
-    data = JS_WriteObject2(ctx, &data_len, argv[0],
+    data = JS_WriteObject3(ctx, &data_len, val,
                            JS_WRITE_OBJ_SAB | JS_WRITE_OBJ_REFERENCE,
-                           &sab_tab, &sab_tab_len);
-    if (!data)
-        return JS_EXCEPTION;
-
-    msg = malloc(sizeof(*msg));
-    if (!msg)
-        goto fail;
-    msg->data = NULL;
-    msg->sab_tab = NULL;
+                           &sab_tab, &sab_tab_len,
+                           (JSValueConst *)transfer_list, msg->transfer_tab,
+                           transfer_len);
+    for(i = 0; i < transfer_len; i++)
+        JS_FreeValue(ctx, transfer_list[i]);
+    js_free(ctx, transfer_list);
+    if (!data) {
+        free(msg->transfer_tab);
+        free(msg);
+        return NULL;
+    }
+    /* from now on, the transferred data belongs to the message */
+    msg->transfer_len = transfer_len;
 
     /* must reallocate because the allocator may be different */
     msg->data = malloc(data_len);
@@ -3560,6 +4176,37 @@ static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
     for(i = 0; i < msg->sab_tab_len; i++) {
         js_sab_dup(NULL, msg->sab_tab[i]);
     }
+    return msg;
+ fail:
+    /* the SAB reference counts were not incremented yet */
+    msg->sab_tab_len = 0;
+    js_free_message(msg);
+    js_free(ctx, data);
+    js_free(ctx, sab_tab);
+    JS_ThrowOutOfMemory(ctx);
+    return NULL;
+ fail_transfer:
+    for(i = 0; i < transfer_len; i++)
+        JS_FreeValue(ctx, transfer_list[i]);
+    js_free(ctx, transfer_list);
+    return NULL;
+}
+
+/* postMessage(msg[, transfer]): 'transfer' is an array of ArrayBuffers
+   which are detached and moved to the receiver without copy */
+static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
+                                     int argc, JSValueConst *argv)
+{
+    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
+    JSWorkerMessagePipe *ps;
+    JSWorkerMessage *msg;
+
+    if (!worker)
+        return JS_EXCEPTION;
+
+    msg = js_new_message(ctx, argv[0], argc >= 2 ? argv[1] : JS_UNDEFINED);
+    if (!msg)
+        return JS_EXCEPTION;
 
     ps = worker->send_pipe;
     pthread_mutex_lock(&ps->mutex);
@@ -3578,16 +4225,6 @@ static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
     list_add_tail(&msg->link, &ps->msg_queue);
     pthread_mutex_unlock(&ps->mutex);
     return JS_UNDEFINED;
- fail:
-    if (msg) {
-        free(msg->data);
-        free(msg->sab_tab);
-        free(msg);
-    }
-    js_free(ctx, data);
-    js_free(ctx, sab_tab);
-    return JS_EXCEPTION;
-
 }
 
 static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
@@ -3618,6 +4255,8 @@ static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
             port->on_message_func = JS_NULL;
             list_add_tail(&port->link, &ts->port_list);
             worker->msg_handler = port;
+            os_poll_update(ts, port->recv_pipe->read_fd, OS_POLL_KIND_PORT,
+                           0, OS_POLL_READ);
         }
         JS_FreeValue(ctx, port->on_message_func);
         port->on_message_func = JS_DupValue(ctx, func);
@@ -3646,130 +4285,1245 @@ static const JSCFunctionListEntry js_worker_proto_funcs[] = {
 
 #endif /* USE_WORKER */
 
-void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt))
-{
 #ifdef USE_WORKER
-    js_worker_new_context_func = func;
-#endif
-}
-
-#if defined(_WIN32)
-#define OS_PLATFORM "win32"
-#elif defined(__APPLE__)
-#define OS_PLATFORM "darwin"
-#elif defined(EMSCRIPTEN)
-#define OS_PLATFORM "js"
-#else
-#define OS_PLATFORM "linux"
-#endif
 
-#define OS_FLAG(x) JS_PROP_INT32_DEF(#x, x, JS_PROP_CONFIGURABLE )
+/* Asynchronous file I/O */
 
-static const JSCFunctionListEntry js_os_funcs[] = {
-    JS_CFUNC_DEF("open", 2, js_os_open ),
-    OS_FLAG(O_RDONLY),
-    OS_FLAG(O_WRONLY),
-    OS_FLAG(O_RDWR),
-    OS_FLAG(O_APPEND),
-    OS_FLAG(O_CREAT),
-    OS_FLAG(O_EXCL),
-    OS_FLAG(O_TRUNC),
-#if defined(_WIN32)
-    OS_FLAG(O_BINARY),
-    OS_FLAG(O_TEXT),
-#endif
-    JS_CFUNC_DEF("close", 1, js_os_close ),
-    JS_CFUNC_DEF("seek", 3, js_os_seek ),
-    JS_CFUNC_MAGIC_DEF("read", 4, js_os_read_write, 0 ),
-    JS_CFUNC_MAGIC_DEF("write", 4, js_os_read_write, 1 ),
-    JS_CFUNC_DEF("isatty", 1, js_os_isatty ),
-    JS_CFUNC_DEF("ttyGetWinSize", 1, js_os_ttyGetWinSize ),
-    JS_CFUNC_DEF("ttySetRaw", 1, js_os_ttySetRaw ),
-    JS_CFUNC_DEF("remove", 1, js_os_remove ),
-    JS_CFUNC_DEF("rename", 2, js_os_rename ),
-    JS_CFUNC_MAGIC_DEF("setReadHandler", 2, js_os_setReadHandler, 0 ),
-    JS_CFUNC_MAGIC_DEF("setWriteHandler", 2, js_os_setReadHandler, 1 ),
-    JS_CFUNC_DEF("signal", 2, js_os_signal ),
-    OS_FLAG(SIGINT),
-    OS_FLAG(SIGABRT),
-    OS_FLAG(SIGFPE),
-    OS_FLAG(SIGILL),
-    OS_FLAG(SIGSEGV),
-    OS_FLAG(SIGTERM),
-#if !defined(_WIN32)
-    OS_FLAG(SIGQUIT),
-    OS_FLAG(SIGPIPE),
-    OS_FLAG(SIGALRM),
-    OS_FLAG(SIGUSR1),
-    OS_FLAG(SIGUSR2),
-    OS_FLAG(SIGCHLD),
-    OS_FLAG(SIGCONT),
-    OS_FLAG(SIGSTOP),
-    OS_FLAG(SIGTSTP),
-    OS_FLAG(SIGTTIN),
-    OS_FLAG(SIGTTOU),
-#endif
-    JS_CFUNC_DEF("now", 0, js_os_now ),
-    JS_CFUNC_DEF("setTimeout", 2, js_os_setTimeout ),
-    JS_CFUNC_DEF("clearTimeout", 1, js_os_clearTimeout ),
-    JS_CFUNC_DEF("sleepAsync", 1, js_os_sleepAsync ),
-    JS_PROP_STRING_DEF("platform", OS_PLATFORM, 0 ),
-    JS_CFUNC_DEF("getcwd", 0, js_os_getcwd ),
-    JS_CFUNC_DEF("chdir", 0, js_os_chdir ),
-    JS_CFUNC_DEF("mkdir", 1, js_os_mkdir ),
-    JS_CFUNC_DEF("readdir", 1, js_os_readdir ),
-    /* st_mode constants */
-    OS_FLAG(S_IFMT),
-    OS_FLAG(S_IFIFO),
-    OS_FLAG(S_IFCHR),
-    OS_FLAG(S_IFDIR),
-    OS_FLAG(S_IFBLK),
-    OS_FLAG(S_IFREG),
-#if !defined(_WIN32)
-    OS_FLAG(S_IFSOCK),
-    OS_FLAG(S_IFLNK),
-    OS_FLAG(S_ISGID),
-    OS_FLAG(S_ISUID),
-#endif
-    JS_CFUNC_MAGIC_DEF("stat", 1, js_os_stat, 0 ),
-    JS_CFUNC_DEF("utimes", 3, js_os_utimes ),
-    JS_CFUNC_DEF("sleep", 1, js_os_sleep ),
-    JS_CFUNC_DEF("realpath", 1, js_os_realpath ),
-#if !defined(_WIN32)
-    JS_CFUNC_MAGIC_DEF("lstat", 1, js_os_stat, 1 ),
-    JS_CFUNC_DEF("symlink", 2, js_os_symlink ),
-    JS_CFUNC_DEF("readlink", 1, js_os_readlink ),
-    JS_CFUNC_DEF("exec", 1, js_os_exec ),
-    JS_CFUNC_DEF("getpid", 0, js_os_getpid ),
-    JS_CFUNC_DEF("waitpid", 2, js_os_waitpid ),
-    OS_FLAG(WNOHANG),
-    JS_CFUNC_DEF("pipe", 0, js_os_pipe ),
-    JS_CFUNC_DEF("kill", 2, js_os_kill ),
-    JS_CFUNC_DEF("dup", 1, js_os_dup ),
-    JS_CFUNC_DEF("dup2", 2, js_os_dup2 ),
-#endif
-};
+/* The blocking system calls are executed by a pool of threads shared
+   by all the runtimes. A request only accesses memory allocated with
+   malloc() so that it can complete after its runtime was freed. The
+   results are queued in the JSOSAsyncQueue of the calling thread and
+   the promises are resolved by js_os_poll(). */
 
-static int js_os_init(JSContext *ctx, JSModuleDef *m)
-{
-    os_poll_func = js_os_poll;
+#define OS_ASYNC_THREADS_MAX 4
 
-#ifdef USE_WORKER
-    {
-        JSRuntime *rt = JS_GetRuntime(ctx);
-        JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-        JSValue proto, obj;
-        /* Worker class */
-        JS_NewClassID(&js_worker_class_id);
-        JS_NewClass(JS_GetRuntime(ctx), js_worker_class_id, &js_worker_class);
-        proto = JS_NewObject(ctx);
-        JS_SetPropertyFunctionList(ctx, proto, js_worker_proto_funcs, countof(js_worker_proto_funcs));
+typedef enum {
+    OS_ASYNC_READ,
+    OS_ASYNC_WRITE,
+    OS_ASYNC_STAT,
+    OS_ASYNC_LSTAT,
+    OS_ASYNC_READDIR,
+    OS_ASYNC_TASK, /* executed by a worker pool */
+} JSOSAsyncOp;
 
-        obj = JS_NewCFunction2(ctx, js_worker_ctor, "Worker", 1,
-                               JS_CFUNC_constructor, 0);
-        JS_SetConstructor(ctx, obj, proto);
+typedef struct JSWorkerPool JSWorkerPool;
 
-        JS_SetClassProto(ctx, js_worker_class_id, proto);
+typedef struct {
+    /* in os_async_jobs, JSOSAsyncQueue.done_list or
+       JSOSRWHandler.async_requests */
+    struct list_head link;
+    JSOSAsyncQueue *queue;
+    JSOSAsyncOp op;
+    int fd;
+    char *path;
+    uint8_t *buf; /* data read or written */
+    size_t len;
+    /* result */
+    ssize_t ret; /* read() or write() result or -errno */
+    int err;
+    struct stat st;
+    DynBuf names; /* OS_ASYNC_READDIR: zero terminated file names */
+    /* OS_ASYNC_TASK */
+    JSWorkerPool *pool;
+    JSWorkerMessage *msg; /* task argument, then its result */
+    char *error; /* message of the exception raised by the task */
+    /* only accessed by the thread of the runtime */
+    struct list_head pending_link; /* in JSThreadState.async_requests */
+    JSValue resolving_funcs[2];
+    JSValue buffer_obj; /* OS_ASYNC_READ: destination array buffer */
+    uint64_t pos;
+} JSOSAsyncRequest;
+
+static void worker_pool_submit(JSWorkerPool *pool, JSOSAsyncRequest *req);
+
+static pthread_mutex_t os_async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t os_async_cond = PTHREAD_COND_INITIALIZER;
+static struct list_head os_async_jobs = LIST_HEAD_INIT(os_async_jobs);
+static int os_async_thread_count;
+static int os_async_idle_count;
+
+static JSOSAsyncQueue *os_async_queue_new(void)
+{
+    JSOSAsyncQueue *q;
+    int pipe_fds[2];
+
+    if (pipe(pipe_fds) < 0)
+        return NULL;
+    q = malloc(sizeof(*q));
+    if (!q) {
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+        return NULL;
+    }
+    q->ref_count = 1;
+    pthread_mutex_init(&q->mutex, NULL);
+    q->closed = FALSE;
+    init_list_head(&q->done_list);
+    q->read_fd = pipe_fds[0];
+    q->write_fd = pipe_fds[1];
+    return q;
+}
+
+static void os_async_req_free(JSOSAsyncRequest *req)
+{
+    free(req->path);
+    free(req->buf);
+    dbuf_free(&req->names);
+    if (req->msg)
+        js_free_message(req->msg);
+    free(req->error);
+    free(req);
+}
+
+/* must be called with q->mutex locked. It is unlocked. */
+static void os_async_queue_unref(JSOSAsyncQueue *q)
+{
+    int ref_count = --q->ref_count;
+    pthread_mutex_unlock(&q->mutex);
+    if (ref_count == 0) {
+        pthread_mutex_destroy(&q->mutex);
+        close(q->read_fd);
+        close(q->write_fd);
+        free(q);
+    }
+}
+
+static void os_async_exec(JSOSAsyncRequest *req)
+{
+    int res;
+
+    switch(req->op) {
+    case OS_ASYNC_READ:
+        req->ret = js_get_errno(read(req->fd, req->buf, req->len));
+        break;
+    case OS_ASYNC_WRITE:
+        req->ret = js_get_errno(write(req->fd, req->buf, req->len));
+        break;
+    case OS_ASYNC_STAT:
+    case OS_ASYNC_LSTAT:
+        if (req->op == OS_ASYNC_LSTAT)
+            res = lstat(req->path, &req->st);
+        else
+            res = stat(req->path, &req->st);
+        req->err = (res < 0) ? errno : 0;
+        break;
+    case OS_ASYNC_READDIR:
+        {
+            DIR *f;
+            struct dirent *d;
+
+            f = opendir(req->path);
+            if (!f) {
+                req->err = errno;
+                break;
+            }
+            req->ret = 0;
+            for(;;) {
+                errno = 0;
+                d = readdir(f);
+                if (!d) {
+                    req->err = errno;
+                    break;
+                }
+                if (dbuf_put(&req->names, (uint8_t *)d->d_name,
+                             strlen(d->d_name) + 1)) {
+                    req->err = ENOMEM;
+                    break;
+                }
+                req->ret++;
+            }
+            closedir(f);
+        }
+        break;
+    default:
+        abort();
+    }
+}
+
+/* queue the result of 'req' to the thread which made the request */
+static void os_async_complete(JSOSAsyncRequest *req)
+{
+    JSOSAsyncQueue *q = req->queue;
+    BOOL closed;
+
+    pthread_mutex_lock(&q->mutex);
+    closed = q->closed;
+    if (!closed) {
+        if (list_empty(&q->done_list)) {
+            uint8_t ch = '\0';
+            int ret;
+            for(;;) {
+                ret = write(q->write_fd, &ch, 1);
+                if (ret >= 0 || errno != EINTR)
+                    break;
+            }
+        }
+        list_add_tail(&req->link, &q->done_list);
+    }
+    os_async_queue_unref(q);
+    if (closed)
+        os_async_req_free(req);
+}
+
+static void *os_async_thread(void *arg)
+{
+    JSOSAsyncRequest *req;
+    sigset_t set;
+
+    /* the signals are handled by the threads running JS code */
+    sigfillset(&set);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+    pthread_mutex_lock(&os_async_mutex);
+    for(;;) {
+        while (list_empty(&os_async_jobs)) {
+            os_async_idle_count++;
+            pthread_cond_wait(&os_async_cond, &os_async_mutex);
+            os_async_idle_count--;
+        }
+        req = list_entry(os_async_jobs.next, JSOSAsyncRequest, link);
+        list_del(&req->link);
+        pthread_mutex_unlock(&os_async_mutex);
+
+        os_async_exec(req);
+        os_async_complete(req);
+
+        pthread_mutex_lock(&os_async_mutex);
+    }
+    return NULL;
+}
+
+static void os_async_submit(JSOSAsyncRequest *req)
+{
+    pthread_attr_t attr;
+    pthread_t tid;
+    BOOL run_inline = FALSE;
+
+    pthread_mutex_lock(&os_async_mutex);
+    list_add_tail(&req->link, &os_async_jobs);
+    if (os_async_idle_count > 0) {
+        pthread_cond_signal(&os_async_cond);
+    } else if (os_async_thread_count < OS_ASYNC_THREADS_MAX) {
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        if (pthread_create(&tid, &attr, os_async_thread, NULL) == 0) {
+            os_async_thread_count++;
+        } else if (os_async_thread_count == 0) {
+            /* no thread to execute the request */
+            list_del(&req->link);
+            run_inline = TRUE;
+        }
+        pthread_attr_destroy(&attr);
+    }
+    pthread_mutex_unlock(&os_async_mutex);
+    if (run_inline) {
+        os_async_exec(req);
+        os_async_complete(req);
+    }
+}
+
+/* allocate a request and its promise. Return NULL if exception. */
+static JSOSAsyncRequest *os_async_req_new(JSContext *ctx, JSOSAsyncOp op,
+                                          JSValue *ppromise)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSOSAsyncRequest *req;
+
+    if (!ts->async_queue) {
+        ts->async_queue = os_async_queue_new();
+        if (!ts->async_queue) {
+            JS_ThrowOutOfMemory(ctx);
+            return NULL;
+        }
+        os_poll_update(ts, ts->async_queue->read_fd, OS_POLL_KIND_ASYNC,
+                       0, OS_POLL_READ);
+    }
+    req = malloc(sizeof(*req));
+    if (!req) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    memset(req, 0, sizeof(*req));
+    req->op = op;
+    req->fd = -1;
+    dbuf_init(&req->names);
+    req->buffer_obj = JS_UNDEFINED;
+    *ppromise = JS_NewPromiseCapability(ctx, req->resolving_funcs);
+    if (JS_IsException(*ppromise)) {
+        os_async_req_free(req);
+        return NULL;
+    }
+    return req;
+}
+
+static void os_async_req_free_values(JSRuntime *rt, JSOSAsyncRequest *req)
+{
+    JS_FreeValueRT(rt, req->resolving_funcs[0]);
+    JS_FreeValueRT(rt, req->resolving_funcs[1]);
+    JS_FreeValueRT(rt, req->buffer_obj);
+    req->resolving_funcs[0] = JS_UNDEFINED;
+    req->resolving_funcs[1] = JS_UNDEFINED;
+    req->buffer_obj = JS_UNDEFINED;
+}
+
+static JSValue os_async_start(JSContext *ctx, JSOSAsyncRequest *req,
+                              JSValue promise)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSOSAsyncQueue *q = ts->async_queue;
+
+    req->queue = q;
+    pthread_mutex_lock(&q->mutex);
+    q->ref_count++;
+    pthread_mutex_unlock(&q->mutex);
+    list_add_tail(&req->pending_link, &ts->async_requests);
+    if (req->op == OS_ASYNC_TASK)
+        worker_pool_submit(req->pool, req);
+    else
+        os_async_submit(req);
+    return promise;
+}
+
+static JSValue os_async_fail(JSContext *ctx, JSOSAsyncRequest *req,
+                             JSValue promise)
+{
+    os_async_req_free_values(JS_GetRuntime(ctx), req);
+    os_async_req_free(req);
+    JS_FreeValue(ctx, promise);
+    return JS_EXCEPTION;
+}
+
+/* return the value of a completed request */
+static JSValue os_async_get_result(JSContext *ctx, JSOSAsyncRequest *req)
+{
+    JSValue obj;
+    uint8_t *buf;
+    size_t size;
+    const char *p;
+    uint32_t i;
+
+    switch(req->op) {
+    case OS_ASYNC_READ:
+        if (req->ret > 0) {
+            /* the array buffer may have been detached or resized */
+            buf = JS_GetArrayBuffer(ctx, &size, req->buffer_obj);
+            if (!buf)
+                return JS_EXCEPTION;
+            if (req->pos + req->ret > size)
+                return JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+            memcpy(buf + req->pos, req->buf, req->ret);
+        }
+        return JS_NewInt64(ctx, req->ret);
+    case OS_ASYNC_WRITE:
+        return JS_NewInt64(ctx, req->ret);
+    case OS_ASYNC_STAT:
+    case OS_ASYNC_LSTAT:
+        if (req->err)
+            obj = JS_NULL;
+        else
+            obj = js_os_stat_obj(ctx, &req->st);
+        return make_obj_error(ctx, obj, req->err);
+    case OS_ASYNC_READDIR:
+        obj = JS_NewArray(ctx);
+        if (JS_IsException(obj))
+            return obj;
+        p = (const char *)req->names.buf;
+        for(i = 0; i < req->ret; i++) {
+            JS_DefinePropertyValueUint32(ctx, obj, i, JS_NewString(ctx, p),
+                                         JS_PROP_C_W_E);
+            p += strlen(p) + 1;
+        }
+        return make_obj_error(ctx, obj, req->err);
+    case OS_ASYNC_TASK:
+        if (req->error) {
+            obj = JS_NewError(ctx);
+            if (JS_IsException(obj))
+                return obj;
+            JS_DefinePropertyValueStr(ctx, obj, "message",
+                                      JS_NewString(ctx, req->error),
+                                      JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+            return JS_Throw(ctx, obj);
+        }
+        return js_read_message(ctx, req->msg);
+    default:
+        abort();
+    }
+}
+
+/* resolve the promise of 'req' with 'val' (rejected if exception)
+   and free 'req' */
+static void os_async_resolve(JSContext *ctx, JSOSAsyncRequest *req,
+                             JSValue val)
+{
+    JSValue ret;
+    int is_reject;
+
+    is_reject = JS_IsException(val);
+    if (is_reject)
+        val = JS_GetException(ctx);
+    ret = JS_Call(ctx, req->resolving_funcs[is_reject], JS_UNDEFINED,
+                  1, (JSValueConst *)&val);
+    JS_FreeValue(ctx, val);
+    if (JS_IsException(ret))
+        js_std_dump_error(ctx);
+    JS_FreeValue(ctx, ret);
+    os_async_req_free_values(JS_GetRuntime(ctx), req);
+    os_async_req_free(req);
+}
+
+/* resolve the promises of the completed requests */
+static void os_async_handle_done(JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSAsyncQueue *q = ts->async_queue;
+    struct list_head done_list, *el, *el1;
+    JSOSAsyncRequest *req;
+    uint8_t buf[16];
+
+    init_list_head(&done_list);
+    pthread_mutex_lock(&q->mutex);
+    for(;;) {
+        if (read(q->read_fd, buf, sizeof(buf)) >= 0 || errno != EINTR)
+            break;
+    }
+    list_splice_tail(&q->done_list, &done_list);
+    init_list_head(&q->done_list);
+    pthread_mutex_unlock(&q->mutex);
+
+    list_for_each_safe(el, el1, &done_list) {
+        req = list_entry(el, JSOSAsyncRequest, link);
+        list_del(&req->pending_link);
+        os_async_resolve(ctx, req, os_async_get_result(ctx, req));
+    }
+}
+
+/* Pipes, sockets and terminals may block a thread indefinitely, so
+   the corresponding requests wait in the event loop until their file
+   descriptor is ready. The data is then read or written directly in
+   the array buffer. */
+
+static JSValue os_async_wait_fd(JSContext *ctx, JSOSAsyncRequest *req,
+                                JSValue promise, int magic)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSOSRWHandler *rh;
+    int old_events;
+
+    rh = get_rh(ctx, ts, req->fd);
+    if (!rh)
+        return os_async_fail(ctx, req, promise);
+    old_events = rh_get_events(rh);
+    list_add_tail(&req->link, &rh->async_requests[magic]);
+    list_add_tail(&req->pending_link, &ts->async_requests);
+    os_poll_update(ts, req->fd, OS_POLL_KIND_RW, old_events,
+                   rh_get_events(rh));
+    return promise;
+}
+
+/* execute the first request waiting for 'rh' to be ready for reading
+   (magic = 0) or writing (magic = 1) */
+static void os_async_fd_ready(JSContext *ctx, JSOSRWHandler *rh, int magic)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSAsyncRequest *req;
+    JSValue val;
+    uint8_t *buf;
+    size_t size;
+    ssize_t ret;
+    int old_events, events;
+
+    old_events = rh_get_events(rh);
+    req = list_entry(rh->async_requests[magic].next, JSOSAsyncRequest, link);
+    list_del(&req->link);
+    list_del(&req->pending_link);
+
+    /* the array buffer may have been detached or resized */
+    buf = JS_GetArrayBuffer(ctx, &size, req->buffer_obj);
+    if (!buf) {
+        val = JS_EXCEPTION;
+    } else if (req->pos + req->len > size) {
+        val = JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+    } else {
+        if (magic)
+            ret = write(req->fd, buf + req->pos, req->len);
+        else
+            ret = read(req->fd, buf + req->pos, req->len);
+        val = JS_NewInt64(ctx, js_get_errno(ret));
+    }
+
+    events = rh_get_events(rh);
+    if (events != old_events) {
+        os_poll_update(ts, rh->fd, OS_POLL_KIND_RW, old_events, events);
+        if (events == 0)
+            free_rw_handler(rt, rh);
+    }
+    os_async_resolve(ctx, req, val);
+}
+
+/* free the requests waiting for 'rh' without resolving their promise */
+static void os_async_fd_free(JSRuntime *rt, JSOSRWHandler *rh)
+{
+    struct list_head *el, *el1;
+    JSOSAsyncRequest *req;
+    int i;
+
+    for(i = 0; i < 2; i++) {
+        list_for_each_safe(el, el1, &rh->async_requests[i]) {
+            req = list_entry(el, JSOSAsyncRequest, link);
+            list_del(&req->link);
+            list_del(&req->pending_link);
+            os_async_req_free_values(rt, req);
+            os_async_req_free(req);
+        }
+    }
+}
+
+/* the requests being executed complete without resolving their promise */
+static void os_async_close(JSRuntime *rt, JSThreadState *ts)
+{
+    JSOSAsyncQueue *q = ts->async_queue;
+    struct list_head *el, *el1;
+    JSOSAsyncRequest *req;
+
+    if (!q)
+        return;
+    list_for_each_safe(el, el1, &ts->async_requests) {
+        req = list_entry(el, JSOSAsyncRequest, pending_link);
+        list_del(&req->pending_link);
+        os_async_req_free_values(rt, req);
+    }
+    pthread_mutex_lock(&q->mutex);
+    q->closed = TRUE;
+    list_for_each_safe(el, el1, &q->done_list) {
+        req = list_entry(el, JSOSAsyncRequest, link);
+        list_del(&req->link);
+        os_async_req_free(req);
+    }
+    os_async_queue_unref(q);
+    ts->async_queue = NULL;
+}
+
+/* readAsync(fd, buffer, offset, length), writeAsync(fd, buffer, offset,
+   length): return a promise resolving to the result of os.read() or
+   os.write() */
+static JSValue js_os_read_write_async(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv, int magic)
+{
+    JSOSAsyncRequest *req;
+    JSValue promise;
+    int fd;
+    uint64_t pos, len;
+    size_t size;
+    uint8_t *buf;
+    struct stat st;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &pos, argv[2]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &len, argv[3]))
+        return JS_EXCEPTION;
+    buf = JS_GetArrayBuffer(ctx, &size, argv[1]);
+    if (!buf)
+        return JS_EXCEPTION;
+    if (pos + len > size)
+        return JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+    req = os_async_req_new(ctx, magic ? OS_ASYNC_WRITE : OS_ASYNC_READ,
+                           &promise);
+    if (!req)
+        return JS_EXCEPTION;
+    req->fd = fd;
+    req->len = len;
+    req->pos = pos;
+    if (fstat(fd, &st) == 0 &&
+        (S_ISFIFO(st.st_mode) || S_ISSOCK(st.st_mode) ||
+         S_ISCHR(st.st_mode))) {
+        /* a ready descriptor may still block when writing more than
+           PIPE_BUF bytes, so the write may be partial */
+        if (magic)
+            req->len = min_int(len, PIPE_BUF);
+        req->buffer_obj = JS_DupValue(ctx, argv[1]);
+        return os_async_wait_fd(ctx, req, promise, magic);
+    }
+    /* the thread uses a copy of the data because the array buffer
+       may be freed, detached or resized by the runtime thread while
+       the request is executed */
+    req->buf = malloc(len ? len : 1);
+    if (!req->buf) {
+        JS_ThrowOutOfMemory(ctx);
+        return os_async_fail(ctx, req, promise);
+    }
+    if (magic)
+        memcpy(req->buf, buf + pos, len);
+    else
+        req->buffer_obj = JS_DupValue(ctx, argv[1]);
+    return os_async_start(ctx, req, promise);
+}
+
+/* statAsync(path), lstatAsync(path), readdirAsync(path): return a
+   promise resolving to the result of os.stat(), os.lstat() or
+   os.readdir() */
+static JSValue js_os_path_async(JSContext *ctx, JSValueConst this_val,
+                                int argc, JSValueConst *argv, int magic)
+{
+    JSOSAsyncRequest *req;
+    JSValue promise;
+    const char *path;
+
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    req = os_async_req_new(ctx, magic, &promise);
+    if (!req) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    req->path = strdup(path);
+    JS_FreeCString(ctx, path);
+    if (!req->path) {
+        JS_ThrowOutOfMemory(ctx);
+        return os_async_fail(ctx, req, promise);
+    }
+    return os_async_start(ctx, req, promise);
+}
+
+/* Worker pool */
+
+/* Each thread of the pool runs its own runtime and has its own queue
+   of tasks. The tasks are submitted to the threads in a round robin
+   way. A thread without queued task steals the last task of the
+   thread which has the most queued tasks, so that the load is
+   balanced even if the execution time of the tasks differs. The
+   queues are small and only accessed when a task starts, hence they
+   are protected by a single mutex. A task is a JSOSAsyncRequest, so
+   its result is returned as for the asynchronous file I/O. */
+
+#define WORKER_POOL_SIZE_MAX 256
+
+typedef struct JSWorkerPoolThread {
+    JSWorkerPool *pool;
+    struct list_head task_list; /* list of JSOSAsyncRequest.link */
+    int task_count;
+    BOOL running; /* TRUE if a task is being executed */
+    /* statistics */
+    int64_t start_time; /* ns */
+    int64_t task_start_time; /* ns, start time of the current task */
+    int64_t busy_time; /* ns */
+    int64_t completed_count;
+    int64_t stolen_count;
+} JSWorkerPoolThread;
+
+struct JSWorkerPool {
+    int ref_count; /* the pool object and each thread, protected by mutex */
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    BOOL closed; /* no more tasks are accepted */
+    int idle_count;
+    int next_thread; /* thread of the next submitted task */
+    char *filename; /* module filename */
+    char *basename; /* module base name */
+    int thread_count;
+    JSWorkerPoolThread threads[0];
+};
+
+static JSClassID js_worker_pool_class_id;
+
+/* must be called with pool->mutex locked. It is unlocked. */
+static void worker_pool_unref(JSWorkerPool *pool)
+{
+    int ref_count = --pool->ref_count;
+    pthread_mutex_unlock(&pool->mutex);
+    if (ref_count == 0) {
+        pthread_mutex_destroy(&pool->mutex);
+        pthread_cond_destroy(&pool->cond);
+        free(pool->filename);
+        free(pool->basename);
+        free(pool);
+    }
+}
+
+/* must be called with pool->mutex locked */
+static void worker_pool_close(JSWorkerPool *pool)
+{
+    pool->closed = TRUE;
+    /* the idle threads exit once all the queued tasks are executed */
+    pthread_cond_broadcast(&pool->cond);
+}
+
+static void worker_pool_submit(JSWorkerPool *pool, JSOSAsyncRequest *req)
+{
+    JSWorkerPoolThread *th;
+
+    pthread_mutex_lock(&pool->mutex);
+    th = &pool->threads[pool->next_thread];
+    if (++pool->next_thread == pool->thread_count)
+        pool->next_thread = 0;
+    list_add_tail(&req->link, &th->task_list);
+    th->task_count++;
+    if (pool->idle_count > 0)
+        pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/* return the next task of 'th' or NULL if the pool is closed and no
+   task remains */
+static JSOSAsyncRequest *worker_pool_get_task(JSWorkerPoolThread *th)
+{
+    JSWorkerPool *pool = th->pool;
+    JSWorkerPoolThread *th1, *victim;
+    JSOSAsyncRequest *req;
+    int i;
+
+    pthread_mutex_lock(&pool->mutex);
+    for(;;) {
+        if (th->task_count > 0) {
+            req = list_entry(th->task_list.next, JSOSAsyncRequest, link);
+            victim = th;
+            break;
+        }
+        victim = NULL;
+        for(i = 0; i < pool->thread_count; i++) {
+            th1 = &pool->threads[i];
+            if (th1->task_count > 0 &&
+                (!victim || th1->task_count > victim->task_count))
+                victim = th1;
+        }
+        if (victim) {
+            req = list_entry(victim->task_list.prev, JSOSAsyncRequest, link);
+            th->stolen_count++;
+            break;
+        }
+        if (pool->closed) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+        pool->idle_count++;
+        pthread_cond_wait(&pool->cond, &pool->mutex);
+        pool->idle_count--;
+    }
+    list_del(&req->link);
+    victim->task_count--;
+    th->running = TRUE;
+    th->task_start_time = get_time_ns();
+    pthread_mutex_unlock(&pool->mutex);
+    return req;
+}
+
+/* call the task handler with the task argument. The result or the
+   exception message is stored in 'req'. */
+static void worker_pool_run_task(JSContext *ctx, JSOSAsyncRequest *req)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSValue data, func, ret, err, val;
+    const char *str;
+
+    data = js_read_message(ctx, req->msg);
+    js_free_message(req->msg);
+    req->msg = NULL;
+    if (JS_IsException(data))
+        goto exception;
+    if (!JS_IsFunction(ctx, ts->task_func)) {
+        JS_FreeValue(ctx, data);
+        JS_ThrowTypeError(ctx, "no task handler");
+        goto exception;
+    }
+    /* the handler may be modified by the call */
+    func = JS_DupValue(ctx, ts->task_func);
+    ret = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst *)&data);
+    JS_FreeValue(ctx, func);
+    JS_FreeValue(ctx, data);
+    ret = js_std_await(ctx, ret);
+    if (JS_IsException(ret))
+        goto exception;
+    req->msg = js_new_message(ctx, ret, JS_UNDEFINED);
+    JS_FreeValue(ctx, ret);
+    if (req->msg)
+        return;
+ exception:
+    err = JS_GetException(ctx);
+    if (JS_IsError(ctx, err)) {
+        val = JS_GetPropertyStr(ctx, err, "message");
+        str = JS_ToCString(ctx, val);
+        JS_FreeValue(ctx, val);
+    } else {
+        str = JS_ToCString(ctx, err);
+    }
+    JS_FreeValue(ctx, err);
+    if (str) {
+        req->error = strdup(str);
+        JS_FreeCString(ctx, str);
+    } else {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    if (!req->error)
+        req->error = strdup("task failure");
+}
+
+static void *worker_pool_func(void *opaque)
+{
+    JSWorkerPoolThread *th = opaque;
+    JSWorkerPool *pool = th->pool;
+    JSRuntime *rt;
+    JSThreadState *ts;
+    JSContext *ctx;
+    JSOSAsyncRequest *req;
+    JSValue val;
+    int64_t end_time;
+
+    rt = JS_NewRuntime();
+    if (rt == NULL) {
+        fprintf(stderr, "JS_NewRuntime failure");
+        exit(1);
+    }
+    js_std_init_handlers(rt);
+
+    JS_SetModuleLoaderFunc(rt, NULL, js_module_loader, NULL);
+
+    ts = JS_GetRuntimeOpaque(rt);
+    ts->pool_thread = th;
+
+    ctx = js_worker_new_context_func(rt);
+    if (ctx == NULL) {
+        fprintf(stderr, "JS_NewContext failure");
+    }
+
+    JS_SetCanBlock(rt, TRUE);
+
+    js_std_add_helpers(ctx, -1, NULL);
+
+    /* the module sets the task handler with os.setTaskHandler() */
+    val = JS_LoadModule(ctx, pool->basename, pool->filename);
+    val = js_std_await(ctx, val);
+    if (JS_IsException(val))
+        js_std_dump_error(ctx);
+    JS_FreeValue(ctx, val);
+
+    while ((req = worker_pool_get_task(th)) != NULL) {
+        worker_pool_run_task(ctx, req);
+        end_time = get_time_ns();
+
+        pthread_mutex_lock(&pool->mutex);
+        th->running = FALSE;
+        th->busy_time += end_time - th->task_start_time;
+        th->completed_count++;
+        pthread_mutex_unlock(&pool->mutex);
+
+        os_async_complete(req);
+    }
+
+    JS_FreeContext(ctx);
+    js_std_free_handlers(rt);
+    JS_FreeRuntime(rt);
+
+    pthread_mutex_lock(&pool->mutex);
+    worker_pool_unref(pool);
+    return NULL;
+}
+
+static void js_worker_pool_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSWorkerPool *pool = JS_GetOpaque(val, js_worker_pool_class_id);
+    if (pool) {
+        pthread_mutex_lock(&pool->mutex);
+        worker_pool_close(pool);
+        worker_pool_unref(pool);
+    }
+}
+
+static JSClassDef js_worker_pool_class = {
+    "WorkerPool",
+    .finalizer = js_worker_pool_finalizer,
+};
+
+/* WorkerPool(module_filename[, size]) */
+static JSValue js_worker_pool_ctor(JSContext *ctx, JSValueConst new_target,
+                                   int argc, JSValueConst *argv)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSWorkerPool *pool = NULL;
+    JSWorkerPoolThread *th;
+    pthread_t tid;
+    pthread_attr_t attr;
+    JSValue obj = JS_UNDEFINED, proto;
+    const char *filename = NULL, *basename = NULL;
+    JSAtom basename_atom;
+    int size, i, ret;
+    int64_t now;
+
+    if (!is_main_thread(rt))
+        return JS_ThrowTypeError(ctx, "cannot create a worker pool inside a worker");
+
+    if (argc >= 2 && !JS_IsUndefined(argv[1])) {
+        if (JS_ToInt32(ctx, &size, argv[1]))
+            return JS_EXCEPTION;
+        if (size < 1 || size > WORKER_POOL_SIZE_MAX)
+            return JS_ThrowRangeError(ctx, "invalid worker pool size");
+    } else {
+        /* one thread per processor */
+        size = min_int(max_int((int)sysconf(_SC_NPROCESSORS_ONLN), 1),
+                       WORKER_POOL_SIZE_MAX);
+    }
+
+    basename_atom = JS_GetScriptOrModuleName(ctx, 1);
+    if (basename_atom == JS_ATOM_NULL) {
+        return JS_ThrowTypeError(ctx, "could not determine calling script or module name");
+    }
+    basename = JS_AtomToCString(ctx, basename_atom);
+    JS_FreeAtom(ctx, basename_atom);
+    if (!basename)
+        goto fail;
+
+    filename = JS_ToCString(ctx, argv[0]);
+    if (!filename)
+        goto fail;
+
+    if (JS_IsUndefined(new_target)) {
+        proto = JS_GetClassProto(ctx, js_worker_pool_class_id);
+    } else {
+        proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+        if (JS_IsException(proto))
+            goto fail;
+    }
+    obj = JS_NewObjectProtoClass(ctx, proto, js_worker_pool_class_id);
+    JS_FreeValue(ctx, proto);
+    if (JS_IsException(obj))
+        goto fail;
+
+    pool = malloc(sizeof(*pool) + sizeof(pool->threads[0]) * size);
+    if (!pool)
+        goto oom_fail;
+    memset(pool, 0, sizeof(*pool) + sizeof(pool->threads[0]) * size);
+    pool->ref_count = 1;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    pool->thread_count = size;
+    pool->filename = strdup(filename);
+    pool->basename = strdup(basename);
+    JS_SetOpaque(obj, pool);
+    if (!pool->filename || !pool->basename)
+        goto oom_fail;
+
+    now = get_time_ns();
+    for(i = 0; i < size; i++) {
+        th = &pool->threads[i];
+        th->pool = pool;
+        init_list_head(&th->task_list);
+        th->start_time = now;
+    }
+
+    pthread_attr_init(&attr);
+    /* no join at the end */
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    for(i = 0; i < size; i++) {
+        pthread_mutex_lock(&pool->mutex);
+        pool->ref_count++;
+        pthread_mutex_unlock(&pool->mutex);
+        ret = pthread_create(&tid, &attr, worker_pool_func, &pool->threads[i]);
+        if (ret != 0) {
+            pthread_mutex_lock(&pool->mutex);
+            pool->ref_count--;
+            /* the started threads exit */
+            worker_pool_close(pool);
+            pthread_mutex_unlock(&pool->mutex);
+            break;
+        }
+    }
+    pthread_attr_destroy(&attr);
+    if (i < size) {
+        JS_ThrowTypeError(ctx, "could not create worker pool");
+        goto fail;
+    }
+    JS_FreeCString(ctx, basename);
+    JS_FreeCString(ctx, filename);
+    return obj;
+ oom_fail:
+    JS_ThrowOutOfMemory(ctx);
+ fail:
+    JS_FreeCString(ctx, basename);
+    JS_FreeCString(ctx, filename);
+    /* the pool is freed by the finalizer */
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+/* submit(data[, transfer]): return a promise resolving to the result
+   of the task handler called with a copy of 'data' */
+static JSValue js_worker_pool_submit(JSContext *ctx, JSValueConst this_val,
+                                     int argc, JSValueConst *argv)
+{
+    JSWorkerPool *pool = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    JSOSAsyncRequest *req;
+    JSWorkerMessage *msg;
+    JSValue promise;
+
+    if (!pool)
+        return JS_EXCEPTION;
+    /* only modified by the thread owning the pool object */
+    if (pool->closed)
+        return JS_ThrowTypeError(ctx, "worker pool is closed");
+    msg = js_new_message(ctx, argv[0], argc >= 2 ? argv[1] : JS_UNDEFINED);
+    if (!msg)
+        return JS_EXCEPTION;
+    req = os_async_req_new(ctx, OS_ASYNC_TASK, &promise);
+    if (!req) {
+        js_free_message(msg);
+        return JS_EXCEPTION;
+    }
+    req->pool = pool;
+    req->msg = msg;
+    return os_async_start(ctx, req, promise);
+}
+
+/* close(): the queued tasks are executed, then the threads exit */
+static JSValue js_worker_pool_close(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSWorkerPool *pool = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+
+    if (!pool)
+        return JS_EXCEPTION;
+    pthread_mutex_lock(&pool->mutex);
+    worker_pool_close(pool);
+    pthread_mutex_unlock(&pool->mutex);
+    return JS_UNDEFINED;
+}
+
+/* stats(): return the number of queued, running and completed tasks
+   and the statistics of each thread */
+static JSValue js_worker_pool_stats(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSWorkerPool *pool = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    JSWorkerPoolThread *th;
+    JSValue obj, tab, th_obj;
+    int64_t now, busy_time, elapsed, queued, running, completed;
+    int i;
+
+    if (!pool)
+        return JS_EXCEPTION;
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    tab = JS_NewArray(ctx);
+    if (JS_IsException(tab)) {
+        JS_FreeValue(ctx, obj);
+        return tab;
+    }
+    queued = running = completed = 0;
+    pthread_mutex_lock(&pool->mutex);
+    now = get_time_ns();
+    for(i = 0; i < pool->thread_count; i++) {
+        th = &pool->threads[i];
+        busy_time = th->busy_time;
+        if (th->running)
+            busy_time += now - th->task_start_time;
+        elapsed = now - th->start_time;
+        th_obj = JS_NewObject(ctx);
+        JS_DefinePropertyValueStr(ctx, th_obj, "queued",
+                                  JS_NewInt32(ctx, th->task_count),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, th_obj, "running",
+                                  JS_NewBool(ctx, th->running),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, th_obj, "completed",
+                                  JS_NewInt64(ctx, th->completed_count),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, th_obj, "stolen",
+                                  JS_NewInt64(ctx, th->stolen_count),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, th_obj, "busyTime",
+                                  JS_NewFloat64(ctx, (double)busy_time / 1e6),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, th_obj, "utilization",
+                                  JS_NewFloat64(ctx, elapsed > 0 ?
+                                                (double)busy_time / elapsed : 0),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, tab, i, th_obj, JS_PROP_C_W_E);
+        queued += th->task_count;
+        running += th->running;
+        completed += th->completed_count;
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    JS_DefinePropertyValueStr(ctx, obj, "queued", JS_NewInt64(ctx, queued),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "running", JS_NewInt64(ctx, running),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "completed",
+                              JS_NewInt64(ctx, completed), JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "workers", tab, JS_PROP_C_W_E);
+    return obj;
+}
+
+static JSValue js_worker_pool_get_size(JSContext *ctx, JSValueConst this_val)
+{
+    JSWorkerPool *pool = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    if (!pool)
+        return JS_EXCEPTION;
+    return JS_NewInt32(ctx, pool->thread_count);
+}
+
+static const JSCFunctionListEntry js_worker_pool_proto_funcs[] = {
+    JS_CFUNC_DEF("submit", 1, js_worker_pool_submit ),
+    JS_CFUNC_DEF("close", 0, js_worker_pool_close ),
+    JS_CFUNC_DEF("stats", 0, js_worker_pool_stats ),
+    JS_CGETSET_DEF("size", js_worker_pool_get_size, NULL ),
+};
+
+/* setTaskHandler(func): in a worker pool thread, set the function
+   called to execute the tasks */
+static JSValue js_os_setTaskHandler(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSValueConst func = argv[0];
+
+    if (!ts->pool_thread)
+        return JS_ThrowTypeError(ctx, "not in a worker pool thread");
+    if (!JS_IsFunction(ctx, func) && !JS_IsNull(func))
+        return JS_ThrowTypeError(ctx, "not a function");
+    JS_FreeValue(ctx, ts->task_func);
+    ts->task_func = JS_DupValue(ctx, func);
+    return JS_UNDEFINED;
+}
+
+#endif /* USE_WORKER */
+
+void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt))
+{
+#ifdef USE_WORKER
+    js_worker_new_context_func = func;
+#endif
+}
+
+#if defined(_WIN32)
+#define OS_PLATFORM "win32"
+#elif defined(__APPLE__)
+#define OS_PLATFORM "darwin"
+#elif defined(EMSCRIPTEN)
+#define OS_PLATFORM "js"
+#else
+#define OS_PLATFORM "linux"
+#endif
+
+#define OS_FLAG(x) JS_PROP_INT32_DEF(#x, x, JS_PROP_CONFIGURABLE )
+
+static const JSCFunctionListEntry js_os_funcs[] = {
+    JS_CFUNC_DEF("open", 2, js_os_open ),
+    OS_FLAG(O_RDONLY),
+    OS_FLAG(O_WRONLY),
+    OS_FLAG(O_RDWR),
+    OS_FLAG(O_APPEND),
+    OS_FLAG(O_CREAT),
+    OS_FLAG(O_EXCL),
+    OS_FLAG(O_TRUNC),
+#if defined(_WIN32)
+    OS_FLAG(O_BINARY),
+    OS_FLAG(O_TEXT),
+#endif
+    JS_CFUNC_DEF("close", 1, js_os_close ),
+    JS_CFUNC_DEF("seek", 3, js_os_seek ),
+    JS_CFUNC_MAGIC_DEF("read", 4, js_os_read_write, 0 ),
+    JS_CFUNC_MAGIC_DEF("write", 4, js_os_read_write, 1 ),
+#ifdef USE_WORKER
+    JS_CFUNC_MAGIC_DEF("readAsync", 4, js_os_read_write_async, 0 ),
+    JS_CFUNC_MAGIC_DEF("writeAsync", 4, js_os_read_write_async, 1 ),
+#endif
+    JS_CFUNC_DEF("isatty", 1, js_os_isatty ),
+    JS_CFUNC_DEF("ttyGetWinSize", 1, js_os_ttyGetWinSize ),
+    JS_CFUNC_DEF("ttySetRaw", 1, js_os_ttySetRaw ),
+    JS_CFUNC_DEF("remove", 1, js_os_remove ),
+    JS_CFUNC_DEF("rename", 2, js_os_rename ),
+    JS_CFUNC_MAGIC_DEF("setReadHandler", 2, js_os_setReadHandler, 0 ),
+    JS_CFUNC_MAGIC_DEF("setWriteHandler", 2, js_os_setReadHandler, 1 ),
+    JS_CFUNC_DEF("signal", 2, js_os_signal ),
+    OS_FLAG(SIGINT),
+    OS_FLAG(SIGABRT),
+    OS_FLAG(SIGFPE),
+    OS_FLAG(SIGILL),
+    OS_FLAG(SIGSEGV),
+    OS_FLAG(SIGTERM),
+#if !defined(_WIN32)
+    OS_FLAG(SIGQUIT),
+    OS_FLAG(SIGPIPE),
+    OS_FLAG(SIGALRM),
+    OS_FLAG(SIGUSR1),
+    OS_FLAG(SIGUSR2),
+    OS_FLAG(SIGCHLD),
+    OS_FLAG(SIGCONT),
+    OS_FLAG(SIGSTOP),
+    OS_FLAG(SIGTSTP),
+    OS_FLAG(SIGTTIN),
+    OS_FLAG(SIGTTOU),
+#endif
+    JS_CFUNC_DEF("now", 0, js_os_now ),
+    JS_CFUNC_DEF("setTimeout", 2, js_os_setTimeout ),
+    JS_CFUNC_DEF("clearTimeout", 1, js_os_clearTimeout ),
+    JS_CFUNC_DEF("sleepAsync", 1, js_os_sleepAsync ),
+    JS_PROP_STRING_DEF("platform", OS_PLATFORM, 0 ),
+    JS_CFUNC_DEF("getcwd", 0, js_os_getcwd ),
+    JS_CFUNC_DEF("chdir", 0, js_os_chdir ),
+    JS_CFUNC_DEF("mkdir", 1, js_os_mkdir ),
+    JS_CFUNC_DEF("readdir", 1, js_os_readdir ),
+#ifdef USE_WORKER
+    JS_CFUNC_MAGIC_DEF("readdirAsync", 1, js_os_path_async, OS_ASYNC_READDIR ),
+#endif
+    /* st_mode constants */
+    OS_FLAG(S_IFMT),
+    OS_FLAG(S_IFIFO),
+    OS_FLAG(S_IFCHR),
+    OS_FLAG(S_IFDIR),
+    OS_FLAG(S_IFBLK),
+    OS_FLAG(S_IFREG),
+#if !defined(_WIN32)
+    OS_FLAG(S_IFSOCK),
+    OS_FLAG(S_IFLNK),
+    OS_FLAG(S_ISGID),
+    OS_FLAG(S_ISUID),
+#endif
+    JS_CFUNC_MAGIC_DEF("stat", 1, js_os_stat, 0 ),
+    JS_CFUNC_DEF("utimes", 3, js_os_utimes ),
+    JS_CFUNC_DEF("sleep", 1, js_os_sleep ),
+    JS_CFUNC_DEF("realpath", 1, js_os_realpath ),
+#if !defined(_WIN32)
+    JS_CFUNC_MAGIC_DEF("lstat", 1, js_os_stat, 1 ),
+    JS_CFUNC_MAGIC_DEF("statAsync", 1, js_os_path_async, OS_ASYNC_STAT ),
+    JS_CFUNC_MAGIC_DEF("lstatAsync", 1, js_os_path_async, OS_ASYNC_LSTAT ),
+    JS_CFUNC_DEF("setTaskHandler", 1, js_os_setTaskHandler ),
+    JS_CFUNC_DEF("symlink", 2, js_os_symlink ),
+    JS_CFUNC_DEF("readlink", 1, js_os_readlink ),
+    JS_CFUNC_DEF("exec", 1, js_os_exec ),
+    JS_CFUNC_DEF("getpid", 0, js_os_getpid ),
+    JS_CFUNC_DEF("waitpid", 2, js_os_waitpid ),
+    OS_FLAG(WNOHANG),
+    JS_CFUNC_DEF("pipe", 0, js_os_pipe ),
+    JS_CFUNC_DEF("kill", 2, js_os_kill ),
+    JS_CFUNC_DEF("dup", 1, js_os_dup ),
+    JS_CFUNC_DEF("dup2", 2, js_os_dup2 ),
+#endif
+};
+
+static int js_os_init(JSContext *ctx, JSModuleDef *m)
+{
+    os_poll_func = js_os_poll;
+
+#ifdef USE_WORKER
+    {
+        JSRuntime *rt = JS_GetRuntime(ctx);
+        JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+        JSValue proto, obj;
+        /* Worker class */
+        JS_NewClassID(&js_worker_class_id);
+        JS_NewClass(JS_GetRuntime(ctx), js_worker_class_id, &js_worker_class);
+        proto = JS_NewObject(ctx);
+        JS_SetPropertyFunctionList(ctx, proto, js_worker_proto_funcs, countof(js_worker_proto_funcs));
+
+        obj = JS_NewCFunction2(ctx, js_worker_ctor, "Worker", 1,
+                               JS_CFUNC_constructor, 0);
+        JS_SetConstructor(ctx, obj, proto);
+
+        JS_SetClassProto(ctx, js_worker_class_id, proto);
 
         /* set 'Worker.parent' if necessary */
         if (ts->recv_pipe && ts->send_pipe) {
@@ -3779,6 +5533,22 @@ static int js_os_init(JSContext *ctx, JSModuleDef *m)
         }
 
         JS_SetModuleExport(ctx, m, "Worker", obj);
+
+        /* WorkerPool class */
+        JS_NewClassID(&js_worker_pool_class_id);
+        JS_NewClass(JS_GetRuntime(ctx), js_worker_pool_class_id,
+                    &js_worker_pool_class);
+        proto = JS_NewObject(ctx);
+        JS_SetPropertyFunctionList(ctx, proto, js_worker_pool_proto_funcs,
+                                   countof(js_worker_pool_proto_funcs));
+
+        obj = JS_NewCFunction2(ctx, js_worker_pool_ctor, "WorkerPool", 1,
+                               JS_CFUNC_constructor, 0);
+        JS_SetConstructor(ctx, obj, proto);
+
+        JS_SetClassProto(ctx, js_worker_pool_class_id, proto);
+
+        JS_SetModuleExport(ctx, m, "WorkerPool", obj);
     }
 #endif /* USE_WORKER */
 
@@ -3795,6 +5565,7 @@ JSModuleDef *js_init_module_os(JSContext *ctx, const char *module_name)
     JS_AddModuleExportList(ctx, m, js_os_funcs, countof(js_os_funcs));
 #ifdef USE_WORKER
     JS_AddModuleExport(ctx, m, "Worker");
+    JS_AddModuleExport(ctx, m, "WorkerPool");
 #endif
     return m;
 }
@@ -3863,9 +5634,15 @@ void js_std_init_handlers(JSRuntime *rt)
     memset(ts, 0, sizeof(*ts));
     init_list_head(&ts->os_rw_handlers);
     init_list_head(&ts->os_signal_handlers);
-    init_list_head(&ts->os_timers);
     init_list_head(&ts->port_list);
+    init_list_head(&ts->async_requests);
     ts->next_timer_id = 1;
+    ts->task_func = JS_UNDEFINED;
+#if defined(USE_EPOLL)
+    ts->poll_fd = epoll_create1(EPOLL_CLOEXEC);
+#elif defined(USE_KQUEUE)
+    ts->poll_fd = kqueue();
+#endif
 
     JS_SetRuntimeOpaque(rt, ts);
 
@@ -3897,21 +5674,122 @@ void js_std_free_handlers(JSRuntime *rt)
         free_sh(rt, sh);
     }
 
-    list_for_each_safe(el, el1, &ts->os_timers) {
-        JSOSTimer *th = list_entry(el, JSOSTimer, link);
-        free_timer(rt, th);
-    }
+    while (ts->timer_count > 0)
+        free_timer(rt, ts->timers[ts->timer_count - 1]);
+    js_free_rt(rt, ts->timers);
+    js_free_rt(rt, ts->timer_hash);
+    js_free_rt(rt, ts->rw_handler_tab);
+#ifdef USE_POLL_FD
+    os_poll_fd_close(ts);
+#endif
 
 #ifdef USE_WORKER
+    os_async_close(rt, ts);
     /* XXX: free port_list ? */
     js_free_message_pipe(ts->recv_pipe);
     js_free_message_pipe(ts->send_pipe);
+    JS_FreeValueRT(rt, ts->task_func);
 #endif
 
     free(ts);
     JS_SetRuntimeOpaque(rt, NULL); /* fail safe */
 }
 
+/* Runtime pool: each runtime contains a single context. Instead of
+   being freed, the runtimes returned to the pool are reset to the
+   state they had after 'new_context_func' with JS_ResetContext(). */
+struct JSRuntimePool {
+    JSContext *(*new_context_func)(JSRuntime *rt, void *opaque);
+    void *opaque;
+    int max_count;
+    int count;
+    JSContext **tab;
+};
+
+JSRuntimePool *js_std_pool_new(int max_count,
+                               JSContext *(*new_context_func)(JSRuntime *rt,
+                                                              void *opaque),
+                               void *opaque)
+{
+    JSRuntimePool *pool;
+
+    pool = malloc(sizeof(*pool));
+    if (!pool)
+        return NULL;
+    pool->new_context_func = new_context_func;
+    pool->opaque = opaque;
+    pool->max_count = max_count;
+    pool->count = 0;
+    pool->tab = malloc(sizeof(pool->tab[0]) * max_int(max_count, 1));
+    if (!pool->tab) {
+        free(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+static void js_std_pool_free_context(JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+
+    js_std_free_handlers(rt);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+void js_std_pool_free(JSRuntimePool *pool)
+{
+    int i;
+
+    for(i = 0; i < pool->count; i++)
+        js_std_pool_free_context(pool->tab[i]);
+    free(pool->tab);
+    free(pool);
+}
+
+/* return a context in its initial state or NULL if error */
+JSContext *js_std_pool_get(JSRuntimePool *pool)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+
+    if (pool->count > 0)
+        return pool->tab[--pool->count];
+    rt = JS_NewRuntime();
+    if (!rt)
+        return NULL;
+    js_std_init_handlers(rt);
+    ctx = pool->new_context_func(rt, pool->opaque);
+    if (!ctx)
+        goto fail;
+    if (JS_SetSnapshotBase(ctx)) {
+        JS_FreeContext(ctx);
+        goto fail;
+    }
+    return ctx;
+ fail:
+    js_std_free_handlers(rt);
+    JS_FreeRuntime(rt);
+    return NULL;
+}
+
+/* return a context obtained with js_std_pool_get() to the pool. The
+   pending jobs, timers and handlers are removed. */
+void js_std_pool_put(JSRuntimePool *pool, JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+
+    if (pool->count < pool->max_count) {
+        js_std_free_handlers(rt);
+        js_std_init_handlers(rt);
+        if (JS_ResetContext(ctx) == 0) {
+            pool->tab[pool->count++] = ctx;
+            return;
+        }
+    }
+    js_std_pool_free_context(ctx);
+}
+
 static void js_dump_obj(JSContext *ctx, FILE *f, JSValueConst val)
 {
     const char *str;
@@ -4008,7 +5886,9 @@ JSValue js_std_await(JSContext *ctx, JSValue obj)
             if (err < 0) {
                 js_std_dump_error(ctx1);
             }
-            if (os_poll_func)
+            /* the pending jobs are all executed before waiting for
+               the I/O or the timers */
+            if (err == 0 && os_poll_func)
                 os_poll_func(ctx);
         } else {
             /* not a promise */
@@ -4021,11 +5901,23 @@ JSValue js_std_await(JSContext *ctx, JSValue obj)
 
 void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                         int load_only)
+{
+    js_std_eval_binary2(ctx, buf, buf_len, load_only, NULL, 0);
+}
+
+/* same as js_std_eval_binary() with the functions output by qjsc -a */
+void js_std_eval_binary2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                         int load_only, JSAOTFunction * const *aot_tab,
+                         int aot_tab_len)
 {
     JSValue obj, val;
     obj = JS_ReadObject(ctx, buf, buf_len, JS_READ_OBJ_BYTECODE);
     if (JS_IsException(obj))
         goto exception;
+    if (aot_tab && JS_SetAOTFunctions(ctx, obj, aot_tab, aot_tab_len) < 0) {
+        JS_FreeValue(ctx, obj);
+        goto exception;
+    }
     if (load_only) {
         if (JS_VALUE_GET_TAG(obj) == JS_TAG_MODULE) {
             js_module_set_import_meta(ctx, obj, FALSE, FALSE);
@@ -4050,3 +5942,11 @@ void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
         JS_FreeValue(ctx, val);
     }
 }
+
+void js_std_read_snapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len)
+{
+    if (JS_ReadSnapshot(ctx, buf, buf_len) < 0) {
+        js_std_dump_error(ctx);
+        exit(1);
+    }
+}
@@ -48,11 +48,24 @@ JSModuleDef *js_module_loader(JSContext *ctx,
                               const char *module_name, void *opaque);
 void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                         int flags);
+void js_std_eval_binary2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                         int flags, JSAOTFunction * const *aot_tab,
+                         int aot_tab_len);
+void js_std_read_snapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len);
 void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
                                       JSValueConst reason,
                                       JS_BOOL is_handled, void *opaque);
 void js_std_set_worker_new_context_func(JSContext *(*func)(JSRuntime *rt));
 
+typedef struct JSRuntimePool JSRuntimePool;
+JSRuntimePool *js_std_pool_new(int max_count,
+                               JSContext *(*new_context_func)(JSRuntime *rt,
+                                                              void *opaque),
+                               void *opaque);
+void js_std_pool_free(JSRuntimePool *pool);
+JSContext *js_std_pool_get(JSRuntimePool *pool);
+void js_std_pool_put(JSRuntimePool *pool, JSContext *ctx);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
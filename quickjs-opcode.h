@@ -262,6 +262,10 @@ DEF(     private_in, 1, 2, 1, none)
 DEF(      mul_pow10, 1, 2, 1, none)
 DEF(       math_mod, 1, 2, 1, none)
 #endif
+/* field accesses with an inline cache index, emitted in phase 3 */
+DEF(   get_field_ic, 7, 1, 1, atom_u16)
+DEF(  get_field2_ic, 7, 1, 2, atom_u16)
+DEF(   put_field_ic, 7, 2, 0, atom_u16)
 /* must be the last non short and non temporary opcode */
 DEF(            nop, 1, 0, 0, none)
 
@@ -365,6 +369,12 @@ DEF(   is_undefined, 1, 1, 1, none)
 DEF(        is_null, 1, 1, 1, none)
 DEF(typeof_is_undefined, 1, 1, 1, none)
 DEF( typeof_is_function, 1, 1, 1, none)
+
+/* comparison followed by if_false8 */
+DEF(  lt_if_false8, 2, 2, 0, label8)
+DEF( lte_if_false8, 2, 2, 0, label8)
+DEF(  gt_if_false8, 2, 2, 0, label8)
+DEF(strict_eq_if_false8, 2, 2, 0, label8)
 #endif
 
 #undef DEF
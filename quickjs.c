@@ -105,6 +105,8 @@
 //#define DUMP_MODULE_RESOLVE
 //#define DUMP_PROMISE
 //#define DUMP_READ_OBJECT
+/* count the executed opcodes and opcode pairs (see JS_DumpOpcodeStats()) */
+//#define DUMP_OPCODE_STATS
 
 /* test the GC by forcing it before each object allocation */
 //#define FORCE_GC_AT_MALLOC
@@ -207,11 +209,13 @@ typedef enum JSErrorEnum {
 typedef struct JSShape JSShape;
 typedef struct JSString JSString;
 typedef struct JSString JSAtomStruct;
+typedef struct JSSnapshotBase JSSnapshotBase;
 
 typedef enum {
     JS_GC_PHASE_NONE,
     JS_GC_PHASE_DECREF,
     JS_GC_PHASE_REMOVE_CYCLES,
+    JS_GC_PHASE_TEARDOWN, /* the objects are released with the slab chunks */
 } JSGCPhaseEnum;
 
 typedef enum OPCodeEnum OPCodeEnum;
@@ -234,6 +238,13 @@ typedef struct {
     int (*mul_pow10)(JSContext *ctx, JSValue *sp);
 } JSNumericOperations;
 
+#ifdef DUMP_OPCODE_STATS
+typedef struct JSOpcodeStats {
+    uint64_t count[256];
+    uint64_t pair_count[256][256]; /* [previous opcode][opcode] */
+} JSOpcodeStats;
+#endif
+
 struct JSRuntime {
     JSMallocFunctions mf;
     JSMallocState malloc_state;
@@ -246,19 +257,34 @@ struct JSRuntime {
     uint32_t *atom_hash;
     JSAtomStruct **atom_array;
     int atom_free_index; /* 0 = none */
+    /* atoms created by JS_ReserveAtoms() after the predefined atoms */
+    int reserved_atom_count;
 
     int class_count;    /* size of class_array */
     JSClass *class_array;
 
     struct list_head context_list; /* list of JSContext.link */
-    /* list of JSGCObjectHeader.link. List of allocated GC objects (used
-       by the garbage collector) */
+    /* list of JSGCObjectHeader.link. List of the GC objects allocated
+       since the last garbage collection (young generation) */
     struct list_head gc_obj_list;
+    /* list of JSGCObjectHeader.link. List of the GC objects which
+       survived a garbage collection (old generation) */
+    struct list_head gc_old_obj_list;
     /* list of JSGCObjectHeader.link. Used during JS_FreeValueRT() */
     struct list_head gc_zero_ref_count_list;
     struct list_head tmp_obj_list; /* used during GC */
     JSGCPhaseEnum gc_phase : 8;
+    uint8_t gc_skip_mark; /* mark of the objects ignored by the GC */
     size_t malloc_gc_threshold;
+    /* a full collection is done when this size is reached */
+    size_t malloc_gc_full_threshold;
+    size_t gc_step_budget; /* 0 if the automatic GC is not incremental */
+    /* GC statistics (times in microseconds) */
+    int64_t gc_count;
+    int64_t gc_full_count;
+    int64_t gc_total_time;
+    int64_t gc_max_pause;
+    int64_t gc_last_pause;
 #ifdef DUMP_LEAKS
     struct list_head string_list; /* list of JSString.link */
 #endif
@@ -275,11 +301,18 @@ struct JSRuntime {
 
     JSInterruptHandler *interrupt_handler;
     void *interrupt_opaque;
+    struct JSProfiler *profiler; /* NULL if the CPU profiler is stopped */
+    struct JSHeapProfiler *heap_profiler; /* NULL if the heap profiler is stopped */
+#ifdef DUMP_OPCODE_STATS
+    struct JSOpcodeStats *opcode_stats;
+#endif
 
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
 
     struct list_head job_list; /* list of JSJobEntry.link */
+    struct list_head job_free_list; /* list of JSJobEntry.link */
+    int job_free_count;
 
     JSModuleNormalizeFunc *module_normalize_func;
     JSModuleLoaderFunc *module_loader_func;
@@ -288,6 +321,7 @@ struct JSRuntime {
     int64_t module_async_evaluation_next_timestamp;
 
     BOOL can_block : 8; /* TRUE if Atomics.wait can block */
+    BOOL lazy_functions : 8; /* TRUE if the inner functions are compiled lazily */
     /* used to allocate, free and clone SharedArrayBuffers */
     JSSharedArrayBufferFunctions sab_funcs;
 
@@ -456,6 +490,8 @@ struct JSContext {
                              const char *input, size_t input_len,
                              const char *filename, int flags, int scope_idx);
     void *user_opaque;
+    /* state recorded by JS_SetSnapshotBase() */
+    JSSnapshotBase *snapshot_base;
 };
 
 typedef union JSFloat64Union {
@@ -503,6 +539,30 @@ struct JSString {
     } u;
 };
 
+/* A string rope is the lazy concatenation of two strings. It is used
+   to build long strings in O(1) per concatenation. The leaves are
+   JS_TAG_STRING values and are never empty. The rope is linearized
+   when its contents are needed (indexing, atoms, native code) and the
+   result is kept in 'left' so that it is only done once. */
+typedef struct JSStringRope {
+    JSRefCountHeader header; /* must come first, 32-bit */
+    uint32_t len;
+    uint8_t is_wide_char; /* 0 = 8 bits, 1 = 16 bits characters */
+    uint8_t depth; /* depth of the tree, the leaves have a depth of 0 */
+    JSValue left; /* JS_TAG_STRING or JS_TAG_STRING_ROPE */
+    JSValue right; /* JS_UNDEFINED if linearized */
+} JSStringRope;
+
+#define JS_VALUE_GET_STRING_ROPE(v) ((JSStringRope *)JS_VALUE_GET_PTR(v))
+
+/* shorter strings are concatenated to a flat string */
+#define JS_STRING_ROPE_SHORT_LEN  512
+/* a short string is appended to the nearest leaf of a rope if the
+   resulting leaf is not longer than this length */
+#define JS_STRING_ROPE_SHORT2_LEN 8192
+/* ropes of larger depth are rebalanced */
+#define JS_STRING_ROPE_MAX_DEPTH  60
+
 typedef struct JSClosureVar {
     uint8_t is_local : 1;
     uint8_t is_arg : 1;
@@ -582,6 +642,30 @@ typedef enum JSFunctionKindEnum {
     JS_FUNC_ASYNC_GENERATOR = (JS_FUNC_GENERATOR | JS_FUNC_ASYNC),
 } JSFunctionKindEnum;
 
+/* number of receiver shapes remembered by each inline cache */
+#define JS_IC_WAYS 4
+/* maximum number of inline caches in a function */
+#define JS_IC_MAX_COUNT 0xffff
+
+/* An inline cache entry is valid if the receiver has the shape
+   'shape'. The shapes are always hashed and referenced by the entry,
+   so they cannot be reused for another object layout. Because of this
+   reference, js_shape_prepare_update() clones the shape of a modified
+   object instead of updating it in place, hence the entry no longer
+   matches it. */
+typedef struct JSInlineCacheEntry {
+    JSShape *shape; /* receiver shape, NULL if the entry is unused */
+    /* shape of the prototype of the receiver if the property is
+       found in it, NULL if it is an own property */
+    JSShape *proto_shape;
+    uint32_t prop_idx; /* index of the property in JSObject.prop */
+} JSInlineCacheEntry;
+
+typedef struct JSInlineCache {
+    JSInlineCacheEntry entries[JS_IC_WAYS];
+    uint32_t next_entry; /* entry replaced by the next update */
+} JSInlineCache;
+
 typedef struct JSFunctionBytecode {
     JSGCObjectHeader header; /* must come first */
     uint8_t js_mode;
@@ -599,7 +683,12 @@ typedef struct JSFunctionBytecode {
     uint8_t backtrace_barrier : 1; /* stop backtrace on this function */
     uint8_t read_only_bytecode : 1;
     uint8_t is_direct_or_indirect_eval : 1; /* used by JS_GetScriptOrModuleName() */
-    /* XXX: 10 bits available */
+    /* not compiled yet: the bytecode is in cpool[0] once compiled */
+    uint8_t is_lazy : 1;
+    uint8_t lazy_is_arrow : 1;
+    uint8_t lazy_is_func_expr : 1;
+    uint8_t lazy_is_module : 1;
+    /* XXX: 6 bits available */
     uint8_t *byte_code_buf; /* (self pointer) */
     int byte_code_len;
     JSAtom func_name;
@@ -613,6 +702,9 @@ typedef struct JSFunctionBytecode {
     JSValue *cpool; /* constant pool (self pointer) */
     int cpool_count;
     int closure_var_count;
+    int ic_count; /* number of OP_xxx_ic opcodes */
+    JSInlineCache *ic; /* allocated on the first cache update, NULL otherwise */
+    JSAOTFunction *aot_func; /* set by JS_SetAOTFunctions() */
     struct {
         /* debug info, move to separate structure to save memory? */
         JSAtom filename;
@@ -830,10 +922,20 @@ typedef struct JSJobEntry {
     struct list_head link;
     JSContext *ctx;
     JSJobFunc *job_func;
+    /* if not NULL, the job resumes this async function after an
+       'await' instead of calling 'job_func'. argv[0] is the awaited
+       value and argv[1] is TRUE if it must be thrown. */
+    JSAsyncFunctionState *async_func;
     int argc;
     JSValue argv[0];
 } JSJobEntry;
 
+/* the job entries with at most JS_JOB_POOL_ARGC arguments are
+   allocated with JS_JOB_POOL_ARGC arguments and at most
+   JS_JOB_POOL_SIZE free entries are kept for reuse */
+#define JS_JOB_POOL_ARGC 5
+#define JS_JOB_POOL_SIZE 64
+
 typedef struct JSProperty {
     union {
         JSValue value;      /* JS_PROP_NORMAL */
@@ -905,7 +1007,7 @@ struct JSObject {
     JSShape *shape; /* prototype and property names + flag */
     JSProperty *prop; /* array of properties */
     /* byte offsets: 24/40 */
-    struct JSMapRecord *first_weak_ref; /* XXX: use a bit and an external hash table? */
+    struct JSMapWeakRef *first_weak_ref; /* XXX: use a bit and an external hash table? */
     /* byte offsets: 28/48 */
     union {
         void *opaque;
@@ -1021,6 +1123,8 @@ static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
                                int atom_type);
 static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p);
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b);
+static int js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b);
+static int js_lazy_function_init(JSContext *ctx, JSObject *p);
 static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
                                   JSValueConst this_obj,
                                   int argc, JSValueConst *argv, int flags);
@@ -1121,6 +1225,14 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
 static JSValue js_regexp_constructor_internal(JSContext *ctx, JSValueConst ctor,
                                               JSValue pattern, JSValue bc);
 static void gc_decref(JSRuntime *rt);
+static void gc_free_with_cycles(JSRuntime *rt, JSGCObjectHeader *p);
+static struct list_head *gc_obj_next(JSRuntime *rt, struct list_head *el);
+static void js_heap_profiler_alloc(JSContext *ctx, JSObject *p);
+static void js_heap_profiler_free(JSRuntime *rt, JSObject *p);
+/* iterate over the GC objects of both generations */
+#define list_for_each_gc_obj(el, rt)                                    \
+    for(el = gc_obj_next(rt, &(rt)->gc_obj_list);                       \
+        el != &(rt)->gc_old_obj_list; el = gc_obj_next(rt, el))
 static int JS_NewClass1(JSRuntime *rt, JSClassID class_id,
                         const JSClassDef *class_def, JSAtom name);
 
@@ -1192,6 +1304,10 @@ static JSValue js_array_buffer_constructor3(JSContext *ctx,
                                             JSFreeArrayBufferDataFunc *free_func,
                                             void *opaque, BOOL alloc_flag);
 static JSArrayBuffer *js_get_array_buffer(JSContext *ctx, JSValueConst obj);
+static int js_array_buffer_transfer(JSContext *ctx, JSValueConst *transfer_list,
+                                    uint8_t **transfer_data, int transfer_len);
+static void js_array_buffer_free_transferred(JSRuntime *rt, void *opaque,
+                                             void *ptr);
 static JSValue js_typed_array_constructor(JSContext *ctx,
                                           JSValueConst this_val,
                                           int argc, JSValueConst *argv,
@@ -1200,6 +1316,9 @@ static JSValue js_typed_array_constructor_ta(JSContext *ctx,
                                              JSValueConst new_target,
                                              JSValueConst src_obj,
                                              int classid);
+static JSValue js_dataview_constructor(JSContext *ctx,
+                                       JSValueConst new_target,
+                                       int argc, JSValueConst *argv);
 static BOOL typed_array_is_detached(JSContext *ctx, JSObject *p);
 static uint32_t typed_array_get_length(JSContext *ctx, JSObject *p);
 static JSValue JS_ThrowTypeErrorDetachedArrayBuffer(JSContext *ctx);
@@ -1223,6 +1342,9 @@ static void js_mark_module_def(JSRuntime *rt, JSModuleDef *m,
 static JSValue js_import_meta(JSContext *ctx);
 static JSValue js_dynamic_import(JSContext *ctx, JSValueConst specifier);
 static void free_var_ref(JSRuntime *rt, JSVarRef *var_ref);
+static void js_snapshot_base_free(JSRuntime *rt, JSSnapshotBase *base);
+static void js_snapshot_base_mark(JSRuntime *rt, JSSnapshotBase *base,
+                                  JS_MarkFunc *mark_func);
 static JSValue js_new_promise_capability(JSContext *ctx,
                                          JSValue *resolving_funcs,
                                          JSValueConst ctor);
@@ -1230,6 +1352,12 @@ static __exception int perform_promise_then(JSContext *ctx,
                                             JSValueConst promise,
                                             JSValueConst *resolve_reject,
                                             JSValueConst *cap_resolving_funcs);
+static int js_async_function_await_fast(JSContext *ctx,
+                                        JSAsyncFunctionState *s,
+                                        JSValueConst value);
+static void js_async_function_resume_job(JSContext *ctx,
+                                         JSAsyncFunctionState *s,
+                                         JSValueConst value, BOOL is_reject);
 static JSValue js_promise_resolve(JSContext *ctx, JSValueConst this_val,
                                   int argc, JSValueConst *argv, int magic);
 static JSValue js_promise_then(JSContext *ctx, JSValueConst this_val,
@@ -1300,9 +1428,29 @@ static void js_trigger_gc(JSRuntime *rt, size_t size)
         printf("GC: size=%" PRIu64 "\n",
                (uint64_t)rt->malloc_state.malloc_size);
 #endif
+#ifdef FORCE_GC_AT_MALLOC
         JS_RunGC(rt);
-        rt->malloc_gc_threshold = rt->malloc_state.malloc_size +
-            (rt->malloc_state.malloc_size >> 1);
+#else
+        /* the cycles involving old objects are only collected by the
+           full collections or the incremental steps */
+        if (rt->gc_step_budget != 0) {
+            JS_RunGCStep(rt, rt->gc_step_budget);
+        } else if ((rt->malloc_state.malloc_size + size) >
+                   rt->malloc_gc_full_threshold) {
+            JS_RunGC(rt);
+        } else {
+            JS_RunGCStep(rt, 0);
+        }
+#endif
+        size = rt->malloc_state.malloc_size >> 1;
+        if (rt->gc_step_budget != 0) {
+            /* bound the size of the young generation so that the
+               pauses stay proportional to the budget */
+            size_t max_size = rt->gc_step_budget * 2 * sizeof(JSObject);
+            if (size > max_size)
+                size = max_size;
+        }
+        rt->malloc_gc_threshold = rt->malloc_state.malloc_size + size;
     }
 }
 
@@ -1642,6 +1790,7 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     }
     rt->malloc_state = ms;
     rt->malloc_gc_threshold = 256 * 1024;
+    rt->malloc_gc_full_threshold = 2 * rt->malloc_gc_threshold;
 
     bf_context_init(&rt->bf_ctx, js_bf_realloc, rt);
     set_dummy_numeric_ops(&rt->bigint_ops);
@@ -1652,6 +1801,7 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
 
     init_list_head(&rt->context_list);
     init_list_head(&rt->gc_obj_list);
+    init_list_head(&rt->gc_old_obj_list);
     init_list_head(&rt->gc_zero_ref_count_list);
     rt->gc_phase = JS_GC_PHASE_NONE;
 
@@ -1659,6 +1809,7 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     init_list_head(&rt->string_list);
 #endif
     init_list_head(&rt->job_list);
+    init_list_head(&rt->job_free_list);
 
     if (JS_InitAtoms(rt))
         goto fail;
@@ -1682,6 +1833,11 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     JS_UpdateStackTop(rt);
 
     rt->current_exception = JS_NULL;
+#ifdef DUMP_OPCODE_STATS
+    rt->opcode_stats = js_mallocz_rt(rt, sizeof(*rt->opcode_stats));
+    if (!rt->opcode_stats)
+        goto fail;
+#endif
 
     return rt;
  fail:
@@ -1779,11 +1935,250 @@ static const JSMallocFunctions def_malloc_funcs = {
     js_def_malloc_usable_size,
 };
 
+/* Size-class slab allocator. The small blocks are allocated from
+   large chunks and are recycled with one free list per size
+   class. Each block is preceded by its size so that no
+   malloc_usable_size() call is needed. The larger blocks are allocated
+   with malloc() and linked together. The chunks and the large blocks
+   are released in bulk when the runtime is freed. */
+
+/* the header is 16 bytes long so that the payloads have the same 16
+   byte alignment as malloc() for long double or SSE types */
+#define JS_SLAB_HEADER_SIZE 16
+#define JS_SLAB_MAX_SIZE    1024 /* maximum block size, including the header */
+#define JS_SLAB_CHUNK_SIZE  (64 * 1024)
+
+/* the link of a large block precedes its header */
+#define JS_SLAB_LARGE_HEADER_SIZE 16
+
+typedef struct JSSlabChunk {
+    struct JSSlabChunk *next;
+} JSSlabChunk;
+
+typedef struct JSSlabLargeBlock {
+    struct list_head link;
+} JSSlabLargeBlock;
+
+typedef struct JSSlabState {
+    JSSlabChunk *chunk_list;
+    struct list_head large_list; /* list of JSSlabLargeBlock.link */
+    uint8_t *chunk_ptr; /* unused part of the current chunk */
+    uint8_t *chunk_end;
+    void *free_list[JS_SLAB_MAX_SIZE / 16];
+} JSSlabState;
+
+/* The blocks sizes are multiples of 16 and the chunks are 16 byte
+   aligned so that the payloads are 16 byte aligned */
+static inline size_t js_slab_block_size(size_t size)
+{
+    return (size + JS_SLAB_HEADER_SIZE + 15) & ~(size_t)15;
+}
+
+static inline size_t js_slab_get_size(const void *ptr)
+{
+    return *(const size_t *)((const uint8_t *)ptr - JS_SLAB_HEADER_SIZE);
+}
+
+static size_t js_slab_malloc_usable_size(const void *ptr)
+{
+    return js_slab_get_size(ptr) - JS_SLAB_HEADER_SIZE;
+}
+
+static void *js_slab_malloc(JSMallocState *s, size_t size)
+{
+    JSSlabState *ss = s->opaque;
+    size_t block_size;
+    uint8_t *ptr;
+    void **pfree;
+
+    assert(size != 0);
+
+    if (unlikely(size > SIZE_MAX / 2))
+        return NULL;
+    block_size = js_slab_block_size(size);
+    if (unlikely(s->malloc_size + block_size > s->malloc_limit))
+        return NULL;
+    if (block_size > JS_SLAB_MAX_SIZE) {
+        JSSlabLargeBlock *lb;
+        /* large blocks are allocated with malloc() */
+        lb = malloc(JS_SLAB_LARGE_HEADER_SIZE + block_size);
+        if (!lb)
+            return NULL;
+        list_add_tail(&lb->link, &ss->large_list);
+        ptr = (uint8_t *)lb + JS_SLAB_LARGE_HEADER_SIZE;
+    } else {
+        pfree = &ss->free_list[block_size / 16 - 1];
+        if (*pfree) {
+            ptr = *pfree;
+            *pfree = *(void **)(ptr + JS_SLAB_HEADER_SIZE);
+        } else {
+            if ((size_t)(ss->chunk_end - ss->chunk_ptr) < block_size) {
+                JSSlabChunk *c;
+                /* the end of the current chunk is lost */
+                c = malloc(JS_SLAB_CHUNK_SIZE);
+                if (!c)
+                    return NULL;
+                c->next = ss->chunk_list;
+                ss->chunk_list = c;
+                ss->chunk_ptr = (uint8_t *)c + 16;
+                ss->chunk_end = (uint8_t *)c + JS_SLAB_CHUNK_SIZE;
+            }
+            ptr = ss->chunk_ptr;
+            ss->chunk_ptr += block_size;
+        }
+    }
+    *(size_t *)ptr = block_size;
+    s->malloc_count++;
+    s->malloc_size += block_size;
+    return ptr + JS_SLAB_HEADER_SIZE;
+}
+
+static void js_slab_free(JSMallocState *s, void *ptr)
+{
+    JSSlabState *ss = s->opaque;
+    size_t block_size;
+    uint8_t *p;
+
+    if (!ptr)
+        return;
+    p = (uint8_t *)ptr - JS_SLAB_HEADER_SIZE;
+    block_size = js_slab_get_size(ptr);
+    s->malloc_count--;
+    s->malloc_size -= block_size;
+    if (block_size > JS_SLAB_MAX_SIZE) {
+        JSSlabLargeBlock *lb;
+        lb = (JSSlabLargeBlock *)(p - JS_SLAB_LARGE_HEADER_SIZE);
+        list_del(&lb->link);
+        free(lb);
+    } else {
+        void **pfree = &ss->free_list[block_size / 16 - 1];
+        *(void **)ptr = *pfree;
+        *pfree = p;
+    }
+}
+
+static void *js_slab_realloc(JSMallocState *s, void *ptr, size_t size)
+{
+    JSSlabState *ss = s->opaque;
+    size_t old_block_size, block_size, old_size;
+    uint8_t *new_ptr;
+
+    if (!ptr) {
+        if (size == 0)
+            return NULL;
+        return js_slab_malloc(s, size);
+    }
+    if (size == 0) {
+        js_slab_free(s, ptr);
+        return NULL;
+    }
+    if (unlikely(size > SIZE_MAX / 2))
+        return NULL;
+    old_block_size = js_slab_get_size(ptr);
+    block_size = js_slab_block_size(size);
+    if (block_size == old_block_size)
+        return ptr;
+    if (old_block_size > JS_SLAB_MAX_SIZE && block_size > JS_SLAB_MAX_SIZE) {
+        JSSlabLargeBlock *lb, *new_lb;
+        if (s->malloc_size + block_size - old_block_size > s->malloc_limit)
+            return NULL;
+        lb = (JSSlabLargeBlock *)((uint8_t *)ptr - JS_SLAB_HEADER_SIZE -
+                                  JS_SLAB_LARGE_HEADER_SIZE);
+        /* the block may move so it is relinked */
+        list_del(&lb->link);
+        new_lb = realloc(lb, JS_SLAB_LARGE_HEADER_SIZE + block_size);
+        if (!new_lb) {
+            list_add_tail(&lb->link, &ss->large_list);
+            return NULL;
+        }
+        list_add_tail(&new_lb->link, &ss->large_list);
+        new_ptr = (uint8_t *)new_lb + JS_SLAB_LARGE_HEADER_SIZE;
+        *(size_t *)new_ptr = block_size;
+        s->malloc_size += block_size - old_block_size;
+        return new_ptr + JS_SLAB_HEADER_SIZE;
+    }
+    new_ptr = js_slab_malloc(s, size);
+    if (!new_ptr)
+        return NULL;
+    old_size = old_block_size - JS_SLAB_HEADER_SIZE;
+    memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+    js_slab_free(s, ptr);
+    return new_ptr;
+}
+
+static const JSMallocFunctions slab_malloc_funcs = {
+    js_slab_malloc,
+    js_slab_free,
+    js_slab_realloc,
+    js_slab_malloc_usable_size,
+};
+
+/* free all the chunks and large blocks of the slab allocator */
+static void js_slab_free_state(JSSlabState *ss)
+{
+    JSSlabChunk *c, *c_next;
+    struct list_head *el, *el1;
+
+    for(c = ss->chunk_list; c != NULL; c = c_next) {
+        c_next = c->next;
+        free(c);
+    }
+    list_for_each_safe(el, el1, &ss->large_list) {
+        free(list_entry(el, JSSlabLargeBlock, link));
+    }
+    free(ss);
+}
+
+/* The data of the transferred ArrayBuffers is allocated with malloc()
+   so that it does not depend on the allocator of a runtime. */
+
+/* Return a malloc() block with the contents of the block 'ptr' of
+   size 'size' allocated with js_malloc_rt(). The block itself is
+   returned if it comes from the default allocator. */
+static uint8_t *js_transfer_data_get(JSRuntime *rt, uint8_t *ptr, size_t size,
+                                     BOOL copy)
+{
+    uint8_t *data;
+    if (!copy && rt->mf.js_free == js_def_free) {
+        /* the block no longer belongs to the runtime */
+        rt->malloc_state.malloc_count--;
+        rt->malloc_state.malloc_size -=
+            js_def_malloc_usable_size(ptr) + MALLOC_OVERHEAD;
+        return ptr;
+    }
+    data = malloc(max_int(size, 1));
+    if (data)
+        memcpy(data, ptr, size);
+    return data;
+}
+
+static void js_array_buffer_free_transferred(JSRuntime *rt, void *opaque,
+                                             void *ptr)
+{
+    free(ptr);
+}
+
 JSRuntime *JS_NewRuntime(void)
 {
     return JS_NewRuntime2(&def_malloc_funcs, NULL);
 }
 
+JSRuntime *JS_NewSlabRuntime(void)
+{
+    JSSlabState *ss;
+    JSRuntime *rt;
+
+    ss = malloc(sizeof(*ss));
+    if (!ss)
+        return NULL;
+    memset(ss, 0, sizeof(*ss));
+    init_list_head(&ss->large_list);
+    rt = JS_NewRuntime2(&slab_malloc_funcs, ss);
+    if (!rt)
+        js_slab_free_state(ss);
+    return rt;
+}
+
 void JS_SetMemoryLimit(JSRuntime *rt, size_t limit)
 {
     rt->malloc_state.malloc_limit = limit;
@@ -1795,6 +2190,12 @@ void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
     rt->malloc_gc_threshold = gc_threshold;
 }
 
+/* use 0 to do full collections in the automatic GC */
+void JS_SetGCStepBudget(JSRuntime *rt, size_t budget)
+{
+    rt->gc_step_budget = budget;
+}
+
 #define malloc(s) malloc_is_forbidden(s)
 #define free(p) free_is_forbidden(p)
 #define realloc(p,s) realloc_is_forbidden(p,s)
@@ -1810,12 +2211,44 @@ void JS_SetCanBlock(JSRuntime *rt, BOOL can_block)
     rt->can_block = can_block;
 }
 
+void JS_SetLazyFunctions(JSRuntime *rt, BOOL enable)
+{
+    rt->lazy_functions = enable;
+}
+
 void JS_SetSharedArrayBufferFunctions(JSRuntime *rt,
                                       const JSSharedArrayBufferFunctions *sf)
 {
     rt->sab_funcs = *sf;
 }
 
+static JSJobEntry *js_alloc_job(JSContext *ctx, int argc)
+{
+    JSRuntime *rt = ctx->rt;
+    JSJobEntry *e;
+
+    if (argc <= JS_JOB_POOL_ARGC) {
+        if (!list_empty(&rt->job_free_list)) {
+            e = list_entry(rt->job_free_list.next, JSJobEntry, link);
+            list_del(&e->link);
+            rt->job_free_count--;
+            return e;
+        }
+        argc = JS_JOB_POOL_ARGC;
+    }
+    return js_malloc(ctx, sizeof(JSJobEntry) + argc * sizeof(JSValue));
+}
+
+static void js_free_job(JSRuntime *rt, JSJobEntry *e)
+{
+    if (e->argc <= JS_JOB_POOL_ARGC && rt->job_free_count < JS_JOB_POOL_SIZE) {
+        list_add(&e->link, &rt->job_free_list);
+        rt->job_free_count++;
+    } else {
+        js_free_rt(rt, e);
+    }
+}
+
 /* return 0 if OK, < 0 if exception */
 int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func,
                   int argc, JSValueConst *argv)
@@ -1824,11 +2257,12 @@ int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func,
     JSJobEntry *e;
     int i;
 
-    e = js_malloc(ctx, sizeof(*e) + argc * sizeof(JSValue));
+    e = js_alloc_job(ctx, argc);
     if (!e)
         return -1;
     e->ctx = ctx;
     e->job_func = job_func;
+    e->async_func = NULL;
     e->argc = argc;
     for(i = 0; i < argc; i++) {
         e->argv[i] = JS_DupValue(ctx, argv[i]);
@@ -1860,7 +2294,14 @@ int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx)
     e = list_entry(rt->job_list.next, JSJobEntry, link);
     list_del(&e->link);
     ctx = e->ctx;
-    res = e->job_func(e->ctx, e->argc, (JSValueConst *)e->argv);
+    if (e->async_func) {
+        js_async_function_resume_job(ctx, e->async_func, e->argv[0],
+                                     JS_VALUE_GET_BOOL(e->argv[1]));
+        async_func_free(rt, e->async_func);
+        res = JS_UNDEFINED;
+    } else {
+        res = e->job_func(e->ctx, e->argc, (JSValueConst *)e->argv);
+    }
     for(i = 0; i < e->argc; i++)
         JS_FreeValue(ctx, e->argv[i]);
     if (JS_IsException(res))
@@ -1868,7 +2309,7 @@ int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx)
     else
         ret = 1;
     JS_FreeValue(ctx, res);
-    js_free(ctx, e);
+    js_free_job(rt, e);
     *pctx = ctx;
     return ret;
 }
@@ -1939,6 +2380,37 @@ void JS_SetRuntimeInfo(JSRuntime *rt, const char *s)
         rt->rt_info = s;
 }
 
+/* Free a runtime using the slab allocator without freeing its objects
+   one by one: only the finalizers which may release resources outside
+   of the runtime memory are called (ArrayBuffer data and user
+   classes), then the chunks and the large blocks are released. */
+static void js_free_slab_runtime(JSRuntime *rt)
+{
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    JSObject *p;
+    JSClassFinalizer *finalizer;
+    JSSlabState *ss = rt->malloc_state.opaque;
+
+    /* the values freed by the finalizers are no longer freed */
+    rt->gc_phase = JS_GC_PHASE_TEARDOWN;
+    list_splice_tail(&rt->gc_old_obj_list, &rt->gc_obj_list);
+    list_for_each(el, &rt->gc_obj_list) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        if (gp->gc_obj_type != JS_GC_OBJ_TYPE_JS_OBJECT)
+            continue;
+        p = (JSObject *)gp;
+        if (p->class_id == JS_CLASS_ARRAY_BUFFER ||
+            p->class_id == JS_CLASS_SHARED_ARRAY_BUFFER ||
+            p->class_id >= JS_CLASS_INIT_COUNT) {
+            finalizer = rt->class_array[p->class_id].finalizer;
+            if (finalizer)
+                finalizer(rt, JS_MKPTR(JS_TAG_OBJECT, p));
+        }
+    }
+    js_slab_free_state(ss);
+}
+
 void JS_FreeRuntime(JSRuntime *rt)
 {
     struct list_head *el, *el1;
@@ -1948,12 +2420,31 @@ void JS_FreeRuntime(JSRuntime *rt)
 
     list_for_each_safe(el, el1, &rt->job_list) {
         JSJobEntry *e = list_entry(el, JSJobEntry, link);
+        if (e->async_func)
+            async_func_free(rt, e->async_func);
         for(i = 0; i < e->argc; i++)
             JS_FreeValueRT(rt, e->argv[i]);
         js_free_rt(rt, e);
     }
     init_list_head(&rt->job_list);
-
+    list_for_each_safe(el, el1, &rt->job_free_list) {
+        JSJobEntry *e = list_entry(el, JSJobEntry, link);
+        js_free_rt(rt, e);
+    }
+    init_list_head(&rt->job_free_list);
+    rt->job_free_count = 0;
+
+    JS_StopProfiler(rt);
+    JS_StopHeapProfiler(rt);
+    for(i = 0; i < rt->reserved_atom_count; i++)
+        JS_FreeAtomRT(rt, JS_ATOM_END + i);
+    rt->reserved_atom_count = 0;
+#ifndef DUMP_LEAKS
+    if (rt->mf.js_free == js_slab_free) {
+        js_free_slab_runtime(rt);
+        return;
+    }
+#endif
     JS_RunGC(rt);
 
 #ifdef DUMP_LEAKS
@@ -1965,10 +2456,8 @@ void JS_FreeRuntime(JSRuntime *rt)
 
         /* remove the internal refcounts to display only the object
            referenced externally */
-        list_for_each(el, &rt->gc_obj_list) {
-            p = list_entry(el, JSGCObjectHeader, link);
-            p->mark = 0;
-        }
+        list_splice_tail(&rt->gc_old_obj_list, &rt->gc_obj_list);
+        rt->gc_skip_mark = 0;
         gc_decref(rt);
 
         header_done = FALSE;
@@ -1996,6 +2485,7 @@ void JS_FreeRuntime(JSRuntime *rt)
     }
 #endif
     assert(list_empty(&rt->gc_obj_list));
+    assert(list_empty(&rt->gc_old_obj_list));
 
     /* free the classes */
     for(i = 0; i < rt->class_count; i++) {
@@ -2005,6 +2495,9 @@ void JS_FreeRuntime(JSRuntime *rt)
         }
     }
     js_free_rt(rt, rt->class_array);
+#ifdef DUMP_OPCODE_STATS
+    js_free_rt(rt, rt->opcode_stats);
+#endif
 
     bf_context_end(&rt->bf_ctx);
 
@@ -2121,7 +2614,10 @@ void JS_FreeRuntime(JSRuntime *rt)
 
     {
         JSMallocState ms = rt->malloc_state;
+        BOOL is_slab = (rt->mf.js_free == js_slab_free);
         rt->mf.js_free(&ms, rt);
+        if (is_slab)
+            js_slab_free_state(ms.opaque);
     }
 }
 
@@ -2277,6 +2773,9 @@ static void JS_MarkContext(JSRuntime *rt, JSContext *ctx,
 
     if (ctx->array_shape)
         mark_func(rt, &ctx->array_shape->header);
+
+    if (ctx->snapshot_base)
+        js_snapshot_base_mark(rt, ctx->snapshot_base, mark_func);
 }
 
 void JS_FreeContext(JSContext *ctx)
@@ -2300,7 +2799,7 @@ void JS_FreeContext(JSContext *ctx)
         JSGCObjectHeader *p;
         printf("JSObjects: {\n");
         JS_DumpObjectHeader(ctx->rt);
-        list_for_each(el, &rt->gc_obj_list) {
+        list_for_each_gc_obj(el, rt) {
             p = list_entry(el, JSGCObjectHeader, link);
             JS_DumpGCObject(rt, p);
         }
@@ -2317,6 +2816,11 @@ void JS_FreeContext(JSContext *ctx)
 
     js_free_modules(ctx, JS_FREE_MODULE_ALL);
 
+    if (ctx->snapshot_base) {
+        js_snapshot_base_free(rt, ctx->snapshot_base);
+        ctx->snapshot_base = NULL;
+    }
+
     JS_FreeValue(ctx, ctx->global_obj);
     JS_FreeValue(ctx, ctx->global_var_obj);
 
@@ -2366,6 +2870,11 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size)
     update_stack_limit(rt);
 }
 
+void JS_SetBignumThreads(JSRuntime *rt, int thread_count)
+{
+    rt->bf_ctx.ntt_threads = thread_count;
+}
+
 void JS_UpdateStackTop(JSRuntime *rt)
 {
     rt->stack_top = js_get_stack_pointer();
@@ -4168,8 +4677,11 @@ static void copy_str16(uint16_t *dst, const JSString *p, int offset, int len)
     }
 }
 
+/* 'max_len' >= p1->len + p2->len is the allocated length so that the
+   next concatenations can be done in place */
 static JSValue JS_ConcatString1(JSContext *ctx,
-                                const JSString *p1, const JSString *p2)
+                                const JSString *p1, const JSString *p2,
+                                uint32_t max_len)
 {
     JSString *p;
     uint32_t len;
@@ -4179,9 +4691,10 @@ static JSValue JS_ConcatString1(JSContext *ctx,
     if (len > JS_STRING_LEN_MAX)
         return JS_ThrowInternalError(ctx, "string too long");
     is_wide_char = p1->is_wide_char | p2->is_wide_char;
-    p = js_alloc_string(ctx, len, is_wide_char);
+    p = js_alloc_string(ctx, max_len, is_wide_char);
     if (!p)
         return JS_EXCEPTION;
+    p->len = len;
     if (!is_wide_char) {
         memcpy(p->u.str8, p1->u.str8, p1->len);
         memcpy(p->u.str8 + p1->len, p2->u.str8, p2->len);
@@ -4193,70 +4706,443 @@ static JSValue JS_ConcatString1(JSContext *ctx,
     return JS_MKPTR(JS_TAG_STRING, p);
 }
 
-static BOOL JS_ConcatStringInPlace(JSContext *ctx, JSString *p1, JSValueConst op2) {
-    if (JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
-        JSString *p2 = JS_VALUE_GET_STRING(op2);
-        size_t size1;
+static inline BOOL tag_is_string(uint32_t tag)
+{
+    return tag == JS_TAG_STRING || tag == JS_TAG_STRING_ROPE;
+}
 
-        if (p2->len == 0)
-            return TRUE;
-        if (p1->header.ref_count != 1)
+/* 'val' must be a string or a string rope */
+static uint32_t js_string_value_len(JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+        return JS_VALUE_GET_STRING_ROPE(val)->len;
+    else
+        return JS_VALUE_GET_STRING(val)->len;
+}
+
+static int js_string_value_is_wide_char(JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+        return JS_VALUE_GET_STRING_ROPE(val)->is_wide_char;
+    else
+        return JS_VALUE_GET_STRING(val)->is_wide_char;
+}
+
+static int js_string_value_depth(JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+        return JS_VALUE_GET_STRING_ROPE(val)->depth;
+    else
+        return 0;
+}
+
+/* iterate thru the leaves of a string rope (or a string) from left to
+   right */
+typedef struct {
+    int stack_len;
+    JSValueConst stack[JS_STRING_ROPE_MAX_DEPTH + 1];
+} JSStringRopeIter;
+
+static void string_rope_iter_init(JSStringRopeIter *s, JSValueConst val)
+{
+    s->stack[0] = val;
+    s->stack_len = 1;
+}
+
+/* return NULL at the end of the string */
+static JSString *string_rope_iter_next(JSStringRopeIter *s)
+{
+    JSValueConst val;
+    JSStringRope *r;
+
+    if (s->stack_len == 0)
+        return NULL;
+    val = s->stack[--s->stack_len];
+    while (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE) {
+        r = JS_VALUE_GET_STRING_ROPE(val);
+        if (JS_IsUndefined(r->right)) {
+            /* linearized */
+            val = r->left;
+            break;
+        }
+        assert(s->stack_len < countof(s->stack));
+        s->stack[s->stack_len++] = r->right;
+        val = r->left;
+    }
+    return JS_VALUE_GET_STRING(val);
+}
+
+/* Return the characters of the string or string rope 'val'. The
+   result is valid as long as 'val' is. Return NULL in case of
+   exception. */
+static JSString *js_get_linear_string(JSContext *ctx, JSValueConst val)
+{
+    JSStringRope *r;
+    JSStringRopeIter it;
+    JSString *p, *p1;
+    uint32_t pos;
+
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING)
+        return JS_VALUE_GET_STRING(val);
+    r = JS_VALUE_GET_STRING_ROPE(val);
+    if (JS_IsUndefined(r->right))
+        return JS_VALUE_GET_STRING(r->left);
+    p = js_alloc_string(ctx, r->len, r->is_wide_char);
+    if (!p)
+        return NULL;
+    pos = 0;
+    string_rope_iter_init(&it, val);
+    while ((p1 = string_rope_iter_next(&it)) != NULL) {
+        if (p->is_wide_char)
+            copy_str16(p->u.str16 + pos, p1, 0, p1->len);
+        else
+            memcpy(p->u.str8 + pos, p1->u.str8, p1->len);
+        pos += p1->len;
+    }
+    if (!p->is_wide_char)
+        p->u.str8[pos] = '\0';
+    /* keep the result so that the rope is linearized only once */
+    JS_FreeValue(ctx, r->left);
+    JS_FreeValue(ctx, r->right);
+    r->left = JS_MKPTR(JS_TAG_STRING, p);
+    r->right = JS_UNDEFINED;
+    r->depth = 1;
+    return p;
+}
+
+/* same as js_string_memcmp() with offsets */
+static int js_string_memcmp2(const JSString *p1, int pos1,
+                             const JSString *p2, int pos2, int len)
+{
+    int res;
+
+    if (likely(!p1->is_wide_char)) {
+        if (likely(!p2->is_wide_char))
+            res = memcmp(p1->u.str8 + pos1, p2->u.str8 + pos2, len);
+        else
+            res = -memcmp16_8(p2->u.str16 + pos2, p1->u.str8 + pos1, len);
+    } else {
+        if (!p2->is_wide_char)
+            res = memcmp16_8(p1->u.str16 + pos1, p2->u.str8 + pos2, len);
+        else
+            res = memcmp16(p1->u.str16 + pos1, p2->u.str16 + pos2, len);
+    }
+    return res;
+}
+
+/* Compare the strings or string ropes 'op1' and 'op2' without
+   linearizing them. Return < 0, 0 or > 0. If 'eq_only' is TRUE, only
+   the equality is tested. */
+static int js_string_rope_compare(JSValueConst op1, JSValueConst op2,
+                                  BOOL eq_only)
+{
+    JSStringRopeIter it1, it2;
+    JSString *p1, *p2;
+    uint32_t len1, len2, pos1, pos2, l;
+    int res;
+
+    len1 = js_string_value_len(op1);
+    len2 = js_string_value_len(op2);
+    if (eq_only && len1 != len2)
+        return 1;
+    string_rope_iter_init(&it1, op1);
+    string_rope_iter_init(&it2, op2);
+    p1 = string_rope_iter_next(&it1);
+    p2 = string_rope_iter_next(&it2);
+    pos1 = 0;
+    pos2 = 0;
+    while (p1 != NULL && p2 != NULL) {
+        l = min_uint32(p1->len - pos1, p2->len - pos2);
+        res = js_string_memcmp2(p1, pos1, p2, pos2, l);
+        if (res != 0)
+            return res;
+        pos1 += l;
+        pos2 += l;
+        if (pos1 == p1->len) {
+            p1 = string_rope_iter_next(&it1);
+            pos1 = 0;
+        }
+        if (pos2 == p2->len) {
+            p2 = string_rope_iter_next(&it2);
+            pos2 = 0;
+        }
+    }
+    if (len1 == len2)
+        return 0;
+    else if (len1 < len2)
+        return -1;
+    else
+        return 1;
+}
+
+/* same result as hash_string() on the linearized string */
+static uint32_t hash_string_rope(JSValueConst val, uint32_t h)
+{
+    JSStringRopeIter it;
+    JSString *p;
+
+    string_rope_iter_init(&it, val);
+    while ((p = string_rope_iter_next(&it)) != NULL)
+        h = hash_string(p, h);
+    return h;
+}
+
+static JSValue js_rebalance_string_rope(JSContext *ctx, JSValue op1,
+                                        JSValue op2);
+
+/* op1 and op2 are freed */
+static JSValue js_new_string_rope(JSContext *ctx, JSValue op1, JSValue op2)
+{
+    JSStringRope *r;
+    int depth;
+
+    depth = max_int(js_string_value_depth(op1),
+                    js_string_value_depth(op2)) + 1;
+    if (depth > JS_STRING_ROPE_MAX_DEPTH)
+        return js_rebalance_string_rope(ctx, op1, op2);
+    r = js_malloc(ctx, sizeof(*r));
+    if (!r) {
+        JS_FreeValue(ctx, op1);
+        JS_FreeValue(ctx, op2);
+        return JS_EXCEPTION;
+    }
+    r->header.ref_count = 1;
+    r->len = js_string_value_len(op1) + js_string_value_len(op2);
+    r->is_wide_char = js_string_value_is_wide_char(op1) |
+        js_string_value_is_wide_char(op2);
+    r->depth = depth;
+    r->left = op1;
+    r->right = op2;
+    return JS_MKPTR(JS_TAG_STRING_ROPE, r);
+}
+
+/* build a balanced rope from the leaves tab[0 ... n - 1]. The leaves
+   are freed. */
+static JSValue js_build_string_rope(JSContext *ctx, JSValue *tab, int n)
+{
+    JSValue op1, op2;
+    int n1;
+
+    if (n == 1)
+        return tab[0];
+    n1 = n / 2;
+    op1 = js_build_string_rope(ctx, tab, n1);
+    op2 = js_build_string_rope(ctx, tab + n1, n - n1);
+    if (JS_IsException(op1) || JS_IsException(op2)) {
+        JS_FreeValue(ctx, op1);
+        JS_FreeValue(ctx, op2);
+        return JS_EXCEPTION;
+    }
+    return js_new_string_rope(ctx, op1, op2);
+}
+
+/* return the concatenation of op1 and op2 as a balanced rope. op1 and
+   op2 are freed. */
+static JSValue js_rebalance_string_rope(JSContext *ctx, JSValue op1,
+                                        JSValue op2)
+{
+    JSStringRopeIter it;
+    JSString *p;
+    JSValue *tab, ret;
+    int i, n;
+
+    n = 0;
+    for(i = 0; i < 2; i++) {
+        string_rope_iter_init(&it, i == 0 ? op1 : op2);
+        while (string_rope_iter_next(&it) != NULL)
+            n++;
+    }
+    tab = js_malloc(ctx, sizeof(tab[0]) * n);
+    if (!tab) {
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    n = 0;
+    for(i = 0; i < 2; i++) {
+        string_rope_iter_init(&it, i == 0 ? op1 : op2);
+        while ((p = string_rope_iter_next(&it)) != NULL)
+            tab[n++] = JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+    }
+    ret = js_build_string_rope(ctx, tab, n);
+    js_free(ctx, tab);
+ done:
+    JS_FreeValue(ctx, op1);
+    JS_FreeValue(ctx, op2);
+    return ret;
+}
+
+/* return the linearized string if 'val' is a linearized rope */
+static JSValue js_string_rope_unwrap(JSContext *ctx, JSValue val)
+{
+    JSStringRope *r;
+    JSValue ret;
+
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING_ROPE)
+        return val;
+    r = JS_VALUE_GET_STRING_ROPE(val);
+    if (!JS_IsUndefined(r->right))
+        return val;
+    ret = JS_DupValue(ctx, r->left);
+    JS_FreeValue(ctx, val);
+    return ret;
+}
+
+/* op1 must be a string or a string rope. Return TRUE if op2 could be
+   appended to op1 without allocating memory. */
+static BOOL JS_ConcatStringInPlace(JSContext *ctx, JSValueConst op1,
+                                   JSValueConst op2)
+{
+    JSString *p1, *p2;
+    size_t size1;
+
+    if (JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)
+        return FALSE;
+    p2 = JS_VALUE_GET_STRING(op2);
+    if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING_ROPE) {
+        JSStringRope *r = JS_VALUE_GET_STRING_ROPE(op1);
+        /* append to the last leaf */
+        if (r->header.ref_count != 1 ||
+            JS_VALUE_GET_TAG(r->right) != JS_TAG_STRING ||
+            r->len + p2->len > JS_STRING_LEN_MAX ||
+            !JS_ConcatStringInPlace(ctx, r->right, op2))
             return FALSE;
-        size1 = js_malloc_usable_size(ctx, p1);
-        if (p1->is_wide_char) {
-            if (size1 >= sizeof(*p1) + ((p1->len + p2->len) << 1)) {
-                if (p2->is_wide_char) {
-                    memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
-                    p1->len += p2->len;
-                    return TRUE;
-                } else {
-                    size_t i;
-                    for (i = 0; i < p2->len; i++) {
-                        p1->u.str16[p1->len++] = p2->u.str8[i];
-                    }
-                    return TRUE;
-                }
-            }
-        } else if (!p2->is_wide_char) {
-            if (size1 >= sizeof(*p1) + p1->len + p2->len + 1) {
-                memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+        r->len += p2->len;
+        return TRUE;
+    }
+    p1 = JS_VALUE_GET_STRING(op1);
+    if (p2->len == 0)
+        return TRUE;
+    if (p1->header.ref_count != 1)
+        return FALSE;
+    size1 = js_malloc_usable_size(ctx, p1);
+    if (p1->is_wide_char) {
+        if (size1 >= sizeof(*p1) + ((p1->len + p2->len) << 1)) {
+            if (p2->is_wide_char) {
+                memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
                 p1->len += p2->len;
-                p1->u.str8[p1->len] = '\0';
+                return TRUE;
+            } else {
+                size_t i;
+                for (i = 0; i < p2->len; i++) {
+                    p1->u.str16[p1->len++] = p2->u.str8[i];
+                }
                 return TRUE;
             }
         }
+    } else if (!p2->is_wide_char) {
+        if (size1 >= sizeof(*p1) + p1->len + p2->len + 1) {
+            memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+            p1->len += p2->len;
+            p1->u.str8[p1->len] = '\0';
+            return TRUE;
+        }
     }
     return FALSE;
 }
 
 /* op1 and op2 are converted to strings. For convenience, op1 or op2 =
-   JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
+   JS_EXCEPTION are accepted and return JS_EXCEPTION. The result is a
+   string rope if it is long enough. */
 static JSValue JS_ConcatString(JSContext *ctx, JSValue op1, JSValue op2)
 {
     JSValue ret;
     JSString *p1, *p2;
+    JSStringRope *r;
+    uint32_t len1, len2;
 
-    if (unlikely(JS_VALUE_GET_TAG(op1) != JS_TAG_STRING)) {
+    if (unlikely(!tag_is_string(JS_VALUE_GET_TAG(op1)))) {
         op1 = JS_ToStringFree(ctx, op1);
         if (JS_IsException(op1)) {
             JS_FreeValue(ctx, op2);
             return JS_EXCEPTION;
         }
     }
-    if (unlikely(JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)) {
+    if (unlikely(!tag_is_string(JS_VALUE_GET_TAG(op2)))) {
         op2 = JS_ToStringFree(ctx, op2);
         if (JS_IsException(op2)) {
             JS_FreeValue(ctx, op1);
             return JS_EXCEPTION;
         }
     }
-    p1 = JS_VALUE_GET_STRING(op1);
-    if (JS_ConcatStringInPlace(ctx, p1, op2)) {
+    if (JS_ConcatStringInPlace(ctx, op1, op2)) {
         JS_FreeValue(ctx, op2);
         return op1;
     }
-    p2 = JS_VALUE_GET_STRING(op2);
-    ret = JS_ConcatString1(ctx, p1, p2);
+    op1 = js_string_rope_unwrap(ctx, op1);
+    op2 = js_string_rope_unwrap(ctx, op2);
+    len1 = js_string_value_len(op1);
+    len2 = js_string_value_len(op2);
+    if (len2 == 0) {
+        JS_FreeValue(ctx, op2);
+        return op1;
+    }
+    if (len1 == 0) {
+        JS_FreeValue(ctx, op1);
+        return op2;
+    }
+    if (len1 + len2 > JS_STRING_LEN_MAX) {
+        ret = JS_ThrowInternalError(ctx, "string too long");
+        goto done;
+    }
+    if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
+        JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
+        if (len1 + len2 <= JS_STRING_ROPE_SHORT_LEN) {
+            p1 = JS_VALUE_GET_STRING(op1);
+            p2 = JS_VALUE_GET_STRING(op2);
+            ret = JS_ConcatString1(ctx, p1, p2, len1 + len2);
+            goto done;
+        }
+    } else if (JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
+        /* append op2 to the last leaf of op1 if it is short. Some
+           space is reserved so that the next concatenations can be
+           done in place. */
+        r = JS_VALUE_GET_STRING_ROPE(op1);
+        if (JS_VALUE_GET_TAG(r->right) == JS_TAG_STRING) {
+            p1 = JS_VALUE_GET_STRING(r->right);
+            p2 = JS_VALUE_GET_STRING(op2);
+            if (p1->len + len2 <= JS_STRING_ROPE_SHORT2_LEN) {
+                ret = JS_ConcatString1(ctx, p1, p2,
+                                       min_uint32(2 * (p1->len + len2),
+                                                  JS_STRING_ROPE_SHORT2_LEN));
+                if (JS_IsException(ret))
+                    goto done;
+                if (r->header.ref_count == 1) {
+                    JS_FreeValue(ctx, r->right);
+                    r->right = ret;
+                    r->len += len2;
+                    r->is_wide_char |= p2->is_wide_char;
+                    JS_FreeValue(ctx, op2);
+                    return op1;
+                }
+                ret = js_new_string_rope(ctx, JS_DupValue(ctx, r->left), ret);
+                goto done;
+            }
+        }
+    } else if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING) {
+        /* prepend op1 to the first leaf of op2 if it is short */
+        r = JS_VALUE_GET_STRING_ROPE(op2);
+        if (JS_VALUE_GET_TAG(r->left) == JS_TAG_STRING) {
+            p1 = JS_VALUE_GET_STRING(op1);
+            p2 = JS_VALUE_GET_STRING(r->left);
+            if (len1 + p2->len <= JS_STRING_ROPE_SHORT2_LEN) {
+                ret = JS_ConcatString1(ctx, p1, p2, len1 + p2->len);
+                if (JS_IsException(ret))
+                    goto done;
+                if (r->header.ref_count == 1) {
+                    JS_FreeValue(ctx, r->left);
+                    r->left = ret;
+                    r->len += len1;
+                    r->is_wide_char |= p1->is_wide_char;
+                    JS_FreeValue(ctx, op1);
+                    return op2;
+                }
+                ret = js_new_string_rope(ctx, ret, JS_DupValue(ctx, r->right));
+                goto done;
+            }
+        }
+    }
+    return js_new_string_rope(ctx, op1, op2);
+ done:
     JS_FreeValue(ctx, op1);
     JS_FreeValue(ctx, op2);
     return ret;
@@ -4515,11 +5401,12 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
     if (!sh_alloc)
         return -1;
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
-    list_del(&old_sh->header.link);
     /* copy all the shape properties */
     memcpy(sh, old_sh,
            sizeof(JSShape) + sizeof(sh->prop[0]) * old_sh->prop_count);
-    list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+    /* keep the same GC generation */
+    list_add_tail(&sh->header.link, &old_sh->header.link);
+    list_del(&old_sh->header.link);
 
     if (new_hash_size != (sh->prop_hash_mask + 1)) {
         /* resize the hash table and the properties */
@@ -4573,9 +5460,10 @@ static int compact_properties(JSContext *ctx, JSObject *p)
     if (!sh_alloc)
         return -1;
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
-    list_del(&old_sh->header.link);
     memcpy(sh, old_sh, sizeof(JSShape));
-    list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+    /* keep the same GC generation */
+    list_add_tail(&sh->header.link, &old_sh->header.link);
+    list_del(&old_sh->header.link);
 
     memset(prop_hash_end(sh) - new_hash_size, 0,
            sizeof(prop_hash_end(sh)[0]) * new_hash_size);
@@ -4742,7 +5630,7 @@ static __maybe_unused void JS_DumpShapes(JSRuntime *rt)
         }
     }
     /* dump non-hashed shapes */
-    list_for_each(el, &rt->gc_obj_list) {
+    list_for_each_gc_obj(el, rt) {
         gp = list_entry(el, JSGCObjectHeader, link);
         if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
             p = (JSObject *)gp;
@@ -4854,6 +5742,8 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
     }
     p->header.ref_count = 1;
     add_gc_object(ctx->rt, &p->header, JS_GC_OBJ_TYPE_JS_OBJECT);
+    if (unlikely(ctx->rt->heap_profiler))
+        js_heap_profiler_alloc(ctx, p);
     return JS_MKPTR(JS_TAG_OBJECT, p);
 }
 
@@ -5443,6 +6333,8 @@ static void free_object(JSRuntime *rt, JSObject *p)
 
     p->free_mark = 1; /* used to tell the object is invalid when
                          freeing cycles */
+    if (unlikely(rt->heap_profiler))
+        js_heap_profiler_free(rt, p);
     /* free all the fields */
     sh = p->shape;
     pr = get_shape_prop(sh);
@@ -5546,16 +6438,29 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
             }
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            /* the recursion is limited by JS_STRING_ROPE_MAX_DEPTH */
+            JSStringRope *p = JS_VALUE_GET_STRING_ROPE(v);
+            JS_FreeValueRT(rt, p->left);
+            JS_FreeValueRT(rt, p->right);
+            js_free_rt(rt, p);
+        }
+        break;
     case JS_TAG_OBJECT:
     case JS_TAG_FUNCTION_BYTECODE:
         {
             JSGCObjectHeader *p = JS_VALUE_GET_PTR(v);
-            if (rt->gc_phase != JS_GC_PHASE_REMOVE_CYCLES) {
+            if (rt->gc_phase == JS_GC_PHASE_TEARDOWN) {
+                /* released with the slab chunks */
+            } else if (rt->gc_phase != JS_GC_PHASE_REMOVE_CYCLES) {
                 list_del(&p->link);
                 list_add(&p->link, &rt->gc_zero_ref_count_list);
                 if (rt->gc_phase == JS_GC_PHASE_NONE) {
                     free_zero_refcount(rt);
                 }
+            } else {
+                gc_free_with_cycles(rt, p);
             }
         }
         break;
@@ -5680,6 +6585,19 @@ static void mark_children(JSRuntime *rt, JSGCObjectHeader *gp,
             for(i = 0; i < b->cpool_count; i++) {
                 JS_MarkValue(rt, b->cpool[i], mark_func);
             }
+            if (b->ic) {
+                /* the cached shapes reference their prototype */
+                for(i = 0; i < b->ic_count; i++) {
+                    JSInlineCacheEntry *e = b->ic[i].entries;
+                    int j;
+                    for(j = 0; j < JS_IC_WAYS; j++, e++) {
+                        if (e->shape)
+                            mark_func(rt, &e->shape->header);
+                        if (e->proto_shape)
+                            mark_func(rt, &e->proto_shape->header);
+                    }
+                }
+            }
             if (b->realm)
                 mark_func(rt, &b->realm->header);
         }
@@ -5736,11 +6654,23 @@ static void mark_children(JSRuntime *rt, JSGCObjectHeader *gp,
     }
 }
 
+/* The cycles are collected with trial deletion on gc_obj_list. In a
+   partial collection, it only contains the young generation and the
+   references to the objects of the old generation are ignored so that
+   they are considered as live. A full collection first moves all the
+   objects to gc_obj_list. */
+
+/* JSGCObjectHeader.mark bits */
+#define JS_GC_MARK_DECREF (1 << 0) /* visited by gc_decref() */
+#define JS_GC_MARK_OLD    (1 << 1) /* in gc_old_obj_list */
+
 static void gc_decref_child(JSRuntime *rt, JSGCObjectHeader *p)
 {
+    if (p->mark & rt->gc_skip_mark)
+        return;
     assert(p->ref_count > 0);
     p->ref_count--;
-    if (p->ref_count == 0 && p->mark == 1) {
+    if (p->ref_count == 0 && (p->mark & JS_GC_MARK_DECREF)) {
         list_del(&p->link);
         list_add_tail(&p->link, &rt->tmp_obj_list);
     }
@@ -5758,9 +6688,9 @@ static void gc_decref(JSRuntime *rt)
        tmp_obj_list */
     list_for_each_safe(el, el1, &rt->gc_obj_list) {
         p = list_entry(el, JSGCObjectHeader, link);
-        assert(p->mark == 0);
+        assert(!(p->mark & JS_GC_MARK_DECREF));
         mark_children(rt, p, gc_decref_child);
-        p->mark = 1;
+        p->mark = JS_GC_MARK_DECREF;
         if (p->ref_count == 0) {
             list_del(&p->link);
             list_add_tail(&p->link, &rt->tmp_obj_list);
@@ -5770,6 +6700,8 @@ static void gc_decref(JSRuntime *rt)
 
 static void gc_scan_incref_child(JSRuntime *rt, JSGCObjectHeader *p)
 {
+    if (p->mark & rt->gc_skip_mark)
+        return;
     p->ref_count++;
     if (p->ref_count == 1) {
         /* ref_count was 0: remove from tmp_obj_list and add at the
@@ -5782,6 +6714,8 @@ static void gc_scan_incref_child(JSRuntime *rt, JSGCObjectHeader *p)
 
 static void gc_scan_incref_child2(JSRuntime *rt, JSGCObjectHeader *p)
 {
+    if (p->mark & rt->gc_skip_mark)
+        return;
     p->ref_count++;
 }
 
@@ -5794,7 +6728,10 @@ static void gc_scan(JSRuntime *rt)
     list_for_each(el, &rt->gc_obj_list) {
         p = list_entry(el, JSGCObjectHeader, link);
         assert(p->ref_count > 0);
-        p->mark = 0; /* reset the mark for the next GC call */
+        /* reset the mark for the next GC call. In a full collection,
+           the old generation mark can be set now because it is
+           ignored. */
+        p->mark = rt->gc_skip_mark ? 0 : JS_GC_MARK_OLD;
         mark_children(rt, p, gc_scan_incref_child);
     }
 
@@ -5805,6 +6742,42 @@ static void gc_scan(JSRuntime *rt)
     }
 }
 
+/* move the objects which survived the collection to the old
+   generation */
+static void gc_promote(JSRuntime *rt)
+{
+    struct list_head *el;
+    JSGCObjectHeader *p;
+
+    if (rt->gc_skip_mark) {
+        list_for_each(el, &rt->gc_obj_list) {
+            p = list_entry(el, JSGCObjectHeader, link);
+            p->mark = JS_GC_MARK_OLD;
+        }
+    }
+    list_splice_tail(&rt->gc_obj_list, &rt->gc_old_obj_list);
+}
+
+static struct list_head *gc_obj_next(JSRuntime *rt, struct list_head *el)
+{
+    el = el->next;
+    if (el == &rt->gc_obj_list)
+        el = rt->gc_old_obj_list.next;
+    return el;
+}
+
+/* Called in the JS_GC_PHASE_REMOVE_CYCLES phase when the ref_count of
+   'p' reaches zero. If 'p' is not part of the cycles (e.g. it is an
+   old object only referenced by young cycles), it is freed with them. */
+static void gc_free_with_cycles(JSRuntime *rt, JSGCObjectHeader *p)
+{
+    if (!(p->mark & JS_GC_MARK_DECREF)) {
+        p->mark = JS_GC_MARK_DECREF;
+        list_del(&p->link);
+        list_add_tail(&p->link, &rt->tmp_obj_list);
+    }
+}
+
 static void gc_free_cycles(JSRuntime *rt)
 {
     struct list_head *el, *el1;
@@ -5856,8 +6829,21 @@ static void gc_free_cycles(JSRuntime *rt)
     init_list_head(&rt->gc_zero_ref_count_list);
 }
 
-void JS_RunGC(JSRuntime *rt)
+/* OS dependent: return a time in microseconds */
+static int64_t gc_get_time_us(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/* collect the cycles of gc_obj_list */
+static void gc_collect(JSRuntime *rt, BOOL is_full, int64_t start_time)
 {
+    int64_t pause;
+
+    rt->gc_skip_mark = is_full ? 0 : JS_GC_MARK_OLD;
+
     /* decrement the reference of the children of each object. mark =
        1 after this pass. */
     gc_decref(rt);
@@ -5865,8 +6851,57 @@ void JS_RunGC(JSRuntime *rt)
     /* keep the GC objects with a non zero refcount and their childs */
     gc_scan(rt);
 
+    /* done before freeing the cycles so that the objects allocated
+       by the finalizers stay in the young generation */
+    gc_promote(rt);
+
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+
+    pause = gc_get_time_us() - start_time;
+    rt->gc_count++;
+    rt->gc_total_time += pause;
+    rt->gc_last_pause = pause;
+    if (pause > rt->gc_max_pause)
+        rt->gc_max_pause = pause;
+}
+
+void JS_RunGC(JSRuntime *rt)
+{
+    int64_t start_time;
+
+    start_time = gc_get_time_us();
+    list_splice_tail(&rt->gc_old_obj_list, &rt->gc_obj_list);
+    gc_collect(rt, TRUE, start_time);
+    rt->gc_full_count++;
+    rt->malloc_gc_full_threshold = rt->malloc_state.malloc_size * 2;
+}
+
+/* Collect the young generation and the next 'budget' objects of the
+   old generation. The time of the pause is proportional to the number
+   of objects in these sets. The cycles which are not entirely in these
+   sets are not collected. */
+void JS_RunGCStep(JSRuntime *rt, size_t budget)
+{
+    struct list_head *el;
+    JSGCObjectHeader *p;
+    int64_t start_time;
+
+    start_time = gc_get_time_us();
+    /* the old generation is scanned in a round robin way because the
+       objects of the old generation which survive the collection go
+       to the end of gc_old_obj_list */
+    while (budget != 0) {
+        el = rt->gc_old_obj_list.next;
+        if (el == &rt->gc_old_obj_list)
+            break;
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->mark = 0;
+        list_del(&p->link);
+        list_add_tail(&p->link, &rt->gc_obj_list);
+        budget--;
+    }
+    gc_collect(rt, FALSE, start_time);
 }
 
 /* Return false if not an object or if the object has already been
@@ -5925,6 +6960,10 @@ static void compute_bytecode_size(JSFunctionBytecode *b, JSMemoryUsage_helper *h
     if (b->closure_var) {
         js_func_size += b->closure_var_count * sizeof(*b->closure_var);
     }
+    if (b->ic) {
+        memory_used_count++;
+        js_func_size += b->ic_count * sizeof(*b->ic);
+    }
     if (!b->read_only_bytecode && b->byte_code_buf) {
         hp->js_func_code_size += b->byte_code_len;
     }
@@ -5934,7 +6973,7 @@ static void compute_bytecode_size(JSFunctionBytecode *b, JSMemoryUsage_helper *h
             memory_used_count++;
             js_func_size += b->debug.source_len + 1;
         }
-        if (b->debug.pc2line_len) {
+        if (b->debug.pc2line_len && !b->read_only_bytecode) {
             memory_used_count++;
             hp->js_func_pc2line_count += 1;
             hp->js_func_pc2line_size += b->debug.pc2line_len;
@@ -5951,6 +6990,16 @@ static void compute_value_size(JSValueConst val, JSMemoryUsage_helper *hp)
     case JS_TAG_STRING:
         compute_jsstring_size(JS_VALUE_GET_STRING(val), hp);
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_STRING_ROPE(val);
+            double s_ref_count = r->header.ref_count;
+            hp->str_count += 1 / s_ref_count;
+            hp->str_size += sizeof(*r) / s_ref_count;
+            compute_value_size(r->left, hp);
+            compute_value_size(r->right, hp);
+        }
+        break;
     case JS_TAG_BIG_INT:
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
@@ -6023,7 +7072,7 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
         }
     }
 
-    list_for_each(el, &rt->gc_obj_list) {
+    list_for_each_gc_obj(el, rt) {
         JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
         JSObject *p;
         JSShape *sh;
@@ -6209,6 +7258,19 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
     }
     s->obj_size += s->obj_count * sizeof(JSObject);
 
+    /* garbage collector */
+    list_for_each(el, &rt->gc_obj_list) {
+        s->gc_young_obj_count++;
+    }
+    list_for_each(el, &rt->gc_old_obj_list) {
+        s->gc_old_obj_count++;
+    }
+    s->gc_count = rt->gc_count;
+    s->gc_full_count = rt->gc_full_count;
+    s->gc_total_time = rt->gc_total_time;
+    s->gc_max_pause = rt->gc_max_pause;
+    s->gc_last_pause = rt->gc_last_pause;
+
     /* hashed shapes */
     s->memory_used_count++; /* rt->shape_hash */
     s->memory_used_size += sizeof(rt->shape_hash[0]) * rt->shape_hash_size;
@@ -6290,7 +7352,7 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
             int obj_classes[JS_CLASS_INIT_COUNT + 1] = { 0 };
             int class_id;
             struct list_head *el;
-            list_for_each(el, &rt->gc_obj_list) {
+            list_for_each_gc_obj(el, rt) {
                 JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
                 JSObject *p;
                 if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
@@ -6376,6 +7438,15 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
         fprintf(fp, "%-20s %8"PRId64" %8"PRId64"\n",
                 "binary objects", s->binary_object_count, s->binary_object_size);
     }
+    if (s->gc_count) {
+        fprintf(fp, "%-20s %8"PRId64"  (%"PRId64" full)\n",
+                "GC runs", s->gc_count, s->gc_full_count);
+        fprintf(fp, "%-20s %8"PRId64" %8"PRId64"  (young, old)\n",
+                "  GC objects", s->gc_young_obj_count, s->gc_old_obj_count);
+        fprintf(fp, "%-20s %0.3f ms total, %0.3f ms max, %0.3f ms last\n",
+                "  GC pauses", s->gc_total_time / 1000.0,
+                s->gc_max_pause / 1000.0, s->gc_last_pause / 1000.0);
+    }
 }
 
 JSValue JS_GetGlobalObject(JSContext *ctx)
@@ -6524,7 +7595,7 @@ static const char *get_func_name(JSContext *ctx, JSValueConst func)
     if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
         return NULL;
     val = pr->u.value;
-    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+    if (!JS_IsString(val))
         return NULL;
     return JS_ToCString(ctx, val);
 }
@@ -6836,10 +7907,740 @@ static JSValue JS_ThrowTypeErrorInvalidClass(JSContext *ctx, int class_id)
     return JS_ThrowTypeErrorAtom(ctx, "%s object expected", name);
 }
 
+/* Sampling CPU profiler. The JS stack is sampled from the interrupt
+   polling points when the sampling interval has elapsed. The samples
+   are aggregated by identical stacks. */
+
+/* number of polling points between the time checks while profiling */
+#define JS_PROFILER_COUNTER_INIT 1000
+
+typedef struct JSProfileEntry {
+    struct JSProfileEntry *hash_next;
+    struct list_head link; /* list of JSProfiler.entry_list */
+    uint32_t hash;
+    int64_t count;
+    size_t len;
+    char stack[0]; /* frames from the root, separated by ';' */
+} JSProfileEntry;
+
+typedef struct JSProfiler {
+    int64_t interval_us;
+    int64_t next_sample_time;
+    uint32_t hash_size; /* power of two */
+    uint32_t entry_count;
+    JSProfileEntry **hash_table;
+    struct list_head entry_list; /* in order of first occurrence */
+    JSStackFrame **frames; /* temporary array for the current stack */
+    int frames_size;
+    DynBuf dbuf;
+} JSProfiler;
+
+int JS_StartProfiler(JSRuntime *rt, int interval_us)
+{
+    JSProfiler *prof;
+
+    JS_StopProfiler(rt);
+    prof = js_mallocz_rt(rt, sizeof(*prof));
+    if (!prof)
+        return -1;
+    prof->hash_size = 256;
+    prof->hash_table = js_mallocz_rt(rt, sizeof(prof->hash_table[0]) *
+                                     prof->hash_size);
+    if (!prof->hash_table) {
+        js_free_rt(rt, prof);
+        return -1;
+    }
+    prof->interval_us = max_int(interval_us, 1);
+    prof->next_sample_time = gc_get_time_us() + prof->interval_us;
+    init_list_head(&prof->entry_list);
+    dbuf_init2(&prof->dbuf, rt, (DynBufReallocFunc *)js_realloc_rt);
+    rt->profiler = prof;
+    return 0;
+}
+
+void JS_StopProfiler(JSRuntime *rt)
+{
+    JSProfiler *prof = rt->profiler;
+    struct list_head *el, *el1;
+
+    if (!prof)
+        return;
+    list_for_each_safe(el, el1, &prof->entry_list) {
+        JSProfileEntry *e = list_entry(el, JSProfileEntry, link);
+        js_free_rt(rt, e);
+    }
+    js_free_rt(rt, prof->hash_table);
+    js_free_rt(rt, prof->frames);
+    dbuf_free(&prof->dbuf);
+    js_free_rt(rt, prof);
+    rt->profiler = NULL;
+}
+
+int JS_WriteProfile(JSRuntime *rt, FILE *f)
+{
+    JSProfiler *prof = rt->profiler;
+    struct list_head *el;
+
+    if (!prof)
+        return -1;
+    list_for_each(el, &prof->entry_list) {
+        JSProfileEntry *e = list_entry(el, JSProfileEntry, link);
+        fwrite(e->stack, 1, e->len, f);
+        fprintf(f, " %" PRId64 "\n", e->count);
+    }
+    return ferror(f) ? -1 : 0;
+}
+
+/* same restrictions as get_func_name() but without allocating memory
+   so that no exception can be raised while sampling */
+static void js_profiler_put_func_name(DynBuf *d, JSValueConst func)
+{
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    JSString *p;
+    JSStringRopeIter it;
+    uint8_t buf[UTF8_CHAR_LEN_MAX];
+    int i, c;
+    size_t pos;
+
+    pos = d->size;
+    if (JS_VALUE_GET_TAG(func) == JS_TAG_OBJECT) {
+        prs = find_own_property(&pr, JS_VALUE_GET_OBJ(func), JS_ATOM_name);
+        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+            JS_IsString(pr->u.value)) {
+            /* a rope cannot be linearized here, so its leaves are
+               read in order (a surrogate pair split between two
+               leaves is output as two characters) */
+            string_rope_iter_init(&it, pr->u.value);
+            while ((p = string_rope_iter_next(&it)) != NULL) {
+                for(i = 0; i < p->len;) {
+                    c = string_getc(p, &i);
+                    /* ';' separates the frames and ' ' the count */
+                    if (c == ';' || c == '\n' || c == '\r')
+                        c = '_';
+                    if (c < 0x80)
+                        dbuf_putc(d, c);
+                    else
+                        dbuf_put(d, buf, unicode_to_utf8(buf, c));
+                }
+            }
+        }
+    }
+    if (d->size == pos)
+        dbuf_putstr(d, "<anonymous>");
+}
+
+static void js_profiler_put_frame(JSContext *ctx, DynBuf *d,
+                                  JSStackFrame *sf)
+{
+    JSObject *p;
+    JSFunctionBytecode *b;
+    char atom_buf[256];
+    const char *filename;
+    uint32_t pc_value;
+    int line_num;
+
+    js_profiler_put_func_name(d, sf->cur_func);
+    p = JS_VALUE_GET_OBJ(sf->cur_func);
+    if (js_class_has_bytecode(p->class_id)) {
+        b = p->u.func.function_bytecode;
+        if (b->has_debug) {
+            filename = JS_AtomGetStr(ctx, atom_buf, sizeof(atom_buf),
+                                     b->debug.filename);
+            dbuf_putstr(d, " (");
+            for(; *filename != '\0'; filename++)
+                dbuf_putc(d, *filename == ';' ? '_' : *filename);
+            pc_value = sf->cur_pc - b->byte_code_buf;
+            if (pc_value > 0)
+                pc_value--;
+            line_num = find_line_num(ctx, b, pc_value);
+            if (line_num == -1)
+                line_num = b->debug.line_num; /* no line number table */
+            dbuf_printf(d, ":%d", line_num);
+            dbuf_putc(d, ')');
+        }
+    } else {
+        dbuf_putstr(d, " (native)");
+    }
+}
+
+static void js_profiler_sample(JSContext *ctx)
+{
+    JSRuntime *rt = ctx->rt;
+    JSProfiler *prof = rt->profiler;
+    JSStackFrame *sf, **frames;
+    JSProfileEntry *e, **tab;
+    DynBuf *d = &prof->dbuf;
+    uint32_t h, i, new_size;
+    int n;
+
+    n = 0;
+    for(sf = rt->current_stack_frame; sf != NULL; sf = sf->prev_frame) {
+        if (n >= prof->frames_size) {
+            int new_frames_size = max_int(16, prof->frames_size * 3 / 2);
+            frames = js_realloc_rt(rt, prof->frames,
+                                   sizeof(frames[0]) * new_frames_size);
+            if (!frames)
+                return;
+            prof->frames = frames;
+            prof->frames_size = new_frames_size;
+        }
+        prof->frames[n++] = sf;
+    }
+    if (n == 0)
+        return;
+
+    d->size = 0;
+    d->error = FALSE;
+    while (n > 0) {
+        js_profiler_put_frame(ctx, d, prof->frames[--n]);
+        if (n > 0)
+            dbuf_putc(d, ';');
+    }
+    if (d->error)
+        return;
+
+    h = hash_string8(d->buf, d->size, 0);
+    for(e = prof->hash_table[h & (prof->hash_size - 1)]; e != NULL;
+        e = e->hash_next) {
+        if (e->hash == h && e->len == d->size &&
+            !memcmp(e->stack, d->buf, d->size)) {
+            e->count++;
+            return;
+        }
+    }
+
+    if (prof->entry_count >= prof->hash_size * 2) {
+        new_size = prof->hash_size * 2;
+        tab = js_mallocz_rt(rt, sizeof(tab[0]) * new_size);
+        if (tab) {
+            for(i = 0; i < prof->hash_size; i++) {
+                JSProfileEntry *e_next;
+                for(e = prof->hash_table[i]; e != NULL; e = e_next) {
+                    e_next = e->hash_next;
+                    e->hash_next = tab[e->hash & (new_size - 1)];
+                    tab[e->hash & (new_size - 1)] = e;
+                }
+            }
+            js_free_rt(rt, prof->hash_table);
+            prof->hash_table = tab;
+            prof->hash_size = new_size;
+        }
+    }
+
+    e = js_malloc_rt(rt, sizeof(*e) + d->size);
+    if (!e)
+        return;
+    e->hash = h;
+    e->count = 1;
+    e->len = d->size;
+    memcpy(e->stack, d->buf, d->size);
+    e->hash_next = prof->hash_table[h & (prof->hash_size - 1)];
+    prof->hash_table[h & (prof->hash_size - 1)] = e;
+    list_add_tail(&e->link, &prof->entry_list);
+    prof->entry_count++;
+}
+
+static void js_profiler_poll(JSContext *ctx)
+{
+    JSProfiler *prof = ctx->rt->profiler;
+    int64_t t;
+
+    ctx->interrupt_counter = JS_PROFILER_COUNTER_INIT;
+    t = gc_get_time_us();
+    if (t >= prof->next_sample_time) {
+        js_profiler_sample(ctx);
+        prof->next_sample_time = t + prof->interval_us;
+    }
+}
+
+/* Heap profiler. JS_WriteHeapProfile() aggregates the live objects by
+   class and constructor name. When it is started with a non zero
+   sampling interval, one object every 'sample_interval' allocated
+   objects is also tagged with its allocation site until it is
+   freed. */
+
+typedef struct JSHeapEntry {
+    struct JSHeapEntry *hash_next;
+    uint32_t hash;
+    int64_t count;
+    int64_t size;
+    int64_t sample_count; /* allocation sites: number of samples */
+    size_t len;
+    char name[0];
+} JSHeapEntry;
+
+/* entries indexed by their name */
+typedef struct JSHeapEntryTable {
+    uint32_t hash_size; /* power of two */
+    uint32_t count;
+    JSHeapEntry **hash_table;
+} JSHeapEntryTable;
+
+typedef struct JSHeapSample {
+    struct JSHeapSample *hash_next;
+    JSObject *obj;
+    JSHeapEntry *site;
+} JSHeapSample;
+
+typedef struct JSHeapProfiler {
+    int sample_interval;
+    int sample_counter;
+    JSHeapEntryTable sites;
+    /* sampled objects indexed by their address */
+    uint32_t sample_hash_size; /* power of two */
+    uint32_t sample_count;
+    JSHeapSample **sample_hash;
+    DynBuf dbuf;
+} JSHeapProfiler;
+
+static int heap_table_init(JSRuntime *rt, JSHeapEntryTable *t)
+{
+    t->hash_size = 256;
+    t->count = 0;
+    t->hash_table = js_mallocz_rt(rt, sizeof(t->hash_table[0]) * t->hash_size);
+    return t->hash_table ? 0 : -1;
+}
+
+static void heap_table_free(JSRuntime *rt, JSHeapEntryTable *t)
+{
+    JSHeapEntry *e, *e_next;
+    uint32_t i;
+
+    if (!t->hash_table)
+        return;
+    for(i = 0; i < t->hash_size; i++) {
+        for(e = t->hash_table[i]; e != NULL; e = e_next) {
+            e_next = e->hash_next;
+            js_free_rt(rt, e);
+        }
+    }
+    js_free_rt(rt, t->hash_table);
+    t->hash_table = NULL;
+}
+
+/* return the entry of name 'buf' or create it. Return NULL if there is
+   not enough memory. */
+static JSHeapEntry *heap_table_get(JSRuntime *rt, JSHeapEntryTable *t,
+                                   const uint8_t *buf, size_t len)
+{
+    JSHeapEntry *e, *e_next, **tab;
+    uint32_t h, i, new_size;
+
+    h = hash_string8(buf, len, 0);
+    for(e = t->hash_table[h & (t->hash_size - 1)]; e != NULL; e = e->hash_next) {
+        if (e->hash == h && e->len == len && !memcmp(e->name, buf, len))
+            return e;
+    }
+    if (t->count >= t->hash_size * 2) {
+        new_size = t->hash_size * 2;
+        tab = js_mallocz_rt(rt, sizeof(tab[0]) * new_size);
+        if (tab) {
+            for(i = 0; i < t->hash_size; i++) {
+                for(e = t->hash_table[i]; e != NULL; e = e_next) {
+                    e_next = e->hash_next;
+                    e->hash_next = tab[e->hash & (new_size - 1)];
+                    tab[e->hash & (new_size - 1)] = e;
+                }
+            }
+            js_free_rt(rt, t->hash_table);
+            t->hash_table = tab;
+            t->hash_size = new_size;
+        }
+    }
+    e = js_mallocz_rt(rt, sizeof(*e) + len);
+    if (!e)
+        return NULL;
+    e->hash = h;
+    e->len = len;
+    memcpy(e->name, buf, len);
+    e->hash_next = t->hash_table[h & (t->hash_size - 1)];
+    t->hash_table[h & (t->hash_size - 1)] = e;
+    t->count++;
+    return e;
+}
+
+static int heap_entry_cmp(const void *a, const void *b, void *opaque)
+{
+    const JSHeapEntry *e1 = *(const JSHeapEntry **)a;
+    const JSHeapEntry *e2 = *(const JSHeapEntry **)b;
+    size_t len;
+    int ret;
+
+    if (e1->size != e2->size)
+        return e1->size < e2->size ? 1 : -1;
+    len = e1->len < e2->len ? e1->len : e2->len;
+    ret = memcmp(e1->name, e2->name, len);
+    if (ret == 0)
+        ret = (e1->len > e2->len) - (e1->len < e2->len);
+    return ret;
+}
+
+/* return the entries of 't' by decreasing size or NULL if there is
+   not enough memory. */
+static JSHeapEntry **heap_table_sort(JSRuntime *rt, JSHeapEntryTable *t)
+{
+    JSHeapEntry **tab, *e;
+    uint32_t i, n;
+
+    tab = js_malloc_rt(rt, sizeof(tab[0]) * max_int(t->count, 1));
+    if (!tab)
+        return NULL;
+    n = 0;
+    for(i = 0; i < t->hash_size; i++) {
+        for(e = t->hash_table[i]; e != NULL; e = e->hash_next)
+            tab[n++] = e;
+    }
+    rqsort(tab, n, sizeof(tab[0]), heap_entry_cmp, NULL);
+    return tab;
+}
+
+static inline uint32_t heap_sample_hash(JSHeapProfiler *hp, JSObject *p)
+{
+    return ((uintptr_t)p * 0x9e3779b1) >> 4 & (hp->sample_hash_size - 1);
+}
+
+int JS_StartHeapProfiler(JSRuntime *rt, int sample_interval)
+{
+    JSHeapProfiler *hp;
+
+    JS_StopHeapProfiler(rt);
+    hp = js_mallocz_rt(rt, sizeof(*hp));
+    if (!hp)
+        return -1;
+    hp->sample_interval = max_int(sample_interval, 0);
+    hp->sample_counter = hp->sample_interval;
+    hp->sample_hash_size = 256;
+    hp->sample_hash = js_mallocz_rt(rt, sizeof(hp->sample_hash[0]) *
+                                    hp->sample_hash_size);
+    if (!hp->sample_hash || heap_table_init(rt, &hp->sites)) {
+        js_free_rt(rt, hp->sample_hash);
+        js_free_rt(rt, hp);
+        return -1;
+    }
+    dbuf_init2(&hp->dbuf, rt, (DynBufReallocFunc *)js_realloc_rt);
+    rt->heap_profiler = hp;
+    return 0;
+}
+
+void JS_StopHeapProfiler(JSRuntime *rt)
+{
+    JSHeapProfiler *hp = rt->heap_profiler;
+    JSHeapSample *s, *s_next;
+    uint32_t i;
+
+    if (!hp)
+        return;
+    for(i = 0; i < hp->sample_hash_size; i++) {
+        for(s = hp->sample_hash[i]; s != NULL; s = s_next) {
+            s_next = s->hash_next;
+            js_free_rt(rt, s);
+        }
+    }
+    js_free_rt(rt, hp->sample_hash);
+    heap_table_free(rt, &hp->sites);
+    dbuf_free(&hp->dbuf);
+    js_free_rt(rt, hp);
+    rt->heap_profiler = NULL;
+}
+
+/* called when the object 'p' is allocated */
+static void js_heap_profiler_alloc(JSContext *ctx, JSObject *p)
+{
+    JSRuntime *rt = ctx->rt;
+    JSHeapProfiler *hp = rt->heap_profiler;
+    JSStackFrame *sf, *sf_top;
+    JSHeapSample *s, **tab, *s_next;
+    JSHeapEntry *site;
+    DynBuf *d = &hp->dbuf;
+    uint32_t i, h, new_size;
+    int n;
+
+    if (hp->sample_interval == 0 || --hp->sample_counter > 0)
+        return;
+    hp->sample_counter = hp->sample_interval;
+
+    /* the site is the innermost JS function and the C functions it
+       called */
+    n = 0;
+    for(sf = rt->current_stack_frame; sf != NULL; sf = sf->prev_frame) {
+        n++;
+        if (JS_VALUE_GET_TAG(sf->cur_func) == JS_TAG_OBJECT &&
+            js_class_has_bytecode(JS_VALUE_GET_OBJ(sf->cur_func)->class_id))
+            break;
+    }
+    d->size = 0;
+    d->error = FALSE;
+    if (n == 0) {
+        dbuf_putstr(d, "<no frame>");
+    } else {
+        sf_top = rt->current_stack_frame;
+        while (n > 0) {
+            n--;
+            sf = sf_top;
+            for(i = 0; i < n; i++)
+                sf = sf->prev_frame;
+            js_profiler_put_frame(ctx, d, sf);
+            if (n > 0)
+                dbuf_putc(d, ';');
+        }
+    }
+    if (d->error)
+        return;
+    site = heap_table_get(rt, &hp->sites, d->buf, d->size);
+    if (!site)
+        return;
+    site->sample_count++;
+
+    if (hp->sample_count >= hp->sample_hash_size * 2) {
+        new_size = hp->sample_hash_size * 2;
+        tab = js_mallocz_rt(rt, sizeof(tab[0]) * new_size);
+        if (tab) {
+            for(i = 0; i < hp->sample_hash_size; i++) {
+                for(s = hp->sample_hash[i]; s != NULL; s = s_next) {
+                    s_next = s->hash_next;
+                    h = ((uintptr_t)s->obj * 0x9e3779b1) >> 4 & (new_size - 1);
+                    s->hash_next = tab[h];
+                    tab[h] = s;
+                }
+            }
+            js_free_rt(rt, hp->sample_hash);
+            hp->sample_hash = tab;
+            hp->sample_hash_size = new_size;
+        }
+    }
+    s = js_malloc_rt(rt, sizeof(*s));
+    if (!s)
+        return;
+    s->obj = p;
+    s->site = site;
+    h = heap_sample_hash(hp, p);
+    s->hash_next = hp->sample_hash[h];
+    hp->sample_hash[h] = s;
+    hp->sample_count++;
+}
+
+/* called when the object 'p' is freed */
+static void js_heap_profiler_free(JSRuntime *rt, JSObject *p)
+{
+    JSHeapProfiler *hp = rt->heap_profiler;
+    JSHeapSample *s, **ps;
+
+    if (hp->sample_count == 0)
+        return;
+    for(ps = &hp->sample_hash[heap_sample_hash(hp, p)]; (s = *ps) != NULL;
+        ps = &s->hash_next) {
+        if (s->obj == p) {
+            *ps = s->hash_next;
+            js_free_rt(rt, s);
+            hp->sample_count--;
+            break;
+        }
+    }
+}
+
+/* size of the value 'val' if it is only referenced by one object. For
+   a rope, the nodes and leaves which are not shared are counted. */
+static size_t js_heap_value_size(JSValueConst val)
+{
+    JSString *str;
+    JSStringRope *r;
+
+    switch(JS_VALUE_GET_TAG(val)) {
+    case JS_TAG_STRING:
+        str = JS_VALUE_GET_STRING(val);
+        if (str->header.ref_count == 1 && !str->atom_type) {
+            return sizeof(*str) + (str->len << str->is_wide_char) +
+                1 - str->is_wide_char;
+        }
+        break;
+    case JS_TAG_STRING_ROPE:
+        /* the recursion is bounded by JS_STRING_ROPE_MAX_DEPTH */
+        r = JS_VALUE_GET_STRING_ROPE(val);
+        if (r->header.ref_count == 1) {
+            return sizeof(*r) + js_heap_value_size(r->left) +
+                js_heap_value_size(r->right);
+        }
+        break;
+    }
+    return 0;
+}
+
+/* memory used by the object 'p', its properties and elements and the
+   strings only referenced by it */
+static size_t js_heap_object_size(JSObject *p)
+{
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    size_t size;
+    int i;
+
+    size = sizeof(*p) + sh->prop_size * sizeof(*p->prop);
+    /* the hashed shapes are shared */
+    if (!sh->is_hashed)
+        size += get_shape_size(sh->prop_hash_mask + 1, sh->prop_size);
+    prs = get_shape_prop(sh);
+    for(i = 0; i < sh->prop_count; i++, prs++) {
+        if (prs->atom != JS_ATOM_NULL && !(prs->flags & JS_PROP_TMASK))
+            size += js_heap_value_size(p->prop[i].u.value);
+    }
+    switch(p->class_id) {
+    case JS_CLASS_ARRAY:
+    case JS_CLASS_ARGUMENTS:
+        if (p->fast_array && p->u.array.u.values) {
+            size += p->u.array.count * sizeof(*p->u.array.u.values);
+            for(i = 0; i < p->u.array.count; i++)
+                size += js_heap_value_size(p->u.array.u.values[i]);
+        }
+        break;
+    case JS_CLASS_ARRAY_BUFFER:
+    case JS_CLASS_SHARED_ARRAY_BUFFER:
+        if (p->u.array_buffer) {
+            size += sizeof(*p->u.array_buffer);
+            if (p->u.array_buffer->data)
+                size += p->u.array_buffer->byte_length;
+        }
+        break;
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_INT8_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+    case JS_CLASS_INT16_ARRAY:
+    case JS_CLASS_UINT16_ARRAY:
+    case JS_CLASS_INT32_ARRAY:
+    case JS_CLASS_UINT32_ARRAY:
+    case JS_CLASS_BIG_INT64_ARRAY:
+    case JS_CLASS_BIG_UINT64_ARRAY:
+    case JS_CLASS_FLOAT32_ARRAY:
+    case JS_CLASS_FLOAT64_ARRAY:
+    case JS_CLASS_DATAVIEW:
+        if (p->u.typed_array)
+            size += sizeof(*p->u.typed_array);
+        break;
+    case JS_CLASS_BYTECODE_FUNCTION:
+        if (p->u.func.var_refs) {
+            size += p->u.func.function_bytecode->closure_var_count *
+                sizeof(*p->u.func.var_refs);
+        }
+        break;
+    default:
+        break;
+    }
+    return size;
+}
+
+/* output the class name and the name of the constructor of 'p' */
+static void js_heap_put_object_name(JSRuntime *rt, DynBuf *d, JSObject *p)
+{
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    JSObject *proto;
+    char atom_buf[ATOM_GET_STR_BUF_SIZE];
+
+    dbuf_putstr(d, JS_AtomGetStrRT(rt, atom_buf, sizeof(atom_buf),
+                                   rt->class_array[p->class_id].class_name));
+    dbuf_putc(d, ' ');
+    proto = p->shape->proto;
+    if (proto) {
+        /* no getter is called */
+        prs = find_own_property(&pr, proto, JS_ATOM_constructor);
+        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+            JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_OBJECT) {
+            js_profiler_put_func_name(d, pr->u.value);
+            return;
+        }
+    }
+    dbuf_putstr(d, "-");
+}
+
+int JS_WriteHeapProfile(JSRuntime *rt, FILE *f)
+{
+    JSHeapProfiler *hp = rt->heap_profiler;
+    JSHeapEntryTable classes_s, *classes = &classes_s;
+    JSHeapEntry **tab, *e;
+    JSHeapSample *s;
+    struct list_head *el;
+    DynBuf dbuf;
+    JSObject *p;
+    size_t size;
+    int64_t total_count, total_size;
+    uint32_t i;
+    int ret = -1;
+
+    if (heap_table_init(rt, classes))
+        return -1;
+    dbuf_init2(&dbuf, rt, (DynBufReallocFunc *)js_realloc_rt);
+    total_count = 0;
+    total_size = 0;
+    list_for_each_gc_obj(el, rt) {
+        JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
+        if (gp->gc_obj_type != JS_GC_OBJ_TYPE_JS_OBJECT)
+            continue;
+        p = (JSObject *)gp;
+        dbuf.size = 0;
+        js_heap_put_object_name(rt, &dbuf, p);
+        if (dbuf.error)
+            goto done;
+        e = heap_table_get(rt, classes, dbuf.buf, dbuf.size);
+        if (!e)
+            goto done;
+        size = js_heap_object_size(p);
+        e->count++;
+        e->size += size;
+        total_count++;
+        total_size += size;
+    }
+    tab = heap_table_sort(rt, classes);
+    if (!tab)
+        goto done;
+    fprintf(f, "# objects: %" PRId64 ", size: %" PRId64 "\n"
+            "# count size class constructor\n", total_count, total_size);
+    for(i = 0; i < classes->count; i++) {
+        e = tab[i];
+        fprintf(f, "%10" PRId64 " %12" PRId64 " %.*s\n",
+                e->count, e->size, (int)e->len, e->name);
+    }
+    js_free_rt(rt, tab);
+
+    if (hp && hp->sample_interval != 0) {
+        for(i = 0; i < hp->sites.hash_size; i++) {
+            for(e = hp->sites.hash_table[i]; e != NULL; e = e->hash_next) {
+                e->count = 0;
+                e->size = 0;
+            }
+        }
+        for(i = 0; i < hp->sample_hash_size; i++) {
+            for(s = hp->sample_hash[i]; s != NULL; s = s->hash_next) {
+                s->site->count++;
+                s->site->size += js_heap_object_size(s->obj);
+            }
+        }
+        tab = heap_table_sort(rt, &hp->sites);
+        if (!tab)
+            goto done;
+        fprintf(f, "\n# allocation sites: 1 sample every %d objects\n"
+                "# live_samples live_size samples site\n",
+                hp->sample_interval);
+        for(i = 0; i < hp->sites.count; i++) {
+            e = tab[i];
+            fprintf(f, "%10" PRId64 " %12" PRId64 " %10" PRId64 " %.*s\n",
+                    e->count, e->size, e->sample_count,
+                    (int)e->len, e->name);
+        }
+        js_free_rt(rt, tab);
+    }
+    ret = ferror(f) ? -1 : 0;
+ done:
+    dbuf_free(&dbuf);
+    heap_table_free(rt, classes);
+    return ret;
+}
+
 static no_inline __exception int __js_poll_interrupts(JSContext *ctx)
 {
     JSRuntime *rt = ctx->rt;
     ctx->interrupt_counter = JS_INTERRUPT_COUNTER_INIT;
+    if (rt->profiler)
+        js_profiler_poll(ctx);
     if (rt->interrupt_handler) {
         if (rt->interrupt_handler(rt, rt->interrupt_opaque)) {
             /* XXX: should set a specific flag to avoid catching */
@@ -6851,6 +8652,11 @@ static no_inline __exception int __js_poll_interrupts(JSContext *ctx)
     return 0;
 }
 
+int JS_PollInterrupts(JSContext *ctx)
+{
+    return __js_poll_interrupts(ctx);
+}
+
 static inline __exception int js_poll_interrupts(JSContext *ctx)
 {
     if (unlikely(--ctx->interrupt_counter <= 0)) {
@@ -6960,6 +8766,7 @@ static JSValueConst JS_GetPrototypePrimitive(JSContext *ctx, JSValueConst val)
         val = ctx->class_proto[JS_CLASS_BOOLEAN];
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = ctx->class_proto[JS_CLASS_STRING];
         break;
     case JS_TAG_SYMBOL:
@@ -7156,12 +8963,16 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
         case JS_TAG_EXCEPTION:
             return JS_EXCEPTION;
         case JS_TAG_STRING:
+        case JS_TAG_STRING_ROPE:
             {
-                JSString *p1 = JS_VALUE_GET_STRING(obj);
+                JSString *p1;
                 if (__JS_AtomIsTaggedInt(prop)) {
                     uint32_t idx, ch;
                     idx = __JS_AtomToUInt32(prop);
-                    if (idx < p1->len) {
+                    if (idx < js_string_value_len(obj)) {
+                        p1 = js_get_linear_string(ctx, obj);
+                        if (!p1)
+                            return JS_EXCEPTION;
                         if (p1->is_wide_char)
                             ch = p1->u.str16[idx];
                         else
@@ -7169,7 +8980,7 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
                         return js_new_string_char(ctx, ch);
                     }
                 } else if (prop == JS_ATOM_length) {
-                    return JS_NewInt32(ctx, p1->len);
+                    return JS_NewInt32(ctx, js_string_value_len(obj));
                 }
             }
             break;
@@ -9976,6 +11787,10 @@ static int JS_ToBoolFree(JSContext *ctx, JSValue val)
             JS_FreeValue(ctx, val);
             return ret;
         }
+    case JS_TAG_STRING_ROPE:
+        /* a rope is never empty */
+        JS_FreeValue(ctx, val);
+        return TRUE;
     case JS_TAG_BIG_INT:
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
@@ -10507,6 +12322,7 @@ static JSValue JS_ToNumberHintFree(JSContext *ctx, JSValue val,
             return JS_EXCEPTION;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             const char *str;
             const char *p;
@@ -10914,6 +12730,34 @@ int JS_ToInt64Ext(JSContext *ctx, int64_t *pres, JSValueConst val)
         return JS_ToInt64(ctx, pres, val);
 }
 
+/* ToInt32() of a number */
+static inline int32_t js_double_to_int32(double d)
+{
+    JSFloat64Union u;
+    int32_t ret;
+    int e;
+
+    u.d = d;
+    /* we avoid doing fmod(x, 2^32) */
+    e = (u.u64 >> 52) & 0x7ff;
+    if (likely(e <= (1023 + 30))) {
+        /* fast case */
+        ret = (int32_t)d;
+    } else if (e <= (1023 + 30 + 53)) {
+        uint64_t v;
+        /* remainder modulo 2^32 */
+        v = (u.u64 & (((uint64_t)1 << 52) - 1)) | ((uint64_t)1 << 52);
+        v = v << ((e - 1023) - 52 + 32);
+        ret = v >> 32;
+        /* take the sign into account */
+        if (u.u64 >> 63)
+            ret = -ret;
+    } else {
+        ret = 0; /* also handles NaN and +inf */
+    }
+    return ret;
+}
+
 /* return (<0, 0) in case of exception */
 static int JS_ToInt32Free(JSContext *ctx, int32_t *pres, JSValue val)
 {
@@ -10930,30 +12774,7 @@ static int JS_ToInt32Free(JSContext *ctx, int32_t *pres, JSValue val)
         ret = JS_VALUE_GET_INT(val);
         break;
     case JS_TAG_FLOAT64:
-        {
-            JSFloat64Union u;
-            double d;
-            int e;
-            d = JS_VALUE_GET_FLOAT64(val);
-            u.d = d;
-            /* we avoid doing fmod(x, 2^32) */
-            e = (u.u64 >> 52) & 0x7ff;
-            if (likely(e <= (1023 + 30))) {
-                /* fast case */
-                ret = (int32_t)d;
-            } else if (e <= (1023 + 30 + 53)) {
-                uint64_t v;
-                /* remainder modulo 2^32 */
-                v = (u.u64 & (((uint64_t)1 << 52) - 1)) | ((uint64_t)1 << 52);
-                v = v << ((e - 1023) - 52 + 32);
-                ret = v >> 32;
-                /* take the sign into account */
-                if (u.u64 >> 63)
-                    ret = -ret;
-            } else {
-                ret = 0; /* also handles NaN and +inf */
-            }
-        }
+        ret = js_double_to_int32(JS_VALUE_GET_FLOAT64(val));
         break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
@@ -10986,6 +12807,18 @@ static inline int JS_ToUint32Free(JSContext *ctx, uint32_t *pres, JSValue val)
     return JS_ToInt32Free(ctx, (int32_t *)pres, val);
 }
 
+static inline int js_double_to_uint8_clamp(double d)
+{
+    if (isnan(d))
+        return 0;
+    else if (d < 0)
+        return 0;
+    else if (d > 255)
+        return 255;
+    else
+        return lrint(d);
+}
+
 static int JS_ToUint8ClampFree(JSContext *ctx, int32_t *pres, JSValue val)
 {
     uint32_t tag;
@@ -11005,19 +12838,7 @@ static int JS_ToUint8ClampFree(JSContext *ctx, int32_t *pres, JSValue val)
         res = max_int(0, min_int(255, res));
         break;
     case JS_TAG_FLOAT64:
-        {
-            double d = JS_VALUE_GET_FLOAT64(val);
-            if (isnan(d)) {
-                res = 0;
-            } else {
-                if (d < 0)
-                    res = 0;
-                else if (d > 255)
-                    res = 255;
-                else
-                    res = lrint(d);
-            }
-        }
+        res = js_double_to_uint8_clamp(JS_VALUE_GET_FLOAT64(val));
         break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_FLOAT:
@@ -11391,14 +13212,425 @@ static void js_ecvt1(double d, int n_digits, int *decpt, int *sign, char *buf,
 /* maximum buffer size for js_dtoa */
 #define JS_DTOA_BUF_SIZE 128
 
+/* Grisu3 double to decimal conversion (F. Loitsch, "Printing
+   Floating-Point Numbers Quickly and Accurately with Integers", 2010).
+   It only uses 64 bit integer arithmetic and fails in the rare cases
+   (about 0.5%) where the result cannot be proven correct. The printf
+   based code is then used as fallback. */
+
+typedef struct {
+    uint64_t f;
+    int e;
+} JSDiyFp; /* f * 2^e */
+
+typedef struct {
+    uint64_t f;
+    int16_t e;
+    int16_t k;
+} JSCachedPow10; /* 10^k ~= f * 2^e */
+
+#define JS_CACHED_POW10_OFFSET 348 /* -k of the first entry */
+#define JS_CACHED_POW10_STEP   8
+
+static const JSCachedPow10 js_cached_pow10[87] = {
+    { 0xfa8fd5a0081c0288, -1220, -348 },
+    { 0xbaaee17fa23ebf76, -1193, -340 },
+    { 0x8b16fb203055ac76, -1166, -332 },
+    { 0xcf42894a5dce35ea, -1140, -324 },
+    { 0x9a6bb0aa55653b2d, -1113, -316 },
+    { 0xe61acf033d1a45df, -1087, -308 },
+    { 0xab70fe17c79ac6ca, -1060, -300 },
+    { 0xff77b1fcbebcdc4f, -1034, -292 },
+    { 0xbe5691ef416bd60c, -1007, -284 },
+    { 0x8dd01fad907ffc3c,  -980, -276 },
+    { 0xd3515c2831559a83,  -954, -268 },
+    { 0x9d71ac8fada6c9b5,  -927, -260 },
+    { 0xea9c227723ee8bcb,  -901, -252 },
+    { 0xaecc49914078536d,  -874, -244 },
+    { 0x823c12795db6ce57,  -847, -236 },
+    { 0xc21094364dfb5637,  -821, -228 },
+    { 0x9096ea6f3848984f,  -794, -220 },
+    { 0xd77485cb25823ac7,  -768, -212 },
+    { 0xa086cfcd97bf97f4,  -741, -204 },
+    { 0xef340a98172aace5,  -715, -196 },
+    { 0xb23867fb2a35b28e,  -688, -188 },
+    { 0x84c8d4dfd2c63f3b,  -661, -180 },
+    { 0xc5dd44271ad3cdba,  -635, -172 },
+    { 0x936b9fcebb25c996,  -608, -164 },
+    { 0xdbac6c247d62a584,  -582, -156 },
+    { 0xa3ab66580d5fdaf6,  -555, -148 },
+    { 0xf3e2f893dec3f126,  -529, -140 },
+    { 0xb5b5ada8aaff80b8,  -502, -132 },
+    { 0x87625f056c7c4a8b,  -475, -124 },
+    { 0xc9bcff6034c13053,  -449, -116 },
+    { 0x964e858c91ba2655,  -422, -108 },
+    { 0xdff9772470297ebd,  -396, -100 },
+    { 0xa6dfbd9fb8e5b88f,  -369,  -92 },
+    { 0xf8a95fcf88747d94,  -343,  -84 },
+    { 0xb94470938fa89bcf,  -316,  -76 },
+    { 0x8a08f0f8bf0f156b,  -289,  -68 },
+    { 0xcdb02555653131b6,  -263,  -60 },
+    { 0x993fe2c6d07b7fac,  -236,  -52 },
+    { 0xe45c10c42a2b3b06,  -210,  -44 },
+    { 0xaa242499697392d3,  -183,  -36 },
+    { 0xfd87b5f28300ca0e,  -157,  -28 },
+    { 0xbce5086492111aeb,  -130,  -20 },
+    { 0x8cbccc096f5088cc,  -103,  -12 },
+    { 0xd1b71758e219652c,   -77,   -4 },
+    { 0x9c40000000000000,   -50,    4 },
+    { 0xe8d4a51000000000,   -24,   12 },
+    { 0xad78ebc5ac620000,     3,   20 },
+    { 0x813f3978f8940984,    30,   28 },
+    { 0xc097ce7bc90715b3,    56,   36 },
+    { 0x8f7e32ce7bea5c70,    83,   44 },
+    { 0xd5d238a4abe98068,   109,   52 },
+    { 0x9f4f2726179a2245,   136,   60 },
+    { 0xed63a231d4c4fb27,   162,   68 },
+    { 0xb0de65388cc8ada8,   189,   76 },
+    { 0x83c7088e1aab65db,   216,   84 },
+    { 0xc45d1df942711d9a,   242,   92 },
+    { 0x924d692ca61be758,   269,  100 },
+    { 0xda01ee641a708dea,   295,  108 },
+    { 0xa26da3999aef774a,   322,  116 },
+    { 0xf209787bb47d6b85,   348,  124 },
+    { 0xb454e4a179dd1877,   375,  132 },
+    { 0x865b86925b9bc5c2,   402,  140 },
+    { 0xc83553c5c8965d3d,   428,  148 },
+    { 0x952ab45cfa97a0b3,   455,  156 },
+    { 0xde469fbd99a05fe3,   481,  164 },
+    { 0xa59bc234db398c25,   508,  172 },
+    { 0xf6c69a72a3989f5c,   534,  180 },
+    { 0xb7dcbf5354e9bece,   561,  188 },
+    { 0x88fcf317f22241e2,   588,  196 },
+    { 0xcc20ce9bd35c78a5,   614,  204 },
+    { 0x98165af37b2153df,   641,  212 },
+    { 0xe2a0b5dc971f303a,   667,  220 },
+    { 0xa8d9d1535ce3b396,   694,  228 },
+    { 0xfb9b7cd9a4a7443c,   720,  236 },
+    { 0xbb764c4ca7a44410,   747,  244 },
+    { 0x8bab8eefb6409c1a,   774,  252 },
+    { 0xd01fef10a657842c,   800,  260 },
+    { 0x9b10a4e5e9913129,   827,  268 },
+    { 0xe7109bfba19c0c9d,   853,  276 },
+    { 0xac2820d9623bf429,   880,  284 },
+    { 0x80444b5e7aa7cf85,   907,  292 },
+    { 0xbf21e44003acdd2d,   933,  300 },
+    { 0x8e679c2f5e44ff8f,   960,  308 },
+    { 0xd433179d9c8cb841,   986,  316 },
+    { 0x9e19db92b4e31ba9,  1013,  324 },
+    { 0xeb96bf6ebadf77d9,  1039,  332 },
+    { 0xaf87023b9bf0ee6b,  1066,  340 },
+};
+
+/* the scaled values must have their binary exponent in this range */
+#define GRISU_MIN_EXP (-60)
+#define GRISU_MAX_EXP (-32)
+
+/* maximum number of digits generated by js_grisu_counted() */
+#define GRISU_MAX_DIGITS 18
+
+static JSDiyFp diyfp_normalize(uint64_t f, int e)
+{
+    JSDiyFp r;
+    int s = clz64(f);
+    r.f = f << s;
+    r.e = e - s;
+    return r;
+}
+
+/* rounded product, the result is not normalized */
+static JSDiyFp diyfp_mul(JSDiyFp x, JSDiyFp y)
+{
+    uint64_t a, b, c, d, ac, bc, ad, bd, tmp;
+    JSDiyFp r;
+
+    a = x.f >> 32;
+    b = x.f & 0xffffffff;
+    c = y.f >> 32;
+    d = y.f & 0xffffffff;
+    ac = a * c;
+    bc = b * c;
+    ad = a * d;
+    bd = b * d;
+    tmp = (bd >> 32) + (ad & 0xffffffff) + (bc & 0xffffffff);
+    tmp += (uint64_t)1 << 31;
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+/* return a power of ten c such that the binary exponent of the
+   product of c with a normalized value of exponent 'e' is in
+   [GRISU_MIN_EXP, GRISU_MAX_EXP] */
+static const JSCachedPow10 *grisu_cached_pow10(int e)
+{
+    int min_exp, k;
+    min_exp = GRISU_MIN_EXP - (e + 64);
+    k = (int)ceil((min_exp + 63) * 0.30102999566398114); /* 1 / log2(10) */
+    return &js_cached_pow10[(JS_CACHED_POW10_OFFSET + k - 1) /
+                            JS_CACHED_POW10_STEP + 1];
+}
+
+/* return the largest power of ten <= n and set *pn_digits to its
+   number of digits */
+static uint32_t grisu_biggest_pow10(uint32_t n, int *pn_digits)
+{
+    uint32_t p;
+    int k;
+    if (n == 0) {
+        *pn_digits = 0;
+        return 0;
+    }
+    p = 1;
+    k = 1;
+    while (n / 10 >= p) {
+        p *= 10;
+        k++;
+    }
+    *pn_digits = k;
+    return p;
+}
+
+static JSDiyFp grisu_unpack(double d)
+{
+    JSFloat64Union u;
+    JSDiyFp r;
+    int be;
+
+    u.d = d;
+    r.f = u.u64 & (((uint64_t)1 << 52) - 1);
+    be = (u.u64 >> 52) & 0x7ff;
+    if (be == 0) {
+        r.e = -1074;
+    } else {
+        r.f |= (uint64_t)1 << 52;
+        r.e = be - 1075;
+    }
+    return r;
+}
+
+/* move the last digit of buf towards w while it stays in the safe
+   interval. Return FALSE if the result may not be the closest
+   representation. */
+static BOOL grisu_round_weed(char *buf, int len, uint64_t dist_too_high_w,
+                             uint64_t unsafe_interval, uint64_t rest,
+                             uint64_t ten_kappa, uint64_t unit)
+{
+    uint64_t small_dist = dist_too_high_w - unit;
+    uint64_t big_dist = dist_too_high_w + unit;
+
+    while (rest < small_dist &&
+           unsafe_interval - rest >= ten_kappa &&
+           (rest + ten_kappa < small_dist ||
+            small_dist - rest >= rest + ten_kappa - small_dist)) {
+        buf[len - 1]--;
+        rest += ten_kappa;
+    }
+    if (rest < big_dist &&
+        unsafe_interval - rest >= ten_kappa &&
+        (rest + ten_kappa < big_dist ||
+         big_dist - rest > rest + ten_kappa - big_dist)) {
+        return FALSE;
+    }
+    return (2 * unit <= rest) && (rest <= unsafe_interval - 4 * unit);
+}
+
+/* 'd' must be finite and > 0. Return TRUE if buf contains the
+   shortest digits which round trip to 'd' and are the closest to 'd':
+   d ~= 0.buf * 10^*pdecpt. */
+static BOOL js_grisu_shortest(double d, char *buf, int *plen, int *pdecpt)
+{
+    const JSCachedPow10 *c;
+    JSDiyFp v, w, m_plus, m_minus, p;
+    uint64_t unit, too_high, unsafe_interval, fractionals, one_mask, rest;
+    uint32_t integrals, divisor;
+    int kappa, len, shift, digit;
+
+    v = grisu_unpack(d);
+    w = diyfp_normalize(v.f, v.e);
+    m_plus = diyfp_normalize((v.f << 1) + 1, v.e - 1);
+    if (v.f == ((uint64_t)1 << 52) && v.e > -1074) {
+        /* the lower boundary is closer */
+        m_minus.f = (v.f << 2) - 1;
+        m_minus.e = v.e - 2;
+    } else {
+        m_minus.f = (v.f << 1) - 1;
+        m_minus.e = v.e - 1;
+    }
+    m_minus.f <<= m_minus.e - m_plus.e;
+    m_minus.e = m_plus.e;
+
+    c = grisu_cached_pow10(w.e);
+    p.f = c->f;
+    p.e = c->e;
+    w = diyfp_mul(w, p);
+    m_plus = diyfp_mul(m_plus, p);
+    m_minus = diyfp_mul(m_minus, p);
+
+    /* the result must be in ]m_minus.f - unit, m_plus.f + unit[ */
+    unit = 1;
+    too_high = m_plus.f + unit;
+    unsafe_interval = too_high - (m_minus.f - unit);
+    shift = -w.e;
+    one_mask = ((uint64_t)1 << shift) - 1;
+    integrals = too_high >> shift;
+    fractionals = too_high & one_mask;
+    divisor = grisu_biggest_pow10(integrals, &kappa);
+    len = 0;
+    while (kappa > 0) {
+        digit = integrals / divisor;
+        buf[len++] = '0' + digit;
+        integrals %= divisor;
+        kappa--;
+        rest = ((uint64_t)integrals << shift) + fractionals;
+        if (rest < unsafe_interval) {
+            if (!grisu_round_weed(buf, len, too_high - w.f, unsafe_interval,
+                                  rest, (uint64_t)divisor << shift, unit))
+                return FALSE;
+            goto done;
+        }
+        divisor /= 10;
+    }
+    for(;;) {
+        fractionals *= 10;
+        unit *= 10;
+        unsafe_interval *= 10;
+        digit = fractionals >> shift;
+        buf[len++] = '0' + digit;
+        fractionals &= one_mask;
+        kappa--;
+        if (fractionals < unsafe_interval) {
+            if (!grisu_round_weed(buf, len, (too_high - w.f) * unit,
+                                  unsafe_interval, fractionals,
+                                  (uint64_t)1 << shift, unit))
+                return FALSE;
+            break;
+        }
+    }
+ done:
+    *plen = len;
+    *pdecpt = len + kappa - c->k;
+    return TRUE;
+}
+
+/* round buf to a multiple of ten_kappa. Return FALSE if rest is too
+   close to the middle to decide given the error 'unit' (it includes
+   the exact ties). */
+static BOOL grisu_round_weed_counted(char *buf, int len, uint64_t rest,
+                                     uint64_t ten_kappa, uint64_t unit,
+                                     int *pkappa)
+{
+    int i;
+    if (unit >= ten_kappa || ten_kappa - unit <= unit)
+        return FALSE;
+    if ((ten_kappa - rest > rest) && (ten_kappa - 2 * rest >= 2 * unit))
+        return TRUE;
+    if ((rest > unit) && (ten_kappa - (rest - unit) <= (rest - unit))) {
+        /* round up */
+        buf[len - 1]++;
+        for(i = len - 1; i > 0; i--) {
+            if (buf[i] != '0' + 10)
+                break;
+            buf[i] = '0';
+            buf[i - 1]++;
+        }
+        if (buf[0] == '0' + 10) {
+            buf[0] = '1';
+            (*pkappa)++;
+        }
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/* 'd' must be finite and > 0. Round 'd' to nearest with n_digits
+   significant digits or, if is_frac is TRUE, with n_digits fractional
+   digits: d ~= 0.buf * 10^*pdecpt. Return FALSE if the result could
+   not be computed or has more than GRISU_MAX_DIGITS digits. */
+static BOOL js_grisu_counted(double d, int n_digits, BOOL is_frac,
+                             char *buf, int *plen, int *pdecpt)
+{
+    const JSCachedPow10 *c;
+    JSDiyFp v, w, p;
+    uint64_t w_error, fractionals, one_mask;
+    uint32_t integrals, divisor;
+    int kappa, len, shift, digit;
+
+    v = grisu_unpack(d);
+    w = diyfp_normalize(v.f, v.e);
+    c = grisu_cached_pow10(w.e);
+    p.f = c->f;
+    p.e = c->e;
+    w = diyfp_mul(w, p);
+
+    w_error = 1;
+    shift = -w.e;
+    one_mask = ((uint64_t)1 << shift) - 1;
+    integrals = w.f >> shift;
+    fractionals = w.f & one_mask;
+    divisor = grisu_biggest_pow10(integrals, &kappa);
+    if (is_frac) {
+        /* the first digit has the weight 10^(kappa - 1 - c->k) */
+        n_digits += kappa - c->k;
+    }
+    if (n_digits <= 0 || n_digits > GRISU_MAX_DIGITS)
+        return FALSE;
+    len = 0;
+    while (kappa > 0) {
+        digit = integrals / divisor;
+        buf[len++] = '0' + digit;
+        n_digits--;
+        integrals %= divisor;
+        kappa--;
+        if (n_digits == 0)
+            break;
+        divisor /= 10;
+    }
+    if (n_digits == 0) {
+        if (!grisu_round_weed_counted(buf, len,
+                                      ((uint64_t)integrals << shift) + fractionals,
+                                      (uint64_t)divisor << shift, w_error,
+                                      &kappa))
+            return FALSE;
+    } else {
+        while (n_digits > 0 && fractionals > w_error) {
+            fractionals *= 10;
+            w_error *= 10;
+            digit = fractionals >> shift;
+            buf[len++] = '0' + digit;
+            n_digits--;
+            fractionals &= one_mask;
+            kappa--;
+        }
+        if (n_digits != 0)
+            return FALSE;
+        if (!grisu_round_weed_counted(buf, len, fractionals,
+                                      (uint64_t)1 << shift, w_error, &kappa))
+            return FALSE;
+    }
+    *plen = len;
+    *pdecpt = len + kappa - c->k;
+    return TRUE;
+}
+
 /* needed because ecvt usually limits the number of digits to
    17. Return the number of digits. */
 static int js_ecvt(double d, int n_digits, int *decpt, int *sign, char *buf,
                    BOOL is_fixed)
 {
-    int rounding_mode;
+    int rounding_mode, len;
     char buf_tmp[JS_DTOA_BUF_SIZE];
 
+    if (d != 0) {
+        /* fast path */
+        if (!is_fixed) {
+            if (js_grisu_shortest(fabs(d), buf, &len, decpt))
+                goto done;
+        } else if (n_digits <= GRISU_MAX_DIGITS) {
+            if (js_grisu_counted(fabs(d), n_digits, FALSE, buf, &len, decpt))
+                goto done;
+        }
+    }
     if (!is_fixed) {
         unsigned int n_digits_min, n_digits_max;
         /* find the minimum amount of digits (XXX: inefficient but simple) */
@@ -11451,6 +13683,10 @@ static int js_ecvt(double d, int n_digits, int *decpt, int *sign, char *buf,
     js_ecvt1(d, n_digits, decpt, sign, buf, rounding_mode,
              buf_tmp, sizeof(buf_tmp));
     return n_digits;
+ done:
+    *sign = (d < 0);
+    buf[len] = '\0';
+    return len;
 }
 
 static int js_fcvt1(char (*buf)[JS_DTOA_BUF_SIZE], double d, int n_digits,
@@ -11466,9 +13702,50 @@ static int js_fcvt1(char (*buf)[JS_DTOA_BUF_SIZE], double d, int n_digits,
     return n;
 }
 
+/* fast path of js_fcvt(). Return FALSE if the result could not be
+   computed. */
+static BOOL js_fcvt_grisu(char (*buf)[JS_DTOA_BUF_SIZE], double d,
+                          int n_digits)
+{
+    char digits[GRISU_MAX_DIGITS + 1];
+    int len, decpt;
+    char *q;
+
+    if (d == 0 ||
+        !js_grisu_counted(fabs(d), n_digits, TRUE, digits, &len, &decpt))
+        return FALSE;
+    /* the rounding may have added a leading digit */
+    while (len < decpt + n_digits)
+        digits[len++] = '0';
+    q = *buf;
+    if (d < 0)
+        *q++ = '-';
+    if (decpt <= 0) {
+        *q++ = '0';
+        *q++ = '.';
+        memset(q, '0', -decpt);
+        q += -decpt;
+        memcpy(q, digits, len);
+        q += len;
+    } else {
+        memcpy(q, digits, decpt);
+        q += decpt;
+        if (n_digits > 0) {
+            *q++ = '.';
+            memcpy(q, digits + decpt, n_digits);
+            q += n_digits;
+        }
+    }
+    *q = '\0';
+    return TRUE;
+}
+
 static void js_fcvt(char (*buf)[JS_DTOA_BUF_SIZE], double d, int n_digits)
 {
     int rounding_mode;
+
+    if (js_fcvt_grisu(buf, d, n_digits))
+        return;
     rounding_mode = FE_TONEAREST;
 #ifdef CONFIG_PRINTF_RNDN
     {
@@ -11695,6 +13972,13 @@ JSValue JS_ToStringInternal(JSContext *ctx, JSValueConst val, BOOL is_ToProperty
     switch(tag) {
     case JS_TAG_STRING:
         return JS_DupValue(ctx, val);
+    case JS_TAG_STRING_ROPE:
+        {
+            JSString *p = js_get_linear_string(ctx, val);
+            if (!p)
+                return JS_EXCEPTION;
+            return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+        }
     case JS_TAG_INT:
         snprintf(buf, sizeof(buf), "%d", JS_VALUE_GET_INT(val));
         str = buf;
@@ -11779,26 +14063,29 @@ static JSValue JS_ToStringCheckObject(JSContext *ctx, JSValueConst val)
     return JS_ToString(ctx, val);
 }
 
-static JSValue JS_ToQuotedString(JSContext *ctx, JSValueConst val1)
+/* append the JSON quoted form of 'p' */
+static int string_buffer_put_quoted(StringBuffer *b, const JSString *p)
 {
-    JSValue val;
-    JSString *p;
-    int i;
+    int i, j;
     uint32_t c;
-    StringBuffer b_s, *b = &b_s;
     char buf[16];
 
-    val = JS_ToStringCheckObject(ctx, val1);
-    if (JS_IsException(val))
-        return val;
-    p = JS_VALUE_GET_STRING(val);
-
-    if (string_buffer_init(ctx, b, p->len + 2))
-        goto fail;
-
     if (string_buffer_putc8(b, '\"'))
-        goto fail;
+        return -1;
     for(i = 0; i < p->len; ) {
+        if (!p->is_wide_char) {
+            /* copy the characters which need no quoting in one go */
+            for(j = i; j < p->len; j++) {
+                c = p->u.str8[j];
+                if (c < 32 || c == '\"' || c == '\\')
+                    break;
+            }
+            if (string_buffer_write8(b, p->u.str8 + i, j - i))
+                return -1;
+            i = j;
+            if (i >= p->len)
+                break;
+        }
         c = string_getc(p, &i);
         switch(c) {
         case '\t':
@@ -11820,23 +14107,39 @@ static JSValue JS_ToQuotedString(JSContext *ctx, JSValueConst val1)
         case '\\':
         quote:
             if (string_buffer_putc8(b, '\\'))
-                goto fail;
+                return -1;
             if (string_buffer_putc8(b, c))
-                goto fail;
+                return -1;
             break;
         default:
             if (c < 32 || is_surrogate(c)) {
                 snprintf(buf, sizeof(buf), "\\u%04x", c);
                 if (string_buffer_puts8(b, buf))
-                    goto fail;
+                    return -1;
             } else {
                 if (string_buffer_putc(b, c))
-                    goto fail;
+                    return -1;
             }
             break;
         }
     }
-    if (string_buffer_putc8(b, '\"'))
+    return string_buffer_putc8(b, '\"');
+}
+
+static JSValue JS_ToQuotedString(JSContext *ctx, JSValueConst val1)
+{
+    JSValue val;
+    JSString *p;
+    StringBuffer b_s, *b = &b_s;
+
+    val = JS_ToStringCheckObject(ctx, val1);
+    if (JS_IsException(val))
+        return val;
+    p = JS_VALUE_GET_STRING(val);
+
+    if (string_buffer_init(ctx, b, p->len + 2))
+        goto fail;
+    if (string_buffer_put_quoted(b, p))
         goto fail;
     JS_FreeValue(ctx, val);
     return string_buffer_end(b);
@@ -12061,6 +14364,12 @@ static __maybe_unused void JS_DumpValueShort(JSRuntime *rt,
             JS_DumpString(rt, p);
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_STRING_ROPE(val);
+            printf("[rope len=%u depth=%d]", r->len, r->depth);
+        }
+        break;
     case JS_TAG_FUNCTION_BYTECODE:
         {
             JSFunctionBytecode *b = JS_VALUE_GET_PTR(val);
@@ -12273,6 +14582,7 @@ static bf_t *JS_ToBigIntFree(JSContext *ctx, bf_t *buf, JSValue val)
         break;
 #endif
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_StringToBigIntErr(ctx, val);
         if (JS_IsException(val))
             return NULL;
@@ -13675,10 +15985,10 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         /* try to call an overloaded operator */
         if ((tag1 == JS_TAG_OBJECT &&
              (tag2 != JS_TAG_NULL && tag2 != JS_TAG_UNDEFINED &&
-              tag2 != JS_TAG_STRING)) ||
+              !tag_is_string(tag2))) ||
             (tag2 == JS_TAG_OBJECT &&
              (tag1 != JS_TAG_NULL && tag1 != JS_TAG_UNDEFINED &&
-              tag1 != JS_TAG_STRING))) {
+              !tag_is_string(tag1)))) {
             JSValue res;
             int ret = js_call_binary_op_fallback(ctx, &res, op1, op2, OP_add,
                                                  FALSE, HINT_NONE);
@@ -13709,7 +16019,7 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         tag2 = JS_VALUE_GET_NORM_TAG(op2);
     }
 
-    if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+    if (tag_is_string(tag1) || tag_is_string(tag2)) {
         sp[-2] = JS_ConcatString(ctx, op1, op2);
         if (JS_IsException(sp[-2]))
             goto exception;
@@ -14006,11 +16316,15 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
 
-    if (tag1 == JS_TAG_STRING && tag2 == JS_TAG_STRING) {
-        JSString *p1, *p2;
-        p1 = JS_VALUE_GET_STRING(op1);
-        p2 = JS_VALUE_GET_STRING(op2);
-        res = js_string_compare(ctx, p1, p2);
+    if (tag_is_string(tag1) && tag_is_string(tag2)) {
+        if (tag1 == JS_TAG_STRING && tag2 == JS_TAG_STRING) {
+            JSString *p1, *p2;
+            p1 = JS_VALUE_GET_STRING(op1);
+            p2 = JS_VALUE_GET_STRING(op2);
+            res = js_string_compare(ctx, p1, p2);
+        } else {
+            res = js_string_rope_compare(op1, op2, FALSE);
+        }
         switch(op) {
         case OP_lt:
             res = (res < 0);
@@ -14033,15 +16347,15 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
         /* fast path for float64/int */
         goto float64_compare;
     } else {
-        if (((tag1 == JS_TAG_BIG_INT && tag2 == JS_TAG_STRING) ||
-             (tag2 == JS_TAG_BIG_INT && tag1 == JS_TAG_STRING)) &&
+        if (((tag1 == JS_TAG_BIG_INT && tag_is_string(tag2)) ||
+             (tag2 == JS_TAG_BIG_INT && tag_is_string(tag1))) &&
             !is_math_mode(ctx)) {
-            if (tag1 == JS_TAG_STRING) {
+            if (tag_is_string(tag1)) {
                 op1 = JS_StringToBigInt(ctx, op1);
                 if (JS_VALUE_GET_TAG(op1) != JS_TAG_BIG_INT)
                     goto invalid_bigint_string;
             }
-            if (tag2 == JS_TAG_STRING) {
+            if (tag_is_string(tag2)) {
                 op2 = JS_StringToBigInt(ctx, op2);
                 if (JS_VALUE_GET_TAG(op2) != JS_TAG_BIG_INT) {
                 invalid_bigint_string:
@@ -14184,7 +16498,8 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
             if (res < 0)
                 goto exception;
         }
-    } else if (tag1 == tag2) {
+    } else if (tag1 == tag2 ||
+               (tag_is_string(tag1) && tag_is_string(tag2))) {
 #ifdef CONFIG_BIGNUM
         if (tag1 == JS_TAG_OBJECT) {
             /* try the fallback operator */
@@ -14207,17 +16522,17 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
     } else if ((tag1 == JS_TAG_NULL && tag2 == JS_TAG_UNDEFINED) ||
                (tag2 == JS_TAG_NULL && tag1 == JS_TAG_UNDEFINED)) {
         res = TRUE;
-    } else if ((tag1 == JS_TAG_STRING && tag_is_number(tag2)) ||
-               (tag2 == JS_TAG_STRING && tag_is_number(tag1))) {
+    } else if ((tag_is_string(tag1) && tag_is_number(tag2)) ||
+               (tag_is_string(tag2) && tag_is_number(tag1))) {
 
         if ((tag1 == JS_TAG_BIG_INT || tag2 == JS_TAG_BIG_INT) &&
             !is_math_mode(ctx)) {
-            if (tag1 == JS_TAG_STRING) {
+            if (tag_is_string(tag1)) {
                 op1 = JS_StringToBigInt(ctx, op1);
                 if (JS_VALUE_GET_TAG(op1) != JS_TAG_BIG_INT)
                     goto invalid_bigint_string;
             }
-            if (tag2 == JS_TAG_STRING) {
+            if (tag_is_string(tag2)) {
                 op2 = JS_StringToBigInt(ctx, op2);
                 if (JS_VALUE_GET_TAG(op2) != JS_TAG_BIG_INT) {
                 invalid_bigint_string:
@@ -14247,9 +16562,9 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
         op2 = JS_NewInt32(ctx, JS_VALUE_GET_INT(op2));
         goto redo;
     } else if ((tag1 == JS_TAG_OBJECT &&
-                (tag_is_number(tag2) || tag2 == JS_TAG_STRING || tag2 == JS_TAG_SYMBOL)) ||
+                (tag_is_number(tag2) || tag_is_string(tag2) || tag2 == JS_TAG_SYMBOL)) ||
                (tag2 == JS_TAG_OBJECT &&
-                (tag_is_number(tag1) || tag1 == JS_TAG_STRING || tag1 == JS_TAG_SYMBOL))) {
+                (tag_is_number(tag1) || tag_is_string(tag1) || tag1 == JS_TAG_SYMBOL))) {
 #ifdef CONFIG_BIGNUM
         /* try the fallback operator */
         res = js_call_binary_op_fallback(ctx, &ret, op1, op2,
@@ -14422,14 +16737,17 @@ static BOOL js_strict_eq2(JSContext *ctx, JSValue op1, JSValue op2,
         res = (tag1 == tag2);
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             JSString *p1, *p2;
-            if (tag1 != tag2) {
+            if (!tag_is_string(tag2)) {
                 res = FALSE;
-            } else {
+            } else if (tag1 == JS_TAG_STRING && tag2 == JS_TAG_STRING) {
                 p1 = JS_VALUE_GET_STRING(op1);
                 p2 = JS_VALUE_GET_STRING(op2);
                 res = (js_string_compare(ctx, p1, p2) == 0);
+            } else {
+                res = (js_string_rope_compare(op1, op2, TRUE) == 0);
             }
         }
         break;
@@ -14728,6 +17046,7 @@ static __exception int js_operator_typeof(JSContext *ctx, JSValueConst op1)
         atom = JS_ATOM_boolean;
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         atom = JS_ATOM_string;
         break;
     case JS_TAG_OBJECT:
@@ -15370,6 +17689,9 @@ static __exception int js_for_of_start(JSContext *ctx, JSValue *sp,
     return 0;
 }
 
+static BOOL js_array_iterator_fast_next(JSContext *ctx, JSValueConst enum_obj,
+                                        JSValueConst method, JSValue *pval);
+
 /* enum_rec [objs] -> enum_rec [objs] value done. There are 'offset'
    objs. If 'done' is true or in case of exception, 'enum_rec' is set
    to undefined. If 'done' is true, 'value' is always set to
@@ -15380,6 +17702,12 @@ static __exception int js_for_of_next(JSContext *ctx, JSValue *sp, int offset)
     int done = 1;
 
     if (likely(!JS_IsUndefined(sp[offset]))) {
+        if (js_array_iterator_fast_next(ctx, sp[offset], sp[offset + 1],
+                                        &value)) {
+            sp[0] = value;
+            sp[1] = JS_FALSE;
+            return 0;
+        }
         value = JS_IteratorNext(ctx, sp[offset], sp[offset + 1], 0, NULL, &done);
         if (JS_IsException(value))
             done = -1;
@@ -15778,6 +18106,13 @@ static JSValue js_closure(JSContext *ctx, JSValue bfunc,
     JSAtom name_atom;
 
     b = JS_VALUE_GET_PTR(bfunc);
+    if (b->is_lazy && !JS_IsUndefined(b->cpool[0])) {
+        /* already compiled: use the bytecode directly */
+        JSValue bfunc1 = JS_DupValue(ctx, b->cpool[0]);
+        JS_FreeValue(ctx, bfunc);
+        bfunc = bfunc1;
+        b = JS_VALUE_GET_PTR(bfunc);
+    }
     func_obj = JS_NewObjectClass(ctx, func_kind_to_class_id[b->func_kind]);
     if (JS_IsException(func_obj)) {
         JS_FreeValue(ctx, bfunc);
@@ -16033,6 +18368,7 @@ static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
         /* here this_obj is new_target */
         /* fall thru */
     case JS_CFUNC_generic:
+    case JS_CFUNC_leaf:
         ret_val = func.generic(ctx, this_obj, argc, arg_buf);
         break;
     case JS_CFUNC_constructor_magic:
@@ -16087,6 +18423,32 @@ static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
             ret_val = JS_NewFloat64(ctx, func.f_f_f(d1, d2));
         }
         break;
+    case JS_CFUNC_i_i:
+        {
+            int32_t v1;
+
+            if (unlikely(JS_ToInt32(ctx, &v1, arg_buf[0]))) {
+                ret_val = JS_EXCEPTION;
+                break;
+            }
+            ret_val = JS_NewInt32(ctx, func.i_i(v1));
+        }
+        break;
+    case JS_CFUNC_i_i_i:
+        {
+            int32_t v1, v2;
+
+            if (unlikely(JS_ToInt32(ctx, &v1, arg_buf[0]))) {
+                ret_val = JS_EXCEPTION;
+                break;
+            }
+            if (unlikely(JS_ToInt32(ctx, &v2, arg_buf[1]))) {
+                ret_val = JS_EXCEPTION;
+                break;
+            }
+            ret_val = JS_NewInt32(ctx, func.i_i_i(v1, v2));
+        }
+        break;
     case JS_CFUNC_iterator_next:
         {
             int done;
@@ -16105,6 +18467,87 @@ static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
     return ret_val;
 }
 
+static inline BOOL js_get_float64_fast(double *pres, JSValueConst val)
+{
+    uint32_t tag = JS_VALUE_GET_NORM_TAG(val);
+    if (tag == JS_TAG_INT) {
+        *pres = JS_VALUE_GET_INT(val);
+        return TRUE;
+    } else if (tag == JS_TAG_FLOAT64) {
+        *pres = JS_VALUE_GET_FLOAT64(val);
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+static inline BOOL js_get_int32_fast(int32_t *pres, JSValueConst val)
+{
+    uint32_t tag = JS_VALUE_GET_NORM_TAG(val);
+    if (tag == JS_TAG_INT) {
+        *pres = JS_VALUE_GET_INT(val);
+        return TRUE;
+    } else if (tag == JS_TAG_FLOAT64) {
+        *pres = js_double_to_int32(JS_VALUE_GET_FLOAT64(val));
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/* Call from the interpreter of the C functions which cannot call JS
+   code: the leaf functions and the typed functions when their
+   arguments are numbers, so that no conversion may have side
+   effects. No stack frame is created and the arguments are not
+   copied. Return FALSE if 'func_obj' cannot be called this way. */
+static inline BOOL js_call_c_function_leaf(JSContext *ctx, JSValue *pret,
+                                           JSValueConst func_obj,
+                                           JSValueConst this_obj,
+                                           int argc, JSValueConst *argv)
+{
+    JSObject *p;
+    JSCFunctionType func;
+    double d1, d2;
+    int32_t v1, v2;
+
+    if (JS_VALUE_GET_TAG(func_obj) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(func_obj);
+    if (p->class_id != JS_CLASS_C_FUNCTION ||
+        argc < p->u.cfunc.length)
+        return FALSE;
+    func = p->u.cfunc.c_function;
+    switch(p->u.cfunc.cproto) {
+    case JS_CFUNC_leaf:
+        *pret = func.generic(p->u.cfunc.realm, this_obj, argc, argv);
+        return TRUE;
+    case JS_CFUNC_f_f:
+        if (!js_get_float64_fast(&d1, argv[0]))
+            return FALSE;
+        *pret = JS_NewFloat64(ctx, func.f_f(d1));
+        return TRUE;
+    case JS_CFUNC_f_f_f:
+        if (!js_get_float64_fast(&d1, argv[0]) ||
+            !js_get_float64_fast(&d2, argv[1]))
+            return FALSE;
+        *pret = JS_NewFloat64(ctx, func.f_f_f(d1, d2));
+        return TRUE;
+    case JS_CFUNC_i_i:
+        if (!js_get_int32_fast(&v1, argv[0]))
+            return FALSE;
+        *pret = JS_NewInt32(ctx, func.i_i(v1));
+        return TRUE;
+    case JS_CFUNC_i_i_i:
+        if (!js_get_int32_fast(&v1, argv[0]) ||
+            !js_get_int32_fast(&v2, argv[1]))
+            return FALSE;
+        *pret = JS_NewInt32(ctx, func.i_i_i(v1, v2));
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
 static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
                                       JSValueConst this_obj,
                                       int argc, JSValueConst *argv, int flags)
@@ -16154,6 +18597,113 @@ typedef enum {
 #define FUNC_RET_YIELD_STAR    2
 #define FUNC_RET_INITIAL_YIELD 3
 
+/* return the cached property of 'p' or NULL if the inline cache does
+   not match */
+static force_inline JSProperty *js_ic_find(JSFunctionBytecode *b,
+                                           int ic_idx, JSObject *p)
+{
+    JSInlineCacheEntry *e;
+    JSShape *sh;
+    int i;
+
+    if (unlikely(!b->ic))
+        return NULL;
+    sh = p->shape;
+    e = b->ic[ic_idx].entries;
+    for(i = 0; i < JS_IC_WAYS; i++, e++) {
+        if (e->shape == sh) {
+            if (likely(!e->proto_shape))
+                return &p->prop[e->prop_idx];
+            /* an exotic object may share the shape of an ordinary
+               object but define the property itself (e.g. a numeric
+               key of a typed array) */
+            if (unlikely(p->is_exotic))
+                return NULL;
+            /* the receiver shape also defines its prototype */
+            p = sh->proto;
+            if (p->shape == e->proto_shape)
+                return &p->prop[e->prop_idx];
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
+/* update the inline cache after a property access on 'obj' which did
+   not hit it. Only plain data properties are cached: own properties
+   or, for reads, properties of the direct prototype. */
+static no_inline void js_ic_update(JSContext *ctx, JSFunctionBytecode *b,
+                                   int ic_idx, JSValueConst obj, JSAtom atom,
+                                   BOOL is_put)
+{
+    JSRuntime *rt = ctx->rt;
+    JSObject *p, *p1;
+    JSShape *sh, *proto_sh;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSInlineCache *ic;
+    JSInlineCacheEntry *e;
+
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+        return;
+    p = JS_VALUE_GET_OBJ(obj);
+    sh = p->shape;
+    /* non hashed shapes can be modified in place */
+    if (!sh->is_hashed)
+        return;
+    prs = find_own_property(&pr, p, atom);
+    if (prs) {
+        if (is_put) {
+            if ((prs->flags & (JS_PROP_TMASK | JS_PROP_WRITABLE |
+                               JS_PROP_LENGTH)) != JS_PROP_WRITABLE)
+                return;
+        } else {
+            if (prs->flags & JS_PROP_TMASK)
+                return;
+        }
+        p1 = p;
+        proto_sh = NULL;
+    } else {
+        /* exotic objects may define the property */
+        if (is_put || p->is_exotic)
+            return;
+        p1 = sh->proto;
+        if (!p1 || !p1->shape->is_hashed)
+            return;
+        prs = find_own_property(&pr, p1, atom);
+        if (!prs || (prs->flags & JS_PROP_TMASK))
+            return;
+        proto_sh = p1->shape;
+    }
+
+    if (!b->ic) {
+        b->ic = js_mallocz_rt(rt, sizeof(b->ic[0]) * b->ic_count);
+        if (!b->ic)
+            return;
+    }
+    ic = &b->ic[ic_idx];
+    e = &ic->entries[ic->next_entry];
+    ic->next_entry = (ic->next_entry + 1) % JS_IC_WAYS;
+    js_free_shape_null(rt, e->shape);
+    js_free_shape_null(rt, e->proto_shape);
+    e->shape = js_dup_shape(sh);
+    e->proto_shape = proto_sh ? js_dup_shape(proto_sh) : NULL;
+    e->prop_idx = pr - p1->prop;
+}
+
+#ifdef DUMP_OPCODE_STATS
+static inline int js_count_opcode(JSRuntime *rt, int *plast_opcode,
+                                  int opcode)
+{
+    JSOpcodeStats *s = rt->opcode_stats;
+    s->count[opcode]++;
+    if (*plast_opcode >= 0)
+        s->pair_count[*plast_opcode][opcode]++;
+    *plast_opcode = opcode;
+    return opcode;
+}
+#endif
+
 /* argv[] is modified if (flags & JS_CALL_FLAG_COPY_ARGV) = 0. */
 static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                                JSValueConst this_obj, JSValueConst new_target,
@@ -16169,9 +18719,15 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     JSValue *local_buf, *stack_buf, *var_buf, *arg_buf, *sp, ret_val, *pval;
     JSVarRef **var_refs;
     size_t alloca_size;
+#ifdef DUMP_OPCODE_STATS
+    int last_opcode = -1;
+#define FETCH_OPCODE(pc) js_count_opcode(rt, &last_opcode, opcode = *pc++)
+#else
+#define FETCH_OPCODE(pc) (opcode = *pc++)
+#endif
 
 #if !DIRECT_DISPATCH
-#define SWITCH(pc)      switch (opcode = *pc++)
+#define SWITCH(pc)      switch (FETCH_OPCODE(pc))
 #define CASE(op)        case op
 #define DEFAULT         default
 #define BREAK           break
@@ -16186,11 +18742,20 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 #include "quickjs-opcode.h"
         [ OP_COUNT ... 255 ] = &&case_default
     };
-#define SWITCH(pc)      goto *dispatch_table[opcode = *pc++];
+#define SWITCH(pc)      goto *dispatch_table[FETCH_OPCODE(pc)];
 #define CASE(op)        case_ ## op
 #define DEFAULT         case_default
 #define BREAK           SWITCH(pc)
 #endif
+    /* the PC is saved so that the profiler samples the current line */
+#define POLL_INTERRUPTS()                                       \
+    do {                                                        \
+        if (unlikely(--ctx->interrupt_counter <= 0)) {          \
+            sf->cur_pc = pc;                                    \
+            if (__js_poll_interrupts(ctx))                      \
+                goto exception;                                 \
+        }                                                       \
+    } while (0)
 
     if (js_poll_interrupts(caller_ctx))
         return JS_EXCEPTION;
@@ -16232,6 +18797,20 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                          (JSValueConst *)argv, flags);
     }
     b = p->u.func.function_bytecode;
+    if (unlikely(b->is_lazy)) {
+        if (js_lazy_function_init(caller_ctx, p))
+            return JS_EXCEPTION;
+        b = p->u.func.function_bytecode;
+    }
+    if (unlikely(b->aot_func)) {
+        JSValue ret;
+        int res;
+        /* the function has no side effect: it can be executed by the
+           interpreter if the C code does not handle the call */
+        res = b->aot_func(b->realm, &ret, argc, (JSValueConst *)argv);
+        if (res != 0)
+            return res < 0 ? JS_EXCEPTION : ret;
+    }
 
     if (unlikely(argc < b->arg_count || (flags & JS_CALL_FLAG_COPY_ARGV))) {
         arg_allocated_size = b->arg_count;
@@ -16271,6 +18850,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     stack_buf = var_buf + b->var_count;
     sp = stack_buf;
     pc = b->byte_code_buf;
+    sf->cur_pc = pc;
     sf->prev_frame = rt->current_stack_frame;
     rt->current_stack_frame = sf;
     ctx = b->realm; /* set the current realm */
@@ -16599,8 +19179,12 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             has_call_argc:
                 call_argv = sp - call_argc;
                 sf->cur_pc = pc;
-                ret_val = JS_CallInternal(ctx, call_argv[-1], JS_UNDEFINED,
-                                          JS_UNDEFINED, call_argc, call_argv, 0);
+                if (!js_call_c_function_leaf(ctx, &ret_val, call_argv[-1],
+                                             JS_UNDEFINED, call_argc,
+                                             (JSValueConst *)call_argv)) {
+                    ret_val = JS_CallInternal(ctx, call_argv[-1], JS_UNDEFINED,
+                                              JS_UNDEFINED, call_argc, call_argv, 0);
+                }
                 if (unlikely(JS_IsException(ret_val)))
                     goto exception;
                 if (opcode == OP_tail_call)
@@ -16635,8 +19219,12 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 pc += 2;
                 call_argv = sp - call_argc;
                 sf->cur_pc = pc;
-                ret_val = JS_CallInternal(ctx, call_argv[-1], call_argv[-2],
-                                          JS_UNDEFINED, call_argc, call_argv, 0);
+                if (!js_call_c_function_leaf(ctx, &ret_val, call_argv[-1],
+                                             call_argv[-2], call_argc,
+                                             (JSValueConst *)call_argv)) {
+                    ret_val = JS_CallInternal(ctx, call_argv[-1], call_argv[-2],
+                                              JS_UNDEFINED, call_argc, call_argv, 0);
+                }
                 if (unlikely(JS_IsException(ret_val)))
                     goto exception;
                 if (opcode == OP_tail_call_method)
@@ -17238,19 +19826,16 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 
         CASE(OP_goto):
             pc += (int32_t)get_u32(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            POLL_INTERRUPTS();
             BREAK;
 #if SHORT_OPCODES
         CASE(OP_goto16):
             pc += (int16_t)get_u16(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            POLL_INTERRUPTS();
             BREAK;
         CASE(OP_goto8):
             pc += (int8_t)pc[0];
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            POLL_INTERRUPTS();
             BREAK;
 #endif
         CASE(OP_if_true):
@@ -17269,8 +19854,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (res) {
                     pc += (int32_t)get_u32(pc - 4) - 4;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_INTERRUPTS();
             }
             BREAK;
         CASE(OP_if_false):
@@ -17290,8 +19874,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (!res) {
                     pc += (int32_t)get_u32(pc - 4) - 4;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_INTERRUPTS();
             }
             BREAK;
 #if SHORT_OPCODES
@@ -17311,8 +19894,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (res) {
                     pc += (int8_t)pc[-1] - 1;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_INTERRUPTS();
             }
             BREAK;
         CASE(OP_if_false8):
@@ -17331,8 +19913,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 if (!res) {
                     pc += (int8_t)pc[-1] - 1;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_INTERRUPTS();
             }
             BREAK;
 #endif
@@ -17551,6 +20132,82 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             BREAK;
 
+        CASE(OP_get_field_ic):
+            {
+                JSValue val;
+                JSAtom atom;
+                JSProperty *pr;
+                int ic_idx;
+                atom = get_u32(pc);
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
+
+                if (likely(JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_OBJECT) &&
+                    (pr = js_ic_find(b, ic_idx, JS_VALUE_GET_OBJ(sp[-1])))) {
+                    val = JS_DupValue(ctx, pr->u.value);
+                } else {
+                    val = JS_GetProperty(ctx, sp[-1], atom);
+                    if (unlikely(JS_IsException(val)))
+                        goto exception;
+                    js_ic_update(ctx, b, ic_idx, sp[-1], atom, FALSE);
+                }
+                JS_FreeValue(ctx, sp[-1]);
+                sp[-1] = val;
+            }
+            BREAK;
+
+        CASE(OP_get_field2_ic):
+            {
+                JSValue val;
+                JSAtom atom;
+                JSProperty *pr;
+                int ic_idx;
+                atom = get_u32(pc);
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
+
+                if (likely(JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_OBJECT) &&
+                    (pr = js_ic_find(b, ic_idx, JS_VALUE_GET_OBJ(sp[-1])))) {
+                    val = JS_DupValue(ctx, pr->u.value);
+                } else {
+                    val = JS_GetProperty(ctx, sp[-1], atom);
+                    if (unlikely(JS_IsException(val)))
+                        goto exception;
+                    js_ic_update(ctx, b, ic_idx, sp[-1], atom, FALSE);
+                }
+                *sp++ = val;
+            }
+            BREAK;
+
+        CASE(OP_put_field_ic):
+            {
+                int ret;
+                JSAtom atom;
+                JSProperty *pr;
+                int ic_idx;
+                atom = get_u32(pc);
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
+
+                if (likely(JS_VALUE_GET_TAG(sp[-2]) == JS_TAG_OBJECT) &&
+                    (pr = js_ic_find(b, ic_idx, JS_VALUE_GET_OBJ(sp[-2])))) {
+                    set_value(ctx, &pr->u.value, sp[-1]);
+                } else {
+                    ret = JS_SetPropertyInternal(ctx, sp[-2], atom, sp[-1], sp[-2],
+                                                 JS_PROP_THROW_STRICT);
+                    if (likely(ret >= 0))
+                        js_ic_update(ctx, b, ic_idx, sp[-2], atom, TRUE);
+                    JS_FreeValue(ctx, sp[-2]);
+                    sp -= 2;
+                    if (unlikely(ret < 0))
+                        goto exception;
+                    BREAK;
+                }
+                JS_FreeValue(ctx, sp[-2]);
+                sp -= 2;
+            }
+            BREAK;
+
         CASE(OP_private_symbol):
             {
                 JSAtom atom;
@@ -17938,12 +20595,12 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     *pv = __JS_NewFloat64(ctx, JS_VALUE_GET_FLOAT64(*pv) +
                                                JS_VALUE_GET_FLOAT64(op2));
                     sp--;
-                } else if (JS_VALUE_GET_TAG(*pv) == JS_TAG_STRING) {
+                } else if (tag_is_string(JS_VALUE_GET_TAG(*pv))) {
                     sp--;
                     op2 = JS_ToPrimitiveFree(ctx, op2, HINT_NONE);
                     if (JS_IsException(op2))
                         goto exception;
-                    if (JS_ConcatStringInPlace(ctx, JS_VALUE_GET_STRING(*pv), op2)) {
+                    if (JS_ConcatStringInPlace(ctx, *pv, op2)) {
                         JS_FreeValue(ctx, op2);
                     } else {
                         op2 = JS_ConcatString(ctx, JS_DupValue(ctx, *pv), op2);
@@ -18391,6 +21048,43 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             OP_CMP(OP_strict_eq, ==, js_strict_eq_slow(ctx, sp, 0));
             OP_CMP(OP_strict_neq, !=, js_strict_eq_slow(ctx, sp, 1));
 
+#if SHORT_OPCODES
+            /* comparison followed by if_false8 */
+#define OP_CMP_IF_FALSE8(opcode, binary_op, slow_call)                  \
+            CASE(opcode):                                               \
+                {                                                       \
+                JSValue op1, op2;                                       \
+                int res;                                                \
+                op1 = sp[-2];                                           \
+                op2 = sp[-1];                                           \
+                if (likely(JS_VALUE_IS_BOTH_INT(op1, op2))) {           \
+                    res = JS_VALUE_GET_INT(op1) binary_op JS_VALUE_GET_INT(op2); \
+                } else {                                                \
+                    if (slow_call)                                      \
+                        goto exception;                                 \
+                    /* the result is not a boolean with the operator \
+                       overloading */                                   \
+                    op1 = sp[-2];                                       \
+                    if ((uint32_t)JS_VALUE_GET_TAG(op1) <= JS_TAG_UNDEFINED) \
+                        res = JS_VALUE_GET_INT(op1);                    \
+                    else                                                \
+                        res = JS_ToBoolFree(ctx, op1);                  \
+                }                                                       \
+                sp -= 2;                                                \
+                pc += 1;                                                \
+                if (!res) {                                             \
+                    pc += (int8_t)pc[-1] - 1;                           \
+                }                                                       \
+                POLL_INTERRUPTS();                                      \
+                }                                                       \
+            BREAK
+
+            OP_CMP_IF_FALSE8(OP_lt_if_false8, <, js_relational_slow(ctx, sp, OP_lt));
+            OP_CMP_IF_FALSE8(OP_lte_if_false8, <=, js_relational_slow(ctx, sp, OP_lte));
+            OP_CMP_IF_FALSE8(OP_gt_if_false8, >, js_relational_slow(ctx, sp, OP_gt));
+            OP_CMP_IF_FALSE8(OP_strict_eq_if_false8, ==, js_strict_eq_slow(ctx, sp, 0));
+#endif
+
 #ifdef CONFIG_BIGNUM
         CASE(OP_mul_pow10):
             if (rt->bigfloat_ops.mul_pow10(ctx, sp))
@@ -18890,6 +21584,11 @@ static JSAsyncFunctionState *async_func_init(JSContext *ctx,
     JSStackFrame *sf;
     int local_count, i, arg_buf_len, n;
 
+    p = JS_VALUE_GET_OBJ(func_obj);
+    if (unlikely(p->u.func.function_bytecode->is_lazy)) {
+        if (js_lazy_function_init(ctx, p))
+            return NULL;
+    }
     s = js_mallocz(ctx, sizeof(*s));
     if (!s)
         return NULL;
@@ -19003,6 +21702,8 @@ static void async_func_free(JSRuntime *rt, JSAsyncFunctionState *s)
             if (rt->gc_phase == JS_GC_PHASE_NONE) {
                 free_zero_refcount(rt);
             }
+        } else {
+            gc_free_with_cycles(rt, &s->header);
         }
     }
 }
@@ -19255,6 +21956,13 @@ static void js_async_function_resume(JSContext *ctx, JSAsyncFunctionState *s)
 
         /* await */
         JS_FreeValue(ctx, func_ret); /* not used */
+        res = js_async_function_await_fast(ctx, s, value);
+        if (res <= 0) {
+            JS_FreeValue(ctx, value);
+            if (res < 0)
+                goto fail;
+            return;
+        }
         promise = js_promise_resolve(ctx, ctx->promise_ctor,
                                      1, (JSValueConst *)&value, 0);
         JS_FreeValue(ctx, value);
@@ -19280,6 +21988,21 @@ static void js_async_function_resume(JSContext *ctx, JSAsyncFunctionState *s)
     }
 }
 
+/* resume 's' with the result of 'await' */
+static void js_async_function_resume_job(JSContext *ctx,
+                                         JSAsyncFunctionState *s,
+                                         JSValueConst value, BOOL is_reject)
+{
+    s->throw_flag = is_reject;
+    if (is_reject) {
+        JS_Throw(ctx, JS_DupValue(ctx, value));
+    } else {
+        /* return value of await */
+        s->frame.cur_sp[-1] = JS_DupValue(ctx, value);
+    }
+    js_async_function_resume(ctx, s);
+}
+
 static JSValue js_async_function_resolve_call(JSContext *ctx,
                                               JSValueConst func_obj,
                                               JSValueConst this_obj,
@@ -19295,14 +22018,7 @@ static JSValue js_async_function_resolve_call(JSContext *ctx,
         arg = argv[0];
     else
         arg = JS_UNDEFINED;
-    s->throw_flag = is_reject;
-    if (is_reject) {
-        JS_Throw(ctx, JS_DupValue(ctx, arg));
-    } else {
-        /* return value of await */
-        s->frame.cur_sp[-1] = JS_DupValue(ctx, arg);
-    }
-    js_async_function_resume(ctx, s);
+    js_async_function_resume_job(ctx, s, arg, is_reject);
     return JS_UNDEFINED;
 }
 
@@ -20046,6 +22762,8 @@ typedef struct JSFunctionDef {
     int jump_size;
     int jump_count;
 
+    int ic_count; /* number of inline caches allocated in phase 3 */
+
     LineNumberSlot *line_number_slots;
     int line_number_size;
     int line_number_count;
@@ -20062,6 +22780,11 @@ typedef struct JSFunctionDef {
 
     JSModuleDef *module; /* != NULL when parsing a module */
     BOOL has_await; /* TRUE if await is used (used in module eval) */
+    BOOL can_be_lazy; /* TRUE if the function may be compiled on its first call */
+    /* names referenced by the body when it was only scanned */
+    JSAtom *lazy_names;
+    int lazy_name_count;
+    int lazy_name_size;
 } JSFunctionDef;
 
 typedef struct JSToken {
@@ -20099,6 +22822,7 @@ typedef struct JSParseState {
     JSToken token;
     BOOL got_lf; /* true if got line feed before the current token */
     const uint8_t *last_ptr;
+    const uint8_t *buf_start;
     const uint8_t *buf_ptr;
     const uint8_t *buf_end;
 
@@ -20107,10 +22831,11 @@ typedef struct JSParseState {
     BOOL is_module; /* parsing a module */
     BOOL allow_html_comments;
     BOOL ext_json; /* true if accepting JSON superset */
+    BOOL is_lazy_compile; /* compiling the body of a lazy function */
 } JSParseState;
 
 typedef struct JSOpCode {
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(DUMP_OPCODE_STATS)
     const char *name;
 #endif
     uint8_t size; /* in bytes */
@@ -20123,7 +22848,7 @@ typedef struct JSOpCode {
 
 static const JSOpCode opcode_info[OP_COUNT + (OP_TEMP_END - OP_TEMP_START)] = {
 #define FMT(f)
-#ifdef DUMP_BYTECODE
+#if defined(DUMP_BYTECODE) || defined(DUMP_OPCODE_STATS)
 #define DEF(id, size, n_pop, n_push, f) { #id, size, n_pop, n_push, OP_FMT_ ## f },
 #else
 #define DEF(id, size, n_pop, n_push, f) { size, n_pop, n_push, OP_FMT_ ## f },
@@ -20145,6 +22870,79 @@ static const JSOpCode opcode_info[OP_COUNT + (OP_TEMP_END - OP_TEMP_START)] = {
 #define short_opcode_info(op) opcode_info[op]
 #endif
 
+#ifdef DUMP_OPCODE_STATS
+typedef struct {
+    uint64_t count;
+    uint16_t op; /* opcode or (previous opcode << 8) | opcode */
+} JSOpcodeStatEntry;
+
+static int js_opcode_stat_cmp(const void *a1, const void *a2, void *opaque)
+{
+    const JSOpcodeStatEntry *e1 = a1, *e2 = a2;
+    if (e1->count != e2->count)
+        return (e1->count < e2->count) - (e1->count > e2->count);
+    return (e1->op > e2->op) - (e1->op < e2->op);
+}
+
+#define OPCODE_STATS_MAX_PAIRS 100
+#endif
+
+/* dump the opcode counts and the most frequent opcode pairs. Nothing
+   is output if the engine is not compiled with DUMP_OPCODE_STATS. */
+void JS_DumpOpcodeStats(JSRuntime *rt, FILE *fp)
+{
+#ifdef DUMP_OPCODE_STATS
+    JSOpcodeStats *s = rt->opcode_stats;
+    JSOpcodeStatEntry *tab;
+    uint64_t total;
+    int i, j, n;
+
+    tab = js_malloc_rt(rt, sizeof(tab[0]) * 256 * 256);
+    if (!tab)
+        return;
+    total = 0;
+    n = 0;
+    for(i = 0; i < 256; i++) {
+        if (s->count[i] != 0) {
+            tab[n].count = s->count[i];
+            tab[n].op = i;
+            n++;
+            total += s->count[i];
+        }
+    }
+    rqsort(tab, n, sizeof(tab[0]), js_opcode_stat_cmp, NULL);
+    fprintf(fp, "%-24s %14s %7s\n", "OPCODE", "COUNT", "%");
+    for(i = 0; i < n; i++) {
+        fprintf(fp, "%-24s %14" PRIu64 " %6.2f%%\n",
+                short_opcode_info(tab[i].op).name, tab[i].count,
+                100.0 * tab[i].count / total);
+    }
+    fprintf(fp, "%-24s %14" PRIu64 "\n\n", "total", total);
+
+    total = 0;
+    n = 0;
+    for(i = 0; i < 256; i++) {
+        for(j = 0; j < 256; j++) {
+            if (s->pair_count[i][j] != 0) {
+                tab[n].count = s->pair_count[i][j];
+                tab[n].op = (i << 8) | j;
+                n++;
+                total += s->pair_count[i][j];
+            }
+        }
+    }
+    rqsort(tab, n, sizeof(tab[0]), js_opcode_stat_cmp, NULL);
+    fprintf(fp, "%-46s %14s %7s\n", "OPCODE PAIR", "COUNT", "%");
+    for(i = 0; i < min_int(n, OPCODE_STATS_MAX_PAIRS); i++) {
+        fprintf(fp, "%-22s %-23s %14" PRIu64 " %6.2f%%\n",
+                short_opcode_info(tab[i].op >> 8).name,
+                short_opcode_info(tab[i].op & 0xff).name, tab[i].count,
+                100.0 * tab[i].count / total);
+    }
+    js_free_rt(rt, tab);
+#endif
+}
+
 static __exception int next_token(JSParseState *s);
 
 static void free_token(JSParseState *s, JSToken *token)
@@ -29619,6 +32417,11 @@ static void js_free_function_def(JSContext *ctx, JSFunctionDef *fd)
 
     js_free(ctx, fd->source);
 
+    for(i = 0; i < fd->lazy_name_count; i++) {
+        JS_FreeAtom(ctx, fd->lazy_names[i]);
+    }
+    js_free(ctx, fd->lazy_names);
+
     if (fd->parent) {
         /* remove in parent list */
         list_del(&fd->link);
@@ -32126,6 +34929,52 @@ static void put_short_code(DynBuf *bc_out, int op, int idx)
     dbuf_put_u16(bc_out, idx);
 }
 
+/* emit OP_get_field, OP_get_field2 or OP_put_field, using the inline
+   cache variant if a cache slot is available */
+static void put_field_code(JSFunctionDef *s, DynBuf *bc_out, int op, JSAtom atom)
+{
+    if (s->ic_count < JS_IC_MAX_COUNT) {
+        switch(op) {
+        case OP_get_field:
+            op = OP_get_field_ic;
+            break;
+        case OP_get_field2:
+            op = OP_get_field2_ic;
+            break;
+        case OP_put_field:
+            op = OP_put_field_ic;
+            break;
+        default:
+            abort();
+        }
+        dbuf_putc(bc_out, op);
+        dbuf_put_u32(bc_out, atom);
+        dbuf_put_u16(bc_out, s->ic_count++);
+    } else {
+        dbuf_putc(bc_out, op);
+        dbuf_put_u32(bc_out, atom);
+    }
+}
+
+#if SHORT_OPCODES
+/* return the opcode combining the comparison 'op' with if_false8 */
+static int get_cmp_if_false8(int op)
+{
+    switch(op) {
+    case OP_lt:
+        return OP_lt_if_false8;
+    case OP_lte:
+        return OP_lte_if_false8;
+    case OP_gt:
+        return OP_gt_if_false8;
+    case OP_strict_eq:
+        return OP_strict_eq_if_false8;
+    default:
+        abort();
+    }
+}
+#endif
+
 /* peephole optimizations and resolve goto/labels */
 static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
 {
@@ -32138,6 +34987,7 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
     int label;
 #if SHORT_OPCODES
     JumpSlot *jp;
+    int cmp_pos = -1; /* position of a comparison followed by if_false */
 #endif
 
     label_slots = s->label_slots;
@@ -32384,7 +35234,13 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                 if (diff < 128 && (op == OP_if_false || op == OP_if_true || op == OP_goto)) {
                     jp->size = 1;
                     jp->op = OP_if_false8 + (op - OP_if_false);
-                    dbuf_putc(&bc_out, OP_if_false8 + (op - OP_if_false));
+                    if (op == OP_if_false && cmp_pos == bc_out.size - 1) {
+                        /* transform cmp if_false8(l1) -> cmp_if_false8(l1) */
+                        bc_out.size = cmp_pos;
+                        jp->op = get_cmp_if_false8(bc_out.buf[cmp_pos]);
+                        jp->pos = cmp_pos + 1;
+                    }
+                    dbuf_putc(&bc_out, jp->op);
                     dbuf_putc(&bc_out, 0);
                     if (!add_reloc(ctx, ls, bc_out.size - 1, 1))
                         goto fail;
@@ -32404,7 +35260,14 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                 if (diff == (int8_t)diff && (op == OP_if_false || op == OP_if_true || op == OP_goto)) {
                     jp->size = 1;
                     jp->op = OP_if_false8 + (op - OP_if_false);
-                    dbuf_putc(&bc_out, OP_if_false8 + (op - OP_if_false));
+                    if (op == OP_if_false && cmp_pos == bc_out.size - 1) {
+                        /* transform cmp if_false8(l1) -> cmp_if_false8(l1) */
+                        bc_out.size = cmp_pos;
+                        jp->op = get_cmp_if_false8(bc_out.buf[cmp_pos]);
+                        jp->pos = cmp_pos + 1;
+                        diff++;
+                    }
+                    dbuf_putc(&bc_out, jp->op);
                     dbuf_putc(&bc_out, diff);
                     break;
                 }
@@ -32463,6 +35326,17 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             }
             break;
 
+#if SHORT_OPCODES
+        case OP_lt:
+        case OP_lte:
+        case OP_gt:
+        case OP_strict_eq:
+            /* the comparison is merged with the jump if it is short */
+            if (OPTIMIZE && code_match(&cc, pos_next, OP_if_false, -1))
+                cmp_pos = bc_out.size;
+            goto no_change;
+#endif
+
         case OP_drop:
             if (OPTIMIZE) {
                 /* remove useless drops before return */
@@ -32570,19 +35444,27 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                 }
             }
             goto no_change;
+#endif
 
         case OP_get_field:
+        case OP_get_field2:
+        case OP_put_field:
             if (OPTIMIZE) {
                 JSAtom atom = get_u32(bc_buf + pos + 1);
-                if (atom == JS_ATOM_length) {
+#if SHORT_OPCODES
+                if (op == OP_get_field && atom == JS_ATOM_length) {
                     JS_FreeAtom(ctx, atom);
                     add_pc2line_info(s, bc_out.size, line_num);
                     dbuf_putc(&bc_out, OP_get_length);
                     break;
                 }
+#endif
+                add_pc2line_info(s, bc_out.size, line_num);
+                put_field_code(s, &bc_out, op, atom);
+                break;
             }
             goto no_change;
-#endif
+
         case OP_push_atom_value:
             if (OPTIMIZE) {
                 JSAtom atom = get_u32(bc_buf + pos + 1);
@@ -32669,8 +35551,12 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                 if (code_match(&cc, pos_next, M2(OP_put_field, OP_put_var_strict), OP_drop, -1)) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
                     add_pc2line_info(s, bc_out.size, line_num);
-                    dbuf_putc(&bc_out, cc.op);
-                    dbuf_put_u32(&bc_out, cc.atom);
+                    if (cc.op == OP_put_field) {
+                        put_field_code(s, &bc_out, cc.op, cc.atom);
+                    } else {
+                        dbuf_putc(&bc_out, cc.op);
+                        dbuf_put_u32(&bc_out, cc.atom);
+                    }
                     pos_next = cc.pos;
                     break;
                 }
@@ -32838,8 +35724,12 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     if (cc.line_num >= 0) line_num = cc.line_num;
                     add_pc2line_info(s, bc_out.size, line_num);
                     dbuf_putc(&bc_out, OP_dec + (op - OP_post_dec));
-                    dbuf_putc(&bc_out, cc.op);
-                    dbuf_put_u32(&bc_out, cc.atom);
+                    if (cc.op == OP_put_field) {
+                        put_field_code(s, &bc_out, cc.op, cc.atom);
+                    } else {
+                        dbuf_putc(&bc_out, cc.op);
+                        dbuf_put_u32(&bc_out, cc.atom);
+                    }
                     pos_next = cc.pos;
                     break;
                 }
@@ -33161,6 +36051,10 @@ static __exception int compute_stack_size(JSContext *ctx,
             break;
         case OP_if_true8:
         case OP_if_false8:
+        case OP_lt_if_false8:
+        case OP_lte_if_false8:
+        case OP_gt_if_false8:
+        case OP_strict_eq_if_false8:
             diff = (int8_t)bc_buf[pos + 1];
             if (ss_check(ctx, s, pos + 1 + diff, op, stack_len, catch_pos))
                 goto fail;
@@ -33298,6 +36192,243 @@ static int add_module_variables(JSContext *ctx, JSFunctionDef *fd)
     return 0;
 }
 
+/* Lazy compilation: when enabled, the body of the inner functions is
+   only scanned (see js_parse_skip_function_body()) and no bytecode is
+   generated. A stub is created instead. Its closure variables are
+   resolved as if all the identifiers found by the scan were
+   referenced, and the body is compiled from its source code on the
+   first call, using the stub closure variables in the same way as a
+   direct eval. When the scan is not conclusive, the function is parsed
+   but its variables are not resolved. */
+
+/* minimum source length of the functions compiled lazily */
+#define JS_LAZY_FUNCTION_MIN_SIZE 128
+
+/* return TRUE if 'name' is always bound in the function 'fd' */
+static BOOL js_lazy_is_local_name(JSFunctionDef *fd, JSAtom name)
+{
+    int i;
+
+    if (name == JS_ATOM_this || name == JS_ATOM_new_target ||
+        name == JS_ATOM_home_object || name == JS_ATOM_this_active_func)
+        return fd->has_this_binding;
+    if (name == JS_ATOM_arguments && fd->has_arguments_binding)
+        return TRUE;
+    if (fd->is_func_expr && name == fd->func_name)
+        return TRUE;
+    /* the parameter expressions may not see the variables of the
+       body */
+    if (fd->has_parameter_expressions)
+        return FALSE;
+    for(i = 0; i < fd->arg_count; i++) {
+        if (fd->args[i].var_name == name)
+            return TRUE;
+    }
+    for(i = 0; i < fd->var_count; i++) {
+        JSVarDef *vd = &fd->vars[i];
+        if (vd->var_name == name &&
+            (vd->scope_level == 0 || vd->scope_level == fd->body_scope))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+typedef struct JSLazyNames {
+    JSAtom *tab;
+    int count;
+    int size;
+} JSLazyNames;
+
+/* add 'name' referenced in 'fd' to 'ln' if it may not be bound in the
+   functions between 'fd' and 'root' */
+static int js_lazy_add_free_name(JSContext *ctx, JSLazyNames *ln,
+                                 JSFunctionDef *root, JSFunctionDef *fd,
+                                 JSAtom name)
+{
+    JSFunctionDef *f;
+
+    for(f = fd; !js_lazy_is_local_name(f, name); f = f->parent) {
+        if (f == root) {
+            if (js_resize_array(ctx, (void **)&ln->tab, sizeof(ln->tab[0]),
+                                &ln->size, ln->count + 1))
+                return -1;
+            ln->tab[ln->count++] = name;
+            break;
+        }
+    }
+    return 0;
+}
+
+/* add to 'ln' the names referenced in 'fd' which may not be bound in
+   the functions between 'fd' and 'root'. Return 1 if the function
+   cannot be compiled lazily, -1 if memory error. */
+static int js_lazy_collect_names(JSContext *ctx, JSLazyNames *ln,
+                                 JSFunctionDef *root, JSFunctionDef *fd)
+{
+    const uint8_t *bc_buf = fd->byte_code.buf;
+    int i, pos, op, ret;
+    struct list_head *el;
+
+    /* the direct eval and the private fields need the full scope
+       chain */
+    if (fd->has_eval_call)
+        return 1;
+    for(pos = 0; pos < fd->byte_code.size; pos += opcode_info[op].size) {
+        op = bc_buf[pos];
+        switch(op) {
+        case OP_scope_get_private_field:
+        case OP_scope_get_private_field2:
+        case OP_scope_put_private_field:
+        case OP_scope_in_private_field:
+            return 1;
+        case OP_scope_get_var_checkthis:
+        case OP_scope_get_var_undef:
+        case OP_scope_get_var:
+        case OP_scope_put_var:
+        case OP_scope_delete_var:
+        case OP_scope_get_ref:
+        case OP_scope_put_var_init:
+        case OP_scope_make_ref:
+            if (js_lazy_add_free_name(ctx, ln, root, fd,
+                                      get_u32(bc_buf + pos + 1)))
+                return -1;
+            break;
+        default:
+            break;
+        }
+    }
+    for(i = 0; i < fd->lazy_name_count; i++) {
+        if (js_lazy_add_free_name(ctx, ln, root, fd, fd->lazy_names[i]))
+            return -1;
+    }
+    list_for_each(el, &fd->child_list) {
+        ret = js_lazy_collect_names(ctx, ln, root,
+                                    list_entry(el, JSFunctionDef, link));
+        if (ret)
+            return ret;
+    }
+    return 0;
+}
+
+static int js_lazy_name_cmp(const void *a, const void *b, void *opaque)
+{
+    JSAtom a1 = *(const JSAtom *)a;
+    JSAtom b1 = *(const JSAtom *)b;
+    return (a1 > b1) - (a1 < b1);
+}
+
+/* return TRUE if the child function 'fd' is compiled on its first
+   call */
+static BOOL js_can_compile_lazily(JSContext *ctx, JSFunctionDef *fd)
+{
+    return fd->can_be_lazy &&
+        fd->parent != NULL &&
+        fd->source != NULL &&
+        fd->source_len >= JS_LAZY_FUNCTION_MIN_SIZE;
+}
+
+/* create the stub of a lazily compiled function. The function
+   definition is freed. Return JS_UNDEFINED if the function must be
+   compiled now. */
+static JSValue js_create_lazy_function(JSContext *ctx, JSFunctionDef *fd)
+{
+    JSFunctionBytecode *b;
+    JSFunctionDef *fd1, *root;
+    JSLazyNames ln;
+    DynBuf bc;
+    int i, ret, function_size, closure_var_offset;
+
+    ln.tab = NULL;
+    ln.count = 0;
+    ln.size = 0;
+    ret = js_lazy_collect_names(ctx, &ln, fd, fd);
+    if (ret) {
+        js_free(ctx, ln.tab);
+        if (ret > 0)
+            return JS_UNDEFINED;
+        goto fail;
+    }
+    rqsort(ln.tab, ln.count, sizeof(ln.tab[0]), js_lazy_name_cmp, NULL);
+
+    /* resolve the names in a dummy function defined at the same
+       position as 'fd' so that its closure variables are the ones
+       needed by 'fd' and its children */
+    fd1 = js_new_function_def(ctx, fd->parent, FALSE, FALSE, "", 0);
+    if (!fd1) {
+        js_free(ctx, ln.tab);
+        goto fail;
+    }
+    fd1->parent_scope_level = fd->parent_scope_level;
+    js_dbuf_init(ctx, &bc);
+    for(i = 0; i < ln.count; i++) {
+        if (i > 0 && ln.tab[i] == ln.tab[i - 1])
+            continue;
+        resolve_scope_var(ctx, fd1, ln.tab[i], 0, OP_scope_get_var,
+                          &bc, NULL, NULL, 0);
+    }
+    free_bytecode_atoms(ctx->rt, bc.buf, bc.size, FALSE);
+    dbuf_free(&bc);
+    js_free(ctx, ln.tab);
+
+    function_size = sizeof(*b) + sizeof(*b->cpool);
+    closure_var_offset = function_size;
+    function_size += fd1->closure_var_count * sizeof(*fd1->closure_var);
+    b = js_mallocz(ctx, function_size);
+    if (!b) {
+        js_free_function_def(ctx, fd1);
+        goto fail;
+    }
+    b->header.ref_count = 1;
+
+    for(root = fd; root->parent; root = root->parent)
+        continue;
+    b->is_lazy = 1;
+    b->lazy_is_arrow = !fd->has_this_binding;
+    b->lazy_is_func_expr = fd->is_func_expr;
+    b->lazy_is_module = (root->is_eval &&
+                         root->eval_type == JS_EVAL_TYPE_MODULE);
+    b->func_name = fd->func_name;
+    fd->func_name = JS_ATOM_NULL;
+    b->defined_arg_count = fd->defined_arg_count;
+    /* the cpool contains the compiled function */
+    b->cpool = (void *)((uint8_t*)b + sizeof(*b));
+    b->cpool[0] = JS_UNDEFINED;
+    b->cpool_count = 1;
+    b->has_debug = 1;
+    b->debug.filename = JS_DupAtom(ctx, fd->filename);
+    b->debug.line_num = fd->line_num;
+    b->debug.source = fd->source;
+    b->debug.source_len = fd->source_len;
+    fd->source = NULL;
+
+    b->closure_var_count = fd1->closure_var_count;
+    if (b->closure_var_count) {
+        b->closure_var = (void *)((uint8_t*)b + closure_var_offset);
+        memcpy(b->closure_var, fd1->closure_var, b->closure_var_count * sizeof(*b->closure_var));
+    }
+    fd1->closure_var_count = 0;
+    js_free_function_def(ctx, fd1);
+
+    b->has_prototype = fd->has_prototype;
+    b->has_simple_parameter_list = fd->has_simple_parameter_list;
+    b->js_mode = fd->js_mode;
+    b->func_kind = fd->func_kind;
+    b->new_target_allowed = fd->new_target_allowed;
+    b->super_call_allowed = fd->super_call_allowed;
+    b->super_allowed = fd->super_allowed;
+    b->arguments_allowed = fd->arguments_allowed;
+    b->backtrace_barrier = fd->backtrace_barrier;
+    b->realm = JS_DupContext(ctx);
+
+    add_gc_object(ctx->rt, &b->header, JS_GC_OBJ_TYPE_FUNCTION_BYTECODE);
+
+    js_free_function_def(ctx, fd);
+    return JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b);
+ fail:
+    js_free_function_def(ctx, fd);
+    return JS_EXCEPTION;
+}
+
 /* create a function object from a function definition. The function
    definition is freed. All the child functions are also created. It
    must be done this way to resolve all the variables. */
@@ -33310,6 +36441,12 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     int function_size, byte_code_offset, cpool_offset;
     int closure_var_offset, vardefs_offset;
 
+    if (js_can_compile_lazily(ctx, fd)) {
+        func_obj = js_create_lazy_function(ctx, fd);
+        if (!JS_IsUndefined(func_obj))
+            return func_obj;
+    }
+
     /* recompute scope linkage */
     for (scope = 0; scope < fd->scope_count; scope++) {
         fd->scopes[scope].first = -1;
@@ -33459,6 +36596,7 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     fd->cpool = NULL;
 
     b->stack_size = stack_size;
+    b->ic_count = fd->ic_count;
 
     if (fd->js_mode & JS_MODE_STRIP) {
         JS_FreeAtom(ctx, fd->filename);
@@ -33539,7 +36677,21 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
                JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name));
     }
 #endif
-    free_bytecode_atoms(rt, b->byte_code_buf, b->byte_code_len, TRUE);
+    /* byte_code_buf is NULL if JS_ReadFunctionTag() failed early */
+    if (b->byte_code_buf)
+        free_bytecode_atoms(rt, b->byte_code_buf, b->byte_code_len, TRUE);
+
+    if (b->ic) {
+        for(i = 0; i < b->ic_count; i++) {
+            JSInlineCache *ic = &b->ic[i];
+            int j;
+            for(j = 0; j < JS_IC_WAYS; j++) {
+                js_free_shape_null(rt, ic->entries[j].shape);
+                js_free_shape_null(rt, ic->entries[j].proto_shape);
+            }
+        }
+        js_free_rt(rt, b->ic);
+    }
 
     if (b->vardefs) {
         for(i = 0; i < b->arg_count + b->var_count; i++) {
@@ -33559,7 +36711,8 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
     JS_FreeAtomRT(rt, b->func_name);
     if (b->has_debug) {
         JS_FreeAtomRT(rt, b->debug.filename);
-        js_free_rt(rt, b->debug.pc2line_buf);
+        if (!b->read_only_bytecode)
+            js_free_rt(rt, b->debug.pc2line_buf);
         js_free_rt(rt, b->debug.source);
     }
 
@@ -33717,6 +36870,173 @@ duplicate:
     return js_parse_error(s, "duplicate argument names not allowed in this context");
 }
 
+static int js_lazy_add_name(JSContext *ctx, JSFunctionDef *fd, JSAtom name)
+{
+    if (js_resize_array(ctx, (void **)&fd->lazy_names,
+                        sizeof(fd->lazy_names[0]),
+                        &fd->lazy_name_size, fd->lazy_name_count + 1))
+        return -1;
+    fd->lazy_names[fd->lazy_name_count++] = JS_DupAtom(ctx, name);
+    return 0;
+}
+
+/* Skip the body of a function compiled lazily by only scanning its
+   tokens. The identifiers which may reference a variable are stored
+   in fd->lazy_names. On success, the current token is the closing '}'
+   of the body. If the scan is not conclusive (ambiguous regexp,
+   direct eval, private names, ...), the parser is rewound so that the
+   body is parsed normally. Return 1 if the body was skipped, 0 if it
+   must be parsed, -1 if memory error. */
+static int js_parse_skip_function_body(JSParseState *s, JSFunctionDef *fd,
+                                       const uint8_t *func_start)
+{
+    JSContext *ctx = s->ctx;
+    char state[256];
+    size_t level = 0;
+    JSParsePos pos;
+    int i, c, last_tok, tok_len;
+    BOOL is_arrow = !fd->has_this_binding;
+
+    state[level++] = 0;
+    state[level++] = '{';
+    js_parse_get_pos(s, &pos);
+    last_tok = '{';
+    for (;;) {
+        switch(s->token.val) {
+        case '(':
+            if (level >= sizeof(state))
+                goto abort;
+            /* a regexp may follow the condition of these statements */
+            if (last_tok == TOK_IF || last_tok == TOK_WHILE ||
+                last_tok == TOK_FOR || last_tok == TOK_WITH)
+                state[level++] = 'c';
+            else
+                state[level++] = '(';
+            break;
+        case '[':
+        case '{':
+            if (level >= sizeof(state))
+                goto abort;
+            state[level++] = s->token.val;
+            break;
+        case ')':
+            c = state[--level];
+            if (c == 'c') {
+                /* regexp allowed */
+                last_tok = TOK_IF;
+                goto next;
+            } else if (c != '(') {
+                goto abort;
+            }
+            break;
+        case ']':
+            if (state[--level] != '[')
+                goto abort;
+            break;
+        case '}':
+            c = state[--level];
+            if (c == '`') {
+                /* continue the parsing of the template */
+                free_token(s, &s->token);
+                s->got_lf = FALSE;
+                s->last_line_num = s->token.line_num;
+                if (js_parse_template_part(s, s->buf_ptr))
+                    goto lex_error;
+                goto handle_template;
+            } else if (c != '{') {
+                goto abort;
+            }
+            if (level == 1) {
+                /* end of the body */
+                if (s->buf_ptr - func_start < JS_LAZY_FUNCTION_MIN_SIZE)
+                    goto abort;
+                return 1;
+            }
+            break;
+        case TOK_TEMPLATE:
+        handle_template:
+            if (s->token.u.str.sep != '`') {
+                if (level >= sizeof(state))
+                    goto abort;
+                state[level++] = '`';
+            }
+            break;
+        case TOK_DIV_ASSIGN:
+            tok_len = 2;
+            goto parse_regexp;
+        case '/':
+            tok_len = 1;
+        parse_regexp:
+            /* a regexp or a division may follow a block or an
+               expression ending with '}' */
+            if (last_tok == '}')
+                goto abort;
+            if (is_regexp_allowed(last_tok)) {
+                s->buf_ptr -= tok_len;
+                if (js_parse_regexp(s))
+                    goto lex_error;
+            }
+            break;
+        case TOK_IDENT:
+            if (last_tok == '.' || last_tok == TOK_QUESTION_MARK_DOT)
+                break;
+            /* the direct eval needs the full scope chain */
+            if (s->token.u.ident.atom == JS_ATOM_eval)
+                goto abort;
+            if (js_lazy_add_name(ctx, fd, s->token.u.ident.atom))
+                goto fail;
+            break;
+        case TOK_PRIVATE_NAME:
+            goto abort;
+        case TOK_SUPER:
+            if (is_arrow)
+                goto abort;
+            break;
+        case TOK_THIS:
+            if (is_arrow && js_lazy_add_name(ctx, fd, JS_ATOM_this))
+                goto fail;
+            break;
+        case '.':
+            if (is_arrow && last_tok == TOK_NEW &&
+                js_lazy_add_name(ctx, fd, JS_ATOM_new_target))
+                goto fail;
+            break;
+        case TOK_EOF:
+            goto abort;
+        default:
+            break;
+        }
+        /* last_tok is only used to recognize regexps */
+        if (s->token.val == TOK_IDENT &&
+            last_tok != '.' && last_tok != TOK_QUESTION_MARK_DOT &&
+            (token_is_pseudo_keyword(s, JS_ATOM_of) ||
+             token_is_pseudo_keyword(s, JS_ATOM_yield) ||
+             token_is_pseudo_keyword(s, JS_ATOM_await))) {
+            last_tok = TOK_OF;
+        } else {
+            last_tok = s->token.val;
+        }
+    next:
+        if (next_token(s))
+            goto lex_error;
+    }
+ lex_error:
+    /* the error is reported again when parsing the body */
+    JS_FreeValue(ctx, JS_GetException(ctx));
+ abort:
+    for(i = 0; i < fd->lazy_name_count; i++)
+        JS_FreeAtom(ctx, fd->lazy_names[i]);
+    js_free(ctx, fd->lazy_names);
+    fd->lazy_names = NULL;
+    fd->lazy_name_count = 0;
+    fd->lazy_name_size = 0;
+    if (js_parse_seek_token(s, &pos))
+        return -1;
+    return 0;
+ fail:
+    return -1;
+}
+
 /* create a function to initialize class fields */
 static JSFunctionDef *js_parse_function_class_fields_init(JSParseState *s)
 {
@@ -33874,6 +37194,23 @@ static __exception int js_parse_function_decl2(JSParseState *s,
         *pfd = fd;
     s->cur_func = fd;
     fd->func_name = func_name;
+    if (ctx->rt->lazy_functions &&
+        (func_type == JS_PARSE_FUNC_STATEMENT ||
+         func_type == JS_PARSE_FUNC_VAR ||
+         func_type == JS_PARSE_FUNC_EXPR ||
+         func_type == JS_PARSE_FUNC_ARROW)) {
+        /* a parenthesized function expression is usually called
+           immediately (e.g. module wrappers), so it is compiled
+           eagerly */
+        const uint8_t *p = ptr;
+        while (p > s->buf_start && (p[-1] == ' ' || p[-1] == '\t' ||
+                                    p[-1] == '\r' || p[-1] == '\n'))
+            p--;
+        fd->can_be_lazy = !(is_expr && p > s->buf_start && p[-1] == '(');
+        /* the function compiled on its first call */
+        if (s->is_lazy_compile && !fd->parent->parent)
+            fd->can_be_lazy = FALSE;
+    }
     /* XXX: test !fd->is_generator is always false */
     fd->has_prototype = (func_type == JS_PARSE_FUNC_STATEMENT ||
                          func_type == JS_PARSE_FUNC_VAR ||
@@ -34170,6 +37507,14 @@ static __exception int js_parse_function_decl2(JSParseState *s,
     if (js_parse_function_check_names(s, fd, func_name))
         goto fail;
 
+    /* the body of a lazily compiled function is parsed on its first
+       call, so it is only scanned here */
+    if (fd->can_be_lazy && fd->has_simple_parameter_list &&
+        !(fd->js_mode & JS_MODE_STRIP)) {
+        if (js_parse_skip_function_body(s, fd, ptr) < 0)
+            goto fail;
+    }
+
     while (s->token.val != '}') {
         if (js_parse_source_element(s))
             goto fail;
@@ -34382,12 +37727,135 @@ static void js_parse_init(JSContext *ctx, JSParseState *s,
     s->ctx = ctx;
     s->filename = filename;
     s->line_num = 1;
+    s->buf_start = (const uint8_t *)input;
     s->buf_ptr = (const uint8_t *)input;
     s->buf_end = s->buf_ptr + input_len;
     s->token.val = ' ';
     s->token.line_num = 1;
 }
 
+/* compile the stub 'b' of a lazily compiled function. The resulting
+   bytecode is stored in b->cpool[0]. */
+static int js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSParseState s1, *s = &s1;
+    JSFunctionDef *fd, *fd1;
+    JSFunctionKindEnum func_kind;
+    JSFunctionBytecode *b1;
+    JSValue func_obj;
+    const char *filename;
+    int i, err;
+
+    filename = JS_AtomToCString(ctx, b->debug.filename);
+    if (!filename)
+        return -1;
+    js_parse_init(ctx, s, b->debug.source, b->debug.source_len, filename);
+    s->line_num = b->debug.line_num;
+    s->is_module = b->lazy_is_module;
+    s->allow_html_comments = !s->is_module;
+    s->is_lazy_compile = TRUE;
+
+    /* the enclosing code is seen as a direct eval whose closure
+       variables are the ones of the stub */
+    fd = js_new_function_def(ctx, NULL, TRUE, FALSE, filename,
+                             b->debug.line_num);
+    if (!fd) {
+        JS_FreeCString(ctx, filename);
+        return -1;
+    }
+    fd->eval_type = JS_EVAL_TYPE_DIRECT;
+    fd->has_this_binding = FALSE;
+    fd->new_target_allowed = b->new_target_allowed;
+    fd->super_call_allowed = b->super_call_allowed;
+    fd->super_allowed = b->super_allowed;
+    fd->arguments_allowed = b->arguments_allowed;
+    fd->js_mode = b->js_mode;
+    fd->func_name = JS_DupAtom(ctx, JS_ATOM__eval_);
+    for(i = 0; i < b->closure_var_count; i++) {
+        JSClosureVar *cv = &b->closure_var[i];
+        if (add_closure_var(ctx, fd, FALSE, FALSE, i, cv->var_name,
+                            cv->is_const, cv->is_lexical, cv->var_kind) < 0)
+            goto fail;
+    }
+    s->cur_func = fd;
+    push_scope(s);
+    fd->body_scope = fd->scope_level;
+
+    if (next_token(s))
+        goto fail;
+    func_kind = JS_FUNC_NORMAL;
+    if (b->lazy_is_arrow) {
+        if (b->func_kind == JS_FUNC_ASYNC) {
+            /* skip 'async' */
+            if (next_token(s))
+                goto fail;
+            func_kind = JS_FUNC_ASYNC;
+        }
+        err = js_parse_function_decl2(s, JS_PARSE_FUNC_ARROW, func_kind,
+                                      JS_ATOM_NULL,
+                                      (const uint8_t *)b->debug.source,
+                                      b->debug.line_num,
+                                      JS_PARSE_EXPORT_NONE, &fd1);
+    } else {
+        err = js_parse_function_decl2(s, JS_PARSE_FUNC_EXPR, func_kind,
+                                      JS_ATOM_NULL,
+                                      (const uint8_t *)b->debug.source,
+                                      b->debug.line_num,
+                                      JS_PARSE_EXPORT_NONE, &fd1);
+    }
+    if (err)
+        goto fail;
+    fd1->is_func_expr = b->lazy_is_func_expr;
+    /* its first closure variables are the ones of the stub */
+    assert(fd1->closure_var_count == 0);
+    for(i = 0; i < b->closure_var_count; i++) {
+        JSClosureVar *cv = &b->closure_var[i];
+        if (add_closure_var(ctx, fd1, FALSE, FALSE, i, cv->var_name,
+                            cv->is_const, cv->is_lexical, cv->var_kind) < 0)
+            goto fail;
+    }
+    func_obj = js_create_function(ctx, fd1);
+    if (JS_IsException(func_obj))
+        goto fail;
+    b1 = JS_VALUE_GET_PTR(func_obj);
+    if (b1->closure_var_count != b->closure_var_count) {
+        /* a name was not resolved when creating the stub */
+        JS_FreeValue(ctx, func_obj);
+        JS_ThrowInternalError(ctx, "invalid lazy function closure");
+        goto fail;
+    }
+    for(i = 0; i < b->closure_var_count; i++) {
+        b1->closure_var[i].is_local = b->closure_var[i].is_local;
+        b1->closure_var[i].is_arg = b->closure_var[i].is_arg;
+        b1->closure_var[i].var_idx = b->closure_var[i].var_idx;
+    }
+    b->cpool[0] = func_obj;
+    free_token(s, &s->token);
+    js_free_function_def(ctx, fd);
+    JS_FreeCString(ctx, filename);
+    return 0;
+ fail:
+    free_token(s, &s->token);
+    js_free_function_def(ctx, fd);
+    JS_FreeCString(ctx, filename);
+    return -1;
+}
+
+/* replace the stub of a lazily compiled function by its bytecode */
+static int js_lazy_function_init(JSContext *ctx, JSObject *p)
+{
+    JSFunctionBytecode *b = p->u.func.function_bytecode;
+
+    if (JS_IsUndefined(b->cpool[0])) {
+        if (js_compile_lazy_function(b->realm, b))
+            return -1;
+    }
+    p->u.func.function_bytecode =
+        JS_VALUE_GET_PTR(JS_DupValue(ctx, b->cpool[0]));
+    JS_FreeValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    return 0;
+}
+
 static JSValue JS_EvalFunctionInternal(JSContext *ctx, JSValue fun_obj,
                                        JSValueConst this_obj,
                                        JSVarRef **var_refs, JSStackFrame *sf)
@@ -34737,12 +38205,18 @@ typedef enum BCTagEnum {
     BC_TAG_BIG_FLOAT,
     BC_TAG_BIG_DECIMAL,
 #endif
+    BC_TAG_TRANSFERRED_ARRAY_BUFFER,
+    /* only used in context snapshots */
+    BC_TAG_SNAPSHOT_BASE,
+    BC_TAG_SNAPSHOT_OBJECT,
+    BC_TAG_SYMBOL,
+    BC_TAG_UNINITIALIZED,
 } BCTagEnum;
 
 #ifdef CONFIG_BIGNUM
-#define BC_VERSION 0x43
+#define BC_VERSION 0x45
 #else
-#define BC_VERSION 3
+#define BC_VERSION 5
 #endif
 
 typedef struct BCWriterState {
@@ -34760,8 +38234,19 @@ typedef struct BCWriterState {
     uint8_t **sab_tab;
     int sab_tab_len;
     int sab_tab_size;
+    /* ArrayBuffers whose data is moved instead of being copied */
+    JSValueConst *transfer_list;
+    int transfer_len;
     /* list of referenced objects (used if allow_reference = TRUE) */
     JSObjectList object_list;
+    /* context snapshot (NULL if not writing a snapshot) */
+    JSSnapshotBase *snapshot;
+    DynBuf base_dbuf; /* paths of the referenced base objects */
+    int *base_ref_tab; /* index in base_dbuf of each base object or -1 */
+    int base_ref_count;
+    /* the JSFunctionBytecode and JSVarRef are stored as JSObject */
+    JSObjectList bytecode_list;
+    JSObjectList var_ref_list;
 } BCWriterState;
 
 #ifdef DUMP_READ_OBJECT
@@ -34790,6 +38275,11 @@ static const char * const bc_tag_str[] = {
     "bigfloat",
     "bigdecimal",
 #endif
+    "TransferredArrayBuffer",
+    "SnapshotBase",
+    "SnapshotObject",
+    "symbol",
+    "uninitialized",
 };
 #endif
 
@@ -35149,6 +38639,10 @@ static int JS_WriteBigNum(BCWriterState *s, JSValueConst obj)
 }
 
 static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj);
+static int js_snapshot_find_base(JSContext *ctx, JSSnapshotBase *base,
+                                 JSObject *p);
+static int JS_WriteSnapshotBaseRef(BCWriterState *s, int idx);
+static int JS_WriteSnapshotObject(BCWriterState *s, JSValueConst obj);
 
 static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
 {
@@ -35156,6 +38650,14 @@ static int JS_WriteFunctionTag(BCWriterState *s, JSValueConst obj)
     uint32_t flags;
     int idx, i;
 
+    if (b->is_lazy) {
+        /* the stubs are not serialized */
+        if (JS_IsUndefined(b->cpool[0])) {
+            if (js_compile_lazy_function(b->realm, b))
+                goto fail;
+        }
+        return JS_WriteFunctionTag(s, b->cpool[0]);
+    }
     bc_put_u8(s, BC_TAG_FUNCTION_BYTECODE);
     flags = idx = 0;
     bc_set_flags(&flags, &idx, b->has_prototype, 1);
@@ -35385,10 +38887,20 @@ static int JS_WriteArrayBuffer(BCWriterState *s, JSValueConst obj)
 {
     JSObject *p = JS_VALUE_GET_OBJ(obj);
     JSArrayBuffer *abuf = p->u.array_buffer;
+    int i;
     if (abuf->detached) {
         JS_ThrowTypeErrorDetachedArrayBuffer(s->ctx);
         return -1;
     }
+    for(i = 0; i < s->transfer_len; i++) {
+        if (JS_VALUE_GET_OBJ(s->transfer_list[i]) == p) {
+            /* the data is given to the reader in transfer_data[i] */
+            bc_put_u8(s, BC_TAG_TRANSFERRED_ARRAY_BUFFER);
+            bc_put_leb128(s, abuf->byte_length);
+            bc_put_leb128(s, i);
+            return 0;
+        }
+    }
     bc_put_u8(s, BC_TAG_ARRAY_BUFFER);
     bc_put_leb128(s, abuf->byte_length);
     dbuf_put(&s->dbuf, abuf->data, abuf->byte_length);
@@ -35450,6 +38962,15 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
             JS_WriteString(s, p);
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSString *p = js_get_linear_string(s->ctx, obj);
+            if (!p)
+                goto fail;
+            bc_put_u8(s, BC_TAG_STRING);
+            JS_WriteString(s, p);
+        }
+        break;
     case JS_TAG_FUNCTION_BYTECODE:
         if (!s->allow_bytecode)
             goto invalid_tag;
@@ -35467,6 +38988,18 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
             JSObject *p = JS_VALUE_GET_OBJ(obj);
             int ret, idx;
 
+            if (s->snapshot) {
+                /* the objects of the snapshot base are not serialized */
+                idx = js_snapshot_find_base(s->ctx, s->snapshot, p);
+                if (idx >= 0) {
+                    idx = JS_WriteSnapshotBaseRef(s, idx);
+                    if (idx < 0)
+                        goto fail;
+                    bc_put_u8(s, BC_TAG_SNAPSHOT_BASE);
+                    bc_put_leb128(s, idx);
+                    break;
+                }
+            }
             if (s->allow_reference) {
                 idx = js_object_list_find(s->ctx, &s->object_list, p);
                 if (idx >= 0) {
@@ -35484,6 +39017,10 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
                 }
                 p->tmp_mark = 1;
             }
+            if (s->snapshot) {
+                ret = JS_WriteSnapshotObject(s, obj);
+                goto obj_done;
+            }
             switch(p->class_id) {
             case JS_CLASS_ARRAY:
                 ret = JS_WriteArray(s, obj);
@@ -35524,6 +39061,7 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
                 }
                 break;
             }
+        obj_done:
             p->tmp_mark = 0;
             if (ret)
                 goto fail;
@@ -35537,6 +39075,19 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
         if (JS_WriteBigNum(s, obj))
             goto fail;
         break;
+    case JS_TAG_SYMBOL:
+        if (!s->snapshot)
+            goto invalid_tag;
+        /* the symbols created by the program are in the atom table */
+        bc_put_u8(s, BC_TAG_SYMBOL);
+        if (bc_put_atom(s, js_get_atom_index(s->ctx->rt, JS_VALUE_GET_PTR(obj))))
+            goto fail;
+        break;
+    case JS_TAG_UNINITIALIZED:
+        if (!s->snapshot)
+            goto invalid_tag;
+        bc_put_u8(s, BC_TAG_UNINITIALIZED);
+        break;
     default:
     invalid_tag:
         JS_ThrowInternalError(s->ctx, "unsupported tag (%d)", tag);
@@ -35562,6 +39113,10 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     bc_put_leb128(s, s->idx_to_atom_count);
     for(i = 0; i < s->idx_to_atom_count; i++) {
         JSAtomStruct *p = rt->atom_array[s->idx_to_atom[i]];
+        /* a snapshot may contain symbols. They are created again
+           when it is read, so each one keeps a single identity. */
+        if (s->snapshot)
+            bc_put_u8(s, p->atom_type);
         JS_WriteString(s, p);
     }
     /* XXX: should check for OOM in above phase */
@@ -35583,13 +39138,38 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     return -1;
 }
 
-uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
-                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_list, uint8_t **transfer_data,
+                         int transfer_len)
 {
     BCWriterState ss, *s = &ss;
+    int i, j;
+
+    for(i = 0; i < transfer_len; i++) {
+        JSArrayBuffer *abuf;
+        abuf = JS_GetOpaque(transfer_list[i], JS_CLASS_ARRAY_BUFFER);
+        if (!abuf) {
+            JS_ThrowTypeError(ctx, "only ArrayBuffers can be transferred");
+            goto fail1;
+        }
+        if (abuf->detached) {
+            JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+            goto fail1;
+        }
+        for(j = 0; j < i; j++) {
+            if (JS_VALUE_GET_OBJ(transfer_list[j]) ==
+                JS_VALUE_GET_OBJ(transfer_list[i])) {
+                JS_ThrowTypeError(ctx, "duplicate ArrayBuffer in the transfer list");
+                goto fail1;
+            }
+        }
+    }
 
     memset(s, 0, sizeof(*s));
     s->ctx = ctx;
+    s->transfer_list = transfer_list;
+    s->transfer_len = transfer_len;
     s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0);
     s->allow_sab = ((flags & JS_WRITE_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_WRITE_OBJ_REFERENCE) != 0);
@@ -35605,6 +39185,9 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
         goto fail;
     if (JS_WriteObjectAtoms(s))
         goto fail;
+    if (js_array_buffer_transfer(ctx, transfer_list, transfer_data,
+                                 transfer_len))
+        goto fail;
     js_object_list_end(ctx, &s->object_list);
     js_free(ctx, s->atom_to_idx);
     js_free(ctx, s->idx_to_atom);
@@ -35618,7 +39201,9 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     js_object_list_end(ctx, &s->object_list);
     js_free(ctx, s->atom_to_idx);
     js_free(ctx, s->idx_to_atom);
+    js_free(ctx, s->sab_tab);
     dbuf_free(&s->dbuf);
+ fail1:
     *psize = 0;
     if (psab_tab)
         *psab_tab = NULL;
@@ -35627,6 +39212,13 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     return NULL;
 }
 
+uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+{
+    return JS_WriteObject3(ctx, psize, obj, flags, psab_tab, psab_tab_len,
+                           NULL, NULL, 0);
+}
+
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags)
 {
@@ -35644,10 +39236,28 @@ typedef struct BCReaderState {
     BOOL allow_bytecode : 8;
     BOOL is_rom_data : 8;
     BOOL allow_reference : 8;
+    /* data of the transferred ArrayBuffers (NULL once used) */
+    uint8_t **transfer_data;
+    int transfer_len;
     /* object references */
     JSObject **objects;
     int objects_count;
     int objects_size;
+    /* context snapshot */
+    BOOL is_snapshot : 8;
+    JSValue *base_tab;
+    int base_count;
+    JSValue *bytecode_tab;
+    int bytecode_count;
+    int bytecode_size;
+    JSVarRef **var_ref_tab;
+    int var_ref_count;
+    int var_ref_size;
+    /* keys of the weak maps, kept alive until the end of the reading
+       because 's->objects' may reference them */
+    JSValue *weak_key_tab;
+    int weak_key_count;
+    int weak_key_size;
 
 #ifdef DUMP_READ_OBJECT
     const uint8_t *ptr_last;
@@ -35918,6 +39528,10 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
         case OP_FMT_atom_u16:
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
+            if (op >= OP_get_field_ic && op <= OP_put_field_ic) {
+                b->ic_count = max_int(b->ic_count,
+                                      get_u16(bc_buf + pos + 5) + 1);
+            }
             idx = get_u32(bc_buf + pos + 1);
             if (s->is_rom_data) {
                 /* just increment the reference count of the atom */
@@ -36080,6 +39694,7 @@ static JSValue JS_ReadBigNum(BCReaderState *s, int tag)
 }
 
 static JSValue JS_ReadObjectRec(BCReaderState *s);
+static JSValue JS_ReadSnapshotObject(BCReaderState *s);
 
 static int BC_add_object_ref1(BCReaderState *s, JSObject *p)
 {
@@ -36260,11 +39875,21 @@ static JSValue JS_ReadFunctionTag(BCReaderState *s)
         if (bc_get_leb128_int(s, &b->debug.pc2line_len))
             goto fail;
         if (b->debug.pc2line_len) {
-            b->debug.pc2line_buf = js_mallocz(ctx, b->debug.pc2line_len);
-            if (!b->debug.pc2line_buf)
-                goto fail;
-            if (bc_get_buf(s, b->debug.pc2line_buf, b->debug.pc2line_len))
-                goto fail;
+            if (b->read_only_bytecode) {
+                /* directly use the input buffer */
+                if (unlikely(s->buf_end - s->ptr < b->debug.pc2line_len)) {
+                    bc_read_error_end(s);
+                    goto fail;
+                }
+                b->debug.pc2line_buf = (uint8_t *)s->ptr;
+                s->ptr += b->debug.pc2line_len;
+            } else {
+                b->debug.pc2line_buf = js_mallocz(ctx, b->debug.pc2line_len);
+                if (!b->debug.pc2line_buf)
+                    goto fail;
+                if (bc_get_buf(s, b->debug.pc2line_buf, b->debug.pc2line_len))
+                    goto fail;
+            }
         }
 #ifdef DUMP_READ_OBJECT
         bc_read_trace(s, "filename: "); print_atom(s->ctx, b->debug.filename); printf("\n");
@@ -36574,6 +40199,33 @@ static JSValue JS_ReadSharedArrayBuffer(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+static JSValue JS_ReadTransferredArrayBuffer(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    uint32_t byte_length, idx;
+    JSValue obj;
+
+    if (bc_get_leb128(s, &byte_length))
+        return JS_EXCEPTION;
+    if (bc_get_leb128(s, &idx))
+        return JS_EXCEPTION;
+    if (idx >= s->transfer_len || !s->transfer_data[idx]) {
+        JS_ThrowSyntaxError(ctx, "invalid transferred ArrayBuffer");
+        return JS_EXCEPTION;
+    }
+    obj = JS_NewArrayBuffer(ctx, s->transfer_data[idx], byte_length,
+                            js_array_buffer_free_transferred, NULL, FALSE);
+    if (JS_IsException(obj))
+        return obj;
+    /* the data now belongs to the ArrayBuffer */
+    s->transfer_data[idx] = NULL;
+    if (BC_add_object_ref(s, obj)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    return obj;
+}
+
 static JSValue JS_ReadDate(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -36701,6 +40353,9 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
             goto invalid_tag;
         obj = JS_ReadSharedArrayBuffer(s);
         break;
+    case BC_TAG_TRANSFERRED_ARRAY_BUFFER:
+        obj = JS_ReadTransferredArrayBuffer(s);
+        break;
     case BC_TAG_DATE:
         obj = JS_ReadDate(s);
         break;
@@ -36726,9 +40381,52 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
                 return JS_ThrowSyntaxError(ctx, "invalid object reference (%u >= %u)",
                                            val, s->objects_count);
             }
+            if (!s->objects[val]) {
+                /* the object is not yet created */
+                return JS_ThrowSyntaxError(ctx, "invalid object reference (%u)",
+                                           val);
+            }
             obj = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, s->objects[val]));
         }
         break;
+    case BC_TAG_SNAPSHOT_BASE:
+        {
+            uint32_t val;
+            if (!s->is_snapshot)
+                goto invalid_tag;
+            if (bc_get_leb128(s, &val))
+                return JS_EXCEPTION;
+            if (val >= s->base_count)
+                return JS_ThrowSyntaxError(ctx, "invalid base object reference");
+            obj = JS_DupValue(ctx, s->base_tab[val]);
+        }
+        break;
+    case BC_TAG_SNAPSHOT_OBJECT:
+        if (!s->is_snapshot)
+            goto invalid_tag;
+        obj = JS_ReadSnapshotObject(s);
+        break;
+    case BC_TAG_SYMBOL:
+        {
+            JSAtom atom;
+            if (!s->is_snapshot)
+                goto invalid_tag;
+            if (bc_get_atom(s, &atom))
+                return JS_EXCEPTION;
+            if (__JS_AtomIsTaggedInt(atom) || atom == JS_ATOM_NULL ||
+                JS_AtomIsString(ctx, atom)) {
+                JS_FreeAtom(ctx, atom);
+                return JS_ThrowSyntaxError(ctx, "invalid symbol");
+            }
+            obj = JS_AtomToValue(ctx, atom);
+            JS_FreeAtom(ctx, atom);
+        }
+        break;
+    case BC_TAG_UNINITIALIZED:
+        if (!s->is_snapshot)
+            goto invalid_tag;
+        obj = JS_UNINITIALIZED;
+        break;
     default:
     invalid_tag:
         return JS_ThrowSyntaxError(ctx, "invalid tag (tag=%d pos=%u)",
@@ -36742,7 +40440,7 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
 {
     uint8_t v8;
     JSString *p;
-    int i;
+    int i, atom_type;
     JSAtom atom;
 
     if (bc_get_u8(s, &v8))
@@ -36764,10 +40462,24 @@ static int JS_ReadObjectAtoms(BCReaderState *s)
             return s->error_state = -1;
     }
     for(i = 0; i < s->idx_to_atom_count; i++) {
+        atom_type = JS_ATOM_TYPE_STRING;
+        if (s->is_snapshot) {
+            if (bc_get_u8(s, &v8))
+                return -1;
+            atom_type = v8;
+            if (atom_type < JS_ATOM_TYPE_STRING ||
+                atom_type > JS_ATOM_TYPE_PRIVATE) {
+                JS_ThrowSyntaxError(s->ctx, "invalid atom type");
+                return -1;
+            }
+        }
         p = JS_ReadString(s);
         if (!p)
             return -1;
-        atom = JS_NewAtomStr(s->ctx, p);
+        if (atom_type == JS_ATOM_TYPE_STRING)
+            atom = JS_NewAtomStr(s->ctx, p);
+        else
+            atom = __JS_NewAtom(s->ctx->rt, p, atom_type);
         if (atom == JS_ATOM_NULL)
             return s->error_state = -1;
         s->idx_to_atom[i] = atom;
@@ -36788,10 +40500,22 @@ static void bc_reader_free(BCReaderState *s)
         js_free(s->ctx, s->idx_to_atom);
     }
     js_free(s->ctx, s->objects);
-}
-
-JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
-                       int flags)
+    for(i = 0; i < s->base_count; i++)
+        JS_FreeValue(s->ctx, s->base_tab[i]);
+    js_free(s->ctx, s->base_tab);
+    for(i = 0; i < s->bytecode_count; i++)
+        JS_FreeValue(s->ctx, s->bytecode_tab[i]);
+    js_free(s->ctx, s->bytecode_tab);
+    for(i = 0; i < s->var_ref_count; i++)
+        free_var_ref(s->ctx->rt, s->var_ref_tab[i]);
+    js_free(s->ctx, s->var_ref_tab);
+    for(i = 0; i < s->weak_key_count; i++)
+        JS_FreeValue(s->ctx, s->weak_key_tab[i]);
+    js_free(s->ctx, s->weak_key_tab);
+}
+
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, uint8_t **transfer_data, int transfer_len)
 {
     BCReaderState ss, *s = &ss;
     JSValue obj;
@@ -36805,9 +40529,12 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     s->buf_end = buf + buf_len;
     s->ptr = buf;
     s->allow_bytecode = ((flags & JS_READ_OBJ_BYTECODE) != 0);
-    s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
+    /* the bytecode is modified in place on big endian hosts */
+    s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0) && !is_be();
     s->allow_sab = ((flags & JS_READ_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_READ_OBJ_REFERENCE) != 0);
+    s->transfer_data = transfer_data;
+    s->transfer_len = transfer_len;
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
@@ -36821,6 +40548,958 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     return obj;
 }
 
+JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags)
+{
+    return JS_ReadObject2(ctx, buf, buf_len, flags, NULL, 0);
+}
+
+/* Create the atoms of the bytecode image 'buf' with the indexes they
+   have in the image. JS_READ_OBJ_ROM_DATA can then use the bytecode
+   and the line number tables of the image in place, so that several
+   runtimes (possibly in different threads) share them. The atoms are
+   kept until the runtime is freed. It must be called before any
+   non predefined atom is created, i.e. before the first context. */
+int JS_ReserveAtoms(JSRuntime *rt, const uint8_t *buf, size_t buf_len)
+{
+    const uint8_t *p = buf, *p_end = buf + buf_len;
+    uint32_t count, i, len, size;
+    BOOL is_wide_char;
+    JSString *str;
+    JSAtom atom;
+    int ret;
+
+    /* the next atoms are allocated sequentially after the predefined
+       ones if no other atom was created (atom_count includes the
+       JS_ATOM_NULL entry) */
+    if (rt->atom_count != JS_ATOM_END)
+        return -1;
+    if (p >= p_end || *p++ != BC_VERSION)
+        return -1;
+    ret = get_leb128(&count, p, p_end);
+    if (ret < 0)
+        return -1;
+    p += ret;
+    for(i = 0; i < count; i++) {
+        ret = get_leb128(&len, p, p_end);
+        if (ret < 0)
+            goto fail;
+        p += ret;
+        is_wide_char = len & 1;
+        len >>= 1;
+        size = len << is_wide_char;
+        if (len > JS_STRING_LEN_MAX || p_end - p < size)
+            goto fail;
+        str = js_alloc_string_rt(rt, len, is_wide_char);
+        if (!str)
+            goto fail;
+        memcpy(str->u.str8, p, size);
+        if (!is_wide_char)
+            str->u.str8[size] = '\0';
+        p += size;
+        atom = __JS_NewAtom(rt, str, JS_ATOM_TYPE_STRING);
+        if (atom == JS_ATOM_NULL)
+            goto fail;
+        rt->reserved_atom_count++;
+        if (atom != JS_ATOM_END + i)
+            goto fail;
+    }
+    return 0;
+ fail:
+    for(i = 0; i < rt->reserved_atom_count; i++)
+        JS_FreeAtomRT(rt, JS_ATOM_END + i);
+    rt->reserved_atom_count = 0;
+    return -1;
+}
+
+/*******************************************************************/
+/* ahead of time compilation */
+
+/* The functions which only compute with numbers stored in their
+   arguments and local variables are translated to C. The stack slots
+   and the variables become C variables of type double. Such functions
+   have no side effect, so the generated code can return 0 at any
+   point to let the interpreter execute the function when it meets a
+   case it does not handle, e.g. an argument which is not a number or
+   a variable which is not initialized. */
+
+#define AOT_STACK_SIZE_MAX 32 /* the slot types must fit in bool_mask */
+
+#define AOT_VAR_USED (1 << 0)
+#define AOT_VAR_READ (1 << 1)
+#define AOT_VAR_CHECK (1 << 2) /* the initialization is tested */
+
+typedef struct {
+    int depth; /* -1 if not reached */
+    uint32_t bool_mask; /* bit 'n' is set if the stack slot 'n' is a boolean */
+} AOTState;
+
+typedef struct {
+    JSFunctionBytecode *b;
+    AOTState *states; /* indexed by the bytecode position */
+    uint8_t *is_label;
+    uint8_t *var_flags; /* arguments then local variables */
+    uint32_t discard_mask; /* bit 'n' is set if a value of the stack
+                              slot 'n' may be discarded without being
+                              read */
+    BOOL has_poll;
+    DynBuf *dbuf; /* NULL during the analysis */
+} AOTFunc;
+
+static void __attribute__((format(printf, 2, 3)))
+aot_printf(AOTFunc *f, const char *fmt, ...)
+{
+    va_list ap;
+    char buf[256];
+    int len;
+
+    if (!f->dbuf)
+        return;
+    va_start(ap, fmt);
+    len = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    dbuf_put(f->dbuf, (uint8_t *)buf, min_int(len, sizeof(buf) - 1));
+}
+
+static void aot_print_number(AOTFunc *f, double d)
+{
+    if (isnan(d))
+        aot_printf(f, "NAN");
+    else if (isinf(d))
+        aot_printf(f, "%sINFINITY", d < 0 ? "-" : "");
+    else if (d == 0 && signbit(d))
+        aot_printf(f, "-0.0");
+    else
+        aot_printf(f, "%.17g", d);
+}
+
+/* truth value of the stack slot 'n' */
+static const char *aot_truth(char *buf, size_t buf_size, int n, uint32_t bool_mask)
+{
+    if (bool_mask & (1U << n))
+        snprintf(buf, buf_size, "(s%d != 0)", n);
+    else
+        snprintf(buf, buf_size, "(s%d != 0 && s%d == s%d)", n, n, n);
+    return buf;
+}
+
+/* code executed before a jump to 'target' */
+static void aot_jump(AOTFunc *f, int pos, int target)
+{
+    if (target <= pos) {
+        /* same frequency as the interpreter */
+        f->has_poll = TRUE;
+        aot_printf(f, "    if (--poll_count <= 0) {\n"
+                   "      poll_count = %d;\n"
+                   "      if (JS_PollInterrupts(ctx))\n"
+                   "        return -1;\n"
+                   "    }\n", JS_INTERRUPT_COUNTER_INIT);
+    }
+    aot_printf(f, "    goto L%d;\n", target);
+}
+
+/* stack permutation opcodes: return the input slot of each output
+   slot and set '*pn_in' to the number of input slots */
+static const char *aot_get_perm(int op, int *pn_in)
+{
+    switch(op) {
+    case OP_drop: *pn_in = 1; return "";
+    case OP_nip: *pn_in = 2; return "1";
+    case OP_nip1: *pn_in = 3; return "12";
+    case OP_dup: *pn_in = 1; return "00";
+    case OP_dup1: *pn_in = 2; return "001";
+    case OP_dup2: *pn_in = 2; return "0101";
+    case OP_dup3: *pn_in = 3; return "012012";
+    case OP_insert2: *pn_in = 2; return "101";
+    case OP_insert3: *pn_in = 3; return "2012";
+    case OP_perm3: *pn_in = 3; return "102";
+    case OP_swap: *pn_in = 2; return "10";
+    case OP_rot3l: *pn_in = 3; return "120";
+    case OP_rot3r: *pn_in = 3; return "201";
+    default: return NULL;
+    }
+}
+
+/* comparison of the stack slots 'n' and 'n + 1' */
+static const char *aot_cmp(char *buf, size_t buf_size, int op, int n,
+                           uint32_t bool_mask)
+{
+    const char *op_str;
+    BOOL is_strict = FALSE;
+
+    switch(op) {
+    case OP_lt:
+        op_str = "<";
+        break;
+    case OP_lte:
+        op_str = "<=";
+        break;
+    case OP_gt:
+        op_str = ">";
+        break;
+    case OP_gte:
+        op_str = ">=";
+        break;
+    case OP_eq:
+        op_str = "==";
+        break;
+    case OP_neq:
+        op_str = "!=";
+        break;
+    case OP_strict_eq:
+        op_str = "==";
+        is_strict = TRUE;
+        break;
+    default:
+        op_str = "!=";
+        is_strict = TRUE;
+        break;
+    }
+    /* a boolean is never strictly equal to a number */
+    if (is_strict && ((bool_mask >> n) & 1) != ((bool_mask >> (n + 1)) & 1))
+        snprintf(buf, buf_size, "%d", op == OP_strict_neq);
+    else
+        snprintf(buf, buf_size, "(s%d %s s%d)", n, op_str, n + 1);
+    return buf;
+}
+
+/* Compute in 'st' the state after the opcode at 'pos' and emit its C
+   code if f->dbuf is not NULL. '*ptarget' is set to the branch target
+   or -1 and '*pfall' to FALSE if the execution does not continue at
+   the next opcode. Return -1 if the opcode is not supported. */
+static int aot_op(AOTFunc *f, int pos, AOTState *st, int *ptarget, BOOL *pfall)
+{
+    JSFunctionBytecode *b = f->b;
+    const uint8_t *bc = b->byte_code_buf + pos;
+    int op, d, idx, n_in, i, n_out, val;
+    uint32_t m, m0;
+    const char *perm, *op_str;
+    char t1[64];
+    JSValue v;
+    BOOL is_arg;
+
+    op = bc[0];
+    d = st->depth;
+    m = st->bool_mask;
+    *ptarget = -1;
+    *pfall = TRUE;
+    switch(op) {
+    case OP_nop:
+        break;
+    case OP_push_minus1:
+    case OP_push_0:
+    case OP_push_1:
+    case OP_push_2:
+    case OP_push_3:
+    case OP_push_4:
+    case OP_push_5:
+    case OP_push_6:
+    case OP_push_7:
+        val = op - OP_push_0;
+        goto push_int;
+    case OP_push_i8:
+        val = (int8_t)bc[1];
+        goto push_int;
+    case OP_push_i16:
+        val = (int16_t)get_u16(bc + 1);
+        goto push_int;
+    case OP_push_i32:
+        val = get_u32(bc + 1);
+    push_int:
+        aot_printf(f, "  s%d = %d;\n", d, val);
+        m &= ~(1U << d);
+        d++;
+        break;
+    case OP_push_false:
+    case OP_push_true:
+        aot_printf(f, "  s%d = %d;\n", d, op == OP_push_true);
+        m |= 1U << d;
+        d++;
+        break;
+    case OP_push_const:
+    case OP_push_const8:
+        if (op == OP_push_const)
+            idx = get_u32(bc + 1);
+        else
+            idx = bc[1];
+        v = b->cpool[idx];
+        if (JS_VALUE_GET_TAG(v) == JS_TAG_INT) {
+            aot_printf(f, "  s%d = %d;\n", d, JS_VALUE_GET_INT(v));
+        } else if (JS_TAG_IS_FLOAT64(JS_VALUE_GET_TAG(v))) {
+            aot_printf(f, "  s%d = ", d);
+            aot_print_number(f, JS_VALUE_GET_FLOAT64(v));
+            aot_printf(f, ";\n");
+        } else {
+            return -1;
+        }
+        m &= ~(1U << d);
+        d++;
+        break;
+
+    case OP_get_loc:
+    case OP_get_loc_check:
+        idx = get_u16(bc + 1);
+        goto get_loc;
+    case OP_get_loc8:
+        idx = bc[1];
+        goto get_loc;
+    case OP_get_loc0:
+    case OP_get_loc1:
+    case OP_get_loc2:
+    case OP_get_loc3:
+        idx = op - OP_get_loc0;
+    get_loc:
+        f->var_flags[b->arg_count + idx] |= AOT_VAR_USED | AOT_VAR_READ;
+        aot_printf(f, "  if (!l%d_ok)\n"
+                   "    return 0;\n"
+                   "  s%d = l%d;\n", idx, d, idx);
+        m &= ~(1U << d);
+        d++;
+        break;
+    case OP_get_arg:
+        idx = get_u16(bc + 1);
+        goto get_arg;
+    case OP_get_arg0:
+    case OP_get_arg1:
+    case OP_get_arg2:
+    case OP_get_arg3:
+        idx = op - OP_get_arg0;
+    get_arg:
+        f->var_flags[idx] |= AOT_VAR_USED | AOT_VAR_READ;
+        aot_printf(f, "  s%d = a%d;\n", d, idx);
+        m &= ~(1U << d);
+        d++;
+        break;
+    case OP_put_loc:
+    case OP_set_loc:
+    case OP_put_loc_check:
+    case OP_put_loc_check_init:
+        idx = get_u16(bc + 1);
+        is_arg = FALSE;
+        goto put_var;
+    case OP_put_loc8:
+    case OP_set_loc8:
+        idx = bc[1];
+        is_arg = FALSE;
+        goto put_var;
+    case OP_put_loc0:
+    case OP_put_loc1:
+    case OP_put_loc2:
+    case OP_put_loc3:
+        idx = op - OP_put_loc0;
+        is_arg = FALSE;
+        goto put_var;
+    case OP_set_loc0:
+    case OP_set_loc1:
+    case OP_set_loc2:
+    case OP_set_loc3:
+        idx = op - OP_set_loc0;
+        is_arg = FALSE;
+        goto put_var;
+    case OP_put_arg:
+    case OP_set_arg:
+        idx = get_u16(bc + 1);
+        is_arg = TRUE;
+        goto put_var;
+    case OP_put_arg0:
+    case OP_put_arg1:
+    case OP_put_arg2:
+    case OP_put_arg3:
+        idx = op - OP_put_arg0;
+        is_arg = TRUE;
+        goto put_var;
+    case OP_set_arg0:
+    case OP_set_arg1:
+    case OP_set_arg2:
+    case OP_set_arg3:
+        idx = op - OP_set_arg0;
+        is_arg = TRUE;
+    put_var:
+        /* the variables only contain numbers */
+        if (m & (1U << (d - 1)))
+            return -1;
+        /* the flags are only complete after the analysis, so the
+           slot is marked if the variable is not read yet */
+        if (!(f->var_flags[is_arg ? idx : b->arg_count + idx] & AOT_VAR_READ))
+            f->discard_mask |= 1U << (d - 1);
+        if (is_arg) {
+            f->var_flags[idx] |= AOT_VAR_USED;
+            if (f->var_flags[idx] & AOT_VAR_READ)
+                aot_printf(f, "  a%d = s%d;\n", idx, d - 1);
+        } else {
+            f->var_flags[b->arg_count + idx] |= AOT_VAR_USED;
+            if (op == OP_put_loc_check) {
+                /* the interpreter throws the ReferenceError */
+                f->var_flags[b->arg_count + idx] |= AOT_VAR_CHECK;
+                aot_printf(f, "  if (!l%d_ok)\n"
+                           "    return 0;\n", idx);
+            }
+            if (f->var_flags[b->arg_count + idx] & AOT_VAR_READ)
+                aot_printf(f, "  l%d = s%d;\n", idx, d - 1);
+            if (f->var_flags[b->arg_count + idx] & (AOT_VAR_READ | AOT_VAR_CHECK))
+                aot_printf(f, "  l%d_ok = 1;\n", idx);
+        }
+        switch(op) {
+        case OP_set_loc:
+        case OP_set_loc8:
+        case OP_set_loc0:
+        case OP_set_loc1:
+        case OP_set_loc2:
+        case OP_set_loc3:
+        case OP_set_arg:
+        case OP_set_arg0:
+        case OP_set_arg1:
+        case OP_set_arg2:
+        case OP_set_arg3:
+            break;
+        default:
+            d--;
+            break;
+        }
+        break;
+    case OP_set_loc_uninitialized:
+        idx = get_u16(bc + 1);
+        f->var_flags[b->arg_count + idx] |= AOT_VAR_USED;
+        if (f->var_flags[b->arg_count + idx] & (AOT_VAR_READ | AOT_VAR_CHECK))
+            aot_printf(f, "  l%d_ok = 0;\n", idx);
+        break;
+    case OP_inc_loc:
+    case OP_dec_loc:
+    case OP_add_loc:
+        idx = bc[1];
+        f->var_flags[b->arg_count + idx] |= AOT_VAR_USED | AOT_VAR_READ;
+        aot_printf(f, "  if (!l%d_ok)\n"
+                   "    return 0;\n", idx);
+        if (op == OP_add_loc) {
+            aot_printf(f, "  l%d += s%d;\n", idx, d - 1);
+            d--;
+        } else {
+            aot_printf(f, "  l%d %s= 1;\n", idx, op == OP_inc_loc ? "+" : "-");
+        }
+        break;
+
+    case OP_neg:
+        aot_printf(f, "  s%d = -s%d;\n", d - 1, d - 1);
+        m &= ~(1U << (d - 1));
+        break;
+    case OP_plus:
+        m &= ~(1U << (d - 1));
+        break;
+    case OP_inc:
+    case OP_dec:
+        aot_printf(f, "  s%d %s= 1;\n", d - 1, op == OP_inc ? "+" : "-");
+        m &= ~(1U << (d - 1));
+        break;
+    case OP_post_inc:
+    case OP_post_dec:
+        aot_printf(f, "  s%d = s%d %s 1;\n", d, d - 1,
+                   op == OP_post_inc ? "+" : "-");
+        m &= ~(3U << (d - 1));
+        d++;
+        break;
+    case OP_not:
+        aot_printf(f, "  s%d = ~aot_toint32(s%d);\n", d - 1, d - 1);
+        m &= ~(1U << (d - 1));
+        break;
+    case OP_lnot:
+        aot_printf(f, "  s%d = !%s;\n",
+                   d - 1, aot_truth(t1, sizeof(t1), d - 1, m));
+        m |= 1U << (d - 1);
+        break;
+
+    case OP_mul:
+        op_str = "*";
+        goto arith;
+    case OP_div:
+        op_str = "/";
+        goto arith;
+    case OP_add:
+        op_str = "+";
+        goto arith;
+    case OP_sub:
+        op_str = "-";
+    arith:
+        aot_printf(f, "  s%d = s%d %s s%d;\n", d - 2, d - 2, op_str, d - 1);
+        goto binary_number;
+    case OP_mod:
+        aot_printf(f, "  s%d = aot_mod(s%d, s%d);\n", d - 2, d - 2, d - 1);
+        goto binary_number;
+    case OP_shl:
+        aot_printf(f, "  s%d = (int32_t)((uint32_t)aot_toint32(s%d) << (aot_toint32(s%d) & 31));\n",
+                   d - 2, d - 2, d - 1);
+        goto binary_number;
+    case OP_sar:
+        aot_printf(f, "  s%d = aot_toint32(s%d) >> (aot_toint32(s%d) & 31);\n",
+                   d - 2, d - 2, d - 1);
+        goto binary_number;
+    case OP_shr:
+        aot_printf(f, "  s%d = (uint32_t)aot_toint32(s%d) >> (aot_toint32(s%d) & 31);\n",
+                   d - 2, d - 2, d - 1);
+        goto binary_number;
+    case OP_and:
+        op_str = "&";
+        goto bitwise;
+    case OP_or:
+        op_str = "|";
+        goto bitwise;
+    case OP_xor:
+        op_str = "^";
+    bitwise:
+        aot_printf(f, "  s%d = aot_toint32(s%d) %s aot_toint32(s%d);\n",
+                   d - 2, d - 2, op_str, d - 1);
+    binary_number:
+        m &= ~(3U << (d - 2));
+        d--;
+        break;
+    case OP_lt:
+    case OP_lte:
+    case OP_gt:
+    case OP_gte:
+    case OP_eq:
+    case OP_neq:
+    case OP_strict_eq:
+    case OP_strict_neq:
+        aot_printf(f, "  s%d = %s;\n", d - 2, aot_cmp(t1, sizeof(t1), op, d - 2, m));
+        m &= ~(3U << (d - 2));
+        m |= 1U << (d - 2);
+        d--;
+        break;
+
+    case OP_if_false:
+    case OP_if_true:
+        *ptarget = pos + 1 + (int32_t)get_u32(bc + 1);
+        goto if_false;
+    case OP_if_false8:
+    case OP_if_true8:
+        *ptarget = pos + 1 + (int8_t)bc[1];
+    if_false:
+        aot_truth(t1, sizeof(t1), d - 1, m);
+        aot_printf(f, "  if (%s%s) {\n",
+                   (op == OP_if_false || op == OP_if_false8) ? "!" : "", t1);
+        aot_jump(f, pos, *ptarget);
+        aot_printf(f, "  }\n");
+        m &= ~(1U << (d - 1));
+        d--;
+        break;
+    case OP_lt_if_false8:
+    case OP_lte_if_false8:
+    case OP_gt_if_false8:
+    case OP_strict_eq_if_false8:
+        *ptarget = pos + 1 + (int8_t)bc[1];
+        switch(op) {
+        case OP_lt_if_false8:
+            i = OP_lt;
+            break;
+        case OP_lte_if_false8:
+            i = OP_lte;
+            break;
+        case OP_gt_if_false8:
+            i = OP_gt;
+            break;
+        default:
+            i = OP_strict_eq;
+            break;
+        }
+        aot_printf(f, "  if (!%s) {\n", aot_cmp(t1, sizeof(t1), i, d - 2, m));
+        aot_jump(f, pos, *ptarget);
+        aot_printf(f, "  }\n");
+        m &= ~(3U << (d - 2));
+        d -= 2;
+        break;
+    case OP_goto:
+        *ptarget = pos + 1 + (int32_t)get_u32(bc + 1);
+        goto do_goto;
+    case OP_goto16:
+        *ptarget = pos + 1 + (int16_t)get_u16(bc + 1);
+        goto do_goto;
+    case OP_goto8:
+        *ptarget = pos + 1 + (int8_t)bc[1];
+    do_goto:
+        aot_printf(f, "  {\n");
+        aot_jump(f, pos, *ptarget);
+        aot_printf(f, "  }\n");
+        *pfall = FALSE;
+        break;
+    case OP_return:
+        if (m & (1U << (d - 1)))
+            aot_printf(f, "  *pret = JS_NewBool(ctx, s%d != 0);\n", d - 1);
+        else
+            aot_printf(f, "  *pret = JS_NewFloat64(ctx, s%d);\n", d - 1);
+        aot_printf(f, "  return 1;\n");
+        d--;
+        *pfall = FALSE;
+        break;
+    case OP_return_undef:
+        aot_printf(f, "  *pret = JS_UNDEFINED;\n"
+                   "  return 1;\n");
+        *pfall = FALSE;
+        break;
+    default:
+        perm = aot_get_perm(op, &n_in);
+        if (!perm)
+            return -1;
+        n_out = strlen(perm);
+        d -= n_in;
+        for(i = 0; i < n_in; i++) {
+            if (!strchr(perm, '0' + i))
+                f->discard_mask |= 1U << (d + i);
+        }
+        if (n_out != 0) {
+            aot_printf(f, "  {\n");
+            for(i = 0; i < n_in; i++) {
+                if (strchr(perm, '0' + i))
+                    aot_printf(f, "    double t%d = s%d;\n", i, d + i);
+            }
+            for(i = 0; i < n_out; i++) {
+                idx = perm[i] - '0';
+                aot_printf(f, "    s%d = t%d;\n", d + i, idx);
+            }
+            aot_printf(f, "  }\n");
+        }
+        /* remove the input slots and add the output slots */
+        m0 = m;
+        m &= (1U << d) - 1;
+        for(i = 0; i < n_out; i++) {
+            idx = perm[i] - '0';
+            if (m0 & (1U << (d + idx)))
+                m |= 1U << (d + i);
+        }
+        d += n_out;
+        break;
+    }
+    /* clear the types of the removed slots */
+    if (d >= 0 && d < 32)
+        m &= (1U << d) - 1;
+    st->depth = d;
+    st->bool_mask = m;
+    return pos + short_opcode_info(op).size;
+}
+
+static BOOL aot_is_candidate(JSFunctionBytecode *b)
+{
+    int i;
+
+    if (b->func_kind != JS_FUNC_NORMAL ||
+        b->is_derived_class_constructor ||
+        b->stack_size > AOT_STACK_SIZE_MAX)
+        return FALSE;
+#ifdef CONFIG_BIGNUM
+    if (b->js_mode & JS_MODE_MATH)
+        return FALSE;
+#endif
+    for(i = 0; i < b->arg_count + b->var_count; i++) {
+        if (b->vardefs[i].is_captured)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* propagate the state 'st' to the opcode at 'pos'. Return -1 if the
+   slot types are not the same on all the paths. */
+static int aot_merge(AOTFunc *f, int pos, const AOTState *st,
+                     int *worklist, int *pworklist_len)
+{
+    AOTState *st1 = &f->states[pos];
+
+    if (pos < 0 || pos >= f->b->byte_code_len)
+        return -1;
+    if (st1->depth < 0) {
+        *st1 = *st;
+        worklist[(*pworklist_len)++] = pos;
+        return 0;
+    }
+    if (st1->depth != st->depth || st1->bool_mask != st->bool_mask)
+        return -1;
+    return 0;
+}
+
+/* Analyze the function 'b' and if it can be translated, output it as
+   the C function 'name'. Return 1 if the function was output, 0 if it
+   cannot be translated and -1 if there is not enough memory. */
+static int aot_function(JSContext *ctx, DynBuf *dbuf, JSFunctionBytecode *b,
+                        const char *name)
+{
+    AOTFunc f_s, *f = &f_s;
+    AOTState st;
+    int *worklist, worklist_len, pos, next, target, i, ret, max_depth;
+    BOOL fall;
+    const char *p;
+    char buf[ATOM_GET_STR_BUF_SIZE];
+
+    if (!aot_is_candidate(b))
+        return 0;
+    memset(f, 0, sizeof(*f));
+    f->b = b;
+    ret = -1;
+    f->states = js_malloc(ctx, sizeof(f->states[0]) * b->byte_code_len);
+    f->is_label = js_mallocz(ctx, b->byte_code_len);
+    f->var_flags = js_mallocz(ctx, b->arg_count + b->var_count + 1);
+    /* each opcode is added at most once */
+    worklist = js_malloc(ctx, sizeof(worklist[0]) * b->byte_code_len);
+    if (!f->states || !f->is_label || !f->var_flags || !worklist)
+        goto done;
+    for(pos = 0; pos < b->byte_code_len; pos++)
+        f->states[pos].depth = -1;
+
+    /* compute the stack state before each reachable opcode */
+    ret = 0;
+    max_depth = 0;
+    f->states[0].depth = 0;
+    f->states[0].bool_mask = 0;
+    worklist[0] = 0;
+    worklist_len = 1;
+    while (worklist_len > 0) {
+        pos = worklist[--worklist_len];
+        st = f->states[pos];
+        for(;;) {
+            next = aot_op(f, pos, &st, &target, &fall);
+            if (next < 0 || st.depth < 0 || st.depth > b->stack_size)
+                goto done;
+            max_depth = max_int(max_depth, st.depth);
+            if (target >= 0) {
+                f->is_label[target] = 1;
+                if (aot_merge(f, target, &st, worklist, &worklist_len))
+                    goto done;
+            }
+            if (!fall)
+                break;
+            if (next >= b->byte_code_len)
+                goto done;
+            if (f->states[next].depth >= 0) {
+                if (aot_merge(f, next, &st, worklist, &worklist_len))
+                    goto done;
+                break;
+            }
+            f->states[next] = st;
+            pos = next;
+        }
+    }
+    /* output the C code */
+    dbuf_printf(dbuf, "\n/* ");
+    for(p = JS_AtomGetStr(ctx, buf, sizeof(buf), b->func_name); *p; p++) {
+        if (*p == '*' || *p == '/' || (uint8_t)*p < 0x20)
+            dbuf_putc(dbuf, '_');
+        else
+            dbuf_putc(dbuf, *p);
+    }
+    if (b->has_debug)
+        dbuf_printf(dbuf, ", line %d", b->debug.line_num);
+    dbuf_printf(dbuf, " */\n"
+                "static int %s(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)\n"
+                "{\n", name);
+    for(i = 0; i < b->arg_count; i++) {
+        if (f->var_flags[i] & AOT_VAR_READ)
+            dbuf_printf(dbuf, "  double a%d;\n", i);
+    }
+    for(i = 0; i < b->var_count; i++) {
+        if (f->var_flags[b->arg_count + i] & AOT_VAR_READ)
+            dbuf_printf(dbuf, "  double l%d = 0;\n", i);
+        if (f->var_flags[b->arg_count + i] & (AOT_VAR_READ | AOT_VAR_CHECK))
+            dbuf_printf(dbuf, "  int l%d_ok = 0;\n", i);
+    }
+    for(i = 0; i < max_depth; i++)
+        dbuf_printf(dbuf, "  double s%d = 0;\n", i);
+    if (f->has_poll)
+        dbuf_printf(dbuf, "  int poll_count = %d;\n", JS_INTERRUPT_COUNTER_INIT);
+    /* avoid the warnings for the slots which are never read */
+    for(i = 0; i < max_depth; i++) {
+        if (f->discard_mask & (1U << i))
+            dbuf_printf(dbuf, "  (void)s%d;\n", i);
+    }
+    dbuf_printf(dbuf, "\n");
+    for(i = 0; i < b->arg_count; i++) {
+        if (f->var_flags[i] & AOT_VAR_READ) {
+            dbuf_printf(dbuf, "  if (argc <= %d || !aot_get_number(&a%d, argv[%d]))\n"
+                        "    return 0;\n", i, i, i);
+        }
+    }
+    f->dbuf = dbuf;
+    for(pos = 0; pos < b->byte_code_len; pos = next) {
+        next = pos + short_opcode_info(b->byte_code_buf[pos]).size;
+        if (f->states[pos].depth < 0)
+            continue; /* not reachable */
+        if (f->is_label[pos])
+            dbuf_printf(dbuf, " L%d:\n", pos);
+        st = f->states[pos];
+        aot_op(f, pos, &st, &target, &fall);
+    }
+    dbuf_printf(dbuf, "}\n");
+    ret = dbuf_error(dbuf) ? -1 : 1;
+ done:
+    js_free(ctx, f->states);
+    js_free(ctx, f->is_label);
+    js_free(ctx, f->var_flags);
+    js_free(ctx, worklist);
+    return ret;
+}
+
+/* set '*pb' to the function bytecode of 'obj' or to NULL if it is not
+   a function */
+static int aot_get_bytecode(JSContext *ctx, JSFunctionBytecode **pb,
+                            JSValueConst obj)
+{
+    JSFunctionBytecode *b;
+
+    *pb = NULL;
+    if (JS_VALUE_GET_TAG(obj) == JS_TAG_MODULE)
+        obj = ((JSModuleDef *)JS_VALUE_GET_PTR(obj))->func_obj;
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_FUNCTION_BYTECODE)
+        return 0;
+    b = JS_VALUE_GET_PTR(obj);
+    if (b->is_lazy) {
+        /* same bytecode as the one written by JS_WriteObject() */
+        if (JS_IsUndefined(b->cpool[0])) {
+            if (js_compile_lazy_function(b->realm, b))
+                return -1;
+        }
+        b = JS_VALUE_GET_PTR(b->cpool[0]);
+    }
+    *pb = b;
+    return 0;
+}
+
+typedef struct {
+    int count; /* number of enumerated functions */
+    /* JS_WriteAOTFunctions() */
+    DynBuf *dbuf;
+    DynBuf is_compiled; /* one byte per function */
+    const char *c_name;
+    /* JS_SetAOTFunctions() */
+    JSAOTFunction * const *tab;
+} AOTUnit;
+
+/* enumerate the functions of 'obj' in depth first order */
+static int aot_unit(JSContext *ctx, AOTUnit *u, JSValueConst obj)
+{
+    JSFunctionBytecode *b;
+    char name[128];
+    int idx, i, ret;
+
+    if (aot_get_bytecode(ctx, &b, obj))
+        return -1;
+    if (!b)
+        return 0;
+    idx = u->count++;
+    if (u->dbuf) {
+        snprintf(name, sizeof(name), "%s_f%d", u->c_name, idx);
+        ret = aot_function(ctx, u->dbuf, b, name);
+        if (ret < 0 || dbuf_putc(&u->is_compiled, ret)) {
+            JS_ThrowOutOfMemory(ctx);
+            return -1;
+        }
+    } else if (u->tab) {
+        b->aot_func = u->tab[idx];
+    }
+    for(i = 0; i < b->cpool_count; i++) {
+        if (aot_unit(ctx, u, b->cpool[i]))
+            return -1;
+    }
+    return 0;
+}
+
+/* Return the C source of the functions of 'obj' (a function or a
+   module returned by JS_Eval() with JS_EVAL_FLAG_COMPILE_ONLY) which
+   can be translated to C. It defines the table 'c_name'_aot[] for
+   JS_SetAOTFunctions() and its length 'c_name'_aot_count. The result
+   must be freed with js_free(). */
+char *JS_WriteAOTFunctions(JSContext *ctx, size_t *psize, JSValueConst obj,
+                           const char *c_name)
+{
+    AOTUnit u_s, *u = &u_s;
+    DynBuf dbuf;
+    int i;
+
+    js_dbuf_init(ctx, &dbuf);
+    memset(u, 0, sizeof(*u));
+    u->dbuf = &dbuf;
+    u->c_name = c_name;
+    js_dbuf_init(ctx, &u->is_compiled);
+    dbuf_printf(&dbuf,
+                "#ifndef AOT_HELPERS_DEFINED\n"
+                "#define AOT_HELPERS_DEFINED\n"
+                "\n"
+                "static inline int aot_get_number(double *pres, JSValueConst val)\n"
+                "{\n"
+                "  int tag = JS_VALUE_GET_TAG(val);\n"
+                "  if (tag == JS_TAG_INT)\n"
+                "    *pres = JS_VALUE_GET_INT(val);\n"
+                "  else if (JS_TAG_IS_FLOAT64(tag))\n"
+                "    *pres = JS_VALUE_GET_FLOAT64(val);\n"
+                "  else\n"
+                "    return 0;\n"
+                "  return 1;\n"
+                "}\n"
+                "\n"
+                "static inline int32_t aot_toint32(double d)\n"
+                "{\n"
+                "  if (d >= -2147483648.0 && d <= 2147483647.0)\n"
+                "    return (int32_t)d;\n"
+                "  if (!isfinite(d))\n"
+                "    return 0;\n"
+                "  d = fmod(trunc(d), 4294967296.0);\n"
+                "  if (d < 0)\n"
+                "    d += 4294967296.0;\n"
+                "  return (int32_t)(uint32_t)d;\n"
+                "}\n"
+                "\n"
+                "static inline double aot_mod(double a, double b)\n"
+                "{\n"
+                "  /* the sign of a null result is the sign of 'a' */\n"
+                "  if (a >= 1 && a <= 2147483647.0 && a == (int32_t)a &&\n"
+                "      b >= 1 && b <= 2147483647.0 && b == (int32_t)b)\n"
+                "    return (int32_t)a %% (int32_t)b;\n"
+                "  return fmod(a, b);\n"
+                "}\n"
+                "\n"
+                "#endif\n");
+    if (aot_unit(ctx, u, obj))
+        goto fail;
+    dbuf_printf(&dbuf, "\nJSAOTFunction * const %s_aot[%d] = {\n",
+                c_name, max_int(u->count, 1));
+    for(i = 0; i < u->count; i++) {
+        if (u->is_compiled.buf[i])
+            dbuf_printf(&dbuf, "  %s_f%d,\n", c_name, i);
+        else
+            dbuf_printf(&dbuf, "  NULL,\n");
+    }
+    dbuf_printf(&dbuf, "};\n"
+                "\n"
+                "const int %s_aot_count = %d;\n", c_name, u->count);
+    if (dbuf_error(&dbuf)) {
+        JS_ThrowOutOfMemory(ctx);
+        goto fail;
+    }
+    dbuf_free(&u->is_compiled);
+    *psize = dbuf.size;
+    /* the result is a C string */
+    dbuf_putc(&dbuf, '\0');
+    return (char *)dbuf.buf;
+ fail:
+    dbuf_free(&u->is_compiled);
+    dbuf_free(&dbuf);
+    return NULL;
+}
+
+/* Install the C functions output by JS_WriteAOTFunctions() in the
+   functions of 'obj' returned by JS_ReadObject(). */
+int JS_SetAOTFunctions(JSContext *ctx, JSValueConst obj,
+                       JSAOTFunction * const *tab, int tab_len)
+{
+    AOTUnit u_s, *u = &u_s;
+
+    /* check the number of functions before modifying them */
+    memset(u, 0, sizeof(*u));
+    if (aot_unit(ctx, u, obj))
+        return -1;
+    if (u->count != tab_len) {
+        JS_ThrowInternalError(ctx, "the compiled functions do not match the bytecode");
+        return -1;
+    }
+    u->count = 0;
+    u->tab = tab;
+    return aot_unit(ctx, u, obj);
+}
+
 /*******************************************************************/
 /* runtime functions & objects */
 
@@ -37157,6 +41836,15 @@ static JSValue JS_ToObject(JSContext *ctx, JSValueConst val)
     case JS_TAG_FLOAT64:
         obj = JS_NewObjectClass(ctx, JS_CLASS_NUMBER);
         goto set_value;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSValue str = JS_ToString(ctx, val);
+            if (JS_IsException(str))
+                return str;
+            obj = JS_ToObject(ctx, str);
+            JS_FreeValue(ctx, str);
+            return obj;
+        }
     case JS_TAG_STRING:
         /* XXX: should call the string constructor */
         {
@@ -40889,6 +45577,39 @@ static JSValue js_array_iterator_next(JSContext *ctx, JSValueConst this_val,
     }
 }
 
+/* Fast path of the built-in array iterator 'next' method for the
+   values of fast arrays: the element is read without going through
+   the 'length' and indexed property accesses. Return FALSE if the
+   generic path must be used (e.g. end of iteration, array no longer
+   fast or element in the prototype). */
+static BOOL js_array_iterator_fast_next(JSContext *ctx, JSValueConst enum_obj,
+                                        JSValueConst method, JSValue *pval)
+{
+    JSObject *p, *pm;
+    JSArrayIteratorData *it;
+
+    if (JS_VALUE_GET_TAG(enum_obj) != JS_TAG_OBJECT ||
+        JS_VALUE_GET_TAG(method) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(enum_obj);
+    pm = JS_VALUE_GET_OBJ(method);
+    if (p->class_id != JS_CLASS_ARRAY_ITERATOR ||
+        pm->class_id != JS_CLASS_C_FUNCTION ||
+        pm->u.cfunc.c_function.iterator_next != js_array_iterator_next)
+        return FALSE;
+    it = p->u.array_iterator_data;
+    if (!it || it->kind != JS_ITERATOR_KIND_VALUE ||
+        JS_VALUE_GET_TAG(it->obj) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(it->obj);
+    /* the elements < count are own data properties */
+    if (p->class_id != JS_CLASS_ARRAY || !p->fast_array ||
+        it->idx >= p->u.array.count)
+        return FALSE;
+    *pval = JS_DupValue(ctx, p->u.array.u.values[it->idx++]);
+    return TRUE;
+}
+
 static JSValue js_iterator_proto_iterator(JSContext *ctx, JSValueConst this_val,
                                           int argc, JSValueConst *argv)
 {
@@ -41439,7 +46160,7 @@ static JSValue js_string_constructor(JSContext *ctx, JSValueConst new_target,
 
 static JSValue js_thisStringValue(JSContext *ctx, JSValueConst this_val)
 {
-    if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING)
+    if (JS_IsString(this_val))
         return JS_DupValue(ctx, this_val);
 
     if (JS_VALUE_GET_TAG(this_val) == JS_TAG_OBJECT) {
@@ -41683,6 +46404,8 @@ static JSValue js_string_concat(JSContext *ctx, JSValueConst this_val,
 static int string_cmp(JSString *p1, JSString *p2, int x1, int x2, int len)
 {
     int i, c1, c2;
+    if (!p1->is_wide_char && !p2->is_wide_char)
+        return memcmp(p1->u.str8 + x1, p2->u.str8 + x2, len);
     for (i = 0; i < len; i++) {
         if ((c1 = string_get(p1, x1 + i)) != (c2 = string_get(p2, x2 + i)))
             return c1 - c2;
@@ -41690,24 +46413,180 @@ static int string_cmp(JSString *p1, JSString *p2, int x1, int x2, int len)
     return 0;
 }
 
+/* Substring search. The short needles are searched by testing their
+   first and last characters on blocks of STRING_FIND_BLOCK_LEN
+   positions so that the loop can be vectorized by the C compiler. The
+   long needles use the Two-Way algorithm (Crochemore and Perrin, 1991)
+   with a bad character shift so that the search time stays linear. */
+
+#define STRING_FIND_BLOCK_LEN 16
+/* minimum needle length for the Two-Way algorithm */
+#define STRING_TWO_WAY_LEN_MIN 32
+
+#define DEF_STRING_FIND(name, htype, ntype)                             \
+static int name ## _short(const htype *h, int len, const ntype *s,     \
+                          int m, int k)                                 \
+{                                                                       \
+    const htype *p;                                                     \
+    htype c0 = s[0], c1 = s[m - 1], found;                              \
+    int i, j, n, last = len - m;                                        \
+    while (k <= last) {                                                 \
+        n = last - k + 1;                                               \
+        if (n >= STRING_FIND_BLOCK_LEN) {                               \
+            p = h + k;                                                  \
+            found = 0;                                                  \
+            for(i = 0; i < STRING_FIND_BLOCK_LEN; i++)                  \
+                found |= (p[i] == c0) & (p[i + m - 1] == c1);           \
+            if (!found) {                                               \
+                k += STRING_FIND_BLOCK_LEN;                             \
+                continue;                                               \
+            }                                                           \
+            n = STRING_FIND_BLOCK_LEN;                                  \
+        }                                                               \
+        for(; n > 0; n--, k++) {                                        \
+            if (h[k] == c0 && h[k + m - 1] == c1) {                     \
+                for(j = 1; j < m - 1 && h[k + j] == s[j]; j++)          \
+                    continue;                                           \
+                if (j >= m - 1)                                         \
+                    return k;                                           \
+            }                                                           \
+        }                                                               \
+    }                                                                   \
+    return -1;                                                          \
+}                                                                       \
+                                                                        \
+static int name ## _two_way(const htype *h, int len, const ntype *s,   \
+                            int m, int k)                               \
+{                                                                       \
+    /* index + 1 of the last needle character with the same low 8      \
+       bits, 0 if none */                                               \
+    int shift[256];                                                     \
+    int i, j, ip, jp, p, p0, ms, mem, mem0;                             \
+                                                                        \
+    /* critical factorization: maximal suffixes for both orderings */  \
+    ip = -1; jp = 0; j = p = 1;                                         \
+    while (jp + j < m) {                                                \
+        if (s[ip + j] == s[jp + j]) {                                   \
+            if (j == p) {                                               \
+                jp += p;                                                \
+                j = 1;                                                  \
+            } else {                                                    \
+                j++;                                                    \
+            }                                                           \
+        } else if (s[ip + j] > s[jp + j]) {                             \
+            jp += j;                                                    \
+            j = 1;                                                      \
+            p = jp - ip;                                                \
+        } else {                                                        \
+            ip = jp++;                                                  \
+            j = p = 1;                                                  \
+        }                                                               \
+    }                                                                   \
+    ms = ip;                                                            \
+    p0 = p;                                                             \
+    ip = -1; jp = 0; j = p = 1;                                         \
+    while (jp + j < m) {                                                \
+        if (s[ip + j] == s[jp + j]) {                                   \
+            if (j == p) {                                               \
+                jp += p;                                                \
+                j = 1;                                                  \
+            } else {                                                    \
+                j++;                                                    \
+            }                                                           \
+        } else if (s[ip + j] < s[jp + j]) {                             \
+            jp += j;                                                    \
+            j = 1;                                                      \
+            p = jp - ip;                                                \
+        } else {                                                        \
+            ip = jp++;                                                  \
+            j = p = 1;                                                  \
+        }                                                               \
+    }                                                                   \
+    if (ip > ms)                                                        \
+        ms = ip;                                                        \
+    else                                                                \
+        p = p0;                                                         \
+                                                                        \
+    /* periodic needle ? */                                             \
+    for(i = 0; i <= ms && s[i] == s[i + p]; i++)                        \
+        continue;                                                       \
+    if (i <= ms) {                                                      \
+        mem0 = 0;                                                       \
+        p = max_int(ms, m - ms - 1) + 1;                                \
+    } else {                                                            \
+        mem0 = m - p;                                                   \
+    }                                                                   \
+                                                                        \
+    memset(shift, 0, sizeof(shift));                                    \
+    for(i = 0; i < m; i++)                                              \
+        shift[s[i] & 0xff] = i + 1;                                     \
+                                                                        \
+    mem = 0;                                                            \
+    while (k <= len - m) {                                              \
+        j = shift[h[k + m - 1] & 0xff];                                 \
+        if (j == 0) {                                                   \
+            k += m;                                                     \
+            mem = 0;                                                    \
+            continue;                                                   \
+        }                                                               \
+        j = m - j;                                                      \
+        if (j != 0) {                                                   \
+            if (j < mem)                                                \
+                j = mem;                                                \
+            k += j;                                                     \
+            mem = 0;                                                    \
+            continue;                                                   \
+        }                                                               \
+        /* compare the right half */                                    \
+        for(j = max_int(ms + 1, mem); j < m && s[j] == h[k + j]; j++)   \
+            continue;                                                   \
+        if (j < m) {                                                    \
+            k += j - ms;                                                \
+            mem = 0;                                                    \
+            continue;                                                   \
+        }                                                               \
+        /* compare the left half */                                     \
+        for(j = ms + 1; j > mem && s[j - 1] == h[k + j - 1]; j--)       \
+            continue;                                                   \
+        if (j <= mem)                                                   \
+            return k;                                                   \
+        k += p;                                                         \
+        mem = mem0;                                                     \
+    }                                                                   \
+    return -1;                                                          \
+}                                                                       \
+                                                                        \
+static int name(const htype *h, int len, const ntype *s, int m, int k) \
+{                                                                       \
+    if (m < STRING_TWO_WAY_LEN_MIN)                                     \
+        return name ## _short(h, len, s, m, k);                         \
+    else                                                                \
+        return name ## _two_way(h, len, s, m, k);                       \
+}
+
+DEF_STRING_FIND(string_find8, uint8_t, uint8_t)
+DEF_STRING_FIND(string_find16, uint16_t, uint16_t)
+DEF_STRING_FIND(string_find16_8, uint16_t, uint8_t)
+
 static int string_indexof_char(JSString *p, int c, int from)
 {
     /* assuming 0 <= from <= p->len */
-    int i, len = p->len;
+    const uint8_t *q;
+    uint16_t c16;
+
     if (p->is_wide_char) {
-        for (i = from; i < len; i++) {
-            if (p->u.str16[i] == c)
-                return i;
-        }
+        if ((c & ~0xffff) != 0)
+            return -1;
+        c16 = c;
+        return string_find16_short(p->u.str16, p->len, &c16, 1, from);
     } else {
-        if ((c & ~0xff) == 0) {
-            for (i = from; i < len; i++) {
-                if (p->u.str8[i] == (uint8_t)c)
-                    return i;
-            }
-        }
+        if ((c & ~0xff) != 0 || from >= p->len)
+            return -1;
+        q = memchr(p->u.str8 + from, c, p->len - from);
+        if (!q)
+            return -1;
+        return q - p->u.str8;
     }
-    return -1;
 }
 
 static int string_indexof(JSString *p1, JSString *p2, int from)
@@ -41716,7 +46595,25 @@ static int string_indexof(JSString *p1, JSString *p2, int from)
     int c, i, j, len1 = p1->len, len2 = p2->len;
     if (len2 == 0)
         return from;
-    for (i = from, c = string_get(p2, 0); i + len2 <= len1; i = j + 1) {
+    if (len2 == 1)
+        return string_indexof_char(p1, string_get(p2, 0), from);
+    if (len2 > len1 - from)
+        return -1;
+    if (p1->is_wide_char) {
+        if (p2->is_wide_char)
+            return string_find16(p1->u.str16, len1, p2->u.str16, len2, from);
+        else
+            return string_find16_8(p1->u.str16, len1, p2->u.str8, len2, from);
+    }
+    if (!p2->is_wide_char)
+        return string_find8(p1->u.str8, len1, p2->u.str8, len2, from);
+    /* 16 bit needle in a 8 bit string: it cannot match if it contains
+       a character >= 0x100 */
+    for (i = 0; i < len2; i++) {
+        if (p2->u.str16[i] >= 0x100)
+            return -1;
+    }
+    for (i = from, c = p2->u.str16[0]; i + len2 <= len1; i = j + 1) {
         j = string_indexof_char(p1, c, i);
         if (j < 0 || j + len2 > len1)
             break;
@@ -41857,7 +46754,10 @@ static JSValue js_string_indexOf(JSContext *ctx, JSValueConst this_val,
         inc = 1;
     }
     ret = -1;
-    if (len >= v_len && inc * (stop - start) >= 0) {
+    if (!lastIndexOf) {
+        if (len >= v_len && start <= stop)
+            ret = string_indexof(p, p1, start);
+    } else if (len >= v_len && inc * (stop - start) >= 0) {
         for (i = start;; i += inc) {
             if (!string_cmp(p, p1, i, 0, v_len)) {
                 ret = i;
@@ -41884,7 +46784,7 @@ static JSValue js_string_includes(JSContext *ctx, JSValueConst this_val,
                                   int argc, JSValueConst *argv, int magic)
 {
     JSValue str, v = JS_UNDEFINED;
-    int i, len, v_len, pos, start, stop, ret;
+    int len, v_len, pos, start, stop, ret;
     JSString *p;
     JSString *p1;
 
@@ -41924,14 +46824,10 @@ static JSValue js_string_includes(JSContext *ctx, JSValueConst this_val,
         start = stop = pos;
     }
     if (start >= 0 && start <= stop) {
-        for (i = start;; i++) {
-            if (!string_cmp(p, p1, i, 0, v_len)) {
-                ret = 1;
-                break;
-            }
-            if (i == stop)
-                break;
-        }
+        if (magic == 0)
+            ret = string_indexof(p, p1, start) >= 0;
+        else
+            ret = !string_cmp(p, p1, start, 0, v_len);
     }
  done:
     JS_FreeValue(ctx, str);
@@ -42044,8 +46940,10 @@ static JSValue js_string___GetSubstitution(JSContext *ctx, JSValueConst this_val
     if (!JS_IsString(rep) || !JS_IsString(str))
         return JS_ThrowTypeError(ctx, "not a string");
 
-    sp = JS_VALUE_GET_STRING(str);
-    rp = JS_VALUE_GET_STRING(rep);
+    sp = js_get_linear_string(ctx, str);
+    rp = js_get_linear_string(ctx, rep);
+    if (!sp || !rp)
+        return JS_EXCEPTION;
 
     string_buffer_init(ctx, b, 0);
 
@@ -43251,33 +48149,22 @@ static double js_math_fround(double a)
     return (float)a;
 }
 
-static JSValue js_math_imul(JSContext *ctx, JSValueConst this_val,
-                            int argc, JSValueConst *argv)
+static int32_t js_math_imul(int32_t a, int32_t b)
 {
-    uint32_t a, b, c;
+    uint32_t c;
     int32_t d;
 
-    if (JS_ToUint32(ctx, &a, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToUint32(ctx, &b, argv[1]))
-        return JS_EXCEPTION;
-    c = a * b;
+    c = (uint32_t)a * (uint32_t)b;
     memcpy(&d, &c, sizeof(d));
-    return JS_NewInt32(ctx, d);
+    return d;
 }
 
-static JSValue js_math_clz32(JSContext *ctx, JSValueConst this_val,
-                             int argc, JSValueConst *argv)
+static int32_t js_math_clz32(int32_t a)
 {
-    uint32_t a, r;
-
-    if (JS_ToUint32(ctx, &a, argv[0]))
-        return JS_EXCEPTION;
     if (a == 0)
-        r = 32;
+        return 32;
     else
-        r = clz32(a);
-    return JS_NewInt32(ctx, r);
+        return clz32(a);
 }
 
 /* xorshift* random number generator by Marsaglia */
@@ -43350,8 +48237,8 @@ static const JSCFunctionListEntry js_math_funcs[] = {
     JS_CFUNC_DEF("hypot", 2, js_math_hypot ),
     JS_CFUNC_DEF("random", 0, js_math_random ),
     JS_CFUNC_SPECIAL_DEF("fround", 1, f_f, js_math_fround ),
-    JS_CFUNC_DEF("imul", 2, js_math_imul ),
-    JS_CFUNC_DEF("clz32", 1, js_math_clz32 ),
+    JS_CFUNC_SPECIAL_DEF("imul", 2, i_i_i, js_math_imul ),
+    JS_CFUNC_SPECIAL_DEF("clz32", 1, i_i, js_math_clz32 ),
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Math", JS_PROP_CONFIGURABLE ),
     JS_PROP_DOUBLE_DEF("E", 2.718281828459045, 0 ),
     JS_PROP_DOUBLE_DEF("LN10", 2.302585092994046, 0 ),
@@ -45156,12 +50043,564 @@ static JSValue json_parse_value(JSParseState *s)
     return JS_EXCEPTION;
 }
 
+/* Fast path for JSON.parse(). The UTF-8 input is scanned in a single
+   pass without the tokenizer. Only the strict JSON syntax is accepted:
+   in case of syntax error, the generic parser is run again to produce
+   the error message. */
+
+#define JSON_ATOM_CACHE_SIZE  128 /* must be a power of two */
+#define JSON_ATOM_CACHE_MAX_LEN 64
+#define JSON_SHAPE_CACHE_SIZE 64 /* must be a power of two */
+
+typedef struct {
+    const uint8_t *str; /* key in the input buffer */
+    int len;
+    JSAtom atom;
+} JSONAtomCacheEntry;
+
+typedef struct {
+    JSAtom atom; /* JS_ATOM_NULL for array elements */
+    JSValue val;
+} JSONMember;
+
+typedef struct JSONParseState {
+    JSContext *ctx;
+    const uint8_t *p;
+    const uint8_t *buf_end;
+    BOOL syntax_error;
+    /* members of the objects and arrays being parsed */
+    JSONMember *stack;
+    int stack_len;
+    int stack_size;
+    /* the atoms of the short ASCII keys */
+    JSONAtomCacheEntry atom_cache[JSON_ATOM_CACHE_SIZE];
+    /* the shapes of the last parsed objects, indexed by key sequence */
+    JSShape *shape_cache[JSON_SHAPE_CACHE_SIZE];
+} JSONParseState;
+
+static const double json_pow10[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static JSValue json_fast_parse_value(JSONParseState *s);
+
+static inline const uint8_t *json_skip_ws(const uint8_t *p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+        p++;
+    return p;
+}
+
+static int json_fast_push(JSONParseState *s, JSAtom atom, JSValue val)
+{
+    if (unlikely(s->stack_len >= s->stack_size)) {
+        if (js_resize_array(s->ctx, (void **)&s->stack, sizeof(s->stack[0]),
+                            &s->stack_size, s->stack_len + 1)) {
+            JS_FreeAtom(s->ctx, atom);
+            JS_FreeValue(s->ctx, val);
+            return -1;
+        }
+    }
+    s->stack[s->stack_len].atom = atom;
+    s->stack[s->stack_len].val = val;
+    s->stack_len++;
+    return 0;
+}
+
+/* free the members above 'base' */
+static void json_fast_pop(JSONParseState *s, int base)
+{
+    while (s->stack_len > base) {
+        s->stack_len--;
+        JS_FreeAtom(s->ctx, s->stack[s->stack_len].atom);
+        JS_FreeValue(s->ctx, s->stack[s->stack_len].val);
+    }
+}
+
+/* 's->p' points after the opening quote */
+static JSValue json_fast_parse_string(JSONParseState *s)
+{
+    const uint8_t *p, *p_next, *start;
+    StringBuffer b_s, *b = &b_s;
+    uint32_t c;
+    int i, h;
+
+    p = start = s->p;
+    while (*p >= 0x20 && *p < 0x80 && *p != '\"' && *p != '\\')
+        p++;
+    if (*p == '\"') {
+        s->p = p + 1;
+        return js_new_string8(s->ctx, start, p - start);
+    }
+    if (string_buffer_init(s->ctx, b, p - start + 16))
+        return JS_EXCEPTION;
+    if (string_buffer_write8(b, start, p - start))
+        goto fail;
+    for(;;) {
+        c = *p;
+        if (c == '\"') {
+            p++;
+            break;
+        } else if (c == '\\') {
+            p++;
+            switch(*p++) {
+            case '\"': c = '\"'; break;
+            case '\\': c = '\\'; break;
+            case '/': c = '/'; break;
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'u':
+                c = 0;
+                for(i = 0; i < 4; i++) {
+                    h = from_hex(*p++);
+                    if (h < 0)
+                        goto syntax_error;
+                    c = (c << 4) | h;
+                }
+                break;
+            default:
+                goto syntax_error;
+            }
+        } else if (c >= 0x80) {
+            c = unicode_from_utf8(p, UTF8_CHAR_LEN_MAX, &p_next);
+            if (c > 0x10FFFF)
+                goto syntax_error;
+            p = p_next;
+        } else if (c >= 0x20) {
+            p++;
+        } else {
+            /* control character or end of input */
+            goto syntax_error;
+        }
+        if (string_buffer_putc(b, c))
+            goto fail;
+    }
+    s->p = p;
+    return string_buffer_end(b);
+ syntax_error:
+    s->syntax_error = TRUE;
+ fail:
+    string_buffer_free(b);
+    return JS_EXCEPTION;
+}
+
+/* 's->p' points after the opening quote */
+static JSAtom json_fast_parse_key(JSONParseState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSONAtomCacheEntry *e;
+    const uint8_t *p, *start;
+    uint32_t h;
+    int len;
+    JSAtom atom;
+    JSValue str;
+
+    p = start = s->p;
+    h = 0;
+    while (*p >= 0x20 && *p < 0x80 && *p != '\"' && *p != '\\') {
+        h = h * 31 + *p;
+        p++;
+    }
+    len = p - start;
+    if (*p == '\"' && len <= JSON_ATOM_CACHE_MAX_LEN) {
+        s->p = p + 1;
+        e = &s->atom_cache[(h + len) & (JSON_ATOM_CACHE_SIZE - 1)];
+        if (e->atom != JS_ATOM_NULL && e->len == len &&
+            !memcmp(e->str, start, len))
+            return JS_DupAtom(ctx, e->atom);
+        atom = JS_NewAtomLen(ctx, (const char *)start, len);
+        if (atom == JS_ATOM_NULL)
+            return JS_ATOM_NULL;
+        JS_FreeAtom(ctx, e->atom);
+        e->str = start;
+        e->len = len;
+        e->atom = JS_DupAtom(ctx, atom);
+        return atom;
+    }
+    str = json_fast_parse_string(s);
+    if (JS_IsException(str))
+        return JS_ATOM_NULL;
+    return JS_NewAtomStr(ctx, JS_VALUE_GET_STRING(str));
+}
+
+static JSValue json_fast_parse_number(JSONParseState *s)
+{
+    const uint8_t *p, *start;
+    uint64_t mant;
+    int n_digits, exp10, e, e_sign;
+    BOOL is_neg;
+    double d;
+
+    p = start = s->p;
+    is_neg = FALSE;
+    if (*p == '-') {
+        is_neg = TRUE;
+        p++;
+    }
+    mant = 0;
+    n_digits = 0;
+    exp10 = 0;
+    if (*p == '0') {
+        p++;
+    } else if (is_digit(*p)) {
+        while (is_digit(*p)) {
+            if (n_digits < 19)
+                mant = mant * 10 + (*p - '0');
+            else
+                exp10++;
+            n_digits++;
+            p++;
+        }
+    } else {
+        goto syntax_error;
+    }
+    if (*p == '.') {
+        p++;
+        if (!is_digit(*p))
+            goto syntax_error;
+        while (is_digit(*p)) {
+            if (n_digits < 19) {
+                mant = mant * 10 + (*p - '0');
+                exp10--;
+            }
+            if (mant != 0)
+                n_digits++;
+            p++;
+        }
+    }
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        e_sign = 1;
+        if (*p == '+') {
+            p++;
+        } else if (*p == '-') {
+            e_sign = -1;
+            p++;
+        }
+        if (!is_digit(*p))
+            goto syntax_error;
+        e = 0;
+        while (is_digit(*p)) {
+            if (e < 100000)
+                e = e * 10 + (*p - '0');
+            p++;
+        }
+        exp10 += e * e_sign;
+    }
+    /* the result is exact if the mantissa and the power of ten are
+       exactly representable (Clinger's fast path) */
+    if (n_digits <= 19 && mant <= ((uint64_t)1 << 53) &&
+        exp10 >= -22 && exp10 <= 22) {
+        d = (double)mant;
+        if (exp10 >= 0)
+            d *= json_pow10[exp10];
+        else
+            d /= json_pow10[-exp10];
+        if (is_neg)
+            d = -d;
+        s->p = p;
+        return JS_NewFloat64(s->ctx, d);
+    } else {
+        const char *p1;
+        JSValue val;
+        val = js_atof(s->ctx, (const char *)start, &p1, 10, 0);
+        if (!JS_IsException(val) && (const uint8_t *)p1 != p) {
+            JS_FreeValue(s->ctx, val);
+            goto syntax_error;
+        }
+        s->p = p;
+        return val;
+    }
+ syntax_error:
+    s->syntax_error = TRUE;
+    return JS_EXCEPTION;
+}
+
+static JSValue json_fast_new_object(JSONParseState *s, int base)
+{
+    JSContext *ctx = s->ctx;
+    JSONMember *members = s->stack + base;
+    int i, n = s->stack_len - base;
+    JSShape *sh, **psh;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSObject *p;
+    JSValue obj;
+    BOOL has_dup;
+    uint32_t h;
+
+    h = n;
+    for(i = 0; i < n; i++)
+        h = h * 31 + members[i].atom;
+    h ^= h >> 16;
+    psh = &s->shape_cache[h & (JSON_SHAPE_CACHE_SIZE - 1)];
+    sh = *psh;
+    if (sh && sh->prop_count == n) {
+        prs = get_shape_prop(sh);
+        for(i = 0; i < n; i++) {
+            if (prs[i].atom != members[i].atom)
+                break;
+        }
+        if (i == n) {
+            /* same keys as a previous object: use its shape */
+            obj = JS_NewObjectFromShape(ctx, js_dup_shape(sh), JS_CLASS_OBJECT);
+            if (JS_IsException(obj))
+                goto fail;
+            p = JS_VALUE_GET_OBJ(obj);
+            for(i = 0; i < n; i++) {
+                p->prop[i].u.value = members[i].val;
+                JS_FreeAtom(ctx, members[i].atom);
+            }
+            s->stack_len = base;
+            return obj;
+        }
+    }
+
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        goto fail;
+    p = JS_VALUE_GET_OBJ(obj);
+    has_dup = FALSE;
+    for(i = 0; i < n; i++) {
+        prs = find_own_property(&pr, p, members[i].atom);
+        if (prs) {
+            /* duplicate key: the last value is kept */
+            JS_FreeValue(ctx, pr->u.value);
+            has_dup = TRUE;
+        } else {
+            pr = add_property(ctx, p, members[i].atom, JS_PROP_C_W_E);
+            if (!pr) {
+                JS_FreeValue(ctx, obj);
+                goto fail;
+            }
+        }
+        pr->u.value = members[i].val;
+        members[i].val = JS_UNDEFINED;
+        JS_FreeAtom(ctx, members[i].atom);
+        members[i].atom = JS_ATOM_NULL;
+    }
+    s->stack_len = base;
+    if (!has_dup && p->shape->is_hashed) {
+        if (*psh)
+            js_free_shape(ctx->rt, *psh);
+        *psh = js_dup_shape(p->shape);
+    }
+    return obj;
+ fail:
+    json_fast_pop(s, base);
+    return JS_EXCEPTION;
+}
+
+static JSValue json_fast_new_array(JSONParseState *s, int base)
+{
+    JSONMember *members = s->stack + base;
+    int i, n = s->stack_len - base;
+    JSObject *p;
+    JSValue obj;
+
+    obj = js_allocate_fast_array(s->ctx, n);
+    if (JS_IsException(obj)) {
+        json_fast_pop(s, base);
+        return obj;
+    }
+    p = JS_VALUE_GET_OBJ(obj);
+    for(i = 0; i < n; i++)
+        p->u.array.u.values[i] = members[i].val;
+    p->prop[0].u.value = JS_NewInt32(s->ctx, n);
+    s->stack_len = base;
+    return obj;
+}
+
+/* 's->p' points after the opening brace */
+static JSValue json_fast_parse_object(JSONParseState *s)
+{
+    const uint8_t *p;
+    JSAtom atom;
+    JSValue val;
+    int base;
+
+    base = s->stack_len;
+    p = json_skip_ws(s->p);
+    if (*p != '}') {
+        for(;;) {
+            if (*p != '\"')
+                goto syntax_error;
+            s->p = p + 1;
+            atom = json_fast_parse_key(s);
+            if (atom == JS_ATOM_NULL)
+                goto fail;
+            p = json_skip_ws(s->p);
+            if (*p != ':') {
+                JS_FreeAtom(s->ctx, atom);
+                goto syntax_error;
+            }
+            s->p = p + 1;
+            val = json_fast_parse_value(s);
+            if (JS_IsException(val)) {
+                JS_FreeAtom(s->ctx, atom);
+                goto fail;
+            }
+            if (json_fast_push(s, atom, val))
+                goto fail;
+            p = json_skip_ws(s->p);
+            if (*p == '}')
+                break;
+            if (*p != ',')
+                goto syntax_error;
+            p = json_skip_ws(p + 1);
+        }
+    }
+    s->p = p + 1;
+    return json_fast_new_object(s, base);
+ syntax_error:
+    s->syntax_error = TRUE;
+ fail:
+    json_fast_pop(s, base);
+    return JS_EXCEPTION;
+}
+
+/* 's->p' points after the opening bracket */
+static JSValue json_fast_parse_array(JSONParseState *s)
+{
+    const uint8_t *p;
+    JSValue val;
+    int base;
+
+    base = s->stack_len;
+    p = json_skip_ws(s->p);
+    if (*p != ']') {
+        for(;;) {
+            s->p = p;
+            val = json_fast_parse_value(s);
+            if (JS_IsException(val))
+                goto fail;
+            if (json_fast_push(s, JS_ATOM_NULL, val))
+                goto fail;
+            p = json_skip_ws(s->p);
+            if (*p == ']')
+                break;
+            if (*p != ',')
+                goto syntax_error;
+            p++;
+        }
+    }
+    s->p = p + 1;
+    return json_fast_new_array(s, base);
+ syntax_error:
+    s->syntax_error = TRUE;
+ fail:
+    json_fast_pop(s, base);
+    return JS_EXCEPTION;
+}
+
+static JSValue json_fast_parse_value(JSONParseState *s)
+{
+    const uint8_t *p;
+
+    p = json_skip_ws(s->p);
+    switch(*p) {
+    case '{':
+    case '[':
+        if (js_check_stack_overflow(s->ctx->rt, 0)) {
+            /* let the generic parser decide */
+            s->syntax_error = TRUE;
+            return JS_EXCEPTION;
+        }
+        s->p = p + 1;
+        if (*p == '{')
+            return json_fast_parse_object(s);
+        else
+            return json_fast_parse_array(s);
+    case '\"':
+        s->p = p + 1;
+        return json_fast_parse_string(s);
+    case 't':
+        if (p[1] == 'r' && p[2] == 'u' && p[3] == 'e') {
+            s->p = p + 4;
+            return JS_TRUE;
+        }
+        break;
+    case 'f':
+        if (p[1] == 'a' && p[2] == 'l' && p[3] == 's' && p[4] == 'e') {
+            s->p = p + 5;
+            return JS_FALSE;
+        }
+        break;
+    case 'n':
+        if (p[1] == 'u' && p[2] == 'l' && p[3] == 'l') {
+            s->p = p + 4;
+            return JS_NULL;
+        }
+        break;
+    case '-':
+    case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+        s->p = p;
+        return json_fast_parse_number(s);
+    default:
+        break;
+    }
+    s->syntax_error = TRUE;
+    return JS_EXCEPTION;
+}
+
+/* 'buf' must be zero terminated. Return JS_EXCEPTION and set
+   '*psyntax_error' to TRUE if the input is not accepted by the fast
+   parser. No exception is raised in this case. */
+static JSValue json_fast_parse(JSContext *ctx, const char *buf, size_t buf_len,
+                               BOOL *psyntax_error)
+{
+    JSONParseState s1, *s = &s1;
+    JSValue val;
+    int i;
+
+    s->ctx = ctx;
+    s->p = (const uint8_t *)buf;
+    s->buf_end = s->p + buf_len;
+    s->syntax_error = FALSE;
+    s->stack = NULL;
+    s->stack_len = 0;
+    s->stack_size = 0;
+    memset(s->atom_cache, 0, sizeof(s->atom_cache));
+    memset(s->shape_cache, 0, sizeof(s->shape_cache));
+
+    val = json_fast_parse_value(s);
+    if (!JS_IsException(val) && json_skip_ws(s->p) != s->buf_end) {
+        JS_FreeValue(ctx, val);
+        val = JS_EXCEPTION;
+        s->syntax_error = TRUE;
+    }
+
+    json_fast_pop(s, 0);
+    js_free(ctx, s->stack);
+    for(i = 0; i < JSON_ATOM_CACHE_SIZE; i++)
+        JS_FreeAtom(ctx, s->atom_cache[i].atom);
+    for(i = 0; i < JSON_SHAPE_CACHE_SIZE; i++) {
+        if (s->shape_cache[i])
+            js_free_shape(ctx->rt, s->shape_cache[i]);
+    }
+    *psyntax_error = s->syntax_error;
+    return val;
+}
+
 JSValue JS_ParseJSON2(JSContext *ctx, const char *buf, size_t buf_len,
                       const char *filename, int flags)
 {
     JSParseState s1, *s = &s1;
     JSValue val = JS_UNDEFINED;
 
+    if (!(flags & JS_PARSE_JSON_EXT)) {
+        BOOL syntax_error;
+        val = json_fast_parse(ctx, buf, buf_len, &syntax_error);
+        if (!syntax_error)
+            return val;
+        val = JS_UNDEFINED;
+    }
+
     js_parse_init(ctx, s, buf, buf_len, filename);
     s->ext_json = ((flags & JS_PARSE_JSON_EXT) != 0);
     if (json_next_token(s))
@@ -45289,6 +50728,11 @@ static JSValue js_json_parse(JSContext *ctx, JSValueConst this_val,
     return obj;
 }
 
+typedef struct {
+    JSAtom atom;
+    JSValue str; /* quoted property name */
+} JSONKeyCacheEntry;
+
 typedef struct JSONStringifyContext {
     JSValueConst replacer_func;
     JSValue stack;
@@ -45296,6 +50740,8 @@ typedef struct JSONStringifyContext {
     JSValue gap;
     JSValue empty;
     StringBuffer *b;
+    BOOL fast_path; /* no replacer function, property list or gap */
+    JSONKeyCacheEntry *key_cache; /* allocated by the fast path */
 } JSONStringifyContext;
 
 static JSValue JS_ToQuotedStringFree(JSContext *ctx, JSValue val) {
@@ -45347,6 +50793,7 @@ static JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
         if (JS_IsFunction(ctx, val))
             break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_INT:
     case JS_TAG_FLOAT64:
     case JS_TAG_BOOL:
@@ -45369,6 +50816,231 @@ exception:
     return JS_EXCEPTION;
 }
 
+static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
+                          JSValueConst holder, JSValue val,
+                          JSValueConst indent);
+static int js_json_to_str_fast(JSContext *ctx, JSONStringifyContext *jsc,
+                               JSValueConst val);
+
+/* Fast path for the objects with no replacer function, property list
+   and gap: the ordinary objects and the fast arrays without toJSON
+   method are serialized by walking directly their shape or their
+   value array. */
+
+#define JSON_KEY_CACHE_SIZE 256 /* must be a power of two */
+
+/* return TRUE if 'p' can be serialized by js_json_to_str_fast() */
+static BOOL js_json_is_plain(JSContext *ctx, JSObject *p)
+{
+    JSShape *sh;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSObject *p1;
+    uint32_t idx;
+    int i;
+
+    if (p->class_id == JS_CLASS_OBJECT) {
+        /* the index keys would be output first */
+        sh = p->shape;
+        if (sh->has_small_array_index)
+            return FALSE;
+        for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+            if (prs->atom != JS_ATOM_NULL &&
+                JS_AtomIsArrayIndex(ctx, &idx, prs->atom))
+                return FALSE;
+        }
+    } else if (p->class_id != JS_CLASS_ARRAY || !p->fast_array) {
+        return FALSE;
+    }
+    /* no toJSON method */
+    for(p1 = p; p1 != NULL; p1 = p1->shape->proto) {
+        if (p1->class_id != JS_CLASS_OBJECT && p1->class_id != JS_CLASS_ARRAY)
+            return FALSE;
+        if (find_own_property(&pr, p1, JS_ATOM_toJSON))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* output the quoted property name 'atom' */
+static int js_json_put_key(JSContext *ctx, JSONStringifyContext *jsc,
+                           JSAtom atom)
+{
+    JSONKeyCacheEntry *e;
+    JSValue str;
+
+    if (!jsc->key_cache) {
+        jsc->key_cache = js_mallocz(ctx, sizeof(jsc->key_cache[0]) *
+                                    JSON_KEY_CACHE_SIZE);
+        if (!jsc->key_cache)
+            return -1;
+    }
+    e = &jsc->key_cache[atom & (JSON_KEY_CACHE_SIZE - 1)];
+    if (e->atom != atom) {
+        str = JS_ToQuotedStringFree(ctx, JS_AtomToString(ctx, atom));
+        if (JS_IsException(str))
+            return -1;
+        JS_FreeAtom(ctx, e->atom);
+        JS_FreeValue(ctx, e->str);
+        e->atom = JS_DupAtom(ctx, atom);
+        e->str = str;
+    }
+    return string_buffer_concat_value(jsc->b, e->str);
+}
+
+/* Output 'val', the property 'prop' of 'holder' or its element 'idx'
+   if 'prop' is JS_ATOM_NULL. Return 1 if the value is omitted. */
+static int js_json_to_str_value(JSContext *ctx, JSONStringifyContext *jsc,
+                                JSValueConst holder, JSValue val,
+                                JSAtom prop, uint32_t idx)
+{
+    JSValue key;
+    char buf[JS_DTOA_BUF_SIZE];
+    int ret;
+
+    switch(JS_VALUE_GET_NORM_TAG(val)) {
+    case JS_TAG_OBJECT:
+        if (js_json_is_plain(ctx, JS_VALUE_GET_OBJ(val))) {
+            ret = js_json_to_str_fast(ctx, jsc, val);
+            JS_FreeValue(ctx, val);
+            return ret;
+        }
+        break;
+    case JS_TAG_STRING:
+        ret = string_buffer_put_quoted(jsc->b, JS_VALUE_GET_STRING(val));
+        JS_FreeValue(ctx, val);
+        return ret;
+    case JS_TAG_INT:
+        return string_buffer_puts8(jsc->b, i64toa(buf + sizeof(buf),
+                                                  JS_VALUE_GET_INT(val), 10));
+    case JS_TAG_FLOAT64:
+        if (!isfinite(JS_VALUE_GET_FLOAT64(val)))
+            return string_buffer_puts8(jsc->b, "null");
+        js_dtoa1(&buf, JS_VALUE_GET_FLOAT64(val), 10, 0, JS_DTOA_VAR_FORMAT);
+        return string_buffer_puts8(jsc->b, buf);
+    case JS_TAG_BOOL:
+        return string_buffer_puts8(jsc->b, JS_VALUE_GET_BOOL(val) ?
+                                   "true" : "false");
+    case JS_TAG_NULL:
+        return string_buffer_puts8(jsc->b, "null");
+    case JS_TAG_UNDEFINED:
+    case JS_TAG_SYMBOL:
+        JS_FreeValue(ctx, val);
+        return 1;
+    default:
+        break;
+    }
+    /* generic case */
+    if (prop == JS_ATOM_NULL)
+        key = JS_ToStringFree(ctx, JS_NewUint32(ctx, idx));
+    else
+        key = JS_AtomToString(ctx, prop);
+    if (JS_IsException(key)) {
+        JS_FreeValue(ctx, val);
+        return -1;
+    }
+    val = js_json_check(ctx, jsc, holder, val, key);
+    JS_FreeValue(ctx, key);
+    if (JS_IsException(val))
+        return -1;
+    if (JS_IsUndefined(val))
+        return 1;
+    return js_json_to_str(ctx, jsc, holder, val, jsc->empty);
+}
+
+/* 'val' must verify js_json_is_plain() */
+static int js_json_to_str_fast(JSContext *ctx, JSONStringifyContext *jsc,
+                               JSValueConst val)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(val);
+    JSShape *sh;
+    JSShapeProperty *prs;
+    JSValue v;
+    int64_t len;
+    uint32_t i;
+    int ret, pos;
+    BOOL has_content;
+
+    v = js_array_includes(ctx, jsc->stack, 1, &val);
+    if (JS_IsException(v))
+        return -1;
+    if (JS_ToBoolFree(ctx, v)) {
+        JS_ThrowTypeError(ctx, "circular reference");
+        return -1;
+    }
+    v = js_array_push(ctx, jsc->stack, 1, &val, 0);
+    if (check_exception_free(ctx, v))
+        return -1;
+
+    if (p->class_id == JS_CLASS_ARRAY) {
+        if (js_get_length64(ctx, &len, val))
+            return -1;
+        string_buffer_putc8(jsc->b, '[');
+        for(i = 0; i < len; i++) {
+            if (i > 0)
+                string_buffer_putc8(jsc->b, ',');
+            /* the array may be modified by a toJSON method */
+            if (likely(p->fast_array && i < p->u.array.count))
+                v = JS_DupValue(ctx, p->u.array.u.values[i]);
+            else
+                v = JS_GetPropertyInt64(ctx, val, i);
+            if (JS_IsException(v))
+                return -1;
+            ret = js_json_to_str_value(ctx, jsc, val, v, JS_ATOM_NULL, i);
+            if (ret < 0)
+                return -1;
+            if (ret > 0)
+                string_buffer_puts8(jsc->b, "null");
+        }
+        string_buffer_putc8(jsc->b, ']');
+    } else {
+        /* the property names are those of the initial shape. Any
+           modification of the object by a getter or a toJSON method
+           changes its shape because it is shared. */
+        sh = js_dup_shape(p->shape);
+        string_buffer_putc8(jsc->b, '{');
+        has_content = FALSE;
+        for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+            if (prs->atom == JS_ATOM_NULL ||
+                !(prs->flags & JS_PROP_ENUMERABLE) ||
+                JS_AtomGetKind(ctx, prs->atom) != JS_ATOM_KIND_STRING)
+                continue;
+            if (likely(p->shape == sh &&
+                       (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL))
+                v = JS_DupValue(ctx, p->prop[i].u.value);
+            else
+                v = JS_GetProperty(ctx, val, prs->atom);
+            if (JS_IsException(v))
+                goto fail;
+            pos = jsc->b->len;
+            if (has_content)
+                string_buffer_putc8(jsc->b, ',');
+            if (js_json_put_key(ctx, jsc, prs->atom)) {
+                JS_FreeValue(ctx, v);
+                goto fail;
+            }
+            string_buffer_putc8(jsc->b, ':');
+            ret = js_json_to_str_value(ctx, jsc, val, v, prs->atom, 0);
+            if (ret < 0)
+                goto fail;
+            if (ret > 0) {
+                /* omitted value: remove the property name */
+                jsc->b->len = pos;
+            } else {
+                has_content = TRUE;
+            }
+        }
+        string_buffer_putc8(jsc->b, '}');
+        js_free_shape(ctx->rt, sh);
+    }
+    if (check_exception_free(ctx, js_array_pop(ctx, jsc->stack, 0, NULL, 0)))
+        return -1;
+    return 0;
+ fail:
+    js_free_shape(ctx->rt, sh);
+    return -1;
+}
+
 static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
                           JSValueConst holder, JSValue val,
                           JSValueConst indent)
@@ -45409,6 +51081,11 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
             set_value(ctx, &val, JS_DupValue(ctx, p->u.object_data));
             goto concat_primitive;
         }
+        if (jsc->fast_path && js_json_is_plain(ctx, p)) {
+            ret = js_json_to_str_fast(ctx, jsc, val);
+            JS_FreeValue(ctx, val);
+            return ret;
+        }
         v = js_array_includes(ctx, jsc->stack, 1, (JSValueConst *)&val);
         if (JS_IsException(v))
             goto exception;
@@ -45524,6 +51201,7 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
  concat_primitive:
     switch (JS_VALUE_GET_NORM_TAG(val)) {
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_ToQuotedStringFree(ctx, val);
         if (JS_IsException(val))
             goto exception;
@@ -45531,8 +51209,14 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
     case JS_TAG_FLOAT64:
         if (!isfinite(JS_VALUE_GET_FLOAT64(val))) {
             val = JS_NULL;
+            goto concat_value;
+        } else {
+            /* avoid the allocation of a temporary string */
+            char buf[JS_DTOA_BUF_SIZE];
+            js_dtoa1(&buf, JS_VALUE_GET_FLOAT64(val), 10, 0,
+                     JS_DTOA_VAR_FORMAT);
+            return string_buffer_puts8(jsc->b, buf);
         }
-        goto concat_value;
     case JS_TAG_INT:
     case JS_TAG_BOOL:
     case JS_TAG_NULL:
@@ -45576,6 +51260,8 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
     jsc->gap = JS_UNDEFINED;
     jsc->b = &b_s;
     jsc->empty = JS_AtomToString(ctx, JS_ATOM_empty_string);
+    jsc->fast_path = FALSE;
+    jsc->key_cache = NULL;
     ret = JS_UNDEFINED;
     wrapper = JS_UNDEFINED;
 
@@ -45653,14 +51339,20 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
             goto exception;
         jsc->gap = JS_NewStringLen(ctx, "          ", n);
     } else if (JS_IsString(space)) {
-        JSString *p = JS_VALUE_GET_STRING(space);
-        jsc->gap = js_sub_string(ctx, p, 0, min_int(p->len, 10));
+        JSString *p = js_get_linear_string(ctx, space);
+        if (p)
+            jsc->gap = js_sub_string(ctx, p, 0, min_int(p->len, 10));
+        else
+            jsc->gap = JS_EXCEPTION;
     } else {
         jsc->gap = JS_DupValue(ctx, jsc->empty);
     }
     JS_FreeValue(ctx, space);
     if (JS_IsException(jsc->gap))
         goto exception;
+    jsc->fast_path = (JS_IsUndefined(jsc->replacer_func) &&
+                      JS_IsUndefined(jsc->property_list) &&
+                      JS_IsEmptyString(jsc->gap));
     wrapper = JS_NewObject(ctx);
     if (JS_IsException(wrapper))
         goto exception;
@@ -45687,6 +51379,13 @@ exception:
 done1:
     string_buffer_free(jsc->b);
 done:
+    if (jsc->key_cache) {
+        for(i = 0; i < JSON_KEY_CACHE_SIZE; i++) {
+            JS_FreeAtom(ctx, jsc->key_cache[i].atom);
+            JS_FreeValue(ctx, jsc->key_cache[i].str);
+        }
+        js_free(ctx, jsc->key_cache);
+    }
     JS_FreeValue(ctx, wrapper);
     JS_FreeValue(ctx, jsc->empty);
     JS_FreeValue(ctx, jsc->gap);
@@ -46972,26 +52671,46 @@ static const JSCFunctionListEntry js_symbol_funcs[] = {
 /* Set/Map/WeakSet/WeakMap */
 
 typedef struct JSMapRecord {
-    int ref_count; /* used during enumeration to avoid freeing the record */
-    BOOL empty; /* TRUE if the record is deleted */
-    struct JSMapState *map;
-    struct JSMapRecord *next_weak_ref;
-    struct list_head link;
-    struct list_head hash_link;
-    JSValue key;
+    JSValue key; /* JS_UNINITIALIZED if the record is deleted */
     JSValue value;
 } JSMapRecord;
 
+typedef struct JSMapHashSlot {
+    uint32_t hash;
+    uint32_t index; /* record index + 1 or 0 if the slot is free */
+} JSMapHashSlot;
+
+/* The records are stored in insertion order in a dense array. The
+   deleted records are kept as holes until the array is compacted so
+   that the iterators can use index positions. The hash table uses
+   open addressing with linear probing and only contains indexes. */
 typedef struct JSMapState {
     BOOL is_weak; /* TRUE if WeakSet/WeakMap */
-    struct list_head records; /* list of JSMapRecord.link */
-    uint32_t record_count;
-    struct list_head *hash_table;
-    uint32_t hash_size; /* must be a power of two */
-    uint32_t record_count_threshold; /* count at which a hash table
-                                        resize is needed */
+    uint32_t record_count; /* number of records which are not deleted */
+    uint32_t record_end; /* number of used records in 'records' */
+    uint32_t record_size; /* allocated size of 'records' */
+    JSMapRecord *records;
+    JSMapHashSlot *hash_table;
+    uint32_t hash_size; /* 0 or a power of two */
+    uint32_t hash_bits; /* log2(hash_size) */
+    struct list_head iterators; /* list of JSMapIteratorData.link */
 } JSMapState;
 
+/* element of the JSObject.first_weak_ref list: the object is a key of
+   the WeakMap/WeakSet 'map' */
+typedef struct JSMapWeakRef {
+    struct JSMapState *map;
+    struct JSMapWeakRef *next_weak_ref;
+    JSValue value; /* used in reset_weak_ref() */
+} JSMapWeakRef;
+
+typedef struct JSMapIteratorData {
+    JSValue obj;
+    JSIteratorKindEnum kind;
+    uint32_t cur_index; /* index of the next record */
+    struct list_head link; /* in JSMapState.iterators if obj is defined */
+} JSMapIteratorData;
+
 #define MAGIC_SET (1 << 0)
 #define MAGIC_WEAK (1 << 1)
 
@@ -47011,15 +52730,9 @@ static JSValue js_map_constructor(JSContext *ctx, JSValueConst new_target,
     s = js_mallocz(ctx, sizeof(*s));
     if (!s)
         goto fail;
-    init_list_head(&s->records);
+    init_list_head(&s->iterators);
     s->is_weak = is_weak;
     JS_SetOpaque(obj, s);
-    s->hash_size = 1;
-    s->hash_table = js_malloc(ctx, sizeof(s->hash_table[0]) * s->hash_size);
-    if (!s->hash_table)
-        goto fail;
-    init_list_head(&s->hash_table[0]);
-    s->record_count_threshold = 4;
 
     arr = JS_UNDEFINED;
     if (argc > 0)
@@ -47117,7 +52830,7 @@ static JSValueConst map_normalize_key(JSContext *ctx, JSValueConst key)
 }
 
 /* XXX: better hash ? */
-static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
+static uint32_t map_hash_key(JSValueConst key)
 {
     uint32_t tag = JS_VALUE_GET_NORM_TAG(key);
     uint32_t h;
@@ -47131,6 +52844,11 @@ static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
     case JS_TAG_STRING:
         h = hash_string(JS_VALUE_GET_STRING(key), 0);
         break;
+    case JS_TAG_STRING_ROPE:
+        /* same hash as the linearized string */
+        h = hash_string_rope(key, 0);
+        tag = JS_TAG_STRING;
+        break;
     case JS_TAG_OBJECT:
     case JS_TAG_SYMBOL:
         h = (uintptr_t)JS_VALUE_GET_PTR(key) * 3163;
@@ -47155,82 +52873,177 @@ static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
     return h;
 }
 
+static inline BOOL map_record_is_deleted(const JSMapRecord *mr)
+{
+    return JS_VALUE_GET_TAG(mr->key) == JS_TAG_UNINITIALIZED;
+}
+
+/* index of the first hash table slot for the hash value 'h'. The high
+   bits of the product are used because the low bits of map_hash_key()
+   are not well distributed. */
+static inline uint32_t map_hash_index(const JSMapState *s, uint32_t h)
+{
+    return (h * 0x9e3779b1) >> (32 - s->hash_bits);
+}
+
 static JSMapRecord *map_find_record(JSContext *ctx, JSMapState *s,
                                     JSValueConst key)
 {
-    struct list_head *el;
+    JSMapHashSlot *hs;
     JSMapRecord *mr;
-    uint32_t h;
-    h = map_hash_key(ctx, key) & (s->hash_size - 1);
-    list_for_each(el, &s->hash_table[h]) {
-        mr = list_entry(el, JSMapRecord, hash_link);
-        if (js_same_value_zero(ctx, mr->key, key))
-            return mr;
+    uint32_t h, i;
+
+    if (s->hash_size == 0)
+        return NULL;
+    h = map_hash_key(key);
+    i = map_hash_index(s, h);
+    for(;;) {
+        hs = &s->hash_table[i];
+        if (hs->index == 0)
+            return NULL;
+        if (hs->hash == h) {
+            mr = &s->records[hs->index - 1];
+            if (js_same_value_zero(ctx, mr->key, key))
+                return mr;
+        }
+        i = (i + 1) & (s->hash_size - 1);
     }
-    return NULL;
 }
 
-static void map_hash_resize(JSContext *ctx, JSMapState *s)
+/* add the record 'idx' to the hash table. The slots of the deleted
+   records are reused. */
+static void map_hash_insert(JSMapState *s, uint32_t h, uint32_t idx)
+{
+    JSMapHashSlot *hs;
+    uint32_t i;
+
+    i = map_hash_index(s, h);
+    for(;;) {
+        hs = &s->hash_table[i];
+        if (hs->index == 0 || map_record_is_deleted(&s->records[hs->index - 1]))
+            break;
+        i = (i + 1) & (s->hash_size - 1);
+    }
+    hs->hash = h;
+    hs->index = idx + 1;
+}
+
+/* Remove the deleted records and set the allocated size of the record
+   array to 'new_size' (>= s->record_count). The index of the
+   iterators is updated. Return -1 if memory allocation failed (the map
+   is then unmodified). */
+static int map_resize(JSContext *ctx, JSMapState *s, uint32_t new_size)
 {
-    uint32_t new_hash_size, i, h;
+    JSMapRecord *new_records;
+    JSMapHashSlot *new_hash_table;
+    JSMapIteratorData *it;
+    struct list_head *el;
+    uint32_t new_hash_size, new_hash_bits, i, j;
     size_t slack;
-    struct list_head *new_hash_table, *el;
-    JSMapRecord *mr;
 
-    /* XXX: no reporting of memory allocation failure */
-    if (s->hash_size == 1)
-        new_hash_size = 4;
-    else
-        new_hash_size = s->hash_size * 2;
-    new_hash_table = js_realloc2(ctx, s->hash_table,
-                                 sizeof(new_hash_table[0]) * new_hash_size, &slack);
-    if (!new_hash_table)
-        return;
-    new_hash_size += slack / sizeof(*new_hash_table);
+    /* the load factor of the hash table is at most 2/3 */
+    new_hash_bits = 2;
+    while ((1U << new_hash_bits) / 3 * 2 < new_size)
+        new_hash_bits++;
+    new_hash_size = 1U << new_hash_bits;
+    if (new_hash_size != s->hash_size) {
+        new_hash_table = js_malloc(ctx, sizeof(new_hash_table[0]) * new_hash_size);
+        if (!new_hash_table)
+            return -1;
+    } else {
+        new_hash_table = s->hash_table;
+    }
+    if (new_size > s->record_size) {
+        new_records = js_realloc2(ctx, s->records,
+                                  sizeof(new_records[0]) * new_size, &slack);
+        if (!new_records) {
+            if (new_hash_table != s->hash_table)
+                js_free(ctx, new_hash_table);
+            return -1;
+        }
+        new_size += slack / sizeof(new_records[0]);
+        /* use all the slots allowed by the load factor */
+        new_size = min_uint32(new_size, new_hash_size / 3 * 2);
+        s->records = new_records;
+        s->record_size = new_size;
+    }
 
-    for(i = 0; i < new_hash_size; i++)
-        init_list_head(&new_hash_table[i]);
+    if (s->record_count != s->record_end) {
+        /* the new index of a record is the number of records which are
+           not deleted before it */
+        list_for_each(el, &s->iterators) {
+            it = list_entry(el, JSMapIteratorData, link);
+            j = 0;
+            for(i = 0; i < it->cur_index; i++) {
+                if (!map_record_is_deleted(&s->records[i]))
+                    j++;
+            }
+            it->cur_index = j;
+        }
+        j = 0;
+        for(i = 0; i < s->record_end; i++) {
+            if (!map_record_is_deleted(&s->records[i]))
+                s->records[j++] = s->records[i];
+        }
+        s->record_end = j;
+    }
 
-    list_for_each(el, &s->records) {
-        mr = list_entry(el, JSMapRecord, link);
-        if (!mr->empty) {
-            h = map_hash_key(ctx, mr->key) & (new_hash_size - 1);
-            list_add_tail(&mr->hash_link, &new_hash_table[h]);
+    if (new_size < s->record_size) {
+        /* shrink the record array */
+        new_records = js_realloc(ctx, s->records,
+                                 sizeof(new_records[0]) * max_int(new_size, 1));
+        if (new_records) {
+            s->records = new_records;
+            s->record_size = new_size;
         }
     }
+
+    if (new_hash_table != s->hash_table)
+        js_free(ctx, s->hash_table);
     s->hash_table = new_hash_table;
     s->hash_size = new_hash_size;
-    s->record_count_threshold = new_hash_size * 2;
+    s->hash_bits = new_hash_bits;
+    memset(s->hash_table, 0, sizeof(s->hash_table[0]) * s->hash_size);
+    for(i = 0; i < s->record_end; i++)
+        map_hash_insert(s, map_hash_key(s->records[i].key), i);
+    return 0;
 }
 
 static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
                                    JSValueConst key)
 {
-    uint32_t h;
     JSMapRecord *mr;
+    JSMapWeakRef *wr;
+    uint32_t new_size;
 
-    mr = js_malloc(ctx, sizeof(*mr));
-    if (!mr)
-        return NULL;
-    mr->ref_count = 1;
-    mr->map = s;
-    mr->empty = FALSE;
+    if (s->record_end >= s->record_size) {
+        if (s->record_count < s->record_end - s->record_end / 4) {
+            /* more than 1/4 of deleted records: just compact */
+            new_size = s->record_size;
+        } else {
+            new_size = max_int(4, s->record_size + s->record_size / 2);
+        }
+        if (map_resize(ctx, s, new_size))
+            return NULL;
+    }
     if (s->is_weak) {
         JSObject *p = JS_VALUE_GET_OBJ(key);
         /* Add the weak reference */
-        mr->next_weak_ref = p->first_weak_ref;
-        p->first_weak_ref = mr;
+        wr = js_malloc(ctx, sizeof(*wr));
+        if (!wr)
+            return NULL;
+        wr->map = s;
+        wr->next_weak_ref = p->first_weak_ref;
+        p->first_weak_ref = wr;
     } else {
         JS_DupValue(ctx, key);
     }
+    mr = &s->records[s->record_end];
     mr->key = (JSValue)key;
-    h = map_hash_key(ctx, key) & (s->hash_size - 1);
-    list_add_tail(&mr->hash_link, &s->hash_table[h]);
-    list_add_tail(&mr->link, &s->records);
+    mr->value = JS_UNDEFINED;
+    map_hash_insert(s, map_hash_key(key), s->record_end);
+    s->record_end++;
     s->record_count++;
-    if (s->record_count >= s->record_count_threshold) {
-        map_hash_resize(ctx, s);
-    }
     return mr;
 }
 
@@ -47238,77 +53051,81 @@ static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
    reference list. we don't use a doubly linked list to
    save space, assuming a given object has few weak
        references to it */
-static void delete_weak_ref(JSRuntime *rt, JSMapRecord *mr)
+static void delete_weak_ref(JSRuntime *rt, JSMapState *s, JSValueConst key)
 {
-    JSMapRecord **pmr, *mr1;
+    JSMapWeakRef **pwr, *wr;
     JSObject *p;
 
-    p = JS_VALUE_GET_OBJ(mr->key);
-    pmr = &p->first_weak_ref;
+    p = JS_VALUE_GET_OBJ(key);
+    pwr = &p->first_weak_ref;
     for(;;) {
-        mr1 = *pmr;
-        assert(mr1 != NULL);
-        if (mr1 == mr)
+        wr = *pwr;
+        assert(wr != NULL);
+        if (wr->map == s)
             break;
-        pmr = &mr1->next_weak_ref;
+        pwr = &wr->next_weak_ref;
     }
-    *pmr = mr1->next_weak_ref;
+    *pwr = wr->next_weak_ref;
+    js_free_rt(rt, wr);
 }
 
 static void map_delete_record(JSRuntime *rt, JSMapState *s, JSMapRecord *mr)
 {
-    if (mr->empty)
+    JSValue key, value;
+
+    if (map_record_is_deleted(mr))
         return;
-    list_del(&mr->hash_link);
+    key = mr->key;
+    value = mr->value;
+    /* the hash table slot is reused or removed when the record array
+       is compacted */
+    mr->key = JS_UNINITIALIZED;
+    mr->value = JS_UNDEFINED;
+    s->record_count--;
     if (s->is_weak) {
-        delete_weak_ref(rt, mr);
-    } else {
-        JS_FreeValueRT(rt, mr->key);
-    }
-    JS_FreeValueRT(rt, mr->value);
-    if (--mr->ref_count == 0) {
-        list_del(&mr->link);
-        js_free_rt(rt, mr);
+        delete_weak_ref(rt, s, key);
     } else {
-        /* keep a zombie record for iterators */
-        mr->empty = TRUE;
-        mr->key = JS_UNDEFINED;
-        mr->value = JS_UNDEFINED;
-    }
-    s->record_count--;
-}
-
-static void map_decref_record(JSRuntime *rt, JSMapRecord *mr)
-{
-    if (--mr->ref_count == 0) {
-        /* the record can be safely removed */
-        assert(mr->empty);
-        list_del(&mr->link);
-        js_free_rt(rt, mr);
+        JS_FreeValueRT(rt, key);
     }
+    JS_FreeValueRT(rt, value);
 }
 
 static void reset_weak_ref(JSRuntime *rt, JSObject *p)
 {
-    JSMapRecord *mr, *mr_next;
+    JSMapWeakRef *wr, *wr_next;
+    JSMapHashSlot *hs;
+    JSMapRecord *mr;
     JSMapState *s;
+    uint32_t h, i;
 
     /* first pass to remove the records from the WeakMap/WeakSet
-       lists */
-    for(mr = p->first_weak_ref; mr != NULL; mr = mr->next_weak_ref) {
-        s = mr->map;
+       records */
+    h = map_hash_key(JS_MKPTR(JS_TAG_OBJECT, p));
+    for(wr = p->first_weak_ref; wr != NULL; wr = wr->next_weak_ref) {
+        s = wr->map;
         assert(s->is_weak);
-        assert(!mr->empty); /* no iterator on WeakMap/WeakSet */
-        list_del(&mr->hash_link);
-        list_del(&mr->link);
+        i = map_hash_index(s, h);
+        for(;;) {
+            hs = &s->hash_table[i];
+            assert(hs->index != 0);
+            mr = &s->records[hs->index - 1];
+            if (hs->hash == h && !map_record_is_deleted(mr) &&
+                JS_VALUE_GET_OBJ(mr->key) == p)
+                break;
+            i = (i + 1) & (s->hash_size - 1);
+        }
+        wr->value = mr->value;
+        mr->key = JS_UNINITIALIZED;
+        mr->value = JS_UNDEFINED;
+        s->record_count--;
     }
 
     /* second pass to free the values to avoid modifying the weak
        reference list while traversing it. */
-    for(mr = p->first_weak_ref; mr != NULL; mr = mr_next) {
-        mr_next = mr->next_weak_ref;
-        JS_FreeValueRT(rt, mr->value);
-        js_free_rt(rt, mr);
+    for(wr = p->first_weak_ref; wr != NULL; wr = wr_next) {
+        wr_next = wr->next_weak_ref;
+        JS_FreeValueRT(rt, wr->value);
+        js_free_rt(rt, wr);
     }
 
     p->first_weak_ref = NULL; /* fail safe */
@@ -47320,6 +53137,7 @@ static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
     JSMapRecord *mr;
     JSValueConst key, value;
+    JSValue old_value;
 
     if (!s)
         return JS_EXCEPTION;
@@ -47331,14 +53149,14 @@ static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
     else
         value = argv[1];
     mr = map_find_record(ctx, s, key);
-    if (mr) {
-        JS_FreeValue(ctx, mr->value);
-    } else {
+    if (!mr) {
         mr = map_add_record(ctx, s, key);
         if (!mr)
             return JS_EXCEPTION;
     }
+    old_value = mr->value;
     mr->value = JS_DupValue(ctx, value);
+    JS_FreeValue(ctx, old_value);
     return JS_DupValue(ctx, this_val);
 }
 
@@ -47379,6 +53197,7 @@ static JSValue js_map_delete(JSContext *ctx, JSValueConst this_val,
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
     JSMapRecord *mr;
     JSValueConst key;
+    JSValue key1, value;
 
     if (!s)
         return JS_EXCEPTION;
@@ -47386,7 +53205,24 @@ static JSValue js_map_delete(JSContext *ctx, JSValueConst this_val,
     mr = map_find_record(ctx, s, key);
     if (!mr)
         return JS_FALSE;
-    map_delete_record(ctx->rt, s, mr);
+    key1 = mr->key;
+    value = mr->value;
+    mr->key = JS_UNINITIALIZED;
+    mr->value = JS_UNDEFINED;
+    s->record_count--;
+    if (s->is_weak)
+        delete_weak_ref(ctx->rt, s, key1);
+    /* compact when more than half of the records are deleted */
+    if (s->record_end >= 16 && s->record_count < s->record_end / 2) {
+        if (s->record_count < s->record_size / 4)
+            map_resize(ctx, s, s->record_size / 2);
+        else
+            map_resize(ctx, s, s->record_size);
+    }
+    /* the map may be modified when freeing the values */
+    if (!s->is_weak)
+        JS_FreeValue(ctx, key1);
+    JS_FreeValue(ctx, value);
     return JS_TRUE;
 }
 
@@ -47394,15 +53230,13 @@ static JSValue js_map_clear(JSContext *ctx, JSValueConst this_val,
                             int argc, JSValueConst *argv, int magic)
 {
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
-    struct list_head *el, *el1;
-    JSMapRecord *mr;
+    uint32_t i;
 
     if (!s)
         return JS_EXCEPTION;
-    list_for_each_safe(el, el1, &s->records) {
-        mr = list_entry(el, JSMapRecord, link);
-        map_delete_record(ctx->rt, s, mr);
-    }
+    for(i = 0; i < s->record_end; i++)
+        map_delete_record(ctx->rt, s, &s->records[i]);
+    map_resize(ctx, s, max_int(4, s->record_count));
     return JS_UNDEFINED;
 }
 
@@ -47420,7 +53254,7 @@ static JSValue js_map_forEach(JSContext *ctx, JSValueConst this_val,
     JSMapState *s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
     JSValueConst func, this_arg;
     JSValue ret, args[3];
-    struct list_head *el;
+    JSMapIteratorData it_s, *it = &it_s;
     JSMapRecord *mr;
 
     if (!s)
@@ -47432,33 +53266,32 @@ static JSValue js_map_forEach(JSContext *ctx, JSValueConst this_val,
         this_arg = JS_UNDEFINED;
     if (check_function(ctx, func))
         return JS_EXCEPTION;
-    /* Note: the list can be modified while traversing it, but the
-       current element is locked */
-    el = s->records.next;
-    while (el != &s->records) {
-        mr = list_entry(el, JSMapRecord, link);
-        if (!mr->empty) {
-            mr->ref_count++;
-            /* must duplicate in case the record is deleted */
-            args[1] = JS_DupValue(ctx, mr->key);
-            if (magic)
-                args[0] = args[1];
-            else
-                args[0] = JS_DupValue(ctx, mr->value);
-            args[2] = (JSValue)this_val;
-            ret = JS_Call(ctx, func, this_arg, 3, (JSValueConst *)args);
-            JS_FreeValue(ctx, args[0]);
-            if (!magic)
-                JS_FreeValue(ctx, args[1]);
-            el = el->next;
-            map_decref_record(ctx->rt, mr);
-            if (JS_IsException(ret))
-                return ret;
-            JS_FreeValue(ctx, ret);
-        } else {
-            el = el->next;
+    /* Note: the map can be modified while traversing it, so the index
+       of the current record is updated as for the iterators */
+    it->cur_index = 0;
+    list_add_tail(&it->link, &s->iterators);
+    while (it->cur_index < s->record_end) {
+        mr = &s->records[it->cur_index++];
+        if (map_record_is_deleted(mr))
+            continue;
+        /* must duplicate in case the record is deleted */
+        args[1] = JS_DupValue(ctx, mr->key);
+        if (magic)
+            args[0] = args[1];
+        else
+            args[0] = JS_DupValue(ctx, mr->value);
+        args[2] = (JSValue)this_val;
+        ret = JS_Call(ctx, func, this_arg, 3, (JSValueConst *)args);
+        JS_FreeValue(ctx, args[0]);
+        if (!magic)
+            JS_FreeValue(ctx, args[1]);
+        if (JS_IsException(ret)) {
+            list_del(&it->link);
+            return ret;
         }
+        JS_FreeValue(ctx, ret);
     }
+    list_del(&it->link);
     return JS_UNDEFINED;
 }
 
@@ -47583,287 +53416,2108 @@ static void js_map_finalizer(JSRuntime *rt, JSValue val)
 {
     JSObject *p;
     JSMapState *s;
-    struct list_head *el, *el1;
     JSMapRecord *mr;
+    uint32_t i;
 
     p = JS_VALUE_GET_OBJ(val);
     s = p->u.map_state;
     if (s) {
         /* if the object is deleted we are sure that no iterator is
            using it */
-        list_for_each_safe(el, el1, &s->records) {
-            mr = list_entry(el, JSMapRecord, link);
-            if (!mr->empty) {
+        for(i = 0; i < s->record_end; i++) {
+            mr = &s->records[i];
+            if (!map_record_is_deleted(mr)) {
                 if (s->is_weak)
-                    delete_weak_ref(rt, mr);
+                    delete_weak_ref(rt, s, mr->key);
                 else
                     JS_FreeValueRT(rt, mr->key);
                 JS_FreeValueRT(rt, mr->value);
             }
-            js_free_rt(rt, mr);
         }
-        js_free_rt(rt, s->hash_table);
-        js_free_rt(rt, s);
+        js_free_rt(rt, s->records);
+        js_free_rt(rt, s->hash_table);
+        js_free_rt(rt, s);
+    }
+}
+
+static void js_map_mark(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(val);
+    JSMapState *s;
+    JSMapRecord *mr;
+    uint32_t i;
+
+    s = p->u.map_state;
+    if (s) {
+        for(i = 0; i < s->record_end; i++) {
+            mr = &s->records[i];
+            if (!s->is_weak)
+                JS_MarkValue(rt, mr->key, mark_func);
+            JS_MarkValue(rt, mr->value, mark_func);
+        }
+    }
+}
+
+/* Map Iterator */
+
+static void js_map_iterator_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSObject *p;
+    JSMapIteratorData *it;
+
+    p = JS_VALUE_GET_OBJ(val);
+    it = p->u.map_iterator_data;
+    if (it) {
+        /* During the GC sweep phase the Map finalizer may be
+           called before the Map iterator finalizer */
+        if (JS_IsLiveObject(rt, it->obj)) {
+            list_del(&it->link);
+        }
+        JS_FreeValueRT(rt, it->obj);
+        js_free_rt(rt, it);
+    }
+}
+
+static void js_map_iterator_mark(JSRuntime *rt, JSValueConst val,
+                                 JS_MarkFunc *mark_func)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(val);
+    JSMapIteratorData *it;
+    it = p->u.map_iterator_data;
+    if (it) {
+        /* the record is already marked by the object */
+        JS_MarkValue(rt, it->obj, mark_func);
+    }
+}
+
+static JSValue js_create_map_iterator(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv, int magic)
+{
+    JSIteratorKindEnum kind;
+    JSMapState *s;
+    JSMapIteratorData *it;
+    JSValue enum_obj;
+
+    kind = magic >> 2;
+    magic &= 3;
+    s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
+    if (!s)
+        return JS_EXCEPTION;
+    enum_obj = JS_NewObjectClass(ctx, JS_CLASS_MAP_ITERATOR + magic);
+    if (JS_IsException(enum_obj))
+        goto fail;
+    it = js_malloc(ctx, sizeof(*it));
+    if (!it) {
+        JS_FreeValue(ctx, enum_obj);
+        goto fail;
+    }
+    it->obj = JS_DupValue(ctx, this_val);
+    it->kind = kind;
+    it->cur_index = 0;
+    list_add_tail(&it->link, &s->iterators);
+    JS_SetOpaque(enum_obj, it);
+    return enum_obj;
+ fail:
+    return JS_EXCEPTION;
+}
+
+static JSValue js_map_iterator_next(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv,
+                                    BOOL *pdone, int magic)
+{
+    JSMapIteratorData *it;
+    JSMapState *s;
+    JSMapRecord *mr;
+
+    it = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP_ITERATOR + magic);
+    if (!it) {
+        *pdone = FALSE;
+        return JS_EXCEPTION;
+    }
+    if (JS_IsUndefined(it->obj))
+        goto done;
+    s = JS_GetOpaque(it->obj, JS_CLASS_MAP + magic);
+    assert(s != NULL);
+    for(;;) {
+        if (it->cur_index >= s->record_end) {
+            /* no more record  */
+            list_del(&it->link);
+            JS_FreeValue(ctx, it->obj);
+            it->obj = JS_UNDEFINED;
+        done:
+            /* end of enumeration */
+            *pdone = TRUE;
+            return JS_UNDEFINED;
+        }
+        mr = &s->records[it->cur_index++];
+        if (!map_record_is_deleted(mr))
+            break;
+    }
+
+    *pdone = FALSE;
+
+    if (it->kind == JS_ITERATOR_KIND_KEY) {
+        return JS_DupValue(ctx, mr->key);
+    } else {
+        JSValueConst args[2];
+        args[0] = mr->key;
+        if (magic)
+            args[1] = mr->key;
+        else
+            args[1] = mr->value;
+        if (it->kind == JS_ITERATOR_KIND_VALUE) {
+            return JS_DupValue(ctx, args[1]);
+        } else {
+            return js_create_array(ctx, 2, args);
+        }
+    }
+}
+
+static const JSCFunctionListEntry js_map_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("groupBy", 2, js_object_groupBy, 1 ),
+    JS_CGETSET_DEF("[Symbol.species]", js_get_this, NULL ),
+};
+
+static const JSCFunctionListEntry js_map_proto_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("set", 2, js_map_set, 0 ),
+    JS_CFUNC_MAGIC_DEF("get", 1, js_map_get, 0 ),
+    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, 0 ),
+    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, 0 ),
+    JS_CFUNC_MAGIC_DEF("clear", 0, js_map_clear, 0 ),
+    JS_CGETSET_MAGIC_DEF("size", js_map_get_size, NULL, 0),
+    JS_CFUNC_MAGIC_DEF("forEach", 1, js_map_forEach, 0 ),
+    JS_CFUNC_MAGIC_DEF("values", 0, js_create_map_iterator, (JS_ITERATOR_KIND_VALUE << 2) | 0 ),
+    JS_CFUNC_MAGIC_DEF("keys", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY << 2) | 0 ),
+    JS_CFUNC_MAGIC_DEF("entries", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY_AND_VALUE << 2) | 0 ),
+    JS_ALIAS_DEF("[Symbol.iterator]", "entries" ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Map", JS_PROP_CONFIGURABLE ),
+};
+
+static const JSCFunctionListEntry js_map_iterator_proto_funcs[] = {
+    JS_ITERATOR_NEXT_DEF("next", 0, js_map_iterator_next, 0 ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Map Iterator", JS_PROP_CONFIGURABLE ),
+};
+
+static const JSCFunctionListEntry js_set_proto_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("add", 1, js_map_set, MAGIC_SET ),
+    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, MAGIC_SET ),
+    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, MAGIC_SET ),
+    JS_CFUNC_MAGIC_DEF("clear", 0, js_map_clear, MAGIC_SET ),
+    JS_CGETSET_MAGIC_DEF("size", js_map_get_size, NULL, MAGIC_SET ),
+    JS_CFUNC_MAGIC_DEF("forEach", 1, js_map_forEach, MAGIC_SET ),
+    JS_CFUNC_MAGIC_DEF("values", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY << 2) | MAGIC_SET ),
+    JS_ALIAS_DEF("keys", "values" ),
+    JS_ALIAS_DEF("[Symbol.iterator]", "values" ),
+    JS_CFUNC_MAGIC_DEF("entries", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY_AND_VALUE << 2) | MAGIC_SET ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Set", JS_PROP_CONFIGURABLE ),
+};
+
+static const JSCFunctionListEntry js_set_iterator_proto_funcs[] = {
+    JS_ITERATOR_NEXT_DEF("next", 0, js_map_iterator_next, MAGIC_SET ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Set Iterator", JS_PROP_CONFIGURABLE ),
+};
+
+static const JSCFunctionListEntry js_weak_map_proto_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("set", 2, js_map_set, MAGIC_WEAK ),
+    JS_CFUNC_MAGIC_DEF("get", 1, js_map_get, MAGIC_WEAK ),
+    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, MAGIC_WEAK ),
+    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, MAGIC_WEAK ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "WeakMap", JS_PROP_CONFIGURABLE ),
+};
+
+static const JSCFunctionListEntry js_weak_set_proto_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("add", 1, js_map_set, MAGIC_SET | MAGIC_WEAK ),
+    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, MAGIC_SET | MAGIC_WEAK ),
+    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, MAGIC_SET | MAGIC_WEAK ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "WeakSet", JS_PROP_CONFIGURABLE ),
+};
+
+static const JSCFunctionListEntry * const js_map_proto_funcs_ptr[6] = {
+    js_map_proto_funcs,
+    js_set_proto_funcs,
+    js_weak_map_proto_funcs,
+    js_weak_set_proto_funcs,
+    js_map_iterator_proto_funcs,
+    js_set_iterator_proto_funcs,
+};
+
+static const uint8_t js_map_proto_funcs_count[6] = {
+    countof(js_map_proto_funcs),
+    countof(js_set_proto_funcs),
+    countof(js_weak_map_proto_funcs),
+    countof(js_weak_set_proto_funcs),
+    countof(js_map_iterator_proto_funcs),
+    countof(js_set_iterator_proto_funcs),
+};
+
+void JS_AddIntrinsicMapSet(JSContext *ctx)
+{
+    int i;
+    JSValue obj1;
+    char buf[ATOM_GET_STR_BUF_SIZE];
+
+    for(i = 0; i < 4; i++) {
+        const char *name = JS_AtomGetStr(ctx, buf, sizeof(buf),
+                                         JS_ATOM_Map + i);
+        ctx->class_proto[JS_CLASS_MAP + i] = JS_NewObject(ctx);
+        JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_MAP + i],
+                                   js_map_proto_funcs_ptr[i],
+                                   js_map_proto_funcs_count[i]);
+        obj1 = JS_NewCFunctionMagic(ctx, js_map_constructor, name, 0,
+                                    JS_CFUNC_constructor_magic, i);
+        if (i < 2) {
+            JS_SetPropertyFunctionList(ctx, obj1, js_map_funcs,
+                                       countof(js_map_funcs));
+        }
+        JS_NewGlobalCConstructor2(ctx, obj1, name, ctx->class_proto[JS_CLASS_MAP + i]);
+    }
+
+    for(i = 0; i < 2; i++) {
+        ctx->class_proto[JS_CLASS_MAP_ITERATOR + i] =
+            JS_NewObjectProto(ctx, ctx->iterator_proto);
+        JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_MAP_ITERATOR + i],
+                                   js_map_proto_funcs_ptr[i + 4],
+                                   js_map_proto_funcs_count[i + 4]);
+    }
+}
+
+/* Context snapshots */
+
+/* A snapshot contains the modifications done to a context since
+   JS_SetSnapshotBase() was called. The objects which existed at that
+   time (the base objects) are not serialized: they are designated by
+   a path from a root of the context, so the snapshot can be loaded in
+   any new context initialized in the same way. The paths are resolved
+   before the modifications are applied. */
+
+typedef enum {
+    JS_SNAPSHOT_EDGE_ROOT,
+    JS_SNAPSHOT_EDGE_VALUE,
+    JS_SNAPSHOT_EDGE_GETTER,
+    JS_SNAPSHOT_EDGE_SETTER,
+    JS_SNAPSHOT_EDGE_PROTO,
+    JS_SNAPSHOT_EDGE_VAR_REF, /* closure variable of a function */
+} JSSnapshotEdgeEnum;
+
+/* the other edges contain a root or closure variable index */
+static inline BOOL js_snapshot_edge_has_atom(int edge)
+{
+    return (edge >= JS_SNAPSHOT_EDGE_VALUE && edge <= JS_SNAPSHOT_EDGE_SETTER);
+}
+
+#define JS_SNAPSHOT_PATCH_PROTO      (1 << 0)
+#define JS_SNAPSHOT_PATCH_EXTENSIBLE (1 << 1)
+#define JS_SNAPSHOT_PATCH_ELEMENTS   (1 << 2)
+
+typedef struct JSSnapshotProp {
+    JSAtom atom;
+    int flags;
+    JSProperty pr;
+} JSSnapshotProp;
+
+typedef struct JSSnapshotBaseEntry {
+    JSObject *obj;
+    int parent; /* index of the parent entry or -1 for a root */
+    uint8_t edge; /* JS_SNAPSHOT_EDGE_x */
+    uint32_t atom; /* root or closure variable index if no atom */
+    /* state when the base was recorded */
+    JSObject *proto;
+    BOOL extensible;
+    int prop_count;
+    JSSnapshotProp *props;
+    BOOL is_fast_array;
+    uint32_t array_count;
+    JSValue *array_values;
+    /* values of the closure variables of a bytecode function */
+    int var_ref_count;
+    JSValue *var_ref_values;
+    /* key and value of the records of a Map, Set, WeakMap or WeakSet */
+    uint32_t map_count;
+    JSValue *map_values;
+    /* value of a Date */
+    JSValue object_data;
+    /* contents of an ArrayBuffer or of the bytes viewed by a typed
+       array or DataView */
+    BOOL has_data;
+    uint32_t data_len;
+    uint8_t *data;
+} JSSnapshotBaseEntry;
+
+struct JSSnapshotBase {
+    JSObjectList object_list; /* same order as 'tab' */
+    JSSnapshotBaseEntry *tab;
+    int count;
+    int size;
+    int module_count; /* number of loaded modules */
+};
+
+static const uint16_t js_snapshot_roots[] = {
+    offsetof(JSContext, global_obj),
+    offsetof(JSContext, global_var_obj),
+    offsetof(JSContext, function_proto),
+    offsetof(JSContext, function_ctor),
+    offsetof(JSContext, array_ctor),
+    offsetof(JSContext, regexp_ctor),
+    offsetof(JSContext, promise_ctor),
+    offsetof(JSContext, iterator_proto),
+    offsetof(JSContext, async_iterator_proto),
+    offsetof(JSContext, array_proto_values),
+    offsetof(JSContext, throw_type_error),
+    offsetof(JSContext, eval_obj),
+};
+
+static int js_snapshot_get_root_count(JSContext *ctx)
+{
+    return countof(js_snapshot_roots) + JS_NATIVE_ERROR_COUNT +
+        ctx->rt->class_count;
+}
+
+static JSValueConst js_snapshot_get_root(JSContext *ctx, uint32_t idx)
+{
+    if (idx < countof(js_snapshot_roots))
+        return *(JSValue *)((uint8_t *)ctx + js_snapshot_roots[idx]);
+    idx -= countof(js_snapshot_roots);
+    if (idx < JS_NATIVE_ERROR_COUNT)
+        return ctx->native_error_proto[idx];
+    idx -= JS_NATIVE_ERROR_COUNT;
+    if (idx < ctx->rt->class_count)
+        return ctx->class_proto[idx];
+    return JS_UNDEFINED;
+}
+
+static void js_snapshot_prop_free(JSRuntime *rt, JSSnapshotProp *sp)
+{
+    switch(sp->flags & JS_PROP_TMASK) {
+    case JS_PROP_NORMAL:
+        JS_FreeValueRT(rt, sp->pr.u.value);
+        break;
+    case JS_PROP_GETSET:
+        if (sp->pr.u.getset.getter)
+            JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, sp->pr.u.getset.getter));
+        if (sp->pr.u.getset.setter)
+            JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, sp->pr.u.getset.setter));
+        break;
+    case JS_PROP_VARREF:
+        free_var_ref(rt, sp->pr.u.var_ref);
+        break;
+    default:
+        break;
+    }
+    JS_FreeAtomRT(rt, sp->atom);
+}
+
+/* copy the property 'src' of type 'flags' to 'dst' */
+static void js_snapshot_dup_prop(JSContext *ctx, JSProperty *dst,
+                                 const JSProperty *src, int flags)
+{
+    switch(flags & JS_PROP_TMASK) {
+    case JS_PROP_NORMAL:
+        dst->u.value = JS_DupValue(ctx, src->u.value);
+        break;
+    case JS_PROP_GETSET:
+        dst->u.getset = src->u.getset;
+        if (dst->u.getset.getter)
+            JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, dst->u.getset.getter));
+        if (dst->u.getset.setter)
+            JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, dst->u.getset.setter));
+        break;
+    case JS_PROP_VARREF:
+        dst->u.var_ref = src->u.var_ref;
+        dst->u.var_ref->header.ref_count++;
+        break;
+    default:
+        abort();
+    }
+}
+
+static void js_snapshot_base_free(JSRuntime *rt, JSSnapshotBase *base)
+{
+    JSSnapshotBaseEntry *e;
+    int i, j;
+
+    for(i = 0; i < base->count; i++) {
+        e = &base->tab[i];
+        JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, e->obj));
+        if (js_snapshot_edge_has_atom(e->edge))
+            JS_FreeAtomRT(rt, e->atom);
+        if (e->proto)
+            JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, e->proto));
+        for(j = 0; j < e->prop_count; j++)
+            js_snapshot_prop_free(rt, &e->props[j]);
+        js_free_rt(rt, e->props);
+        for(j = 0; j < e->array_count; j++)
+            JS_FreeValueRT(rt, e->array_values[j]);
+        js_free_rt(rt, e->array_values);
+        for(j = 0; j < e->var_ref_count; j++)
+            JS_FreeValueRT(rt, e->var_ref_values[j]);
+        js_free_rt(rt, e->var_ref_values);
+        for(j = 0; j < 2 * e->map_count; j++)
+            JS_FreeValueRT(rt, e->map_values[j]);
+        js_free_rt(rt, e->map_values);
+        JS_FreeValueRT(rt, e->object_data);
+        js_free_rt(rt, e->data);
+    }
+    js_free_rt(rt, base->tab);
+    js_free_rt(rt, base->object_list.object_tab);
+    js_free_rt(rt, base->object_list.hash_table);
+    js_free_rt(rt, base);
+}
+
+static void js_snapshot_base_mark(JSRuntime *rt, JSSnapshotBase *base,
+                                  JS_MarkFunc *mark_func)
+{
+    JSSnapshotBaseEntry *e;
+    JSSnapshotProp *sp;
+    int i, j;
+
+    for(i = 0; i < base->count; i++) {
+        e = &base->tab[i];
+        mark_func(rt, &e->obj->header);
+        if (e->proto)
+            mark_func(rt, &e->proto->header);
+        for(j = 0; j < e->prop_count; j++) {
+            sp = &e->props[j];
+            switch(sp->flags & JS_PROP_TMASK) {
+            case JS_PROP_NORMAL:
+                JS_MarkValue(rt, sp->pr.u.value, mark_func);
+                break;
+            case JS_PROP_GETSET:
+                if (sp->pr.u.getset.getter)
+                    mark_func(rt, &sp->pr.u.getset.getter->header);
+                if (sp->pr.u.getset.setter)
+                    mark_func(rt, &sp->pr.u.getset.setter->header);
+                break;
+            case JS_PROP_VARREF:
+                mark_func(rt, &sp->pr.u.var_ref->header);
+                break;
+            default:
+                break;
+            }
+        }
+        for(j = 0; j < e->array_count; j++)
+            JS_MarkValue(rt, e->array_values[j], mark_func);
+        for(j = 0; j < e->var_ref_count; j++)
+            JS_MarkValue(rt, e->var_ref_values[j], mark_func);
+        for(j = 0; j < 2 * e->map_count; j++)
+            JS_MarkValue(rt, e->map_values[j], mark_func);
+        JS_MarkValue(rt, e->object_data, mark_func);
+    }
+}
+
+static int js_snapshot_base_add(JSContext *ctx, JSSnapshotBase *base,
+                                JSObject *p, int parent, int edge,
+                                uint32_t atom)
+{
+    JSSnapshotBaseEntry *e;
+
+    if (js_object_list_find(ctx, &base->object_list, p) >= 0)
+        return 0;
+    /* a path cannot go through a symbol created at runtime, except
+       the registered symbols which are found by their key */
+    if (js_snapshot_edge_has_atom(edge) && !__JS_AtomIsTaggedInt(atom) &&
+        atom >= JS_ATOM_END &&
+        ctx->rt->atom_array[atom]->atom_type >= JS_ATOM_TYPE_SYMBOL)
+        return 0;
+    if (js_resize_array(ctx, (void **)&base->tab, sizeof(base->tab[0]),
+                        &base->size, base->count + 1))
+        return -1;
+    if (js_object_list_add(ctx, &base->object_list, p))
+        return -1;
+    e = &base->tab[base->count++];
+    memset(e, 0, sizeof(*e));
+    e->object_data = JS_UNDEFINED;
+    e->obj = JS_VALUE_GET_OBJ(JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, p)));
+    e->parent = parent;
+    e->edge = edge;
+    if (js_snapshot_edge_has_atom(edge))
+        e->atom = JS_DupAtom(ctx, atom);
+    else
+        e->atom = atom;
+    return 0;
+}
+
+/* record the internal state of the base object 'e' which is not
+   stored in its properties. The objects referenced by the records of
+   a Map or Set are not added to the base. */
+static int js_snapshot_record_internal_state(JSContext *ctx,
+                                             JSSnapshotBaseEntry *e)
+{
+    JSObject *p = e->obj;
+    JSMapState *ms;
+    JSMapRecord *mr;
+    JSArrayBuffer *abuf;
+    JSTypedArray *ta;
+    uint8_t *ptr;
+    uint32_t i, j;
+
+    switch(p->class_id) {
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+    case JS_CLASS_WEAKMAP:
+    case JS_CLASS_WEAKSET:
+        ms = p->u.map_state;
+        if (ms->record_count == 0)
+            return 0;
+        e->map_values = js_malloc(ctx, sizeof(e->map_values[0]) * 2 *
+                                  ms->record_count);
+        if (!e->map_values)
+            return -1;
+        j = 0;
+        for(i = 0; i < ms->record_end; i++) {
+            mr = &ms->records[i];
+            if (map_record_is_deleted(mr))
+                continue;
+            e->map_values[j++] = JS_DupValue(ctx, mr->key);
+            e->map_values[j++] = JS_DupValue(ctx, mr->value);
+        }
+        e->map_count = ms->record_count;
+        return 0;
+    case JS_CLASS_DATE:
+        e->object_data = JS_DupValue(ctx, p->u.object_data);
+        return 0;
+    case JS_CLASS_ARRAY_BUFFER:
+        abuf = p->u.array_buffer;
+        if (abuf->detached)
+            return 0;
+        ptr = abuf->data;
+        e->data_len = abuf->byte_length;
+        break;
+    default:
+        if (p->class_id < JS_CLASS_UINT8C_ARRAY ||
+            p->class_id > JS_CLASS_DATAVIEW)
+            return 0;
+        ta = p->u.typed_array;
+        abuf = ta->buffer->u.array_buffer;
+        /* the contents of a SharedArrayBuffer may be modified by
+           other agents so they are not restored */
+        if (abuf->detached || abuf->shared)
+            return 0;
+        ptr = abuf->data + ta->offset;
+        e->data_len = ta->length;
+        break;
+    }
+    if (e->data_len != 0) {
+        e->data = js_malloc(ctx, e->data_len);
+        if (!e->data)
+            return -1;
+        memcpy(e->data, ptr, e->data_len);
+    }
+    e->has_data = TRUE;
+    return 0;
+}
+
+/* record the state of the base object 'idx' and add the objects it
+   references to the base */
+static int js_snapshot_base_record(JSContext *ctx, JSSnapshotBase *base,
+                                   int idx)
+{
+    JSSnapshotBaseEntry *e = &base->tab[idx];
+    JSObject *p = e->obj;
+    JSShape *sh;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSSnapshotProp *sp, *props;
+    JSVarRef *var_ref;
+    JSValue *var_ref_values;
+    int i, prop_count, var_ref_count;
+
+    /* instantiate the lazy properties so that the objects they
+       contain are part of the base */
+    for(i = 0; i < p->shape->prop_count; i++) {
+        prs = &get_shape_prop(p->shape)[i];
+        pr = &p->prop[i];
+        if (prs->atom != JS_ATOM_NULL &&
+            (prs->flags & JS_PROP_TMASK) == JS_PROP_AUTOINIT) {
+            if (JS_AutoInitProperty(ctx, p, prs->atom, pr, prs))
+                return -1;
+        }
+    }
+
+    sh = p->shape;
+    props = js_malloc(ctx, sizeof(props[0]) * max_int(sh->prop_count, 1));
+    if (!props)
+        return -1;
+    e->props = props;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        pr = &p->prop[i];
+        sp = &props[e->prop_count++];
+        sp->atom = JS_DupAtom(ctx, prs->atom);
+        sp->flags = prs->flags;
+        js_snapshot_dup_prop(ctx, &sp->pr, pr, prs->flags);
+    }
+    if (sh->proto)
+        e->proto = JS_VALUE_GET_OBJ(JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, sh->proto)));
+    e->extensible = p->extensible;
+    if (p->class_id == JS_CLASS_ARRAY && p->fast_array) {
+        e->is_fast_array = TRUE;
+        if (p->u.array.count != 0) {
+            e->array_values = js_malloc(ctx, sizeof(e->array_values[0]) *
+                                        p->u.array.count);
+            if (!e->array_values)
+                return -1;
+            for(i = 0; i < p->u.array.count; i++)
+                e->array_values[i] = JS_DupValue(ctx, p->u.array.u.values[i]);
+            e->array_count = p->u.array.count;
+        }
+    }
+    if (js_class_has_bytecode(p->class_id) && p->u.func.var_refs) {
+        JSFunctionBytecode *b = p->u.func.function_bytecode;
+        if (b->closure_var_count != 0) {
+            e->var_ref_values = js_malloc(ctx, sizeof(e->var_ref_values[0]) *
+                                          b->closure_var_count);
+            if (!e->var_ref_values)
+                return -1;
+            for(i = 0; i < b->closure_var_count; i++) {
+                var_ref = p->u.func.var_refs[i];
+                if (var_ref)
+                    e->var_ref_values[i] = JS_DupValue(ctx, *var_ref->pvalue);
+                else
+                    e->var_ref_values[i] = JS_UNDEFINED;
+            }
+            e->var_ref_count = b->closure_var_count;
+        }
+    }
+    if (js_snapshot_record_internal_state(ctx, e))
+        return -1;
+
+    /* 'e' is no longer valid after js_snapshot_base_add() */
+    prop_count = e->prop_count;
+    var_ref_count = e->var_ref_count;
+    var_ref_values = e->var_ref_values;
+    if (sh->proto) {
+        if (js_snapshot_base_add(ctx, base, sh->proto, idx,
+                                 JS_SNAPSHOT_EDGE_PROTO, 0))
+            return -1;
+    }
+    for(i = 0; i < prop_count; i++) {
+        sp = &props[i];
+        switch(sp->flags & JS_PROP_TMASK) {
+        case JS_PROP_NORMAL:
+            if (JS_VALUE_GET_TAG(sp->pr.u.value) == JS_TAG_OBJECT) {
+                if (js_snapshot_base_add(ctx, base,
+                                         JS_VALUE_GET_OBJ(sp->pr.u.value), idx,
+                                         JS_SNAPSHOT_EDGE_VALUE, sp->atom))
+                    return -1;
+            }
+            break;
+        case JS_PROP_GETSET:
+            if (sp->pr.u.getset.getter) {
+                if (js_snapshot_base_add(ctx, base, sp->pr.u.getset.getter, idx,
+                                         JS_SNAPSHOT_EDGE_GETTER, sp->atom))
+                    return -1;
+            }
+            if (sp->pr.u.getset.setter) {
+                if (js_snapshot_base_add(ctx, base, sp->pr.u.getset.setter, idx,
+                                         JS_SNAPSHOT_EDGE_SETTER, sp->atom))
+                    return -1;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    for(i = 0; i < var_ref_count; i++) {
+        if (JS_VALUE_GET_TAG(var_ref_values[i]) == JS_TAG_OBJECT) {
+            if (js_snapshot_base_add(ctx, base,
+                                     JS_VALUE_GET_OBJ(var_ref_values[i]), idx,
+                                     JS_SNAPSHOT_EDGE_VAR_REF, i))
+                return -1;
+        }
+    }
+    return 0;
+}
+
+int JS_SetSnapshotBase(JSContext *ctx)
+{
+    JSSnapshotBase *base;
+    JSValueConst val;
+    struct list_head *el;
+    int i, n;
+
+    base = js_mallocz(ctx, sizeof(*base));
+    if (!base)
+        return -1;
+    js_object_list_init(&base->object_list);
+    list_for_each(el, &ctx->loaded_modules)
+        base->module_count++;
+    n = js_snapshot_get_root_count(ctx);
+    for(i = 0; i < n; i++) {
+        val = js_snapshot_get_root(ctx, i);
+        if (JS_VALUE_GET_TAG(val) == JS_TAG_OBJECT) {
+            if (js_snapshot_base_add(ctx, base, JS_VALUE_GET_OBJ(val), -1,
+                                     JS_SNAPSHOT_EDGE_ROOT, i))
+                goto fail;
+        }
+    }
+    /* breadth first traversal so that the paths are short */
+    for(i = 0; i < base->count; i++) {
+        if (js_snapshot_base_record(ctx, base, i))
+            goto fail;
+    }
+    if (ctx->snapshot_base)
+        js_snapshot_base_free(ctx->rt, ctx->snapshot_base);
+    ctx->snapshot_base = base;
+    return 0;
+ fail:
+    js_snapshot_base_free(ctx->rt, base);
+    return -1;
+}
+
+static int js_snapshot_find_base(JSContext *ctx, JSSnapshotBase *base,
+                                 JSObject *p)
+{
+    return js_object_list_find(ctx, &base->object_list, p);
+}
+
+/* return the index of the base object 'idx' in the path table */
+static int JS_WriteSnapshotBaseRef(BCWriterState *s, int idx)
+{
+    JSSnapshotBaseEntry *e = &s->snapshot->tab[idx];
+    DynBuf dbuf;
+    int parent_ref, ret;
+
+    if (s->base_ref_tab[idx] >= 0)
+        return s->base_ref_tab[idx];
+    parent_ref = -1;
+    if (e->parent >= 0) {
+        parent_ref = JS_WriteSnapshotBaseRef(s, e->parent);
+        if (parent_ref < 0)
+            return -1;
+    }
+    dbuf = s->dbuf;
+    s->dbuf = s->base_dbuf;
+    bc_put_leb128(s, parent_ref + 1);
+    ret = 0;
+    if (e->edge == JS_SNAPSHOT_EDGE_ROOT) {
+        bc_put_leb128(s, e->atom);
+    } else {
+        bc_put_u8(s, e->edge);
+        if (js_snapshot_edge_has_atom(e->edge))
+            ret = bc_put_atom(s, e->atom);
+        else if (e->edge == JS_SNAPSHOT_EDGE_VAR_REF)
+            bc_put_leb128(s, e->atom);
+    }
+    s->base_dbuf = s->dbuf;
+    s->dbuf = dbuf;
+    if (ret)
+        return -1;
+    s->base_ref_tab[idx] = s->base_ref_count;
+    return s->base_ref_count++;
+}
+
+static int JS_WriteSnapshotProperty(BCWriterState *s, JSShapeProperty *prs,
+                                    JSProperty *pr)
+{
+    JSObject *getter, *setter;
+
+    if (bc_put_atom(s, prs->atom))
+        return -1;
+    bc_put_leb128(s, prs->flags & (JS_PROP_C_W_E | JS_PROP_TMASK));
+    switch(prs->flags & JS_PROP_TMASK) {
+    case JS_PROP_NORMAL:
+        return JS_WriteObjectRec(s, pr->u.value);
+    case JS_PROP_GETSET:
+        getter = pr->u.getset.getter;
+        setter = pr->u.getset.setter;
+        if (JS_WriteObjectRec(s, getter ? JS_MKPTR(JS_TAG_OBJECT, getter) :
+                              JS_UNDEFINED))
+            return -1;
+        return JS_WriteObjectRec(s, setter ? JS_MKPTR(JS_TAG_OBJECT, setter) :
+                                 JS_UNDEFINED);
+    case JS_PROP_AUTOINIT:
+        /* the 'prototype' property of the functions is created again
+           when loading the snapshot */
+        if (js_autoinit_get_id(pr) == JS_AUTOINIT_ID_PROTOTYPE)
+            return 0;
+        /* fall thru */
+    default:
+        JS_ThrowTypeError(s->ctx, "unsupported property in snapshot");
+        return -1;
+    }
+}
+
+static int JS_WriteSnapshotProperties(BCWriterState *s, JSObject *p)
+{
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    uint32_t i, prop_count;
+
+    prop_count = 0;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom != JS_ATOM_NULL)
+            prop_count++;
+    }
+    bc_put_leb128(s, prop_count);
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom != JS_ATOM_NULL) {
+            if (JS_WriteSnapshotProperty(s, prs, &p->prop[i]))
+                return -1;
+        }
+    }
+    return 0;
+}
+
+static int JS_WriteSnapshotBytecode(BCWriterState *s, JSFunctionBytecode *b)
+{
+    int idx;
+
+    if (b->is_lazy) {
+        if (JS_IsUndefined(b->cpool[0])) {
+            if (js_compile_lazy_function(b->realm, b))
+                return -1;
+        }
+        b = JS_VALUE_GET_PTR(b->cpool[0]);
+    }
+    /* the bytecode is shared by all the closures of a function */
+    idx = js_object_list_find(s->ctx, &s->bytecode_list, (JSObject *)b);
+    if (idx >= 0) {
+        bc_put_leb128(s, idx);
+        return 0;
+    }
+    bc_put_leb128(s, s->bytecode_list.object_count);
+    if (js_object_list_add(s->ctx, &s->bytecode_list, (JSObject *)b))
+        return -1;
+    return JS_WriteFunctionTag(s, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+}
+
+static int JS_WriteSnapshotVarRef(BCWriterState *s, JSVarRef *var_ref)
+{
+    int idx;
+
+    idx = js_object_list_find(s->ctx, &s->var_ref_list, (JSObject *)var_ref);
+    if (idx >= 0) {
+        bc_put_leb128(s, idx);
+        return 0;
+    }
+    if (!var_ref->is_detached) {
+        JS_ThrowTypeError(s->ctx, "cannot snapshot a running function");
+        return -1;
+    }
+    bc_put_leb128(s, s->var_ref_list.object_count);
+    if (js_object_list_add(s->ctx, &s->var_ref_list, (JSObject *)var_ref))
+        return -1;
+    return JS_WriteObjectRec(s, var_ref->value);
+}
+
+static int JS_WriteSnapshotObject(BCWriterState *s, JSValueConst obj)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSObject *proto;
+    uint32_t i;
+
+    switch(p->class_id) {
+    case JS_CLASS_OBJECT:
+    case JS_CLASS_ERROR:
+    case JS_CLASS_ARRAY:
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+    case JS_CLASS_BOUND_FUNCTION:
+    case JS_CLASS_NUMBER:
+    case JS_CLASS_STRING:
+    case JS_CLASS_BOOLEAN:
+    case JS_CLASS_SYMBOL:
+    case JS_CLASS_DATE:
+    case JS_CLASS_BIG_INT:
+#ifdef CONFIG_BIGNUM
+    case JS_CLASS_BIG_FLOAT:
+    case JS_CLASS_BIG_DECIMAL:
+#endif
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+    case JS_CLASS_WEAKMAP:
+    case JS_CLASS_WEAKSET:
+    case JS_CLASS_REGEXP:
+    case JS_CLASS_DATAVIEW:
+        break;
+    case JS_CLASS_ARRAY_BUFFER:
+        return JS_WriteArrayBuffer(s, obj);
+    default:
+        if (p->class_id >= JS_CLASS_UINT8C_ARRAY &&
+            p->class_id <= JS_CLASS_FLOAT64_ARRAY)
+            return JS_WriteTypedArray(s, obj);
+        JS_ThrowTypeError(s->ctx, "unsupported object class in snapshot");
+        return -1;
+    }
+
+    bc_put_u8(s, BC_TAG_SNAPSHOT_OBJECT);
+    bc_put_leb128(s, p->class_id);
+    switch(p->class_id) {
+    case JS_CLASS_ARRAY:
+        if (p->fast_array) {
+            bc_put_leb128(s, p->u.array.count);
+            for(i = 0; i < p->u.array.count; i++) {
+                if (JS_WriteObjectRec(s, p->u.array.u.values[i]))
+                    return -1;
+            }
+        } else {
+            /* the elements are in the properties */
+            bc_put_leb128(s, 0);
+        }
+        break;
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+        {
+            JSFunctionBytecode *b = p->u.func.function_bytecode;
+            JSObject *home_object = p->u.func.home_object;
+
+            if (JS_WriteSnapshotBytecode(s, b))
+                return -1;
+            for(i = 0; i < b->closure_var_count; i++) {
+                if (JS_WriteSnapshotVarRef(s, p->u.func.var_refs[i]))
+                    return -1;
+            }
+            if (JS_WriteObjectRec(s, home_object ?
+                                  JS_MKPTR(JS_TAG_OBJECT, home_object) :
+                                  JS_NULL))
+                return -1;
+        }
+        break;
+    case JS_CLASS_BOUND_FUNCTION:
+        {
+            JSBoundFunction *bf = p->u.bound_function;
+
+            if (JS_WriteObjectRec(s, bf->func_obj))
+                return -1;
+            if (JS_WriteObjectRec(s, bf->this_val))
+                return -1;
+            bc_put_leb128(s, bf->argc);
+            for(i = 0; i < bf->argc; i++) {
+                if (JS_WriteObjectRec(s, bf->argv[i]))
+                    return -1;
+            }
+        }
+        break;
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+    case JS_CLASS_WEAKMAP:
+    case JS_CLASS_WEAKSET:
+        {
+            JSMapState *ms = p->u.map_state;
+            JSMapRecord *mr;
+            uint32_t i;
+
+            /* the keys of a weak map only reachable from it are
+               collected again after the snapshot is read */
+            bc_put_leb128(s, ms->record_count);
+            for(i = 0; i < ms->record_end; i++) {
+                mr = &ms->records[i];
+                if (map_record_is_deleted(mr))
+                    continue;
+                if (JS_WriteObjectRec(s, mr->key))
+                    return -1;
+                if (!((p->class_id - JS_CLASS_MAP) & MAGIC_SET)) {
+                    if (JS_WriteObjectRec(s, mr->value))
+                        return -1;
+                }
+            }
+        }
+        break;
+    case JS_CLASS_REGEXP:
+        JS_WriteString(s, p->u.regexp.pattern);
+        JS_WriteString(s, p->u.regexp.bytecode);
+        break;
+    case JS_CLASS_DATAVIEW:
+        {
+            JSTypedArray *ta = p->u.typed_array;
+
+            if (JS_WriteObjectRec(s, JS_MKPTR(JS_TAG_OBJECT, ta->buffer)))
+                return -1;
+            bc_put_leb128(s, ta->offset);
+            bc_put_leb128(s, ta->length);
+        }
+        break;
+    case JS_CLASS_OBJECT:
+    case JS_CLASS_ERROR:
+        break;
+    default:
+        if (JS_WriteObjectRec(s, p->u.object_data))
+            return -1;
+        break;
+    }
+
+    proto = p->shape->proto;
+    if (JS_WriteObjectRec(s, proto ? JS_MKPTR(JS_TAG_OBJECT, proto) : JS_NULL))
+        return -1;
+    if (JS_WriteSnapshotProperties(s, p))
+        return -1;
+    bc_put_u8(s, p->extensible | (p->is_constructor << 1));
+    return 0;
+}
+
+static JSSnapshotProp *js_snapshot_find_prop(JSSnapshotBaseEntry *e,
+                                             JSAtom atom, int hint)
+{
+    int i;
+    /* the properties are usually in the same order */
+    if (hint < e->prop_count && e->props[hint].atom == atom)
+        return &e->props[hint];
+    for(i = 0; i < e->prop_count; i++) {
+        if (e->props[i].atom == atom)
+            return &e->props[i];
+    }
+    return NULL;
+}
+
+/* same as js_same_value() with a fast path for the unmodified values */
+static inline BOOL js_snapshot_same_value(JSContext *ctx, JSValueConst op1,
+                                          JSValueConst op2)
+{
+    if (JS_VALUE_HAS_REF_COUNT(op1) &&
+        JS_VALUE_GET_TAG(op1) == JS_VALUE_GET_TAG(op2) &&
+        JS_VALUE_GET_PTR(op1) == JS_VALUE_GET_PTR(op2))
+        return TRUE;
+    return js_same_value(ctx, op1, op2);
+}
+
+static BOOL js_snapshot_prop_changed(JSContext *ctx, JSSnapshotProp *sp,
+                                     JSShapeProperty *prs, JSProperty *pr)
+{
+    if (!sp || sp->flags != prs->flags)
+        return TRUE;
+    switch(prs->flags & JS_PROP_TMASK) {
+    case JS_PROP_NORMAL:
+        return !js_snapshot_same_value(ctx, sp->pr.u.value, pr->u.value);
+    case JS_PROP_GETSET:
+        return (sp->pr.u.getset.getter != pr->u.getset.getter ||
+                sp->pr.u.getset.setter != pr->u.getset.setter);
+    case JS_PROP_VARREF:
+        return sp->pr.u.var_ref != pr->u.var_ref;
+    default:
+        return TRUE;
+    }
+}
+
+/* write the modifications of the base object 'idx' */
+static int JS_WriteSnapshotPatch(BCWriterState *s, int idx)
+{
+    JSContext *ctx = s->ctx;
+    JSSnapshotBaseEntry *e = &s->snapshot->tab[idx];
+    JSObject *p = e->obj;
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSSnapshotProp *sp;
+    uint32_t i, j, deleted_count, changed_count, count;
+    int flags, ref;
+
+    deleted_count = 0;
+    for(i = 0; i < e->prop_count; i++) {
+        if (!find_own_property(&pr, p, e->props[i].atom))
+            deleted_count++;
+    }
+    changed_count = 0;
+    for(i = 0, j = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        sp = js_snapshot_find_prop(e, prs->atom, j++);
+        if (js_snapshot_prop_changed(ctx, sp, prs, &p->prop[i]))
+            changed_count++;
+    }
+    flags = 0;
+    if (sh->proto != e->proto)
+        flags |= JS_SNAPSHOT_PATCH_PROTO;
+    if (p->extensible != e->extensible)
+        flags |= JS_SNAPSHOT_PATCH_EXTENSIBLE;
+    if (e->is_fast_array) {
+        if (!p->fast_array || p->u.array.count != e->array_count) {
+            flags |= JS_SNAPSHOT_PATCH_ELEMENTS;
+        } else {
+            for(i = 0; i < e->array_count; i++) {
+                if (!js_snapshot_same_value(ctx, e->array_values[i],
+                                            p->u.array.u.values[i])) {
+                    flags |= JS_SNAPSHOT_PATCH_ELEMENTS;
+                    break;
+                }
+            }
+        }
+    }
+    if (flags == 0 && deleted_count == 0 && changed_count == 0)
+        return 0;
+
+    ref = JS_WriteSnapshotBaseRef(s, idx);
+    if (ref < 0)
+        return -1;
+    bc_put_leb128(s, ref + 1);
+    bc_put_u8(s, flags);
+    if (flags & JS_SNAPSHOT_PATCH_PROTO) {
+        if (JS_WriteObjectRec(s, sh->proto ? JS_MKPTR(JS_TAG_OBJECT, sh->proto) :
+                              JS_NULL))
+            return -1;
+    }
+    if (flags & JS_SNAPSHOT_PATCH_ELEMENTS) {
+        count = p->fast_array ? p->u.array.count : 0;
+        bc_put_leb128(s, count);
+        for(i = 0; i < count; i++) {
+            if (JS_WriteObjectRec(s, p->u.array.u.values[i]))
+                return -1;
+        }
+    }
+    bc_put_leb128(s, deleted_count);
+    for(i = 0; i < e->prop_count; i++) {
+        if (!find_own_property(&pr, p, e->props[i].atom)) {
+            if (bc_put_atom(s, e->props[i].atom))
+                return -1;
+        }
+    }
+    bc_put_leb128(s, changed_count);
+    for(i = 0, j = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        sp = js_snapshot_find_prop(e, prs->atom, j++);
+        if (js_snapshot_prop_changed(ctx, sp, prs, &p->prop[i])) {
+            if (JS_WriteSnapshotProperty(s, prs, &p->prop[i]))
+                return -1;
+        }
+    }
+    return 0;
+}
+
+static void js_snapshot_writer_free(BCWriterState *s)
+{
+    JSContext *ctx = s->ctx;
+    js_object_list_end(ctx, &s->object_list);
+    js_object_list_end(ctx, &s->bytecode_list);
+    js_object_list_end(ctx, &s->var_ref_list);
+    js_free(ctx, s->atom_to_idx);
+    js_free(ctx, s->idx_to_atom);
+    js_free(ctx, s->base_ref_tab);
+    dbuf_free(&s->base_dbuf);
+}
+
+uint8_t *JS_WriteSnapshot(JSContext *ctx, size_t *psize)
+{
+    BCWriterState ss, *s = &ss;
+    JSSnapshotBase *base = ctx->snapshot_base;
+    DynBuf dbuf1;
+    int i;
+
+    *psize = 0;
+    if (!base) {
+        JS_ThrowTypeError(ctx, "no snapshot base");
+        return NULL;
+    }
+    if (JS_IsJobPending(ctx->rt)) {
+        JS_ThrowTypeError(ctx, "cannot snapshot a context with pending jobs");
+        return NULL;
+    }
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->allow_bytecode = TRUE;
+    s->allow_reference = TRUE;
+    s->first_atom = JS_ATOM_END;
+    s->snapshot = base;
+    js_dbuf_init(ctx, &s->dbuf);
+    js_dbuf_init(ctx, &s->base_dbuf);
+    js_object_list_init(&s->object_list);
+    js_object_list_init(&s->bytecode_list);
+    js_object_list_init(&s->var_ref_list);
+    s->base_ref_tab = js_malloc(ctx, sizeof(s->base_ref_tab[0]) *
+                                max_int(base->count, 1));
+    if (!s->base_ref_tab)
+        goto fail;
+    for(i = 0; i < base->count; i++)
+        s->base_ref_tab[i] = -1;
+
+    for(i = 0; i < base->count; i++) {
+        if (JS_WriteSnapshotPatch(s, i))
+            goto fail;
+    }
+    bc_put_leb128(s, 0);
+
+    /* the paths of the base objects are put before the patches */
+    dbuf1 = s->dbuf;
+    js_dbuf_init(ctx, &s->dbuf);
+    bc_put_leb128(s, s->base_ref_count);
+    dbuf_put(&s->dbuf, s->base_dbuf.buf, s->base_dbuf.size);
+    dbuf_put(&s->dbuf, dbuf1.buf, dbuf1.size);
+    dbuf_free(&dbuf1);
+    if (JS_WriteObjectAtoms(s))
+        goto fail;
+    js_snapshot_writer_free(s);
+    *psize = s->dbuf.size;
+    return s->dbuf.buf;
+ fail:
+    js_snapshot_writer_free(s);
+    dbuf_free(&s->dbuf);
+    return NULL;
+}
+
+static int JS_ReadSnapshotBase(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSPropertyDescriptor desc;
+    JSValue val;
+    JSObject *p;
+    uint32_t count, i, parent, root_idx, idx;
+    uint8_t edge;
+    JSAtom atom;
+    int ret;
+
+    if (bc_get_leb128(s, &count))
+        return -1;
+    if (count > s->buf_end - s->ptr)
+        return bc_read_error_end(s);
+    if (count == 0)
+        return 0;
+    s->base_tab = js_malloc(ctx, sizeof(s->base_tab[0]) * count);
+    if (!s->base_tab)
+        return -1;
+    for(i = 0; i < count; i++) {
+        if (bc_get_leb128(s, &parent))
+            return -1;
+        if (parent == 0) {
+            if (bc_get_leb128(s, &root_idx))
+                return -1;
+            val = JS_DupValue(ctx, js_snapshot_get_root(ctx, root_idx));
+        } else {
+            if (parent > i)
+                goto invalid;
+            p = JS_VALUE_GET_OBJ(s->base_tab[parent - 1]);
+            if (bc_get_u8(s, &edge))
+                return -1;
+            if (edge == JS_SNAPSHOT_EDGE_PROTO) {
+                if (p->shape->proto)
+                    val = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, p->shape->proto));
+                else
+                    val = JS_NULL;
+            } else if (edge >= JS_SNAPSHOT_EDGE_VALUE &&
+                       edge <= JS_SNAPSHOT_EDGE_SETTER) {
+                if (bc_get_atom(s, &atom))
+                    return -1;
+                ret = JS_GetOwnPropertyInternal(ctx, &desc, p, atom);
+                JS_FreeAtom(ctx, atom);
+                if (ret < 0)
+                    return -1;
+                val = JS_UNDEFINED;
+                if (ret) {
+                    if (edge == JS_SNAPSHOT_EDGE_VALUE) {
+                        val = desc.value;
+                        desc.value = JS_UNDEFINED;
+                    } else if (edge == JS_SNAPSHOT_EDGE_GETTER) {
+                        val = desc.getter;
+                        desc.getter = JS_UNDEFINED;
+                    } else {
+                        val = desc.setter;
+                        desc.setter = JS_UNDEFINED;
+                    }
+                    js_free_desc(ctx, &desc);
+                }
+            } else if (edge == JS_SNAPSHOT_EDGE_VAR_REF) {
+                if (bc_get_leb128(s, &idx))
+                    return -1;
+                val = JS_UNDEFINED;
+                if (js_class_has_bytecode(p->class_id) && p->u.func.var_refs &&
+                    idx < p->u.func.function_bytecode->closure_var_count &&
+                    p->u.func.var_refs[idx]) {
+                    val = JS_DupValue(ctx, *p->u.func.var_refs[idx]->pvalue);
+                }
+            } else {
+                goto invalid;
+            }
+        }
+        s->base_tab[s->base_count++] = val;
+        if (!JS_IsObject(val)) {
+            JS_ThrowSyntaxError(ctx, "the snapshot does not match the context");
+            return -1;
+        }
+    }
+    return 0;
+ invalid:
+    JS_ThrowSyntaxError(ctx, "invalid base object path");
+    return -1;
+}
+
+static int JS_ReadSnapshotProperties(BCReaderState *s, JSValueConst obj)
+{
+    JSContext *ctx = s->ctx;
+    JSValue val, getter, setter;
+    uint32_t count, i, flags;
+    JSAtom atom;
+    int ret;
+
+    if (bc_get_leb128(s, &count))
+        return -1;
+    for(i = 0; i < count; i++) {
+        if (bc_get_atom(s, &atom))
+            return -1;
+        if (bc_get_leb128(s, &flags)) {
+            JS_FreeAtom(ctx, atom);
+            return -1;
+        }
+        switch(flags & JS_PROP_TMASK) {
+        case JS_PROP_NORMAL:
+            val = JS_ReadObjectRec(s);
+            if (JS_IsException(val)) {
+                ret = -1;
+                break;
+            }
+            ret = JS_DefinePropertyValue(ctx, obj, atom, val,
+                                         (flags & JS_PROP_C_W_E) | JS_PROP_THROW);
+            break;
+        case JS_PROP_GETSET:
+            ret = -1;
+            getter = JS_ReadObjectRec(s);
+            if (JS_IsException(getter))
+                break;
+            setter = JS_ReadObjectRec(s);
+            if (JS_IsException(setter)) {
+                JS_FreeValue(ctx, getter);
+                break;
+            }
+            if ((!JS_IsUndefined(getter) && !JS_IsFunction(ctx, getter)) ||
+                (!JS_IsUndefined(setter) && !JS_IsFunction(ctx, setter))) {
+                JS_FreeValue(ctx, getter);
+                JS_FreeValue(ctx, setter);
+                JS_ThrowSyntaxError(ctx, "invalid accessor property");
+                break;
+            }
+            ret = JS_DefinePropertyGetSet(ctx, obj, atom, getter, setter,
+                                          (flags & (JS_PROP_CONFIGURABLE |
+                                                    JS_PROP_ENUMERABLE)) |
+                                          JS_PROP_THROW);
+            break;
+        case JS_PROP_AUTOINIT:
+            ret = JS_DeleteProperty(ctx, obj, atom, JS_PROP_THROW);
+            if (ret >= 0) {
+                ret = JS_DefineAutoInitProperty(ctx, obj, atom,
+                                                JS_AUTOINIT_ID_PROTOTYPE, NULL,
+                                                flags & JS_PROP_C_W_E);
+            }
+            break;
+        default:
+            JS_ThrowSyntaxError(ctx, "invalid property flags");
+            ret = -1;
+            break;
+        }
+        JS_FreeAtom(ctx, atom);
+        if (ret < 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int JS_ReadSnapshotElements(BCReaderState *s, JSValueConst obj)
+{
+    JSContext *ctx = s->ctx;
+    JSValue val;
+    uint32_t len, i;
+
+    if (bc_get_leb128(s, &len))
+        return -1;
+    for(i = 0; i < len; i++) {
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            return -1;
+        if (JS_DefinePropertyValueUint32(ctx, obj, i, val,
+                                         JS_PROP_C_W_E | JS_PROP_THROW) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+static JSVarRef *JS_ReadSnapshotVarRef(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSVarRef *var_ref;
+    JSValue val;
+    uint32_t idx;
+
+    if (bc_get_leb128(s, &idx))
+        return NULL;
+    if (idx < s->var_ref_count) {
+        var_ref = s->var_ref_tab[idx];
+        var_ref->header.ref_count++;
+        return var_ref;
+    }
+    if (idx != s->var_ref_count) {
+        JS_ThrowSyntaxError(ctx, "invalid closure variable reference");
+        return NULL;
+    }
+    if (js_resize_array(ctx, (void **)&s->var_ref_tab,
+                        sizeof(s->var_ref_tab[0]),
+                        &s->var_ref_size, s->var_ref_count + 1))
+        return NULL;
+    var_ref = js_create_module_var(ctx, FALSE);
+    if (!var_ref)
+        return NULL;
+    /* added before reading the value which may reference it */
+    s->var_ref_tab[s->var_ref_count++] = var_ref;
+    val = JS_ReadObjectRec(s);
+    if (JS_IsException(val))
+        return NULL;
+    var_ref->value = val;
+    var_ref->header.ref_count++;
+    return var_ref;
+}
+
+static int JS_ReadSnapshotFunction(BCReaderState *s, JSObject *p)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionBytecode *b;
+    JSValue val;
+    uint32_t idx;
+    int i;
+
+    if (bc_get_leb128(s, &idx))
+        return -1;
+    if (idx == s->bytecode_count) {
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            return -1;
+        if (JS_VALUE_GET_TAG(val) != JS_TAG_FUNCTION_BYTECODE) {
+            JS_FreeValue(ctx, val);
+            goto invalid;
+        }
+        if (js_resize_array(ctx, (void **)&s->bytecode_tab,
+                            sizeof(s->bytecode_tab[0]),
+                            &s->bytecode_size, s->bytecode_count + 1)) {
+            JS_FreeValue(ctx, val);
+            return -1;
+        }
+        s->bytecode_tab[s->bytecode_count++] = val;
+    } else if (idx > s->bytecode_count) {
+        goto invalid;
+    }
+    b = JS_VALUE_GET_PTR(s->bytecode_tab[idx]);
+    if (func_kind_to_class_id[b->func_kind] != p->class_id)
+        goto invalid;
+    p->u.func.function_bytecode = b;
+    b->header.ref_count++;
+    if (b->closure_var_count) {
+        p->u.func.var_refs = js_mallocz(ctx, sizeof(p->u.func.var_refs[0]) *
+                                        b->closure_var_count);
+        if (!p->u.func.var_refs)
+            return -1;
+        for(i = 0; i < b->closure_var_count; i++) {
+            p->u.func.var_refs[i] = JS_ReadSnapshotVarRef(s);
+            if (!p->u.func.var_refs[i])
+                return -1;
+        }
+    }
+    val = JS_ReadObjectRec(s);
+    if (JS_IsException(val))
+        return -1;
+    if (JS_IsObject(val)) {
+        p->u.func.home_object = JS_VALUE_GET_OBJ(val);
+    } else if (!JS_IsNull(val)) {
+        JS_FreeValue(ctx, val);
+        goto invalid;
+    }
+    return 0;
+ invalid:
+    JS_ThrowSyntaxError(ctx, "invalid function in snapshot");
+    return -1;
+}
+
+static JSValue JS_ReadSnapshotBoundFunction(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj, func_obj, this_val, val;
+    JSBoundFunction *bf;
+    uint32_t argc, i;
+
+    func_obj = JS_ReadObjectRec(s);
+    if (JS_IsException(func_obj))
+        return JS_EXCEPTION;
+    this_val = JS_ReadObjectRec(s);
+    if (JS_IsException(this_val))
+        goto fail;
+    if (!JS_IsFunction(ctx, func_obj)) {
+        JS_ThrowSyntaxError(ctx, "invalid bound function in snapshot");
+        goto fail;
+    }
+    if (bc_get_leb128(s, &argc))
+        goto fail;
+    if (argc > s->buf_end - s->ptr) {
+        bc_read_error_end(s);
+        goto fail;
+    }
+    bf = js_malloc(ctx, sizeof(*bf) + argc * sizeof(JSValue));
+    if (!bf)
+        goto fail;
+    bf->func_obj = func_obj;
+    bf->this_val = this_val;
+    bf->argc = 0;
+    for(i = 0; i < argc; i++) {
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            goto fail_bf;
+        bf->argv[bf->argc++] = val;
+    }
+    obj = JS_NewObjectProtoClass(ctx, ctx->function_proto,
+                                 JS_CLASS_BOUND_FUNCTION);
+    if (JS_IsException(obj))
+        goto fail_bf;
+    JS_VALUE_GET_OBJ(obj)->u.bound_function = bf;
+    return obj;
+ fail_bf:
+    for(i = 0; i < bf->argc; i++)
+        JS_FreeValue(ctx, bf->argv[i]);
+    js_free(ctx, bf);
+ fail:
+    JS_FreeValue(ctx, func_obj);
+    JS_FreeValue(ctx, this_val);
+    return JS_EXCEPTION;
+}
+
+static JSValue JS_ReadSnapshotObject(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj = JS_UNDEFINED, val, proto;
+    JSObject *p;
+    uint32_t class_id, idx, len, i;
+    uint8_t flags;
+    int ret;
+
+    if (bc_get_leb128(s, &class_id))
+        return JS_EXCEPTION;
+    /* the reference is set as soon as the object is created */
+    idx = s->objects_count;
+    if (BC_add_object_ref1(s, NULL))
+        return JS_EXCEPTION;
+    switch(class_id) {
+    case JS_CLASS_OBJECT:
+    case JS_CLASS_ERROR:
+        obj = JS_NewObjectClass(ctx, class_id);
+        if (JS_IsException(obj))
+            goto fail;
+        s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        break;
+    case JS_CLASS_ARRAY:
+        obj = JS_NewArray(ctx);
+        if (JS_IsException(obj))
+            goto fail;
+        s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        if (JS_ReadSnapshotElements(s, obj))
+            goto fail;
+        break;
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+        obj = JS_NewObjectClass(ctx, class_id);
+        if (JS_IsException(obj))
+            goto fail;
+        p = JS_VALUE_GET_OBJ(obj);
+        p->u.func.function_bytecode = NULL;
+        p->u.func.var_refs = NULL;
+        p->u.func.home_object = NULL;
+        s->objects[idx] = p;
+        if (JS_ReadSnapshotFunction(s, p))
+            goto fail;
+        break;
+    case JS_CLASS_BOUND_FUNCTION:
+        obj = JS_ReadSnapshotBoundFunction(s);
+        if (JS_IsException(obj))
+            goto fail;
+        s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        break;
+    case JS_CLASS_NUMBER:
+    case JS_CLASS_STRING:
+    case JS_CLASS_BOOLEAN:
+    case JS_CLASS_SYMBOL:
+    case JS_CLASS_DATE:
+    case JS_CLASS_BIG_INT:
+#ifdef CONFIG_BIGNUM
+    case JS_CLASS_BIG_FLOAT:
+    case JS_CLASS_BIG_DECIMAL:
+#endif
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            goto fail;
+        obj = JS_NewObjectClass(ctx, class_id);
+        if (JS_IsException(obj)) {
+            JS_FreeValue(ctx, val);
+            goto fail;
+        }
+        s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        if (JS_SetObjectData(ctx, obj, val))
+            goto fail;
+        break;
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+    case JS_CLASS_WEAKMAP:
+    case JS_CLASS_WEAKSET:
+        obj = js_map_constructor(ctx, JS_UNDEFINED, 0, NULL,
+                                 class_id - JS_CLASS_MAP);
+        if (JS_IsException(obj))
+            goto fail;
+        s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        if (bc_get_leb128(s, &len))
+            goto fail;
+        for(i = 0; i < len; i++) {
+            JSValue args[2];
+            args[0] = JS_ReadObjectRec(s);
+            if (JS_IsException(args[0]))
+                goto fail;
+            args[1] = JS_UNDEFINED;
+            if (!((class_id - JS_CLASS_MAP) & MAGIC_SET)) {
+                args[1] = JS_ReadObjectRec(s);
+                if (JS_IsException(args[1])) {
+                    JS_FreeValue(ctx, args[0]);
+                    goto fail;
+                }
+            }
+            val = js_map_set(ctx, obj, 2, (JSValueConst *)args,
+                             class_id - JS_CLASS_MAP);
+            JS_FreeValue(ctx, args[1]);
+            if ((class_id - JS_CLASS_MAP) & MAGIC_WEAK) {
+                /* the weak map does not hold a reference to its keys */
+                if (js_resize_array(ctx, (void **)&s->weak_key_tab,
+                                    sizeof(s->weak_key_tab[0]),
+                                    &s->weak_key_size,
+                                    s->weak_key_count + 1)) {
+                    JS_FreeValue(ctx, args[0]);
+                    JS_FreeValue(ctx, val);
+                    goto fail;
+                }
+                s->weak_key_tab[s->weak_key_count++] = args[0];
+            } else {
+                JS_FreeValue(ctx, args[0]);
+            }
+            if (JS_IsException(val))
+                goto fail;
+            JS_FreeValue(ctx, val);
+        }
+        break;
+    case JS_CLASS_REGEXP:
+        {
+            JSString *pattern, *bc;
+            pattern = JS_ReadString(s);
+            if (!pattern)
+                goto fail;
+            bc = JS_ReadString(s);
+            if (!bc) {
+                js_free_string(ctx->rt, pattern);
+                goto fail;
+            }
+            obj = js_regexp_constructor_internal(ctx, JS_UNDEFINED,
+                                                 JS_MKPTR(JS_TAG_STRING, pattern),
+                                                 JS_MKPTR(JS_TAG_STRING, bc));
+            if (JS_IsException(obj))
+                goto fail;
+            s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        }
+        break;
+    case JS_CLASS_DATAVIEW:
+        {
+            JSValue args[3];
+            uint32_t offset;
+
+            args[0] = JS_ReadObjectRec(s);
+            if (JS_IsException(args[0]))
+                goto fail;
+            if (bc_get_leb128(s, &offset) || bc_get_leb128(s, &len)) {
+                JS_FreeValue(ctx, args[0]);
+                goto fail;
+            }
+            args[1] = JS_NewUint32(ctx, offset);
+            args[2] = JS_NewUint32(ctx, len);
+            obj = js_dataview_constructor(ctx, JS_UNDEFINED, 3,
+                                          (JSValueConst *)args);
+            JS_FreeValue(ctx, args[0]);
+            if (JS_IsException(obj))
+                goto fail;
+            s->objects[idx] = JS_VALUE_GET_OBJ(obj);
+        }
+        break;
+    default:
+        JS_ThrowSyntaxError(ctx, "invalid object class in snapshot");
+        goto fail;
+    }
+
+    proto = JS_ReadObjectRec(s);
+    if (JS_IsException(proto))
+        goto fail;
+    if (!JS_IsObject(proto) && !JS_IsNull(proto)) {
+        JS_FreeValue(ctx, proto);
+        JS_ThrowSyntaxError(ctx, "invalid prototype");
+        goto fail;
+    }
+    ret = JS_SetPrototypeInternal(ctx, obj, proto, TRUE);
+    JS_FreeValue(ctx, proto);
+    if (ret < 0)
+        goto fail;
+    if (JS_ReadSnapshotProperties(s, obj))
+        goto fail;
+    if (bc_get_u8(s, &flags))
+        goto fail;
+    p = JS_VALUE_GET_OBJ(obj);
+    p->is_constructor = (flags >> 1) & 1;
+    if (!(flags & 1))
+        JS_PreventExtensions(ctx, obj);
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static int JS_ReadSnapshotPatch(BCReaderState *s, JSValueConst obj)
+{
+    JSContext *ctx = s->ctx;
+    JSValue proto;
+    uint32_t count, i;
+    uint8_t flags;
+    JSAtom atom;
+    int ret;
+
+    if (bc_get_u8(s, &flags))
+        return -1;
+    if (flags & JS_SNAPSHOT_PATCH_PROTO) {
+        proto = JS_ReadObjectRec(s);
+        if (JS_IsException(proto))
+            return -1;
+        if (!JS_IsObject(proto) && !JS_IsNull(proto)) {
+            JS_FreeValue(ctx, proto);
+            JS_ThrowSyntaxError(ctx, "invalid prototype");
+            return -1;
+        }
+        ret = JS_SetPrototypeInternal(ctx, obj, proto, TRUE);
+        JS_FreeValue(ctx, proto);
+        if (ret < 0)
+            return -1;
+    }
+    if (flags & JS_SNAPSHOT_PATCH_ELEMENTS) {
+        if (JS_SetProperty(ctx, obj, JS_ATOM_length, JS_NewInt32(ctx, 0)) < 0)
+            return -1;
+        if (JS_ReadSnapshotElements(s, obj))
+            return -1;
+    }
+    if (bc_get_leb128(s, &count))
+        return -1;
+    for(i = 0; i < count; i++) {
+        if (bc_get_atom(s, &atom))
+            return -1;
+        ret = JS_DeleteProperty(ctx, obj, atom, JS_PROP_THROW);
+        JS_FreeAtom(ctx, atom);
+        if (ret < 0)
+            return -1;
+    }
+    if (JS_ReadSnapshotProperties(s, obj))
+        return -1;
+    if (flags & JS_SNAPSHOT_PATCH_EXTENSIBLE) {
+        if (JS_PreventExtensions(ctx, obj) < 0)
+            return -1;
     }
+    return 0;
 }
 
-static void js_map_mark(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func)
+int JS_ReadSnapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len)
 {
-    JSObject *p = JS_VALUE_GET_OBJ(val);
-    JSMapState *s;
-    struct list_head *el;
-    JSMapRecord *mr;
+    BCReaderState ss, *s = &ss;
+    uint32_t idx;
+    int ret;
 
-    s = p->u.map_state;
-    if (s) {
-        list_for_each(el, &s->records) {
-            mr = list_entry(el, JSMapRecord, link);
-            if (!s->is_weak)
-                JS_MarkValue(rt, mr->key, mark_func);
-            JS_MarkValue(rt, mr->value, mark_func);
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->buf_start = buf;
+    s->buf_end = buf + buf_len;
+    s->ptr = buf;
+    s->allow_bytecode = TRUE;
+    s->allow_reference = TRUE;
+    s->is_snapshot = TRUE;
+    s->first_atom = JS_ATOM_END;
+    ret = -1;
+    if (JS_ReadObjectAtoms(s))
+        goto done;
+    if (JS_ReadSnapshotBase(s))
+        goto done;
+    for(;;) {
+        if (bc_get_leb128(s, &idx))
+            goto done;
+        if (idx == 0)
+            break;
+        if (idx > s->base_count) {
+            JS_ThrowSyntaxError(ctx, "invalid base object reference");
+            goto done;
         }
+        if (JS_ReadSnapshotPatch(s, s->base_tab[idx - 1]))
+            goto done;
     }
+    ret = 0;
+ done:
+    bc_reader_free(s);
+    return ret;
 }
 
-/* Map Iterator */
-
-typedef struct JSMapIteratorData {
-    JSValue obj;
-    JSIteratorKindEnum kind;
-    JSMapRecord *cur_record;
-} JSMapIteratorData;
+/* Context reset */
 
-static void js_map_iterator_finalizer(JSRuntime *rt, JSValue val)
+/* Rebuild the properties of the base object 'e' from the recorded
+   state. Used when properties were added, deleted or reconfigured. */
+static int js_reset_object_props(JSContext *ctx, JSSnapshotBaseEntry *e)
 {
-    JSObject *p;
-    JSMapIteratorData *it;
+    JSRuntime *rt = ctx->rt;
+    JSObject *p = e->obj;
+    JSShape *sh, *new_sh;
+    JSShapeProperty *prs;
+    JSProperty *pr, *old_prop;
+    JSSnapshotProp *sp;
+    int i;
 
-    p = JS_VALUE_GET_OBJ(val);
-    it = p->u.map_iterator_data;
-    if (it) {
-        /* During the GC sweep phase the Map finalizer may be
-           called before the Map iterator finalizer */
-        if (JS_IsLiveObject(rt, it->obj) && it->cur_record) {
-            map_decref_record(rt, it->cur_record);
-        }
-        JS_FreeValueRT(rt, it->obj);
-        js_free_rt(rt, it);
+    new_sh = find_hashed_shape_proto(rt, e->proto);
+    if (new_sh) {
+        new_sh = js_dup_shape(new_sh);
+    } else {
+        new_sh = js_new_shape(ctx, e->proto);
+        if (!new_sh)
+            return -1;
     }
-}
+    pr = js_malloc(ctx, sizeof(pr[0]) * new_sh->prop_size);
+    if (!pr) {
+        js_free_shape(rt, new_sh);
+        return -1;
+    }
+    /* the old properties are freed once the object is consistent */
+    sh = p->shape;
+    old_prop = p->prop;
+    p->shape = new_sh;
+    p->prop = pr;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++)
+        free_property(rt, &old_prop[i], prs->flags);
+    js_free(ctx, old_prop);
+    js_free_shape(rt, sh);
 
-static void js_map_iterator_mark(JSRuntime *rt, JSValueConst val,
-                                 JS_MarkFunc *mark_func)
-{
-    JSObject *p = JS_VALUE_GET_OBJ(val);
-    JSMapIteratorData *it;
-    it = p->u.map_iterator_data;
-    if (it) {
-        /* the record is already marked by the object */
-        JS_MarkValue(rt, it->obj, mark_func);
+    for(i = 0; i < e->prop_count; i++) {
+        sp = &e->props[i];
+        pr = add_property(ctx, p, sp->atom, sp->flags);
+        if (!pr)
+            return -1;
+        js_snapshot_dup_prop(ctx, pr, &sp->pr, sp->flags);
     }
+    return 0;
 }
 
-static JSValue js_create_map_iterator(JSContext *ctx, JSValueConst this_val,
-                                      int argc, JSValueConst *argv, int magic)
+/* restore the fast array elements of the base object 'e' */
+static int js_reset_array(JSContext *ctx, JSSnapshotBaseEntry *e)
 {
-    JSIteratorKindEnum kind;
-    JSMapState *s;
-    JSMapIteratorData *it;
-    JSValue enum_obj;
+    JSObject *p = e->obj;
+    JSValue *tab, *old_tab;
+    uint32_t i, old_count;
 
-    kind = magic >> 2;
-    magic &= 3;
-    s = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP + magic);
-    if (!s)
-        return JS_EXCEPTION;
-    enum_obj = JS_NewObjectClass(ctx, JS_CLASS_MAP_ITERATOR + magic);
-    if (JS_IsException(enum_obj))
-        goto fail;
-    it = js_malloc(ctx, sizeof(*it));
-    if (!it) {
-        JS_FreeValue(ctx, enum_obj);
-        goto fail;
+    if (p->fast_array && p->u.array.count == e->array_count) {
+        for(i = 0; i < e->array_count; i++) {
+            if (!js_snapshot_same_value(ctx, p->u.array.u.values[i],
+                                        e->array_values[i])) {
+                set_value(ctx, &p->u.array.u.values[i],
+                          JS_DupValue(ctx, e->array_values[i]));
+            }
+        }
+        return 0;
     }
-    it->obj = JS_DupValue(ctx, this_val);
-    it->kind = kind;
-    it->cur_record = NULL;
-    JS_SetOpaque(enum_obj, it);
-    return enum_obj;
- fail:
-    return JS_EXCEPTION;
+    tab = NULL;
+    if (e->array_count != 0) {
+        tab = js_malloc(ctx, sizeof(tab[0]) * e->array_count);
+        if (!tab)
+            return -1;
+        for(i = 0; i < e->array_count; i++)
+            tab[i] = JS_DupValue(ctx, e->array_values[i]);
+    }
+    old_tab = NULL;
+    old_count = 0;
+    if (p->fast_array) {
+        old_tab = p->u.array.u.values;
+        old_count = p->u.array.count;
+    }
+    /* the array elements were converted to properties which were
+       removed by js_reset_object_props() */
+    p->fast_array = TRUE;
+    p->u.array.u.values = tab;
+    p->u.array.u1.size = e->array_count;
+    p->u.array.count = e->array_count;
+    for(i = 0; i < old_count; i++)
+        JS_FreeValue(ctx, old_tab[i]);
+    js_free(ctx, old_tab);
+    return 0;
 }
 
-static JSValue js_map_iterator_next(JSContext *ctx, JSValueConst this_val,
-                                    int argc, JSValueConst *argv,
-                                    BOOL *pdone, int magic)
+/* restore the records of the base Map, Set, WeakMap or WeakSet 'e' */
+static int js_reset_map(JSContext *ctx, JSSnapshotBaseEntry *e)
 {
-    JSMapIteratorData *it;
-    JSMapState *s;
+    JSMapState *s = e->obj->u.map_state;
     JSMapRecord *mr;
-    struct list_head *el;
+    JSValue *tab = e->map_values;
+    uint32_t i, j;
+
+    if (s->record_count == e->map_count) {
+        j = 0;
+        for(i = 0; i < s->record_end; i++) {
+            mr = &s->records[i];
+            if (map_record_is_deleted(mr))
+                continue;
+            if (!js_snapshot_same_value(ctx, mr->key, tab[2 * j]) ||
+                !js_snapshot_same_value(ctx, mr->value, tab[2 * j + 1]))
+                break;
+            j++;
+        }
+        if (i == s->record_end)
+            return 0;
+    }
+    /* rebuild the records so that the insertion order is restored */
+    for(i = 0; i < s->record_end; i++)
+        map_delete_record(ctx->rt, s, &s->records[i]);
+    if (map_resize(ctx, s, max_int(4, e->map_count)))
+        return -1;
+    for(i = 0; i < e->map_count; i++) {
+        mr = map_add_record(ctx, s, tab[2 * i]);
+        if (!mr)
+            return -1;
+        mr->value = JS_DupValue(ctx, tab[2 * i + 1]);
+    }
+    return 0;
+}
 
-    it = JS_GetOpaque2(ctx, this_val, JS_CLASS_MAP_ITERATOR + magic);
-    if (!it) {
-        *pdone = FALSE;
-        return JS_EXCEPTION;
+/* restore the internal state recorded by
+   js_snapshot_record_internal_state() */
+static int js_reset_internal_state(JSContext *ctx, JSSnapshotBaseEntry *e)
+{
+    JSObject *p = e->obj;
+    JSArrayBuffer *abuf;
+    JSTypedArray *ta;
+    uint8_t *ptr;
+
+    switch(p->class_id) {
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+    case JS_CLASS_WEAKMAP:
+    case JS_CLASS_WEAKSET:
+        return js_reset_map(ctx, e);
+    case JS_CLASS_DATE:
+        if (!js_snapshot_same_value(ctx, p->u.object_data, e->object_data)) {
+            set_value(ctx, &p->u.object_data,
+                      JS_DupValue(ctx, e->object_data));
+        }
+        return 0;
+    default:
+        break;
     }
-    if (JS_IsUndefined(it->obj))
-        goto done;
-    s = JS_GetOpaque(it->obj, JS_CLASS_MAP + magic);
-    assert(s != NULL);
-    if (!it->cur_record) {
-        el = s->records.next;
+    if (!e->has_data)
+        return 0;
+    if (p->class_id == JS_CLASS_ARRAY_BUFFER) {
+        abuf = p->u.array_buffer;
+        ptr = abuf->data;
     } else {
-        mr = it->cur_record;
-        el = mr->link.next;
-        map_decref_record(ctx->rt, mr); /* the record can be freed here */
+        ta = p->u.typed_array;
+        abuf = ta->buffer->u.array_buffer;
+        ptr = abuf->data + ta->offset;
     }
-    for(;;) {
-        if (el == &s->records) {
-            /* no more record  */
-            it->cur_record = NULL;
-            JS_FreeValue(ctx, it->obj);
-            it->obj = JS_UNDEFINED;
-        done:
-            /* end of enumeration */
-            *pdone = TRUE;
-            return JS_UNDEFINED;
-        }
-        mr = list_entry(el, JSMapRecord, link);
-        if (!mr->empty)
-            break;
-        /* get the next record */
-        el = mr->link.next;
+    /* the contents of a detached buffer cannot be restored */
+    if (abuf->detached) {
+        JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+        return -1;
     }
+    if (e->data_len != 0)
+        memcpy(ptr, e->data, e->data_len);
+    return 0;
+}
 
-    /* lock the record so that it won't be freed */
-    mr->ref_count++;
-    it->cur_record = mr;
-    *pdone = FALSE;
+/* restore the base object 'e' to its recorded state. Only the
+   modified properties are touched. */
+static int js_reset_object(JSContext *ctx, JSSnapshotBaseEntry *e)
+{
+    JSObject *p = e->obj;
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSSnapshotProp *sp;
+    JSVarRef *var_ref;
+    int i, j;
 
-    if (it->kind == JS_ITERATOR_KIND_KEY) {
-        return JS_DupValue(ctx, mr->key);
-    } else {
-        JSValueConst args[2];
-        args[0] = mr->key;
-        if (magic)
-            args[1] = mr->key;
-        else
-            args[1] = mr->value;
-        if (it->kind == JS_ITERATOR_KIND_VALUE) {
-            return JS_DupValue(ctx, args[1]);
-        } else {
-            return js_create_array(ctx, 2, args);
+    p->extensible = e->extensible;
+    if (sh->proto != e->proto)
+        goto rebuild;
+    for(i = 0, j = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom == JS_ATOM_NULL)
+            continue;
+        if (j >= e->prop_count)
+            goto rebuild;
+        sp = &e->props[j++];
+        if (sp->atom != prs->atom || sp->flags != prs->flags)
+            goto rebuild;
+        pr = &p->prop[i];
+        if (js_snapshot_prop_changed(ctx, sp, prs, pr)) {
+            /* same property type: only the value changed */
+            free_property(ctx->rt, pr, prs->flags);
+            js_snapshot_dup_prop(ctx, pr, &sp->pr, prs->flags);
+        }
+    }
+    if (j != e->prop_count) {
+    rebuild:
+        if (js_reset_object_props(ctx, e))
+            return -1;
+    }
+    if (e->is_fast_array) {
+        if (js_reset_array(ctx, e))
+            return -1;
+    }
+    if (js_reset_internal_state(ctx, e))
+        return -1;
+    /* the closure variables of a base function are restored in place
+       because they may be shared with other closures */
+    for(i = 0; i < e->var_ref_count; i++) {
+        var_ref = p->u.func.var_refs[i];
+        if (var_ref && !js_snapshot_same_value(ctx, *var_ref->pvalue,
+                                               e->var_ref_values[i])) {
+            set_value(ctx, var_ref->pvalue,
+                      JS_DupValue(ctx, e->var_ref_values[i]));
         }
     }
+    return 0;
 }
 
-static const JSCFunctionListEntry js_map_funcs[] = {
-    JS_CFUNC_MAGIC_DEF("groupBy", 2, js_object_groupBy, 1 ),
-    JS_CGETSET_DEF("[Symbol.species]", js_get_this, NULL ),
-};
-
-static const JSCFunctionListEntry js_map_proto_funcs[] = {
-    JS_CFUNC_MAGIC_DEF("set", 2, js_map_set, 0 ),
-    JS_CFUNC_MAGIC_DEF("get", 1, js_map_get, 0 ),
-    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, 0 ),
-    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, 0 ),
-    JS_CFUNC_MAGIC_DEF("clear", 0, js_map_clear, 0 ),
-    JS_CGETSET_MAGIC_DEF("size", js_map_get_size, NULL, 0),
-    JS_CFUNC_MAGIC_DEF("forEach", 1, js_map_forEach, 0 ),
-    JS_CFUNC_MAGIC_DEF("values", 0, js_create_map_iterator, (JS_ITERATOR_KIND_VALUE << 2) | 0 ),
-    JS_CFUNC_MAGIC_DEF("keys", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY << 2) | 0 ),
-    JS_CFUNC_MAGIC_DEF("entries", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY_AND_VALUE << 2) | 0 ),
-    JS_ALIAS_DEF("[Symbol.iterator]", "entries" ),
-    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Map", JS_PROP_CONFIGURABLE ),
-};
-
-static const JSCFunctionListEntry js_map_iterator_proto_funcs[] = {
-    JS_ITERATOR_NEXT_DEF("next", 0, js_map_iterator_next, 0 ),
-    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Map Iterator", JS_PROP_CONFIGURABLE ),
-};
-
-static const JSCFunctionListEntry js_set_proto_funcs[] = {
-    JS_CFUNC_MAGIC_DEF("add", 1, js_map_set, MAGIC_SET ),
-    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, MAGIC_SET ),
-    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, MAGIC_SET ),
-    JS_CFUNC_MAGIC_DEF("clear", 0, js_map_clear, MAGIC_SET ),
-    JS_CGETSET_MAGIC_DEF("size", js_map_get_size, NULL, MAGIC_SET ),
-    JS_CFUNC_MAGIC_DEF("forEach", 1, js_map_forEach, MAGIC_SET ),
-    JS_CFUNC_MAGIC_DEF("values", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY << 2) | MAGIC_SET ),
-    JS_ALIAS_DEF("keys", "values" ),
-    JS_ALIAS_DEF("[Symbol.iterator]", "values" ),
-    JS_CFUNC_MAGIC_DEF("entries", 0, js_create_map_iterator, (JS_ITERATOR_KIND_KEY_AND_VALUE << 2) | MAGIC_SET ),
-    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Set", JS_PROP_CONFIGURABLE ),
-};
-
-static const JSCFunctionListEntry js_set_iterator_proto_funcs[] = {
-    JS_ITERATOR_NEXT_DEF("next", 0, js_map_iterator_next, MAGIC_SET ),
-    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "Set Iterator", JS_PROP_CONFIGURABLE ),
-};
-
-static const JSCFunctionListEntry js_weak_map_proto_funcs[] = {
-    JS_CFUNC_MAGIC_DEF("set", 2, js_map_set, MAGIC_WEAK ),
-    JS_CFUNC_MAGIC_DEF("get", 1, js_map_get, MAGIC_WEAK ),
-    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, MAGIC_WEAK ),
-    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, MAGIC_WEAK ),
-    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "WeakMap", JS_PROP_CONFIGURABLE ),
-};
-
-static const JSCFunctionListEntry js_weak_set_proto_funcs[] = {
-    JS_CFUNC_MAGIC_DEF("add", 1, js_map_set, MAGIC_SET | MAGIC_WEAK ),
-    JS_CFUNC_MAGIC_DEF("has", 1, js_map_has, MAGIC_SET | MAGIC_WEAK ),
-    JS_CFUNC_MAGIC_DEF("delete", 1, js_map_delete, MAGIC_SET | MAGIC_WEAK ),
-    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "WeakSet", JS_PROP_CONFIGURABLE ),
-};
-
-static const JSCFunctionListEntry * const js_map_proto_funcs_ptr[6] = {
-    js_map_proto_funcs,
-    js_set_proto_funcs,
-    js_weak_map_proto_funcs,
-    js_weak_set_proto_funcs,
-    js_map_iterator_proto_funcs,
-    js_set_iterator_proto_funcs,
-};
-
-static const uint8_t js_map_proto_funcs_count[6] = {
-    countof(js_map_proto_funcs),
-    countof(js_set_proto_funcs),
-    countof(js_weak_map_proto_funcs),
-    countof(js_weak_set_proto_funcs),
-    countof(js_map_iterator_proto_funcs),
-    countof(js_set_iterator_proto_funcs),
-};
-
-void JS_AddIntrinsicMapSet(JSContext *ctx)
+int JS_ResetContext(JSContext *ctx)
 {
+    JSRuntime *rt = ctx->rt;
+    JSSnapshotBase *base = ctx->snapshot_base;
+    struct list_head *el, *el1;
+    JSJobEntry *job;
     int i;
-    JSValue obj1;
-    char buf[ATOM_GET_STR_BUF_SIZE];
 
-    for(i = 0; i < 4; i++) {
-        const char *name = JS_AtomGetStr(ctx, buf, sizeof(buf),
-                                         JS_ATOM_Map + i);
-        ctx->class_proto[JS_CLASS_MAP + i] = JS_NewObject(ctx);
-        JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_MAP + i],
-                                   js_map_proto_funcs_ptr[i],
-                                   js_map_proto_funcs_count[i]);
-        obj1 = JS_NewCFunctionMagic(ctx, js_map_constructor, name, 0,
-                                    JS_CFUNC_constructor_magic, i);
-        if (i < 2) {
-            JS_SetPropertyFunctionList(ctx, obj1, js_map_funcs,
-                                       countof(js_map_funcs));
-        }
-        JS_NewGlobalCConstructor2(ctx, obj1, name, ctx->class_proto[JS_CLASS_MAP + i]);
+    if (!base) {
+        JS_ThrowTypeError(ctx, "no snapshot base");
+        return -1;
+    }
+    if (rt->current_stack_frame) {
+        JS_ThrowTypeError(ctx, "cannot reset a running context");
+        return -1;
     }
+    JS_FreeValue(ctx, JS_GetException(ctx));
 
-    for(i = 0; i < 2; i++) {
-        ctx->class_proto[JS_CLASS_MAP_ITERATOR + i] =
-            JS_NewObjectProto(ctx, ctx->iterator_proto);
-        JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_MAP_ITERATOR + i],
-                                   js_map_proto_funcs_ptr[i + 4],
-                                   js_map_proto_funcs_count[i + 4]);
+    /* remove the pending jobs of the context */
+    list_for_each_safe(el, el1, &rt->job_list) {
+        job = list_entry(el, JSJobEntry, link);
+        if (job->ctx != ctx)
+            continue;
+        list_del(&job->link);
+        if (job->async_func)
+            async_func_free(rt, job->async_func);
+        for(i = 0; i < job->argc; i++)
+            JS_FreeValue(ctx, job->argv[i]);
+        js_free_job(rt, job);
+    }
+
+    for(i = 0; i < base->count; i++) {
+        if (js_reset_object(ctx, &base->tab[i]))
+            return -1;
     }
+
+    /* free the modules loaded after the base was recorded */
+    i = 0;
+    list_for_each_safe(el, el1, &ctx->loaded_modules) {
+        if (i++ >= base->module_count)
+            js_free_module_def(ctx, list_entry(el, JSModuleDef, link));
+    }
+
+    /* the objects created since the base are now only referenced by
+       cycles. Most of them are in the young generation, the other ones
+       are collected by the next full collection. */
+    JS_RunGCStep(rt, 0);
+    return 0;
 }
 
 /* Generator */
@@ -48751,6 +56405,67 @@ static __exception int perform_promise_then(JSContext *ctx,
     return 0;
 }
 
+/* Fast path of 'await value' when 'value' is not an object or is a
+   settled promise whose 'constructor' is the original one. The result
+   is the same as js_promise_resolve() followed by
+   perform_promise_then(), but the async function is directly resumed
+   by a job, so no promise, resolving functions or reaction records are
+   allocated. Return 0 if OK, 1 if the fast path does not apply or -1
+   if exception. */
+static int js_async_function_await_fast(JSContext *ctx,
+                                        JSAsyncFunctionState *s,
+                                        JSValueConst value)
+{
+    JSRuntime *rt = ctx->rt;
+    JSObject *p;
+    JSPromiseData *pd;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSJobEntry *e;
+    JSValueConst result;
+    BOOL is_reject;
+
+    if (JS_VALUE_GET_TAG(value) != JS_TAG_OBJECT) {
+        result = value;
+        is_reject = FALSE;
+    } else {
+        p = JS_VALUE_GET_OBJ(value);
+        if (p->class_id != JS_CLASS_PROMISE)
+            return 1;
+        pd = p->u.promise_data;
+        if (!pd || pd->promise_state == JS_PROMISE_PENDING)
+            return 1;
+        /* the 'constructor' property must be the one of
+           Promise.prototype so that getting it has no side effect */
+        if (p->shape->proto != JS_VALUE_GET_OBJ(ctx->class_proto[JS_CLASS_PROMISE]) ||
+            find_own_property(&pr, p, JS_ATOM_constructor))
+            return 1;
+        prs = find_own_property(&pr, p->shape->proto, JS_ATOM_constructor);
+        if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+            !js_same_value(ctx, pr->u.value, ctx->promise_ctor))
+            return 1;
+        result = pd->promise_result;
+        is_reject = (pd->promise_state == JS_PROMISE_REJECTED);
+        if (is_reject && !pd->is_handled && rt->host_promise_rejection_tracker) {
+            rt->host_promise_rejection_tracker(ctx, value, result, TRUE,
+                                               rt->host_promise_rejection_tracker_opaque);
+        }
+        pd->is_handled = TRUE;
+    }
+    e = js_alloc_job(ctx, 2);
+    if (!e)
+        return -1;
+    e->ctx = ctx;
+    e->job_func = NULL;
+    e->async_func = s;
+    s->header.ref_count++;
+    e->argc = 2;
+    e->argv[0] = JS_DupValue(ctx, result);
+    e->argv[1] = JS_NewBool(ctx, is_reject);
+    list_add_tail(&e->link, &rt->job_list);
+    return 0;
+}
+
 static JSValue js_promise_then(JSContext *ctx, JSValueConst this_val,
                                int argc, JSValueConst *argv)
 {
@@ -50995,6 +58710,7 @@ static JSValue JS_ToBigIntCtorFree(JSContext *ctx, JSValue val)
         goto redo;
 #endif
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_StringToBigIntErr(ctx, val);
         break;
     case JS_TAG_OBJECT:
@@ -51555,6 +59271,7 @@ static JSValue js_bigfloat_constructor(JSContext *ctx,
                 break;
             goto redo;
         case JS_TAG_STRING:
+        case JS_TAG_STRING_ROPE:
             {
                 const char *str, *p;
                 size_t len;
@@ -52243,6 +59960,7 @@ static JSValue JS_ToBigDecimalFree(JSContext *ctx, JSValue val,
             break;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             const char *str, *p;
             size_t len;
@@ -53168,15 +60886,11 @@ static JSValue js_array_buffer_get_byteLength(JSContext *ctx,
     return JS_NewUint32(ctx, abuf->byte_length);
 }
 
-void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
+/* detach 'abuf' without freeing its data */
+static void array_buffer_detach(JSArrayBuffer *abuf)
 {
-    JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
     struct list_head *el;
 
-    if (!abuf || abuf->detached)
-        return;
-    if (abuf->free_func)
-        abuf->free_func(ctx->rt, abuf->opaque, abuf->data);
     abuf->data = NULL;
     abuf->byte_length = 0;
     abuf->detached = TRUE;
@@ -53195,6 +60909,64 @@ void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
     }
 }
 
+void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
+{
+    JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
+
+    if (!abuf || abuf->detached)
+        return;
+    if (abuf->free_func)
+        abuf->free_func(ctx->rt, abuf->opaque, abuf->data);
+    array_buffer_detach(abuf);
+}
+
+/* Detach the ArrayBuffers of 'transfer_list' and store their data in
+   'transfer_data'. The data is not copied when it comes from the
+   default allocator or from a previous transfer. The ArrayBuffers
+   must have been checked by the caller. Return -1 if exception (the
+   ArrayBuffers are then left untouched). */
+static int js_array_buffer_transfer(JSContext *ctx, JSValueConst *transfer_list,
+                                    uint8_t **transfer_data, int transfer_len)
+{
+    JSRuntime *rt = ctx->rt;
+    JSArrayBuffer *abuf;
+    int i;
+
+    /* first do the copies so that nothing is detached if an
+       allocation fails */
+    for(i = 0; i < transfer_len; i++) {
+        abuf = JS_GetOpaque(transfer_list[i], JS_CLASS_ARRAY_BUFFER);
+        transfer_data[i] = NULL;
+        if (abuf->free_func == js_array_buffer_free_transferred ||
+            (abuf->free_func == js_array_buffer_free &&
+             rt->mf.js_free == js_def_free))
+            continue;
+        transfer_data[i] = js_transfer_data_get(rt, abuf->data,
+                                                abuf->byte_length, TRUE);
+        if (!transfer_data[i]) {
+            while (--i >= 0) {
+                js_array_buffer_free_transferred(rt, NULL, transfer_data[i]);
+            }
+            JS_ThrowOutOfMemory(ctx);
+            return -1;
+        }
+    }
+    for(i = 0; i < transfer_len; i++) {
+        abuf = JS_GetOpaque(transfer_list[i], JS_CLASS_ARRAY_BUFFER);
+        if (transfer_data[i]) {
+            if (abuf->free_func)
+                abuf->free_func(rt, abuf->opaque, abuf->data);
+        } else if (abuf->free_func == js_array_buffer_free) {
+            transfer_data[i] = js_transfer_data_get(rt, abuf->data,
+                                                    abuf->byte_length, FALSE);
+        } else {
+            transfer_data[i] = abuf->data;
+        }
+        array_buffer_detach(abuf);
+    }
+    return 0;
+}
+
 /* get an ArrayBuffer or SharedArrayBuffer */
 static JSArrayBuffer *js_get_array_buffer(JSContext *ctx, JSValueConst obj)
 {
@@ -53478,6 +61250,101 @@ static JSValue js_typed_array_get_toStringTag(JSContext *ctx,
     return JS_AtomToString(ctx, ctx->rt->class_array[p->class_id].class_name);
 }
 
+static inline BOOL is_bigint_typed_array(int class_id)
+{
+    return class_id == JS_CLASS_BIG_INT64_ARRAY ||
+        class_id == JS_CLASS_BIG_UINT64_ARRAY;
+}
+
+/* number of elements converted at once by js_typed_array_convert() */
+#define TA_CONVERT_BLOCK_LEN 256
+
+/* Convert 'len' elements of the non BigInt typed array class
+   'src_class_id' to the class 'dst_class_id'. The buffers must not
+   overlap. Each block of elements is first converted to double so
+   that both loops are simple enough to be vectorized. */
+static void js_typed_array_convert(int dst_class_id, void *dst,
+                                   int src_class_id, const void *src,
+                                   size_t len)
+{
+    double buf[TA_CONVERT_BLOCK_LEN];
+    size_t pos, n, i;
+
+    for(pos = 0; pos < len; pos += n) {
+        n = len - pos;
+        if (n > TA_CONVERT_BLOCK_LEN)
+            n = TA_CONVERT_BLOCK_LEN;
+        switch(src_class_id) {
+        case JS_CLASS_INT8_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const int8_t *)src)[pos + i];
+            break;
+        case JS_CLASS_UINT8C_ARRAY:
+        case JS_CLASS_UINT8_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const uint8_t *)src)[pos + i];
+            break;
+        case JS_CLASS_INT16_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const int16_t *)src)[pos + i];
+            break;
+        case JS_CLASS_UINT16_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const uint16_t *)src)[pos + i];
+            break;
+        case JS_CLASS_INT32_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const int32_t *)src)[pos + i];
+            break;
+        case JS_CLASS_UINT32_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const uint32_t *)src)[pos + i];
+            break;
+        case JS_CLASS_FLOAT32_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const float *)src)[pos + i];
+            break;
+        case JS_CLASS_FLOAT64_ARRAY:
+            for(i = 0; i < n; i++)
+                buf[i] = ((const double *)src)[pos + i];
+            break;
+        default:
+            abort();
+        }
+        switch(dst_class_id) {
+        case JS_CLASS_UINT8C_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint8_t *)dst)[pos + i] = js_double_to_uint8_clamp(buf[i]);
+            break;
+        case JS_CLASS_INT8_ARRAY:
+        case JS_CLASS_UINT8_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint8_t *)dst)[pos + i] = js_double_to_int32(buf[i]);
+            break;
+        case JS_CLASS_INT16_ARRAY:
+        case JS_CLASS_UINT16_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint16_t *)dst)[pos + i] = js_double_to_int32(buf[i]);
+            break;
+        case JS_CLASS_INT32_ARRAY:
+        case JS_CLASS_UINT32_ARRAY:
+            for(i = 0; i < n; i++)
+                ((uint32_t *)dst)[pos + i] = js_double_to_int32(buf[i]);
+            break;
+        case JS_CLASS_FLOAT32_ARRAY:
+            for(i = 0; i < n; i++)
+                ((float *)dst)[pos + i] = buf[i];
+            break;
+        case JS_CLASS_FLOAT64_ARRAY:
+            for(i = 0; i < n; i++)
+                ((double *)dst)[pos + i] = buf[i];
+            break;
+        default:
+            abort();
+        }
+    }
+}
+
 static JSValue js_typed_array_set_internal(JSContext *ctx,
                                            JSValueConst dst,
                                            JSValueConst src,
@@ -53521,17 +61388,38 @@ static JSValue js_typed_array_set_internal(JSContext *ctx,
             goto range_error;
 
         /* copying between typed objects */
-        if (src_p->class_id == p->class_id) {
-            /* same type, use memmove */
+        if (src_p->class_id == p->class_id ||
+            (is_bigint_typed_array(src_p->class_id) &&
+             is_bigint_typed_array(p->class_id))) {
+            /* same type or same representation, use memmove */
             memmove(dest_abuf->data + dest_ta->offset + (offset << shift),
                     src_abuf->data + src_ta->offset, src_len << shift);
             goto done;
         }
-        if (dest_abuf->data == src_abuf->data) {
-            /* copying between the same buffer using different types of mappings
-               would require a temporary buffer */
+        if (!is_bigint_typed_array(src_p->class_id) &&
+            !is_bigint_typed_array(p->class_id)) {
+            const uint8_t *src_ptr = src_abuf->data + src_ta->offset;
+            uint8_t *src_tmp = NULL;
+            if (src_len == 0)
+                goto done;
+            if (dest_abuf->data == src_abuf->data) {
+                /* copying between the same buffer using different
+                   types of mappings requires a temporary buffer */
+                size_t src_size = src_len << typed_array_size_log2(src_p->class_id);
+                src_tmp = js_malloc(ctx, src_size);
+                if (!src_tmp)
+                    goto fail;
+                memcpy(src_tmp, src_ptr, src_size);
+                src_ptr = src_tmp;
+            }
+            js_typed_array_convert(p->class_id,
+                                   dest_abuf->data + dest_ta->offset + (offset << shift),
+                                   src_p->class_id, src_ptr, src_len);
+            js_free(ctx, src_tmp);
+            goto done;
         }
-        /* otherwise, default behavior is slow but correct */
+        /* otherwise (BigInt and Number mix), default behavior is slow
+           but correct */
     } else {
         if (js_get_length64(ctx, &src_len, src_obj))
             goto fail;
@@ -54038,6 +61926,67 @@ exception:
 #define special_lastIndexOf 1
 #define special_includes -1
 
+/* The elements are compared by blocks without early exit so that the
+   loop can be vectorized by the C compiler. The DEF_TA_FIND()
+   functions return the index of the first element equal to 'v' in
+   tab[k..len-1], the DEF_TA_FIND_LAST() ones the index of the last one
+   in tab[0..k]. They return -1 if there is none. 'mask_type' has the
+   element size so that the comparison result needs no conversion. */
+#define TA_FIND_BLOCK_LEN 16
+
+#define DEF_TA_FIND(name, type, mask_type)                              \
+static int name(const type *tab, int k, int len, type v)               \
+{                                                                       \
+    const type *p;                                                      \
+    mask_type found;                                                    \
+    int i;                                                              \
+    for(; len - k >= TA_FIND_BLOCK_LEN; k += TA_FIND_BLOCK_LEN) {       \
+        p = tab + k;                                                    \
+        found = 0;                                                      \
+        for(i = 0; i < TA_FIND_BLOCK_LEN; i++)                          \
+            found |= (p[i] == v);                                       \
+        if (found)                                                      \
+            break;                                                      \
+    }                                                                   \
+    for(; k < len; k++) {                                               \
+        if (tab[k] == v)                                                \
+            return k;                                                   \
+    }                                                                   \
+    return -1;                                                          \
+}
+
+#define DEF_TA_FIND_LAST(name, type, mask_type)                         \
+static int name(const type *tab, int k, type v)                        \
+{                                                                       \
+    const type *p;                                                      \
+    mask_type found;                                                    \
+    int i;                                                              \
+    for(; k + 1 >= TA_FIND_BLOCK_LEN; k -= TA_FIND_BLOCK_LEN) {         \
+        p = tab + k + 1 - TA_FIND_BLOCK_LEN;                            \
+        found = 0;                                                      \
+        for(i = 0; i < TA_FIND_BLOCK_LEN; i++)                          \
+            found |= (p[i] == v);                                       \
+        if (found)                                                      \
+            break;                                                      \
+    }                                                                   \
+    for(; k >= 0; k--) {                                                \
+        if (tab[k] == v)                                                \
+            return k;                                                   \
+    }                                                                   \
+    return -1;                                                          \
+}
+
+/* the 8 bit elements are searched forward with memchr(). The 64 bit
+   elements use a simple loop because their comparisons are usually not
+   vectorized. */
+DEF_TA_FIND_LAST(ta_find8_last, uint8_t, uint8_t)
+DEF_TA_FIND(ta_find16, uint16_t, uint16_t)
+DEF_TA_FIND_LAST(ta_find16_last, uint16_t, uint16_t)
+DEF_TA_FIND(ta_find32, uint32_t, uint32_t)
+DEF_TA_FIND_LAST(ta_find32_last, uint32_t, uint32_t)
+DEF_TA_FIND(ta_find_float32, float, uint32_t)
+DEF_TA_FIND_LAST(ta_find_float32_last, float, uint32_t)
+
 static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
                                       int argc, JSValueConst *argv, int special)
 {
@@ -54146,12 +62095,7 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
                 if (pp)
                     res = pp - pv;
             } else {
-                for (; k != stop; k += inc) {
-                    if (pv[k] == v) {
-                        res = k;
-                        break;
-                    }
-                }
+                res = ta_find8_last(pv, k, v);
             }
         }
         break;
@@ -54166,12 +62110,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
         scan16:
             pv = p->u.array.u.uint16_ptr;
             v = v64;
-            for (; k != stop; k += inc) {
-                if (pv[k] == v) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_find16(pv, k, len, v);
+            else
+                res = ta_find16_last(pv, k, v);
         }
         break;
     case JS_CLASS_INT32_ARRAY:
@@ -54185,12 +62127,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
         scan32:
             pv = p->u.array.u.uint32_ptr;
             v = v64;
-            for (; k != stop; k += inc) {
-                if (pv[k] == v) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_find32(pv, k, len, v);
+            else
+                res = ta_find32_last(pv, k, v);
         }
         break;
     case JS_CLASS_FLOAT32_ARRAY:
@@ -54209,12 +62149,10 @@ static JSValue js_typed_array_indexOf(JSContext *ctx, JSValueConst this_val,
             }
         } else if ((f = (float)d) == d) {
             const float *pv = p->u.array.u.float_ptr;
-            for (; k != stop; k += inc) {
-                if (pv[k] == f) {
-                    res = k;
-                    break;
-                }
-            }
+            if (inc > 0)
+                res = ta_find_float32(pv, k, len, f);
+            else
+                res = ta_find_float32_last(pv, k, f);
         }
         break;
     case JS_CLASS_FLOAT64_ARRAY:
@@ -54682,6 +62620,189 @@ static int js_TA_cmp_generic(const void *a, const void *b, void *opaque) {
     return cmp;
 }
 
+/* Radix sort of the typed arrays without comparison function. The
+   elements are converted in place to unsigned keys which have the
+   same order, sorted with a LSD radix sort on 8 bit digits and
+   converted back. */
+
+/* below this length, rqsort() is faster */
+#define TA_RADIX_SORT_LEN_MIN 64
+
+#define DEF_TA_RADIX_SORT(name, type)                                   \
+static void name(type *tab, type *tmp, size_t len)                     \
+{                                                                       \
+    uint32_t count[sizeof(type)][256], *c, sum, t;                     \
+    type *src, *dst, *tab_tmp, x;                                       \
+    size_t i;                                                           \
+    int d, b;                                                           \
+                                                                        \
+    if (len == 0)                                                       \
+        return;                                                         \
+    memset(count, 0, sizeof(count));                                    \
+    for(i = 0; i < len; i++) {                                          \
+        x = tab[i];                                                     \
+        for(d = 0; d < sizeof(type); d++)                               \
+            count[d][(x >> (d * 8)) & 0xff]++;                          \
+    }                                                                   \
+    src = tab;                                                          \
+    dst = tmp;                                                          \
+    for(d = 0; d < sizeof(type); d++) {                                 \
+        c = count[d];                                                   \
+        /* skip the digit if it is the same in all the keys */          \
+        if (c[(src[0] >> (d * 8)) & 0xff] == len)                       \
+            continue;                                                   \
+        sum = 0;                                                        \
+        for(b = 0; b < 256; b++) {                                      \
+            t = c[b];                                                   \
+            c[b] = sum;                                                 \
+            sum += t;                                                   \
+        }                                                               \
+        for(i = 0; i < len; i++) {                                      \
+            x = src[i];                                                 \
+            dst[c[(x >> (d * 8)) & 0xff]++] = x;                        \
+        }                                                               \
+        tab_tmp = src;                                                  \
+        src = dst;                                                      \
+        dst = tab_tmp;                                                  \
+    }                                                                   \
+    if (src != tab)                                                     \
+        memcpy(tab, src, len * sizeof(type));                           \
+}
+
+DEF_TA_RADIX_SORT(ta_radix_sort16, uint16_t)
+DEF_TA_RADIX_SORT(ta_radix_sort32, uint32_t)
+DEF_TA_RADIX_SORT(ta_radix_sort64, uint64_t)
+
+/* counting sort of 8 bit elements. 'bias' is 0x80 for signed elements. */
+static void ta_count_sort8(uint8_t *tab, size_t len, int bias)
+{
+    uint32_t count[256];
+    size_t i, pos;
+    int b;
+
+    memset(count, 0, sizeof(count));
+    for(i = 0; i < len; i++)
+        count[tab[i] ^ bias]++;
+    pos = 0;
+    for(b = 0; b < 256; b++) {
+        memset(tab + pos, b ^ bias, count[b]);
+        pos += count[b];
+    }
+}
+
+/* move the NaN to the end of 'tab' using 'tmp' and return the number
+   of the other elements */
+#define DEF_TA_MOVE_NAN(name, type, abs_mask, inf)                      \
+static size_t name(type *tab, type *tmp, size_t len)                   \
+{                                                                       \
+    size_t i, n, n_nan;                                                 \
+    type x;                                                             \
+                                                                        \
+    n = 0;                                                              \
+    n_nan = 0;                                                          \
+    for(i = 0; i < len; i++) {                                          \
+        x = tab[i];                                                     \
+        if ((x & abs_mask) > inf)                                       \
+            tmp[n_nan++] = x;                                           \
+        else                                                            \
+            tab[n++] = x;                                               \
+    }                                                                   \
+    memcpy(tab + n, tmp, n_nan * sizeof(type));                         \
+    return n;                                                           \
+}
+
+DEF_TA_MOVE_NAN(ta_move_nan32, uint32_t, 0x7fffffff, 0x7f800000)
+DEF_TA_MOVE_NAN(ta_move_nan64, uint64_t, 0x7fffffffffffffff, 0x7ff0000000000000)
+
+/* sort the typed array elements in 'array_ptr' with temporary buffer
+   'tmp' of the same size. -0 is before +0 and the NaN are at the end. */
+static void js_TA_radix_sort(int class_id, void *array_ptr, void *tmp, size_t len)
+{
+    size_t i, n;
+
+    switch(class_id) {
+    case JS_CLASS_INT8_ARRAY:
+        ta_count_sort8(array_ptr, len, 0x80);
+        break;
+    case JS_CLASS_UINT8C_ARRAY:
+    case JS_CLASS_UINT8_ARRAY:
+        ta_count_sort8(array_ptr, len, 0);
+        break;
+    case JS_CLASS_INT16_ARRAY:
+        {
+            uint16_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x8000;
+            ta_radix_sort16(tab, tmp, len);
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x8000;
+        }
+        break;
+    case JS_CLASS_UINT16_ARRAY:
+        ta_radix_sort16(array_ptr, tmp, len);
+        break;
+    case JS_CLASS_INT32_ARRAY:
+        {
+            uint32_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x80000000;
+            ta_radix_sort32(tab, tmp, len);
+            for(i = 0; i < len; i++)
+                tab[i] ^= 0x80000000;
+        }
+        break;
+    case JS_CLASS_UINT32_ARRAY:
+        ta_radix_sort32(array_ptr, tmp, len);
+        break;
+    case JS_CLASS_BIG_INT64_ARRAY:
+        {
+            uint64_t *tab = array_ptr;
+            for(i = 0; i < len; i++)
+                tab[i] ^= (uint64_t)1 << 63;
+            ta_radix_sort64(tab, tmp, len);
+            for(i = 0; i < len; i++)
+                tab[i] ^= (uint64_t)1 << 63;
+        }
+        break;
+    case JS_CLASS_BIG_UINT64_ARRAY:
+        ta_radix_sort64(array_ptr, tmp, len);
+        break;
+    case JS_CLASS_FLOAT32_ARRAY:
+        {
+            uint32_t *tab = array_ptr, x;
+            n = ta_move_nan32(tab, tmp, len);
+            /* the negative numbers are reversed */
+            for(i = 0; i < n; i++) {
+                x = tab[i];
+                tab[i] = (x >> 31) ? ~x : x | 0x80000000;
+            }
+            ta_radix_sort32(tab, tmp, n);
+            for(i = 0; i < n; i++) {
+                x = tab[i];
+                tab[i] = (x >> 31) ? x & 0x7fffffff : ~x;
+            }
+        }
+        break;
+    case JS_CLASS_FLOAT64_ARRAY:
+        {
+            uint64_t *tab = array_ptr, x;
+            n = ta_move_nan64(tab, tmp, len);
+            for(i = 0; i < n; i++) {
+                x = tab[i];
+                tab[i] = (x >> 63) ? ~x : x | ((uint64_t)1 << 63);
+            }
+            ta_radix_sort64(tab, tmp, n);
+            for(i = 0; i < n; i++) {
+                x = tab[i];
+                tab[i] = (x >> 63) ? x & ~((uint64_t)1 << 63) : ~x;
+            }
+        }
+        break;
+    default:
+        abort();
+    }
+}
+
 static JSValue js_typed_array_sort(JSContext *ctx, JSValueConst this_val,
                                    int argc, JSValueConst *argv)
 {
@@ -54810,6 +62931,16 @@ static JSValue js_typed_array_sort(JSContext *ctx, JSValueConst this_val,
                 js_free(ctx, array_tmp);
             }
             js_free(ctx, array_idx);
+        } else if (len >= TA_RADIX_SORT_LEN_MIN) {
+            void *array_tmp = NULL;
+            /* the 8 bit elements are sorted in place */
+            if (elt_size > 1) {
+                array_tmp = js_malloc(ctx, len * elt_size);
+                if (!array_tmp)
+                    return JS_EXCEPTION;
+            }
+            js_TA_radix_sort(p->class_id, array_ptr, array_tmp, len);
+            js_free(ctx, array_tmp);
         } else {
             rqsort(array_ptr, len, elt_size, cmpfun, &tsc);
             if (tsc.exception)
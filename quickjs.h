@@ -72,6 +72,9 @@ enum {
     JS_TAG_BIG_FLOAT   = -9,
     JS_TAG_SYMBOL      = -8,
     JS_TAG_STRING      = -7,
+    /* a string may also have this tag: the code comparing the tags
+       directly must handle it or use JS_IsString() */
+    JS_TAG_STRING_ROPE = -6,
     JS_TAG_MODULE      = -3, /* used internally */
     JS_TAG_FUNCTION_BYTECODE = -2, /* used internally */
     JS_TAG_OBJECT      = -1,
@@ -332,12 +335,27 @@ typedef struct JSMallocFunctions {
 typedef struct JSGCObjectHeader JSGCObjectHeader;
 
 JSRuntime *JS_NewRuntime(void);
+/* same as JS_NewRuntime() but the memory is allocated with a size-class
+   slab allocator which is released in bulk by JS_FreeRuntime(). Only
+   the finalizers of the ArrayBuffers and of the user classes are then
+   called. */
+JSRuntime *JS_NewSlabRuntime(void);
 /* info lifetime must exceed that of rt */
 void JS_SetRuntimeInfo(JSRuntime *rt, const char *info);
 void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
+/* if budget != 0, the automatic GC only does JS_RunGCStep(rt, budget)
+   and the cycles larger than 'budget' objects are only collected by
+   JS_RunGC() */
+void JS_SetGCStepBudget(JSRuntime *rt, size_t budget);
 /* use 0 to disable maximum stack size check */
 void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
+/* maximum number of threads used to multiply very large BigInt,
+   BigFloat or BigDecimal values (default = 1). Values above 16 are
+   handled as 16. Only the products whose transform has 2^16 points
+   or more are computed in parallel. The multiplication itself
+   remains synchronous. */
+void JS_SetBignumThreads(JSRuntime *rt, int thread_count);
 /* should be called when changing thread to update the stack top value
    used to check stack overflow. */
 void JS_UpdateStackTop(JSRuntime *rt);
@@ -348,6 +366,9 @@ void JS_SetRuntimeOpaque(JSRuntime *rt, void *opaque);
 typedef void JS_MarkFunc(JSRuntime *rt, JSGCObjectHeader *gp);
 void JS_MarkValue(JSRuntime *rt, JSValueConst val, JS_MarkFunc *mark_func);
 void JS_RunGC(JSRuntime *rt);
+/* collect the objects allocated since the last GC and at most 'budget'
+   older objects */
+void JS_RunGCStep(JSRuntime *rt, size_t budget);
 JS_BOOL JS_IsLiveObject(JSRuntime *rt, JSValueConst obj);
 
 JSContext *JS_NewContext(JSRuntime *rt);
@@ -413,10 +434,16 @@ typedef struct JSMemoryUsage {
     int64_t c_func_count, array_count;
     int64_t fast_array_count, fast_array_elements;
     int64_t binary_object_count, binary_object_size;
+    int64_t gc_count, gc_full_count;
+    int64_t gc_young_obj_count, gc_old_obj_count;
+    /* in microseconds */
+    int64_t gc_total_time, gc_max_pause, gc_last_pause;
 } JSMemoryUsage;
 
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
+/* only available if the engine is compiled with DUMP_OPCODE_STATS */
+void JS_DumpOpcodeStats(JSRuntime *rt, FILE *fp);
 
 /* atom support */
 #define JS_ATOM_NULL 0
@@ -618,7 +645,8 @@ static inline JS_BOOL JS_IsUninitialized(JSValueConst v)
 
 static inline JS_BOOL JS_IsString(JSValueConst v)
 {
-    return JS_VALUE_GET_TAG(v) == JS_TAG_STRING;
+    return JS_VALUE_GET_TAG(v) == JS_TAG_STRING ||
+        JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE;
 }
 
 static inline JS_BOOL JS_IsSymbol(JSValueConst v)
@@ -881,6 +909,25 @@ typedef int JSInterruptHandler(JSRuntime *rt, void *opaque);
 void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque);
 /* if can_block is TRUE, Atomics.wait() can be used */
 void JS_SetCanBlock(JSRuntime *rt, JS_BOOL can_block);
+/* if enable is TRUE, the inner functions of the code parsed afterwards
+   are compiled on their first call */
+void JS_SetLazyFunctions(JSRuntime *rt, JS_BOOL enable);
+/* sampling CPU profiler: the JS stack is sampled every 'interval_us'
+   microseconds from the interrupt polling points. JS_WriteProfile()
+   outputs the samples in the collapsed stack format ("f1;f2;f3
+   count" lines) used by the flame graph tools. */
+int JS_StartProfiler(JSRuntime *rt, int interval_us);
+void JS_StopProfiler(JSRuntime *rt);
+int JS_WriteProfile(JSRuntime *rt, FILE *f);
+/* heap profiler: JS_WriteHeapProfile() outputs the number and size of
+   the live objects by class and constructor name. If the heap
+   profiler is started with a non zero 'sample_interval', the
+   allocation site of one object every 'sample_interval' objects is
+   recorded and the live sampled objects are also reported by
+   allocation site. */
+int JS_StartHeapProfiler(JSRuntime *rt, int sample_interval);
+void JS_StopHeapProfiler(JSRuntime *rt);
+int JS_WriteHeapProfile(JSRuntime *rt, FILE *f);
 /* set the [IsHTMLDDA] internal slot */
 void JS_SetIsHTMLDDA(JSContext *ctx, JSValueConst obj);
 
@@ -923,6 +970,14 @@ uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags);
 uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
                          int flags, uint8_t ***psab_tab, size_t *psab_tab_len);
+/* The ArrayBuffers of 'transfer_list' are detached and their data is
+   returned in 'transfer_data' instead of being copied. Each element of
+   'transfer_data' must be given to JS_ReadObject2() or freed with
+   free(). */
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_list, uint8_t **transfer_data,
+                         int transfer_len);
 
 #define JS_READ_OBJ_BYTECODE  (1 << 0) /* allow function/module */
 #define JS_READ_OBJ_ROM_DATA  (1 << 1) /* avoid duplicating 'buf' data */
@@ -930,6 +985,41 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
 JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                       int flags);
+/* 'transfer_data' is the array returned by JS_WriteObject3(). The
+   elements used by the ArrayBuffers of the result are set to NULL. */
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, uint8_t **transfer_data, int transfer_len);
+/* create the atoms of a bytecode image so that it can be read with
+   JS_READ_OBJ_ROM_DATA by several runtimes without copying its
+   bytecode. Must be called before creating the first context. */
+int JS_ReserveAtoms(JSRuntime *rt, const uint8_t *buf, size_t buf_len);
+/* Record the objects of the context as the base of the next
+   snapshots. JS_WriteSnapshot() serializes the changes done to the
+   context since then. The snapshot must be read with JS_ReadSnapshot()
+   in a context initialized in the same way before JS_SetSnapshotBase()
+   was called. */
+int JS_SetSnapshotBase(JSContext *ctx);
+uint8_t *JS_WriteSnapshot(JSContext *ctx, size_t *psize);
+int JS_ReadSnapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len);
+/* Restore the objects recorded by JS_SetSnapshotBase() to their state
+   at that time, free the modules loaded since then and remove the
+   pending jobs of the context. Return -1 if exception, in which case
+   the context should be freed. */
+int JS_ResetContext(JSContext *ctx);
+/* Ahead of time compilation: JS_WriteAOTFunctions() translates to C
+   the functions of a compiled script or module which only compute
+   with numbers. JS_SetAOTFunctions() installs the table it defines in
+   the same script or module returned by JS_ReadObject(). A C function
+   returns 1 and sets '*pret' if it executed the call, 0 to let the
+   interpreter execute it and -1 if an exception was raised. */
+typedef int JSAOTFunction(JSContext *ctx, JSValue *pret, int argc,
+                          JSValueConst *argv);
+char *JS_WriteAOTFunctions(JSContext *ctx, size_t *psize, JSValueConst obj,
+                           const char *c_name);
+int JS_SetAOTFunctions(JSContext *ctx, JSValueConst obj,
+                       JSAOTFunction * const *tab, int tab_len);
+/* call the interrupt handler. Return -1 if the execution must stop. */
+int JS_PollInterrupts(JSContext *ctx);
 /* instantiate and evaluate a bytecode function. Only used when
    reading a script or module with JS_ReadObject() */
 JSValue JS_EvalFunction(JSContext *ctx, JSValue fun_obj);
@@ -958,6 +1048,15 @@ typedef enum JSCFunctionEnum {  /* XXX: should rename for namespace isolation */
     JS_CFUNC_getter_magic,
     JS_CFUNC_setter_magic,
     JS_CFUNC_iterator_next,
+    /* same as JS_CFUNC_generic but the function must not call JS code
+       (e.g. it must not call JS_Call() or convert objects). When called
+       from JS with at least 'length' arguments, no stack frame is
+       created and the arguments are not copied. The function does not
+       appear in the backtraces. */
+    JS_CFUNC_leaf,
+    /* the int32 arguments are converted as with JS_ToInt32() */
+    JS_CFUNC_i_i,
+    JS_CFUNC_i_i_i,
 } JSCFunctionEnum;
 
 typedef union JSCFunctionType {
@@ -968,6 +1067,8 @@ typedef union JSCFunctionType {
     JSCFunction *constructor_or_func;
     double (*f_f)(double);
     double (*f_f_f)(double, double);
+    int32_t (*i_i)(int32_t);
+    int32_t (*i_i_i)(int32_t, int32_t);
     JSValue (*getter)(JSContext *ctx, JSValueConst this_val);
     JSValue (*setter)(JSContext *ctx, JSValueConst this_val, JSValueConst val);
     JSValue (*getter_magic)(JSContext *ctx, JSValueConst this_val, int magic);
@@ -989,6 +1090,12 @@ static inline JSValue JS_NewCFunction(JSContext *ctx, JSCFunction *func, const c
     return JS_NewCFunction2(ctx, func, name, length, JS_CFUNC_generic, 0);
 }
 
+static inline JSValue JS_NewCFunctionLeaf(JSContext *ctx, JSCFunction *func,
+                                          const char *name, int length)
+{
+    return JS_NewCFunction2(ctx, func, name, length, JS_CFUNC_leaf, 0);
+}
+
 static inline JSValue JS_NewCFunctionMagic(JSContext *ctx, JSCFunctionMagic *func,
                                            const char *name,
                                            int length, JSCFunctionEnum cproto, int magic)
@@ -1044,6 +1151,7 @@ typedef struct JSCFunctionListEntry {
 /* Note: c++ does not like nested designators */
 #define JS_CFUNC_DEF(name, length, func1) { name, JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE, JS_DEF_CFUNC, 0, .u = { .func = { length, JS_CFUNC_generic, { .generic = func1 } } } }
 #define JS_CFUNC_MAGIC_DEF(name, length, func1, magic) { name, JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE, JS_DEF_CFUNC, magic, .u = { .func = { length, JS_CFUNC_generic_magic, { .generic_magic = func1 } } } }
+#define JS_CFUNC_LEAF_DEF(name, length, func1) { name, JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE, JS_DEF_CFUNC, 0, .u = { .func = { length, JS_CFUNC_leaf, { .generic = func1 } } } }
 #define JS_CFUNC_SPECIAL_DEF(name, length, cproto, func1) { name, JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE, JS_DEF_CFUNC, 0, .u = { .func = { length, JS_CFUNC_ ## cproto, { .cproto = func1 } } } }
 #define JS_ITERATOR_NEXT_DEF(name, length, func1, magic) { name, JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE, JS_DEF_CFUNC, magic, .u = { .func = { length, JS_CFUNC_iterator_next, { .iterator_next = func1 } } } }
 #define JS_CGETSET_DEF(name, fgetter, fsetter) { name, JS_PROP_CONFIGURABLE, JS_DEF_CGETSET, 0, .u = { .getset = { .get = { .getter = fgetter }, .set = { .setter = fsetter } } } }
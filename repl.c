@@ -0,0 +1,2104 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include <inttypes.h>
+
+const uint32_t qjsc_repl_size = 16759;
+
+const uint8_t qjsc_repl[16759] = {
+ 0x45, 0xa7, 0x03, 0x0e, 0x72, 0x65, 0x70, 0x6c,
+ 0x2e, 0x6a, 0x73, 0x06, 0x73, 0x74, 0x64, 0x04,
+ 0x6f, 0x73, 0x10, 0x69, 0x73, 0x46, 0x69, 0x6e,
+ 0x69, 0x74, 0x65, 0x14, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x08, 0x6f,
+ 0x70, 0x65, 0x6e, 0x10, 0x46, 0x72, 0x61, 0x63,
+ 0x74, 0x69, 0x6f, 0x6e, 0x08, 0x1b, 0x5b, 0x30,
+ 0x6d, 0x08, 0x6e, 0x6f, 0x6e, 0x65, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x30, 0x6d, 0x0a, 0x62, 0x6c, 0x61,
+ 0x63, 0x6b, 0x0a, 0x1b, 0x5b, 0x33, 0x31, 0x6d,
+ 0x06, 0x72, 0x65, 0x64, 0x0a, 0x1b, 0x5b, 0x33,
+ 0x32, 0x6d, 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x33, 0x6d, 0x0c, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0a, 0x1b, 0x5b,
+ 0x33, 0x34, 0x6d, 0x08, 0x62, 0x6c, 0x75, 0x65,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x35, 0x6d, 0x0e, 0x6d,
+ 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x36, 0x6d, 0x08, 0x63, 0x79, 0x61,
+ 0x6e, 0x0a, 0x1b, 0x5b, 0x33, 0x37, 0x6d, 0x0a,
+ 0x77, 0x68, 0x69, 0x74, 0x65, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x30, 0x3b, 0x31, 0x6d, 0x08, 0x67, 0x72,
+ 0x61, 0x79, 0x08, 0x67, 0x72, 0x65, 0x79, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x31, 0x3b, 0x31, 0x6d, 0x14,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x72,
+ 0x65, 0x64, 0x0e, 0x1b, 0x5b, 0x33, 0x32, 0x3b,
+ 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69, 0x67, 0x68,
+ 0x74, 0x5f, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x33, 0x3b, 0x31, 0x6d, 0x1a,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x34, 0x3b, 0x31, 0x6d, 0x16, 0x62, 0x72,
+ 0x69, 0x67, 0x68, 0x74, 0x5f, 0x62, 0x6c, 0x75,
+ 0x65, 0x0e, 0x1b, 0x5b, 0x33, 0x35, 0x3b, 0x31,
+ 0x6d, 0x1c, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74,
+ 0x5f, 0x6d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61,
+ 0x0e, 0x1b, 0x5b, 0x33, 0x36, 0x3b, 0x31, 0x6d,
+ 0x16, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+ 0x63, 0x79, 0x61, 0x6e, 0x0e, 0x1b, 0x5b, 0x33,
+ 0x37, 0x3b, 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69,
+ 0x67, 0x68, 0x74, 0x5f, 0x77, 0x68, 0x69, 0x74,
+ 0x65, 0x0e, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+ 0x74, 0x0a, 0x72, 0x65, 0x67, 0x65, 0x78, 0x0e,
+ 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x08,
+ 0x74, 0x79, 0x70, 0x65, 0x14, 0x69, 0x64, 0x65,
+ 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x0a,
+ 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0c, 0x72, 0x65,
+ 0x73, 0x75, 0x6c, 0x74, 0x12, 0x65, 0x72, 0x72,
+ 0x6f, 0x72, 0x5f, 0x6d, 0x73, 0x67, 0x0c, 0x71,
+ 0x6a, 0x73, 0x20, 0x3e, 0x20, 0x0c, 0x20, 0x20,
+ 0x2e, 0x2e, 0x2e, 0x20, 0x02, 0x01, 0x02, 0x02,
+ 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+ 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0a,
+ 0x02, 0x0b, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x10,
+ 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14,
+ 0x02, 0x18, 0x02, 0x19, 0x06, 0x1b, 0x4f, 0x41,
+ 0x06, 0x1b, 0x4f, 0x42, 0x06, 0x1b, 0x4f, 0x43,
+ 0x06, 0x1b, 0x4f, 0x44, 0x06, 0x1b, 0x4f, 0x46,
+ 0x06, 0x1b, 0x4f, 0x48, 0x0c, 0x1b, 0x5b, 0x31,
+ 0x3b, 0x35, 0x43, 0x0c, 0x1b, 0x5b, 0x31, 0x3b,
+ 0x35, 0x44, 0x08, 0x1b, 0x5b, 0x31, 0x7e, 0x08,
+ 0x1b, 0x5b, 0x33, 0x7e, 0x08, 0x1b, 0x5b, 0x34,
+ 0x7e, 0x08, 0x1b, 0x5b, 0x35, 0x7e, 0x08, 0x1b,
+ 0x5b, 0x36, 0x7e, 0x06, 0x1b, 0x5b, 0x41, 0x06,
+ 0x1b, 0x5b, 0x42, 0x06, 0x1b, 0x5b, 0x43, 0x06,
+ 0x1b, 0x5b, 0x44, 0x06, 0x1b, 0x5b, 0x46, 0x06,
+ 0x1b, 0x5b, 0x48, 0x04, 0x1b, 0x7f, 0x04, 0x1b,
+ 0x62, 0x04, 0x1b, 0x64, 0x04, 0x1b, 0x66, 0x04,
+ 0x1b, 0x6b, 0x04, 0x1b, 0x6c, 0x04, 0x1b, 0x74,
+ 0x04, 0x1b, 0x75, 0x02, 0x7f, 0x04, 0x3e, 0x20,
+ 0x0e, 0x65, 0x78, 0x65, 0x63, 0x43, 0x6d, 0x64,
+ 0x10, 0x74, 0x65, 0x72, 0x6d, 0x49, 0x6e, 0x69,
+ 0x74, 0x0c, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x6f,
+ 0x0c, 0x69, 0x73, 0x61, 0x74, 0x74, 0x79, 0x1a,
+ 0x74, 0x74, 0x79, 0x47, 0x65, 0x74, 0x57, 0x69,
+ 0x6e, 0x53, 0x69, 0x7a, 0x65, 0x12, 0x74, 0x74,
+ 0x79, 0x53, 0x65, 0x74, 0x52, 0x61, 0x77, 0x0c,
+ 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x0c, 0x53,
+ 0x49, 0x47, 0x49, 0x4e, 0x54, 0x1c, 0x73, 0x65,
+ 0x74, 0x52, 0x65, 0x61, 0x64, 0x48, 0x61, 0x6e,
+ 0x64, 0x6c, 0x65, 0x72, 0x1c, 0x73, 0x69, 0x67,
+ 0x69, 0x6e, 0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x72, 0x16, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x22,
+ 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61,
+ 0x64, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+ 0x72, 0x08, 0x72, 0x65, 0x61, 0x64, 0x0c, 0x62,
+ 0x75, 0x66, 0x66, 0x65, 0x72, 0x10, 0x69, 0x73,
+ 0x5f, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x02, 0x41,
+ 0x02, 0x5a, 0x02, 0x61, 0x02, 0x7a, 0x10, 0x69,
+ 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x0e,
+ 0x69, 0x73, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x02,
+ 0x5f, 0x02, 0x24, 0x14, 0x75, 0x63, 0x73, 0x5f,
+ 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x14, 0x63,
+ 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41,
+ 0x74, 0x2a, 0x69, 0x73, 0x5f, 0x74, 0x72, 0x61,
+ 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x75,
+ 0x72, 0x72, 0x6f, 0x67, 0x61, 0x74, 0x65, 0x16,
+ 0x63, 0x6f, 0x64, 0x65, 0x50, 0x6f, 0x69, 0x6e,
+ 0x74, 0x41, 0x74, 0x16, 0x69, 0x73, 0x5f, 0x62,
+ 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x04,
+ 0x28, 0x29, 0x04, 0x5b, 0x5d, 0x04, 0x7b, 0x7d,
+ 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+ 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x74, 0x65, 0x78,
+ 0x74, 0x08, 0x70, 0x75, 0x74, 0x73, 0x12, 0x73,
+ 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+ 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+ 0x73, 0x69, 0x04, 0x1b, 0x5b, 0x16, 0x6d, 0x6f,
+ 0x76, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f,
+ 0x72, 0x06, 0x6d, 0x69, 0x6e, 0x02, 0x43, 0x02,
+ 0x44, 0x0c, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+ 0x04, 0x20, 0x08, 0x06, 0x1b, 0x5b, 0x4a, 0x06,
+ 0x6f, 0x75, 0x74, 0x0a, 0x66, 0x6c, 0x75, 0x73,
+ 0x68, 0x0c, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74,
+ 0x1a, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x64, 0x5f,
+ 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x14, 0x71,
+ 0x75, 0x6f, 0x74, 0x65, 0x5f, 0x66, 0x6c, 0x61,
+ 0x67, 0x0a, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x06,
+ 0x63, 0x6d, 0x64, 0x14, 0x63, 0x75, 0x72, 0x73,
+ 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x0a, 0x61,
+ 0x6c, 0x65, 0x72, 0x74, 0x22, 0x62, 0x65, 0x67,
+ 0x69, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x5f, 0x6f,
+ 0x66, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x16, 0x65,
+ 0x6e, 0x64, 0x5f, 0x6f, 0x66, 0x5f, 0x6c, 0x69,
+ 0x6e, 0x65, 0x18, 0x66, 0x6f, 0x72, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x0c,
+ 0x63, 0x68, 0x61, 0x72, 0x41, 0x74, 0x1a, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x63, 0x68, 0x61, 0x72, 0x22, 0x73, 0x6b, 0x69,
+ 0x70, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x66,
+ 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x24, 0x73,
+ 0x6b, 0x69, 0x70, 0x5f, 0x77, 0x6f, 0x72, 0x64,
+ 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72,
+ 0x64, 0x18, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72,
+ 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x1a, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x16, 0x61, 0x63, 0x63,
+ 0x65, 0x70, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+ 0x16, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x5f, 0x61, 0x64, 0x64, 0x08, 0x70, 0x75, 0x73,
+ 0x68, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
+ 0x75, 0x73, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x1a, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+ 0x0e, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x18, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x1c, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65,
+ 0x61, 0x72, 0x63, 0x68, 0x2e, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61,
+ 0x72, 0x63, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x2c, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61,
+ 0x72, 0x63, 0x68, 0x5f, 0x66, 0x6f, 0x72, 0x77,
+ 0x61, 0x72, 0x64, 0x1e, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x5f,
+ 0x64, 0x69, 0x72, 0x16, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x12,
+ 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f,
+ 0x64, 0x28, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74,
+ 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x1e, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+ 0x5f, 0x63, 0x68, 0x61, 0x72, 0x73, 0x1e, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+ 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x16, 0x75,
+ 0x70, 0x63, 0x61, 0x73, 0x65, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x16, 0x74, 0x6f, 0x55, 0x70, 0x70,
+ 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x1a, 0x64,
+ 0x6f, 0x77, 0x6e, 0x63, 0x61, 0x73, 0x65, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x16, 0x74, 0x6f, 0x4c,
+ 0x6f, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65,
+ 0x16, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x72, 0x65,
+ 0x67, 0x69, 0x6f, 0x6e, 0x12, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x24, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x6c, 0x69, 0x6e,
+ 0x65, 0x12, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x77,
+ 0x6f, 0x72, 0x64, 0x24, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x5f, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x08, 0x79,
+ 0x61, 0x6e, 0x6b, 0x14, 0x63, 0x6c, 0x69, 0x70,
+ 0x5f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x12, 0x63,
+ 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f, 0x63,
+ 0x10, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x66, 0x75,
+ 0x6e, 0x2a, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74,
+ 0x5f, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x08,
+ 0x65, 0x78, 0x69, 0x74, 0x3c, 0x0a, 0x28, 0x50,
+ 0x72, 0x65, 0x73, 0x73, 0x20, 0x43, 0x74, 0x72,
+ 0x6c, 0x2d, 0x43, 0x20, 0x61, 0x67, 0x61, 0x69,
+ 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x71, 0x75, 0x69,
+ 0x74, 0x29, 0x0a, 0x0a, 0x72, 0x65, 0x73, 0x65,
+ 0x74, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x6f,
+ 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x24, 0x67, 0x65, 0x74, 0x5f, 0x63,
+ 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x6f,
+ 0x62, 0x6a, 0x65, 0x63, 0x74, 0x08, 0x6c, 0x69,
+ 0x6e, 0x65, 0x06, 0x70, 0x6f, 0x73, 0x06, 0x6f,
+ 0x62, 0x6a, 0x08, 0x62, 0x61, 0x73, 0x65, 0x02,
+ 0x63, 0x02, 0x67, 0x1c, 0x63, 0x6f, 0x6e, 0x66,
+ 0x69, 0x67, 0x5f, 0x6e, 0x75, 0x6d, 0x63, 0x61,
+ 0x6c, 0x63, 0x14, 0x68, 0x61, 0x73, 0x5f, 0x6a,
+ 0x73, 0x63, 0x61, 0x6c, 0x63, 0x14, 0x68, 0x61,
+ 0x73, 0x5f, 0x62, 0x69, 0x67, 0x6e, 0x75, 0x6d,
+ 0x0c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x0c,
+ 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x08, 0x70,
+ 0x72, 0x65, 0x63, 0x0e, 0x65, 0x78, 0x70, 0x42,
+ 0x69, 0x74, 0x73, 0x0e, 0x6c, 0x6f, 0x67, 0x32,
+ 0x5f, 0x31, 0x30, 0x0c, 0x70, 0x73, 0x74, 0x61,
+ 0x74, 0x65, 0x0c, 0x70, 0x72, 0x6f, 0x6d, 0x70,
+ 0x74, 0x08, 0x70, 0x6c, 0x65, 0x6e, 0x06, 0x70,
+ 0x73, 0x31, 0x06, 0x70, 0x73, 0x32, 0x08, 0x75,
+ 0x74, 0x66, 0x38, 0x12, 0x73, 0x68, 0x6f, 0x77,
+ 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x16, 0x73, 0x68,
+ 0x6f, 0x77, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+ 0x73, 0x1e, 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x73,
+ 0x74, 0x61, 0x72, 0x74, 0x5f, 0x74, 0x69, 0x6d,
+ 0x65, 0x12, 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x74,
+ 0x69, 0x6d, 0x65, 0x0a, 0x6d, 0x65, 0x78, 0x70,
+ 0x72, 0x0a, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x10,
+ 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6d, 0x64,
+ 0x1e, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x75,
+ 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73,
+ 0x10, 0x74, 0x68, 0x69, 0x73, 0x5f, 0x66, 0x75,
+ 0x6e, 0x14, 0x75, 0x74, 0x66, 0x38, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x10, 0x75, 0x74, 0x66,
+ 0x38, 0x5f, 0x76, 0x61, 0x6c, 0x0e, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x66, 0x64, 0x1a, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f,
+ 0x62, 0x75, 0x66, 0x14, 0x74, 0x65, 0x72, 0x6d,
+ 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x1a, 0x74,
+ 0x65, 0x72, 0x6d, 0x5f, 0x63, 0x75, 0x72, 0x73,
+ 0x6f, 0x72, 0x5f, 0x78, 0x1e, 0x67, 0x65, 0x74,
+ 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74,
+ 0x69, 0x6f, 0x6e, 0x73, 0x14, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x10,
+ 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73,
+ 0x0c, 0x64, 0x75, 0x70, 0x73, 0x74, 0x72, 0x1a,
+ 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65,
+ 0x5f, 0x6b, 0x65, 0x79, 0x73, 0x1c, 0x72, 0x65,
+ 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x16, 0x72, 0x65, 0x61,
+ 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x63, 0x62,
+ 0x1c, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x16,
+ 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x63,
+ 0x68, 0x61, 0x72, 0x14, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x10, 0x68,
+ 0x65, 0x78, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x12,
+ 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x6d, 0x6f, 0x64,
+ 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+ 0x5f, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69,
+ 0x6e, 0x67, 0x24, 0x62, 0x69, 0x67, 0x66, 0x6c,
+ 0x6f, 0x61, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x73,
+ 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x69,
+ 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x5f,
+ 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0a, 0x70,
+ 0x72, 0x69, 0x6e, 0x74, 0x22, 0x65, 0x78, 0x74,
+ 0x72, 0x61, 0x63, 0x74, 0x5f, 0x64, 0x69, 0x72,
+ 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x64, 0x69,
+ 0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x08,
+ 0x68, 0x65, 0x6c, 0x70, 0x12, 0x63, 0x6d, 0x64,
+ 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x24, 0x63,
+ 0x6d, 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6c,
+ 0x69, 0x6e, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72,
+ 0x74, 0x26, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c,
+ 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x14, 0x68, 0x61,
+ 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64,
+ 0x28, 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x61, 0x6e,
+ 0x64, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f,
+ 0x73, 0x74, 0x61, 0x72, 0x74, 0x22, 0x70, 0x72,
+ 0x69, 0x6e, 0x74, 0x5f, 0x65, 0x76, 0x61, 0x6c,
+ 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20,
+ 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x65, 0x76,
+ 0x61, 0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72,
+ 0x1c, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f,
+ 0x63, 0x6d, 0x64, 0x5f, 0x65, 0x6e, 0x64, 0x16,
+ 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x69, 0x7a, 0x65,
+ 0x5f, 0x6a, 0x73, 0x2a, 0x20, 0x7e, 0x21, 0x25,
+ 0x5e, 0x26, 0x2a, 0x28, 0x2d, 0x2b, 0x3d, 0x7b,
+ 0x5b, 0x7c, 0x3a, 0x3b, 0x2c, 0x3c, 0x3e, 0x3f,
+ 0x2f, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+ 0x66, 0x02, 0x2e, 0x02, 0x27, 0x02, 0x22, 0x02,
+ 0x5d, 0x02, 0x7d, 0x02, 0x2f, 0x10, 0x69, 0x6e,
+ 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x0a, 0x69,
+ 0x73, 0x4e, 0x61, 0x4e, 0x26, 0x67, 0x65, 0x74,
+ 0x4f, 0x77, 0x6e, 0x50, 0x72, 0x6f, 0x70, 0x65,
+ 0x72, 0x74, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x73,
+ 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57,
+ 0x69, 0x74, 0x68, 0x08, 0x73, 0x6f, 0x72, 0x74,
+ 0x06, 0x74, 0x61, 0x62, 0x06, 0x63, 0x74, 0x78,
+ 0x0c, 0x73, 0x79, 0x6d, 0x63, 0x6d, 0x70, 0x02,
+ 0x28, 0x02, 0x29, 0x06, 0x6d, 0x61, 0x78, 0x0a,
+ 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x08, 0x63, 0x65,
+ 0x69, 0x6c, 0x0c, 0x70, 0x61, 0x64, 0x45, 0x6e,
+ 0x64, 0x02, 0x20, 0x0e, 0x74, 0x6f, 0x46, 0x69,
+ 0x78, 0x65, 0x64, 0x1a, 0x66, 0x72, 0x6f, 0x6d,
+ 0x43, 0x6f, 0x64, 0x65, 0x50, 0x6f, 0x69, 0x6e,
+ 0x74, 0x02, 0x1b, 0x02, 0x5b, 0x02, 0x4f, 0x02,
+ 0x3b, 0x04, 0x2d, 0x30, 0x02, 0x2d, 0x04, 0x30,
+ 0x78, 0x08, 0x6d, 0x61, 0x74, 0x68, 0x12, 0x42,
+ 0x69, 0x67, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28,
+ 0x02, 0x6c, 0x02, 0x70, 0x02, 0x65, 0x04, 0x2e,
+ 0x30, 0x02, 0x6e, 0x12, 0x70, 0x72, 0x69, 0x6e,
+ 0x74, 0x5f, 0x72, 0x65, 0x63, 0x14, 0x5b, 0x63,
+ 0x69, 0x72, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5d,
+ 0x0a, 0x44, 0x61, 0x74, 0x65, 0x20, 0x16, 0x74,
+ 0x6f, 0x47, 0x4d, 0x54, 0x53, 0x74, 0x72, 0x69,
+ 0x6e, 0x67, 0x0e, 0x5f, 0x5f, 0x71, 0x75, 0x6f,
+ 0x74, 0x65, 0x0e, 0x43, 0x6f, 0x6d, 0x70, 0x6c,
+ 0x65, 0x78, 0x06, 0x4d, 0x6f, 0x64, 0x14, 0x50,
+ 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61,
+ 0x6c, 0x0e, 0x50, 0x6f, 0x6c, 0x79, 0x4d, 0x6f,
+ 0x64, 0x20, 0x52, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+ 0x61, 0x6c, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x0c, 0x53, 0x65, 0x72, 0x69, 0x65,
+ 0x73, 0x0e, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61,
+ 0x79, 0x04, 0x5b, 0x20, 0x04, 0x2c, 0x20, 0x0e,
+ 0x3c, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x3e, 0x06,
+ 0x2e, 0x2e, 0x2e, 0x04, 0x20, 0x5d, 0x14, 0x5f,
+ 0x5f, 0x67, 0x65, 0x74, 0x43, 0x6c, 0x61, 0x73,
+ 0x73, 0x08, 0x6b, 0x65, 0x79, 0x73, 0x04, 0x7b,
+ 0x20, 0x04, 0x3a, 0x20, 0x04, 0x20, 0x7d, 0x06,
+ 0x70, 0x6f, 0x70, 0x08, 0x2e, 0x2e, 0x2e, 0x22,
+ 0x02, 0x6d, 0x12, 0x66, 0x75, 0x6e, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x20, 0x02, 0x5c, 0x02, 0x68,
+ 0x02, 0x3f, 0x08, 0x6c, 0x6f, 0x61, 0x64, 0x08,
+ 0x74, 0x72, 0x69, 0x6d, 0x16, 0x6c, 0x61, 0x73,
+ 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66,
+ 0x06, 0x2e, 0x6a, 0x73, 0x14, 0x6c, 0x6f, 0x61,
+ 0x64, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x02,
+ 0x78, 0x02, 0x64, 0x02, 0x74, 0x26, 0x42, 0x69,
+ 0x67, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70,
+ 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+ 0x3d, 0x10, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20,
+ 0x28, 0x7e, 0x30, 0x20, 0x64, 0x69, 0x67, 0x69,
+ 0x74, 0x73, 0x29, 0x2c, 0x20, 0x65, 0x78, 0x70,
+ 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x69,
+ 0x7a, 0x65, 0x3d, 0x0c, 0x20, 0x62, 0x69, 0x74,
+ 0x73, 0x0a, 0x06, 0x66, 0x31, 0x36, 0x06, 0x66,
+ 0x33, 0x32, 0x06, 0x66, 0x36, 0x34, 0x08, 0x66,
+ 0x31, 0x32, 0x38, 0x10, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x49, 0x6e, 0x74, 0x14, 0x65, 0x78, 0x70,
+ 0x42, 0x69, 0x74, 0x73, 0x4d, 0x61, 0x78, 0x0e,
+ 0x70, 0x72, 0x65, 0x63, 0x4d, 0x69, 0x6e, 0x0e,
+ 0x70, 0x72, 0x65, 0x63, 0x4d, 0x61, 0x78, 0x24,
+ 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20,
+ 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f,
+ 0x6e, 0x0a, 0x14, 0x65, 0x78, 0x70, 0x42, 0x69,
+ 0x74, 0x73, 0x4d, 0x69, 0x6e, 0x2c, 0x49, 0x6e,
+ 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x65, 0x78,
+ 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x62,
+ 0x69, 0x74, 0x73, 0x0a, 0x0c, 0x64, 0x69, 0x67,
+ 0x69, 0x74, 0x73, 0x08, 0x6d, 0x6f, 0x64, 0x65,
+ 0x1a, 0x52, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67,
+ 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x1a, 0x49,
+ 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x6d,
+ 0x6f, 0x64, 0x65, 0x0a, 0x0a, 0x63, 0x6c, 0x65,
+ 0x61, 0x72, 0x0c, 0x1b, 0x5b, 0x48, 0x1b, 0x5b,
+ 0x4a, 0x02, 0x71, 0x1a, 0x61, 0x6c, 0x67, 0x65,
+ 0x62, 0x72, 0x61, 0x69, 0x63, 0x4d, 0x6f, 0x64,
+ 0x65, 0x26, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77,
+ 0x6e, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+ 0x69, 0x76, 0x65, 0x3a, 0x20, 0x06, 0x64, 0x65,
+ 0x63, 0x06, 0x68, 0x65, 0x78, 0x06, 0x6e, 0x75,
+ 0x6d, 0x06, 0x61, 0x6c, 0x67, 0x2c, 0x5c, 0x68,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x68,
+ 0x65, 0x6c, 0x70, 0x0a, 0x16, 0x5c, 0x78, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x36, 0x68, 0x65, 0x78, 0x61, 0x64, 0x65, 0x63,
+ 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x6e, 0x75, 0x6d,
+ 0x62, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70,
+ 0x6c, 0x61, 0x79, 0x0a, 0x16, 0x5c, 0x64, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x2e, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c,
+ 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+ 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x0a,
+ 0x16, 0x5c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x2c, 0x74, 0x6f, 0x67,
+ 0x67, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x69,
+ 0x6e, 0x67, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
+ 0x61, 0x79, 0x0a, 0x3e, 0x5c, 0x63, 0x6c, 0x65,
+ 0x61, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x74, 0x68,
+ 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e,
+ 0x61, 0x6c, 0x0a, 0x16, 0x5c, 0x61, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1e,
+ 0x61, 0x6c, 0x67, 0x65, 0x62, 0x72, 0x61, 0x69,
+ 0x63, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x0a, 0x16,
+ 0x5c, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x1a, 0x6e, 0x75, 0x6d, 0x65,
+ 0x72, 0x69, 0x63, 0x20, 0x6d, 0x6f, 0x64, 0x65,
+ 0x0a, 0x66, 0x5c, 0x70, 0x20, 0x5b, 0x6d, 0x20,
+ 0x5b, 0x65, 0x5d, 0x5d, 0x20, 0x20, 0x73, 0x65,
+ 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x69,
+ 0x67, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70,
+ 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+ 0x20, 0x74, 0x6f, 0x20, 0x27, 0x6d, 0x27, 0x20,
+ 0x62, 0x69, 0x74, 0x73, 0x0a, 0x84, 0x01, 0x5c,
+ 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x6e,
+ 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74,
+ 0x68, 0x65, 0x20, 0x42, 0x69, 0x67, 0x46, 0x6c,
+ 0x6f, 0x61, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63,
+ 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f,
+ 0x20, 0x27, 0x63, 0x65, 0x69, 0x6c, 0x28, 0x6e,
+ 0x2a, 0x6c, 0x6f, 0x67, 0x32, 0x28, 0x31, 0x30,
+ 0x29, 0x29, 0x27, 0x20, 0x62, 0x69, 0x74, 0x73,
+ 0x0a, 0x68, 0x5c, 0x6d, 0x6f, 0x64, 0x65, 0x20,
+ 0x5b, 0x73, 0x74, 0x64, 0x7c, 0x6d, 0x61, 0x74,
+ 0x68, 0x5d, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67,
+ 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75,
+ 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f,
+ 0x64, 0x65, 0x20, 0x28, 0x63, 0x75, 0x72, 0x72,
+ 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x04, 0x29,
+ 0x0a, 0x22, 0x5c, 0x71, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78,
+ 0x69, 0x74, 0x0a, 0x06, 0x73, 0x65, 0x6c, 0x3a,
+ 0x51, 0x4a, 0x53, 0x43, 0x61, 0x6c, 0x63, 0x20,
+ 0x2d, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x22,
+ 0x5c, 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20,
+ 0x68, 0x65, 0x6c, 0x70, 0x0a, 0x3a, 0x51, 0x75,
+ 0x69, 0x63, 0x6b, 0x4a, 0x53, 0x20, 0x2d, 0x20,
+ 0x54, 0x79, 0x70, 0x65, 0x20, 0x22, 0x5c, 0x68,
+ 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x65,
+ 0x6c, 0x70, 0x0a, 0x06, 0x6c, 0x6f, 0x67, 0x08,
+ 0x20, 0x20, 0x20, 0x20, 0x0e, 0x73, 0x65, 0x74,
+ 0x50, 0x72, 0x65, 0x63, 0x08, 0x62, 0x69, 0x6e,
+ 0x64, 0x26, 0x22, 0x75, 0x73, 0x65, 0x20, 0x6d,
+ 0x61, 0x74, 0x68, 0x22, 0x3b, 0x20, 0x76, 0x6f,
+ 0x69, 0x64, 0x20, 0x30, 0x3b, 0x06, 0x6e, 0x6f,
+ 0x77, 0x14, 0x65, 0x76, 0x61, 0x6c, 0x53, 0x63,
+ 0x72, 0x69, 0x70, 0x74, 0x22, 0x62, 0x61, 0x63,
+ 0x6b, 0x74, 0x72, 0x61, 0x63, 0x65, 0x5f, 0x62,
+ 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x0e, 0x63,
+ 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x0e, 0x54,
+ 0x68, 0x72, 0x6f, 0x77, 0x3a, 0x20, 0x04, 0x67,
+ 0x63, 0x02, 0x7c, 0x6a, 0x62, 0x72, 0x65, 0x61,
+ 0x6b, 0x7c, 0x63, 0x61, 0x73, 0x65, 0x7c, 0x63,
+ 0x61, 0x74, 0x63, 0x68, 0x7c, 0x63, 0x6f, 0x6e,
+ 0x74, 0x69, 0x6e, 0x75, 0x65, 0x7c, 0x64, 0x65,
+ 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x7c, 0x64,
+ 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x64,
+ 0x65, 0x6c, 0x65, 0x74, 0x65, 0x7c, 0x64, 0x6f,
+ 0x7c, 0x5e, 0x65, 0x6c, 0x73, 0x65, 0x7c, 0x66,
+ 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x7c, 0x66,
+ 0x6f, 0x72, 0x7c, 0x66, 0x75, 0x6e, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x7c, 0x69, 0x66, 0x7c, 0x69,
+ 0x6e, 0x7c, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+ 0x63, 0x65, 0x6f, 0x66, 0x7c, 0x6e, 0x65, 0x77,
+ 0x7c, 0x5e, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+ 0x7c, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x7c,
+ 0x74, 0x68, 0x69, 0x73, 0x7c, 0x74, 0x68, 0x72,
+ 0x6f, 0x77, 0x7c, 0x74, 0x72, 0x79, 0x7c, 0x74,
+ 0x79, 0x70, 0x65, 0x6f, 0x66, 0x7c, 0x77, 0x68,
+ 0x69, 0x6c, 0x65, 0x7c, 0x77, 0x69, 0x74, 0x68,
+ 0x7c, 0x5a, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x7c,
+ 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x7c, 0x65, 0x6e,
+ 0x75, 0x6d, 0x7c, 0x69, 0x6d, 0x70, 0x6f, 0x72,
+ 0x74, 0x7c, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74,
+ 0x7c, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x73,
+ 0x7c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x7c, 0x66,
+ 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+ 0x74, 0x73, 0x7c, 0x69, 0x6e, 0x74, 0x65, 0x72,
+ 0x66, 0x61, 0x63, 0x65, 0x7c, 0x6c, 0x65, 0x74,
+ 0x7c, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67, 0x65,
+ 0x7c, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+ 0x7c, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74,
+ 0x65, 0x64, 0x7c, 0x28, 0x70, 0x75, 0x62, 0x6c,
+ 0x69, 0x63, 0x7c, 0x73, 0x74, 0x61, 0x74, 0x69,
+ 0x63, 0x7c, 0x79, 0x69, 0x65, 0x6c, 0x64, 0x7c,
+ 0x4e, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+ 0x65, 0x64, 0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7c,
+ 0x74, 0x72, 0x75, 0x65, 0x7c, 0x66, 0x61, 0x6c,
+ 0x73, 0x65, 0x7c, 0x49, 0x6e, 0x66, 0x69, 0x6e,
+ 0x69, 0x74, 0x79, 0x7c, 0x4e, 0x61, 0x4e, 0x7c,
+ 0x1e, 0x65, 0x76, 0x61, 0x6c, 0x7c, 0x61, 0x72,
+ 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x7c,
+ 0x0c, 0x61, 0x77, 0x61, 0x69, 0x74, 0x7c, 0x7a,
+ 0x7c, 0x74, 0x68, 0x69, 0x73, 0x7c, 0x73, 0x75,
+ 0x70, 0x65, 0x72, 0x7c, 0x75, 0x6e, 0x64, 0x65,
+ 0x66, 0x69, 0x6e, 0x65, 0x64, 0x7c, 0x6e, 0x75,
+ 0x6c, 0x6c, 0x7c, 0x74, 0x72, 0x75, 0x65, 0x7c,
+ 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7c, 0x49, 0x6e,
+ 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x7c, 0x4e,
+ 0x61, 0x4e, 0x7c, 0x61, 0x72, 0x67, 0x75, 0x6d,
+ 0x65, 0x6e, 0x74, 0x73, 0x7c, 0x14, 0x7c, 0x76,
+ 0x6f, 0x69, 0x64, 0x7c, 0x76, 0x61, 0x72, 0x7c,
+ 0x02, 0x2b, 0x02, 0x60, 0x02, 0x7b, 0x14, 0x70,
+ 0x75, 0x73, 0x68, 0x5f, 0x73, 0x74, 0x61, 0x74,
+ 0x65, 0x14, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x12, 0x70, 0x6f, 0x70,
+ 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x26, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x5f, 0x62, 0x6c, 0x6f,
+ 0x63, 0x6b, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x65,
+ 0x6e, 0x74, 0x0a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+ 0x02, 0x69, 0x06, 0x73, 0x74, 0x72, 0x24, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x5f, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+ 0x74, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f,
+ 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x16, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x67,
+ 0x65, 0x78, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65,
+ 0x5f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x69, 0x64,
+ 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+ 0x12, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x79,
+ 0x6c, 0x65, 0x0d, 0xc6, 0x03, 0x02, 0xc8, 0x03,
+ 0xca, 0x03, 0x00, 0x00, 0x02, 0x00, 0xfc, 0x01,
+ 0x00, 0x01, 0xfc, 0x01, 0x01, 0x00, 0x0c, 0x20,
+ 0x02, 0x03, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x02,
+ 0x02, 0x01, 0x0f, 0x00, 0xc8, 0x03, 0x00, 0x0d,
+ 0xca, 0x03, 0x01, 0x0d, 0x08, 0xef, 0x02, 0x29,
+ 0xc5, 0x00, 0x38, 0x8c, 0x00, 0x00, 0x00, 0xf4,
+ 0x0e, 0x06, 0x2e, 0x0c, 0x43, 0x02, 0x03, 0x00,
+ 0x01, 0x7b, 0x01, 0x02, 0x02, 0x4b, 0x90, 0x0a,
+ 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x0c, 0xc5,
+ 0x00, 0xc8, 0x2b, 0xc5, 0x01, 0xc8, 0x2c, 0xc5,
+ 0x02, 0xc8, 0x2d, 0xc5, 0x03, 0xc8, 0x2e, 0xc5,
+ 0x04, 0xc8, 0x2f, 0xc5, 0x05, 0xc8, 0x30, 0xc5,
+ 0x06, 0xc8, 0x31, 0xc5, 0x07, 0xc8, 0x32, 0xc5,
+ 0x08, 0xc8, 0x33, 0xc5, 0x09, 0xc8, 0x34, 0xc5,
+ 0x0a, 0xc8, 0x35, 0xc5, 0x0b, 0xc8, 0x36, 0xc5,
+ 0x0c, 0xc8, 0x37, 0xc5, 0x0d, 0xc8, 0x38, 0xc5,
+ 0x0e, 0xc8, 0x39, 0xc5, 0x0f, 0xc8, 0x3a, 0xc5,
+ 0x10, 0xc8, 0x3b, 0xc5, 0x11, 0xc8, 0x3c, 0xc5,
+ 0x12, 0xc8, 0x3d, 0xc5, 0x13, 0xc8, 0x3e, 0xc5,
+ 0x14, 0xc8, 0x3f, 0xc5, 0x15, 0xc8, 0x40, 0xc5,
+ 0x16, 0xc8, 0x41, 0xc5, 0x17, 0xc8, 0x42, 0xc5,
+ 0x18, 0xc8, 0x43, 0xc5, 0x19, 0xc8, 0x44, 0xc5,
+ 0x1a, 0xc8, 0x45, 0xc5, 0x1b, 0xc8, 0x46, 0xc5,
+ 0x1c, 0xc8, 0x47, 0xc5, 0x1d, 0xc8, 0x48, 0xc5,
+ 0x1e, 0xc8, 0x49, 0xc5, 0x1f, 0xc8, 0x4a, 0xc5,
+ 0x20, 0xc8, 0x4b, 0xc5, 0x21, 0xc8, 0x4c, 0xc5,
+ 0x22, 0xc8, 0x4d, 0xc5, 0x23, 0xc8, 0x4e, 0xc5,
+ 0x24, 0xc8, 0x4f, 0xc5, 0x25, 0xc8, 0x50, 0xc5,
+ 0x26, 0xc8, 0x51, 0xc5, 0x27, 0xc8, 0x52, 0xc5,
+ 0x28, 0xc8, 0x53, 0xc5, 0x29, 0xc8, 0x54, 0xc5,
+ 0x2a, 0xc8, 0x55, 0xc5, 0x2b, 0xc8, 0x56, 0xc5,
+ 0x2c, 0xc8, 0x57, 0xc5, 0x2d, 0xc8, 0x58, 0xc5,
+ 0x2e, 0xc8, 0x59, 0xc5, 0x2f, 0xc8, 0x5a, 0xc5,
+ 0x30, 0xc8, 0x5b, 0xc5, 0x31, 0xc8, 0x5c, 0xc5,
+ 0x32, 0xc8, 0x5d, 0xc5, 0x33, 0xc8, 0x5e, 0xc5,
+ 0x34, 0xc8, 0x5f, 0xc5, 0x35, 0xc8, 0x61, 0xc5,
+ 0x36, 0xc8, 0x65, 0xc5, 0x37, 0xc8, 0x66, 0xc5,
+ 0x38, 0xc8, 0x67, 0xc5, 0x39, 0xc8, 0x68, 0xc5,
+ 0x3a, 0xc8, 0x6b, 0xc5, 0x3b, 0xc8, 0x6c, 0xc5,
+ 0x3c, 0xc8, 0x6d, 0xc5, 0x3d, 0xc8, 0x6e, 0xc5,
+ 0x3e, 0xc8, 0x6f, 0xc5, 0x3f, 0xc8, 0x70, 0xc5,
+ 0x41, 0xc8, 0x71, 0xc5, 0x42, 0xc8, 0x72, 0xc5,
+ 0x43, 0xc8, 0x73, 0xc5, 0x44, 0xc8, 0x74, 0xc5,
+ 0x45, 0xc8, 0x75, 0xc5, 0x46, 0xc8, 0x76, 0xc5,
+ 0x47, 0xc8, 0x77, 0xc5, 0x48, 0xc8, 0x78, 0xc5,
+ 0x49, 0xc8, 0x79, 0xc5, 0x4a, 0xc8, 0x7a, 0xd6,
+ 0x66, 0x01, 0x00, 0xb7, 0xe5, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0xd6, 0x66, 0x00, 0x00, 0xb7, 0xe4,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0xd6, 0xb5, 0x97,
+ 0x00, 0x00, 0x00, 0x02, 0x00, 0xce, 0xd6, 0xb5,
+ 0x9b, 0x00, 0x00, 0x00, 0x03, 0x00, 0xcf, 0xd6,
+ 0xb5, 0x98, 0x00, 0x00, 0x00, 0x04, 0x00, 0xd0,
+ 0xd6, 0xb5, 0xa1, 0x00, 0x00, 0x00, 0x05, 0x00,
+ 0xd1, 0xd6, 0xb5, 0x9f, 0x00, 0x00, 0x00, 0x06,
+ 0x00, 0xc8, 0x04, 0xd6, 0xb5, 0xe6, 0x00, 0x00,
+ 0x00, 0x07, 0x00, 0xc8, 0x05, 0xd6, 0xb5, 0xe7,
+ 0x00, 0x00, 0x00, 0x08, 0x00, 0xc8, 0x06, 0x66,
+ 0x01, 0x00, 0xb5, 0xe8, 0x00, 0x00, 0x00, 0x09,
+ 0x00, 0xf9, 0xc8, 0x07, 0x37, 0xe9, 0x00, 0x00,
+ 0x00, 0xfa, 0xc8, 0x08, 0x37, 0xb5, 0x00, 0x00,
+ 0x00, 0xfa, 0xc8, 0x09, 0x0b, 0x04, 0xea, 0x00,
+ 0x00, 0x00, 0x4c, 0xeb, 0x00, 0x00, 0x00, 0x04,
+ 0xec, 0x00, 0x00, 0x00, 0x4c, 0xed, 0x00, 0x00,
+ 0x00, 0x04, 0xee, 0x00, 0x00, 0x00, 0x4c, 0xef,
+ 0x00, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00,
+ 0x4c, 0xf1, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x00,
+ 0x00, 0x00, 0x4c, 0xf3, 0x00, 0x00, 0x00, 0x04,
+ 0xf4, 0x00, 0x00, 0x00, 0x4c, 0xf5, 0x00, 0x00,
+ 0x00, 0x04, 0xf6, 0x00, 0x00, 0x00, 0x4c, 0xf7,
+ 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00,
+ 0x4c, 0xf9, 0x00, 0x00, 0x00, 0x04, 0xfa, 0x00,
+ 0x00, 0x00, 0x4c, 0xfb, 0x00, 0x00, 0x00, 0x04,
+ 0xfc, 0x00, 0x00, 0x00, 0x4c, 0xfd, 0x00, 0x00,
+ 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x4c, 0xfe,
+ 0x00, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00,
+ 0x4c, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01, 0x01,
+ 0x00, 0x00, 0x4c, 0x02, 0x01, 0x00, 0x00, 0x04,
+ 0x03, 0x01, 0x00, 0x00, 0x4c, 0x04, 0x01, 0x00,
+ 0x00, 0x04, 0x05, 0x01, 0x00, 0x00, 0x4c, 0x06,
+ 0x01, 0x00, 0x00, 0x04, 0x07, 0x01, 0x00, 0x00,
+ 0x4c, 0x08, 0x01, 0x00, 0x00, 0x04, 0x09, 0x01,
+ 0x00, 0x00, 0x4c, 0x0a, 0x01, 0x00, 0x00, 0x04,
+ 0x0b, 0x01, 0x00, 0x00, 0x4c, 0x0c, 0x01, 0x00,
+ 0x00, 0xc8, 0x0a, 0x0b, 0x04, 0x02, 0x01, 0x00,
+ 0x00, 0x4c, 0x16, 0x00, 0x00, 0x00, 0x04, 0xfb,
+ 0x00, 0x00, 0x00, 0x4c, 0x0d, 0x01, 0x00, 0x00,
+ 0x04, 0x0a, 0x01, 0x00, 0x00, 0x4c, 0x49, 0x00,
+ 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x00, 0x4c,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0xf1, 0x00, 0x00,
+ 0x00, 0x4c, 0x47, 0x00, 0x00, 0x00, 0x04, 0x0c,
+ 0x01, 0x00, 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00,
+ 0x04, 0x04, 0x01, 0x00, 0x00, 0x4c, 0x1b, 0x00,
+ 0x00, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x4c,
+ 0x10, 0x01, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00,
+ 0x00, 0x4c, 0x11, 0x01, 0x00, 0x00, 0x04, 0xef,
+ 0x00, 0x00, 0x00, 0x4c, 0x12, 0x01, 0x00, 0x00,
+ 0x04, 0x0c, 0x01, 0x00, 0x00, 0x4c, 0x13, 0x01,
+ 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x4c,
+ 0x14, 0x01, 0x00, 0x00, 0xc8, 0x0b, 0x26, 0x00,
+ 0x00, 0xc8, 0x0c, 0xc6, 0xc8, 0x0d, 0xc6, 0xc8,
+ 0x11, 0xc6, 0xc8, 0x12, 0xba, 0xc8, 0x13, 0x04,
+ 0x15, 0x01, 0x00, 0x00, 0xc8, 0x14, 0x04, 0x16,
+ 0x01, 0x00, 0x00, 0xc8, 0x15, 0x0a, 0xc8, 0x16,
+ 0x09, 0xc8, 0x17, 0x0a, 0xc8, 0x18, 0xba, 0xc8,
+ 0x1a, 0xc6, 0xc8, 0x1b, 0xba, 0xc8, 0x1c, 0xc6,
+ 0xc8, 0x1d, 0xba, 0xc8, 0x1e, 0xc6, 0xc8, 0x1f,
+ 0xba, 0xc8, 0x20, 0x09, 0xc8, 0x24, 0xba, 0xc8,
+ 0x25, 0xba, 0xc8, 0x26, 0xba, 0xc8, 0x2a, 0x0b,
+ 0xc7, 0x3d, 0x4c, 0x17, 0x01, 0x00, 0x00, 0xc7,
+ 0x40, 0x4c, 0x18, 0x01, 0x00, 0x00, 0xc7, 0x5a,
+ 0x4c, 0x19, 0x01, 0x00, 0x00, 0xc7, 0x4e, 0x4c,
+ 0x1a, 0x01, 0x00, 0x00, 0xc7, 0x3e, 0x4c, 0x1b,
+ 0x01, 0x00, 0x00, 0xc7, 0x3f, 0x4c, 0x1c, 0x01,
+ 0x00, 0x00, 0xc7, 0x3b, 0x4c, 0x1d, 0x01, 0x00,
+ 0x00, 0xc7, 0x4f, 0x4c, 0x1e, 0x01, 0x00, 0x00,
+ 0xc7, 0x5f, 0x4c, 0x1f, 0x01, 0x00, 0x00, 0xc7,
+ 0x45, 0x4c, 0x20, 0x01, 0x00, 0x00, 0xc7, 0x55,
+ 0x4c, 0x21, 0x01, 0x00, 0x00, 0xc7, 0x45, 0x4c,
+ 0x22, 0x01, 0x00, 0x00, 0xc7, 0x48, 0x4c, 0x23,
+ 0x01, 0x00, 0x00, 0xc7, 0x47, 0x4c, 0x24, 0x01,
+ 0x00, 0x00, 0xc7, 0x3a, 0x4c, 0x25, 0x01, 0x00,
+ 0x00, 0xc7, 0x3c, 0x4c, 0x26, 0x01, 0x00, 0x00,
+ 0xc7, 0x3c, 0x4c, 0x27, 0x01, 0x00, 0x00, 0xc7,
+ 0x50, 0x4c, 0x28, 0x01, 0x00, 0x00, 0xc7, 0x5b,
+ 0x4c, 0x29, 0x01, 0x00, 0x00, 0xc7, 0x59, 0x4c,
+ 0x2a, 0x01, 0x00, 0x00, 0xc7, 0x47, 0x4c, 0x2b,
+ 0x01, 0x00, 0x00, 0xc7, 0x48, 0x4c, 0x2c, 0x01,
+ 0x00, 0x00, 0xc7, 0x3f, 0x4c, 0x2d, 0x01, 0x00,
+ 0x00, 0xc7, 0x40, 0x4c, 0x2e, 0x01, 0x00, 0x00,
+ 0xc7, 0x43, 0x4c, 0x2f, 0x01, 0x00, 0x00, 0xc7,
+ 0x44, 0x4c, 0x30, 0x01, 0x00, 0x00, 0xc7, 0x43,
+ 0x4c, 0x31, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x4c,
+ 0x32, 0x01, 0x00, 0x00, 0xc7, 0x3d, 0x4c, 0x33,
+ 0x01, 0x00, 0x00, 0xc7, 0x4d, 0x4c, 0x34, 0x01,
+ 0x00, 0x00, 0xc7, 0x3e, 0x4c, 0x35, 0x01, 0x00,
+ 0x00, 0xc7, 0x4a, 0x4c, 0x36, 0x01, 0x00, 0x00,
+ 0xc7, 0x4b, 0x4c, 0x37, 0x01, 0x00, 0x00, 0xc7,
+ 0x47, 0x4c, 0x38, 0x01, 0x00, 0x00, 0xc7, 0x48,
+ 0x4c, 0x39, 0x01, 0x00, 0x00, 0xc7, 0x3f, 0x4c,
+ 0x3a, 0x01, 0x00, 0x00, 0xc7, 0x40, 0x4c, 0x3b,
+ 0x01, 0x00, 0x00, 0xc7, 0x3e, 0x4c, 0x3c, 0x01,
+ 0x00, 0x00, 0xc7, 0x3d, 0x4c, 0x3d, 0x01, 0x00,
+ 0x00, 0xc7, 0x58, 0x4c, 0x3e, 0x01, 0x00, 0x00,
+ 0xc7, 0x44, 0x4c, 0x3f, 0x01, 0x00, 0x00, 0xc7,
+ 0x57, 0x4c, 0x40, 0x01, 0x00, 0x00, 0xc7, 0x43,
+ 0x4c, 0x41, 0x01, 0x00, 0x00, 0xc7, 0x56, 0x4c,
+ 0x42, 0x01, 0x00, 0x00, 0xc7, 0x53, 0x4c, 0x43,
+ 0x01, 0x00, 0x00, 0xc7, 0x51, 0x4c, 0x44, 0x01,
+ 0x00, 0x00, 0xc7, 0x52, 0x4c, 0x45, 0x01, 0x00,
+ 0x00, 0xc7, 0x4f, 0x4c, 0x46, 0x01, 0x00, 0x00,
+ 0xc8, 0x60, 0x09, 0xc8, 0x69, 0x04, 0xe4, 0x00,
+ 0x00, 0x00, 0xc8, 0x6a, 0xc7, 0x07, 0x6a, 0x90,
+ 0x00, 0x00, 0x00, 0x0b, 0x04, 0xed, 0x00, 0x00,
+ 0x00, 0x4c, 0x16, 0x00, 0x00, 0x00, 0x04, 0xfb,
+ 0x00, 0x00, 0x00, 0x4c, 0x0d, 0x01, 0x00, 0x00,
+ 0x04, 0xf1, 0x00, 0x00, 0x00, 0x4c, 0x49, 0x00,
+ 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x00, 0x4c,
+ 0x0e, 0x01, 0x00, 0x00, 0x04, 0xf1, 0x00, 0x00,
+ 0x00, 0x4c, 0x47, 0x00, 0x00, 0x00, 0x04, 0xf5,
+ 0x00, 0x00, 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00,
+ 0x04, 0xfd, 0x00, 0x00, 0x00, 0x4c, 0x1b, 0x00,
+ 0x00, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x4c,
+ 0x10, 0x01, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00,
+ 0x00, 0x4c, 0x11, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0x01, 0x00, 0x00, 0x4c, 0x12, 0x01, 0x00, 0x00,
+ 0x04, 0xed, 0x00, 0x00, 0x00, 0x4c, 0x13, 0x01,
+ 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x4c,
+ 0x14, 0x01, 0x00, 0x00, 0xc8, 0x0b, 0x04, 0x47,
+ 0x01, 0x00, 0x00, 0xc8, 0x14, 0xd6, 0xc5, 0x40,
+ 0xb7, 0x48, 0x01, 0x00, 0x00, 0x0a, 0x00, 0xc7,
+ 0x2b, 0xf3, 0x0e, 0xc7, 0x72, 0xf3, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0x92, 0x05, 0x00, 0x01, 0x00,
+ 0x04, 0x07, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x27,
+ 0x01, 0x00, 0x00, 0x0c, 0x00, 0x29, 0x01, 0x00,
+ 0x01, 0x0c, 0x00, 0x2c, 0x01, 0x00, 0x28, 0x01,
+ 0x00, 0x2d, 0x01, 0x66, 0x01, 0x00, 0xb5, 0x0d,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x4a, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0xe6,
+ 0xc2, 0x50, 0xe8, 0x66, 0x03, 0x00, 0xb6, 0x4b,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0xe2, 0x24, 0x01,
+ 0x00, 0xef, 0x3d, 0x66, 0x03, 0x00, 0xb5, 0x4c,
+ 0x01, 0x00, 0x00, 0x03, 0x00, 0xef, 0x16, 0x66,
+ 0x03, 0x00, 0xb6, 0x4c, 0x01, 0x00, 0x00, 0x04,
+ 0x00, 0xe2, 0x24, 0x01, 0x00, 0xd2, 0xef, 0x05,
+ 0xca, 0xba, 0x47, 0xe8, 0x66, 0x03, 0x00, 0xb5,
+ 0x4d, 0x01, 0x00, 0x00, 0x05, 0x00, 0xef, 0x10,
+ 0x66, 0x03, 0x00, 0xb6, 0x4d, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0xe2, 0x24, 0x01, 0x00, 0x0e, 0x66,
+ 0x03, 0x00, 0xb6, 0x4e, 0x01, 0x00, 0x00, 0x07,
+ 0x00, 0x66, 0x03, 0x00, 0xb5, 0x4f, 0x01, 0x00,
+ 0x00, 0x08, 0x00, 0x5e, 0x04, 0x00, 0x24, 0x02,
+ 0x00, 0x0e, 0x38, 0xaa, 0x00, 0x00, 0x00, 0x11,
+ 0xc2, 0x40, 0x21, 0x01, 0x00, 0x5f, 0x05, 0x00,
+ 0x66, 0x03, 0x00, 0xb6, 0x50, 0x01, 0x00, 0x00,
+ 0x09, 0x00, 0xe2, 0x5e, 0x06, 0x00, 0x24, 0x02,
+ 0x00, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xa2, 0x05,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00,
+ 0xa4, 0x05, 0x2e, 0x01, 0xe2, 0xbd, 0xf4, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0xa6, 0x05, 0x00, 0x02,
+ 0x00, 0x06, 0x04, 0x00, 0x2b, 0x00, 0x00, 0x01,
+ 0x0c, 0x00, 0x27, 0x01, 0x00, 0x28, 0x01, 0x00,
+ 0x2e, 0x01, 0x66, 0x00, 0x00, 0xb6, 0x54, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe4, 0xb5, 0x55,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xba, 0xe4, 0xee,
+ 0x24, 0x04, 0x00, 0xce, 0xba, 0xcf, 0xcb, 0xca,
+ 0xfb, 0x0b, 0xe5, 0xe4, 0xcb, 0x47, 0xf4, 0x0e,
+ 0x94, 0x01, 0xf1, 0xf3, 0x29, 0x0c, 0x43, 0x02,
+ 0x03, 0xa4, 0x05, 0x01, 0x00, 0x01, 0x04, 0x04,
+ 0x00, 0x5f, 0x00, 0x00, 0x16, 0x01, 0x00, 0x67,
+ 0x01, 0x00, 0x25, 0x01, 0x00, 0x26, 0x01, 0xe2,
+ 0x97, 0xef, 0x06, 0xe3, 0xd6, 0xf4, 0x0e, 0x29,
+ 0xe4, 0xba, 0xad, 0xef, 0x24, 0xd6, 0xc3, 0x80,
+ 0x00, 0xa7, 0xef, 0x1d, 0xd6, 0xc3, 0xc0, 0x00,
+ 0xa4, 0xef, 0x16, 0xe5, 0xc0, 0xa1, 0xd6, 0xc2,
+ 0x3f, 0xae, 0xb0, 0xe9, 0xe4, 0x8f, 0xec, 0xba,
+ 0xac, 0xef, 0x33, 0xe3, 0xe5, 0xf4, 0x0e, 0x29,
+ 0xd6, 0xc3, 0xc0, 0x00, 0xa7, 0xef, 0x21, 0xd6,
+ 0xc3, 0xf8, 0x00, 0xa4, 0xef, 0x1a, 0xbb, 0xd6,
+ 0xc3, 0xe0, 0x00, 0xa7, 0x9e, 0xd6, 0xc3, 0xf0,
+ 0x00, 0xa7, 0x9e, 0xe8, 0xd6, 0xbb, 0xc0, 0xe4,
+ 0x9f, 0xa1, 0xbb, 0x9f, 0xae, 0xe9, 0x29, 0xba,
+ 0xe8, 0xe3, 0xd6, 0xf4, 0x0e, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0xac, 0x05, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x35, 0x00, 0xd6, 0x98, 0x04, 0x49,
+ 0x00, 0x00, 0x00, 0xac, 0x11, 0xef, 0x2a, 0x0e,
+ 0xd6, 0x04, 0x57, 0x01, 0x00, 0x00, 0xa7, 0x11,
+ 0xef, 0x09, 0x0e, 0xd6, 0x04, 0x58, 0x01, 0x00,
+ 0x00, 0xa5, 0x11, 0xf0, 0x14, 0x0e, 0xd6, 0x04,
+ 0x59, 0x01, 0x00, 0x00, 0xa7, 0x11, 0xef, 0x09,
+ 0x0e, 0xd6, 0x04, 0x5a, 0x01, 0x00, 0x00, 0xa5,
+ 0x28, 0x0c, 0x43, 0x02, 0x03, 0xb6, 0x05, 0x01,
+ 0x00, 0x01, 0x02, 0x00, 0x02, 0x19, 0x00, 0xd6,
+ 0x98, 0x04, 0x49, 0x00, 0x00, 0x00, 0xac, 0x11,
+ 0xef, 0x0e, 0x0e, 0xd6, 0xc4, 0x00, 0xa7, 0x11,
+ 0xef, 0x06, 0x0e, 0xd6, 0xc4, 0x01, 0xa5, 0x28,
+ 0x07, 0x02, 0x30, 0x07, 0x02, 0x39, 0x0c, 0x43,
+ 0x02, 0x03, 0xb8, 0x05, 0x01, 0x00, 0x01, 0x02,
+ 0x02, 0x00, 0x2d, 0x00, 0x00, 0x2f, 0x01, 0x00,
+ 0x30, 0x01, 0xd6, 0x98, 0x04, 0x49, 0x00, 0x00,
+ 0x00, 0xac, 0x11, 0xef, 0x22, 0x0e, 0xe2, 0xd6,
+ 0xf4, 0x11, 0xf0, 0x1b, 0x0e, 0xe3, 0xd6, 0xf4,
+ 0x11, 0xf0, 0x14, 0x0e, 0xd6, 0x04, 0x5d, 0x01,
+ 0x00, 0x00, 0xaa, 0x11, 0xf0, 0x09, 0x0e, 0xd6,
+ 0x04, 0x5e, 0x01, 0x00, 0x00, 0xaa, 0x28, 0x0c,
+ 0x43, 0x02, 0x03, 0xbe, 0x05, 0x01, 0x04, 0x01,
+ 0x03, 0x00, 0x00, 0x33, 0x00, 0xd6, 0xee, 0xd1,
+ 0xba, 0xce, 0xba, 0xd0, 0xcc, 0xcd, 0xfb, 0x27,
+ 0xd6, 0xb6, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xcc, 0x24, 0x01, 0x00, 0xd3, 0x01, 0x00, 0xdc,
+ 0x00, 0x00, 0xa4, 0x11, 0xf0, 0x09, 0x0e, 0xcb,
+ 0x01, 0x00, 0xe0, 0x00, 0x00, 0xa7, 0xef, 0x03,
+ 0x94, 0x00, 0x94, 0x02, 0xf1, 0xd7, 0xca, 0x28,
+ 0x0c, 0x43, 0x02, 0x03, 0xc2, 0x05, 0x01, 0x01,
+ 0x01, 0x03, 0x00, 0x00, 0x2b, 0x00, 0xd6, 0x98,
+ 0x04, 0x49, 0x00, 0x00, 0x00, 0xad, 0xef, 0x03,
+ 0x09, 0x28, 0xd6, 0xb6, 0x62, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xba, 0x24, 0x01, 0x00, 0xd2, 0x01,
+ 0x00, 0xdc, 0x00, 0x00, 0xa7, 0x11, 0xef, 0x09,
+ 0x0e, 0xca, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xa4,
+ 0x28, 0x0c, 0x43, 0x02, 0x03, 0xc6, 0x05, 0x02,
+ 0x00, 0x02, 0x03, 0x00, 0x00, 0x22, 0x00, 0xd6,
+ 0xd7, 0x9e, 0x11, 0x04, 0x64, 0x01, 0x00, 0x00,
+ 0xac, 0xf0, 0x12, 0x11, 0x04, 0x65, 0x01, 0x00,
+ 0x00, 0xac, 0xf0, 0x09, 0x11, 0x04, 0x66, 0x01,
+ 0x00, 0x00, 0xfe, 0x03, 0x0a, 0x28, 0x0e, 0x09,
+ 0x28, 0x0c, 0x43, 0x02, 0x03, 0xce, 0x05, 0x03,
+ 0x03, 0x03, 0x06, 0x03, 0x00, 0x6a, 0x00, 0x00,
+ 0x00, 0x0c, 0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01,
+ 0xd7, 0xcf, 0xcb, 0xd6, 0xee, 0xa4, 0xef, 0x62,
+ 0xd8, 0xcb, 0xd2, 0x47, 0xd0, 0xcb, 0x90, 0xd3,
+ 0xd6, 0xee, 0xfb, 0x08, 0xd8, 0xcb, 0x47, 0xcc,
+ 0xaa, 0xf0, 0xf3, 0x66, 0x00, 0x00, 0xb6, 0x68,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe4, 0xcc,
+ 0x47, 0x11, 0xf0, 0x07, 0x0e, 0x04, 0x16, 0x00,
+ 0x00, 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xd6, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0xca, 0xcb, 0x24, 0x02, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x03, 0x00, 0xe3, 0x04, 0xeb, 0x00,
+ 0x00, 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0xf1,
+ 0x9a, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xd4, 0x05,
+ 0x02, 0x00, 0x02, 0x05, 0x01, 0x00, 0x1f, 0x00,
+ 0x00, 0x00, 0x0c, 0x66, 0x00, 0x00, 0xb6, 0x68,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6b, 0x01,
+ 0x00, 0x00, 0xd6, 0xbb, 0xab, 0xef, 0x04, 0xd6,
+ 0xf1, 0x02, 0xc6, 0x9e, 0xd7, 0x9e, 0x24, 0x01,
+ 0x00, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xd8, 0x05,
+ 0x01, 0x02, 0x01, 0x04, 0x05, 0x00, 0xa7, 0x01,
+ 0x00, 0x00, 0x2a, 0x01, 0x00, 0x29, 0x01, 0x00,
+ 0x00, 0x0c, 0x00, 0x04, 0x01, 0x00, 0x36, 0x01,
+ 0xd6, 0xba, 0xa6, 0xef, 0x51, 0xd6, 0xba, 0xab,
+ 0x6a, 0x9d, 0x00, 0x00, 0x00, 0xe2, 0xe3, 0xbb,
+ 0x9f, 0xaa, 0xef, 0x1b, 0x66, 0x02, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xba,
+ 0xe6, 0xd6, 0x8f, 0xda, 0xf1, 0xd8, 0xe5, 0xb6,
+ 0x6d, 0x01, 0x00, 0x00, 0x01, 0x00, 0xe3, 0xbb,
+ 0x9f, 0xe2, 0x9f, 0xd6, 0x24, 0x02, 0x00, 0xcf,
+ 0x5e, 0x04, 0x00, 0xcb, 0x04, 0x6e, 0x01, 0x00,
+ 0x00, 0xf5, 0x0e, 0xd6, 0xcb, 0x9f, 0xda, 0xe2,
+ 0xcb, 0x9e, 0xe6, 0xf1, 0xb1, 0xd6, 0x8d, 0xda,
+ 0xd6, 0xba, 0xab, 0xef, 0x4a, 0xe2, 0xba, 0xaa,
+ 0xef, 0x22, 0x5e, 0x04, 0x00, 0xbb, 0x04, 0x57,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x5e, 0x04, 0x00,
+ 0xe3, 0xbb, 0x9f, 0x04, 0x6e, 0x01, 0x00, 0x00,
+ 0xf5, 0x0e, 0xd6, 0x8f, 0xda, 0xe3, 0xbb, 0x9f,
+ 0xe6, 0xf1, 0xd6, 0xe5, 0xb6, 0x6d, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0xd6, 0xe2, 0x24, 0x02, 0x00,
+ 0xcf, 0x5e, 0x04, 0x00, 0xcb, 0x04, 0x6f, 0x01,
+ 0x00, 0x00, 0xf5, 0x0e, 0xd6, 0xcb, 0x9f, 0xda,
+ 0xe2, 0xcb, 0x9f, 0xe6, 0xf1, 0xb3, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0xe0, 0x05, 0x00, 0x05, 0x00,
+ 0x06, 0x0d, 0x00, 0xb2, 0x02, 0x00, 0x00, 0x1d,
+ 0x01, 0x00, 0x1f, 0x01, 0x00, 0x18, 0x01, 0x00,
+ 0x20, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x37, 0x01,
+ 0x00, 0x32, 0x01, 0x00, 0x1b, 0x01, 0x00, 0x7a,
+ 0x01, 0x00, 0x35, 0x01, 0x00, 0x2a, 0x01, 0x00,
+ 0x29, 0x01, 0x00, 0x1e, 0x01, 0xe2, 0xe3, 0xab,
+ 0x6a, 0xd6, 0x00, 0x00, 0x00, 0xe4, 0x97, 0xef,
+ 0x3a, 0xe3, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xba, 0xe5, 0x24, 0x02, 0x00, 0xe2, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x01, 0x00, 0xba, 0xe5,
+ 0x24, 0x02, 0x00, 0xaa, 0xef, 0x1d, 0x66, 0x04,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0xe2, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xe5, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xf1, 0x57, 0x5e, 0x05, 0x00, 0x5e, 0x06, 0x00,
+ 0xe3, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0xba, 0xe5, 0x24, 0x02, 0x00, 0xf4, 0x8d, 0xf4,
+ 0x0e, 0xe4, 0xef, 0x2e, 0x5e, 0x07, 0x00, 0xef,
+ 0x0e, 0x5e, 0x07, 0x00, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0x9e, 0xe2, 0x9e, 0xf1, 0x02, 0xe2, 0xd4,
+ 0xee, 0xe2, 0xee, 0x9f, 0xd1, 0x5e, 0x08, 0x00,
+ 0xcc, 0xf4, 0xc8, 0x04, 0x5e, 0x09, 0x00, 0xcc,
+ 0xcd, 0xc7, 0x04, 0xbc, 0x47, 0xf6, 0x0e, 0xf1,
+ 0x10, 0x66, 0x04, 0x00, 0xb6, 0x68, 0x01, 0x00,
+ 0x00, 0x05, 0x00, 0xe2, 0x24, 0x01, 0x00, 0x0e,
+ 0x5e, 0x0a, 0x00, 0x5e, 0x06, 0x00, 0xe2, 0xf4,
+ 0x9e, 0x5e, 0x0b, 0x00, 0x9d, 0x60, 0x0a, 0x00,
+ 0xba, 0xaa, 0xef, 0x14, 0x66, 0x04, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x06, 0x00, 0x04, 0x71,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x66,
+ 0x04, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x07,
+ 0x00, 0x04, 0x72, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xe2, 0xe7, 0xe2, 0xee, 0xe9, 0x5e,
+ 0x0c, 0x00, 0xe5, 0xfd, 0x1b, 0x5e, 0x05, 0x00,
+ 0x5e, 0x06, 0x00, 0xe2, 0xb6, 0x69, 0x01, 0x00,
+ 0x00, 0x08, 0x00, 0xe5, 0x5e, 0x0c, 0x00, 0x24,
+ 0x02, 0x00, 0xf4, 0xf4, 0x0e, 0xf1, 0x20, 0x5e,
+ 0x0c, 0x00, 0xe5, 0xfb, 0x1a, 0x5e, 0x05, 0x00,
+ 0x5e, 0x06, 0x00, 0xe2, 0xb6, 0x69, 0x01, 0x00,
+ 0x00, 0x09, 0x00, 0x5e, 0x0c, 0x00, 0xe5, 0x24,
+ 0x02, 0x00, 0xf4, 0x8d, 0xf4, 0x0e, 0x5e, 0x0c,
+ 0x00, 0xe9, 0x66, 0x04, 0x00, 0xb5, 0x73, 0x01,
+ 0x00, 0x00, 0x0a, 0x00, 0xb6, 0x74, 0x01, 0x00,
+ 0x00, 0x0b, 0x00, 0x24, 0x00, 0x00, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0xea, 0x05, 0x01, 0x00, 0x01,
+ 0x04, 0x02, 0x00, 0x26, 0x00, 0x00, 0x1d, 0x01,
+ 0x00, 0x1e, 0x01, 0xd6, 0xef, 0x23, 0xe2, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0xba, 0xe3,
+ 0x24, 0x02, 0x00, 0xd6, 0x9e, 0xe2, 0xb6, 0x69,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xe3, 0x24, 0x01,
+ 0x00, 0x9e, 0xe6, 0xe3, 0xd6, 0xee, 0x9e, 0xe7,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0xec, 0x05, 0x00,
+ 0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0xee,
+ 0x05, 0x24, 0x01, 0x0a, 0xe6, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x01,
+ 0x02, 0x00, 0x07, 0x00, 0xf2, 0x05, 0x1d, 0x01,
+ 0xf4, 0x05, 0x1e, 0x01, 0xc6, 0xe6, 0xba, 0xe7,
+ 0xc2, 0xfe, 0x28, 0x0c, 0x43, 0x02, 0x03, 0xf6,
+ 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xf8, 0x05,
+ 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00,
+ 0xf4, 0x05, 0x1e, 0x01, 0xba, 0xe6, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0xfa, 0x05, 0x00, 0x00, 0x00,
+ 0x01, 0x02, 0x00, 0x04, 0x00, 0xf4, 0x05, 0x1e,
+ 0x01, 0xf2, 0x05, 0x1d, 0x01, 0xe3, 0xee, 0xe6,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0xfc, 0x05, 0x00,
+ 0x00, 0x00, 0x04, 0x03, 0x00, 0x1e, 0x00, 0xf4,
+ 0x05, 0x1e, 0x01, 0xf2, 0x05, 0x1d, 0x01, 0xc2,
+ 0x05, 0x33, 0x01, 0xe2, 0xe3, 0xee, 0xfb, 0x19,
+ 0xe2, 0x90, 0xe6, 0xe4, 0xe3, 0xb6, 0x7f, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xe2, 0x24, 0x01, 0x00,
+ 0xf4, 0xef, 0x06, 0xe2, 0x90, 0xe6, 0xf1, 0xec,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0x80, 0x06, 0x00,
+ 0x00, 0x00, 0x04, 0x03, 0x00, 0x1d, 0x00, 0xf4,
+ 0x05, 0x1e, 0x01, 0xc2, 0x05, 0x33, 0x01, 0xf2,
+ 0x05, 0x1d, 0x01, 0xe2, 0xba, 0xfd, 0x19, 0xe2,
+ 0x8f, 0xe6, 0xe3, 0xe4, 0xb6, 0x7f, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xe2, 0x24, 0x01, 0x00, 0xf4,
+ 0xef, 0x06, 0xe2, 0x8f, 0xe6, 0xf1, 0xec, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0x82, 0x06, 0x01, 0x00,
+ 0x01, 0x04, 0x02, 0x00, 0x37, 0x00, 0x00, 0x1d,
+ 0x01, 0x00, 0x31, 0x01, 0xd6, 0xe2, 0xee, 0xfb,
+ 0x17, 0xe3, 0xe2, 0xb6, 0x7f, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00, 0xf4, 0x97,
+ 0xef, 0x06, 0xd6, 0x90, 0xda, 0xf1, 0xe6, 0xd6,
+ 0xe2, 0xee, 0xfb, 0x16, 0xe3, 0xe2, 0xb6, 0x7f,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xd6, 0x24, 0x01,
+ 0x00, 0xf4, 0xef, 0x06, 0xd6, 0x90, 0xda, 0xf1,
+ 0xe7, 0xd6, 0x28, 0x0c, 0x43, 0x02, 0x03, 0x84,
+ 0x06, 0x01, 0x00, 0x01, 0x05, 0x02, 0x00, 0x39,
+ 0x00, 0x00, 0x31, 0x01, 0x00, 0x1d, 0x01, 0xd6,
+ 0xba, 0xfd, 0x19, 0xe2, 0xe3, 0xb6, 0x7f, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xd6, 0xbb, 0x9f, 0x24,
+ 0x01, 0x00, 0xf4, 0x97, 0xef, 0x06, 0xd6, 0x8f,
+ 0xda, 0xf1, 0xe5, 0xd6, 0xba, 0xfd, 0x18, 0xe2,
+ 0xe3, 0xb6, 0x7f, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0xd6, 0xbb, 0x9f, 0x24, 0x01, 0x00, 0xf4, 0xef,
+ 0x06, 0xd6, 0x8f, 0xda, 0xf1, 0xe6, 0xd6, 0x28,
+ 0x0c, 0x43, 0x02, 0x03, 0x86, 0x06, 0x00, 0x00,
+ 0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0xf4, 0x05,
+ 0x1e, 0x01, 0x82, 0x06, 0x41, 0x01, 0xe3, 0xe2,
+ 0xf4, 0xe6, 0x29, 0x0c, 0x43, 0x02, 0x03, 0x88,
+ 0x06, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x05,
+ 0x00, 0xf4, 0x05, 0x1e, 0x01, 0x84, 0x06, 0x42,
+ 0x01, 0xe3, 0xe2, 0xf4, 0xe6, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0x8a, 0x06, 0x00, 0x00, 0x00, 0x03,
+ 0x03, 0x00, 0x19, 0x00, 0xc8, 0x03, 0x00, 0x0c,
+ 0x8c, 0x06, 0x46, 0x01, 0xf2, 0x05, 0x1d, 0x01,
+ 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xe3, 0xe4, 0xf4, 0x0e, 0xb9,
+ 0x28, 0x0c, 0x43, 0x02, 0x03, 0x8c, 0x06, 0x01,
+ 0x00, 0x01, 0x03, 0x02, 0x00, 0x14, 0x00, 0x00,
+ 0x0c, 0x01, 0x00, 0x21, 0x01, 0xd6, 0xef, 0x0e,
+ 0xe2, 0xb6, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xd6, 0x24, 0x01, 0x00, 0x0e, 0xe2, 0xee, 0xe7,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0x90, 0x06, 0x00,
+ 0x00, 0x00, 0x03, 0x04, 0x00, 0x21, 0x00, 0x92,
+ 0x06, 0x21, 0x01, 0x94, 0x06, 0x0c, 0x01, 0xf2,
+ 0x05, 0x1d, 0x01, 0xf4, 0x05, 0x1e, 0x01, 0xe2,
+ 0xba, 0xfd, 0x1d, 0xe2, 0xe3, 0xee, 0xaa, 0xef,
+ 0x0e, 0xe3, 0xb6, 0x87, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xe4, 0x24, 0x01, 0x00, 0x0e, 0xe2, 0x8f,
+ 0xe6, 0xe3, 0xe2, 0x47, 0xec, 0xee, 0xe9, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0x96, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x04, 0x00, 0x11, 0x00, 0x92, 0x06,
+ 0x21, 0x01, 0x94, 0x06, 0x0c, 0x01, 0xf2, 0x05,
+ 0x1d, 0x01, 0xf4, 0x05, 0x1e, 0x01, 0xe2, 0xe3,
+ 0xee, 0xbb, 0x9f, 0xfb, 0x0a, 0xe2, 0x90, 0xe6,
+ 0xe3, 0xe2, 0x47, 0xec, 0xee, 0xe9, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0x98, 0x06, 0x01, 0x03, 0x01,
+ 0x05, 0x04, 0x00, 0x41, 0x00, 0x00, 0x1e, 0x01,
+ 0x00, 0x0c, 0x01, 0x00, 0x21, 0x01, 0x00, 0x1d,
+ 0x01, 0xe2, 0xce, 0xbb, 0xcf, 0xcb, 0xe3, 0xee,
+ 0xa5, 0xef, 0x37, 0xe3, 0xee, 0xcb, 0xd6, 0x9b,
+ 0x9e, 0xe4, 0x9e, 0xe3, 0xee, 0x9d, 0xd0, 0xe3,
+ 0xcc, 0x47, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xba, 0xca, 0x24, 0x02, 0x00, 0xe5, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x01, 0x00, 0xba, 0xca,
+ 0x24, 0x02, 0x00, 0xaa, 0xef, 0x08, 0xcc, 0xe8,
+ 0xe3, 0xcc, 0x47, 0xe9, 0x29, 0x94, 0x01, 0xf1,
+ 0xc5, 0x29, 0x0c, 0x43, 0x02, 0x03, 0x9a, 0x06,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00,
+ 0x98, 0x06, 0x49, 0x01, 0xe2, 0xb9, 0x23, 0x01,
+ 0x00, 0x0c, 0x43, 0x02, 0x03, 0x9c, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x98,
+ 0x06, 0x49, 0x01, 0xe2, 0xbb, 0x23, 0x01, 0x00,
+ 0x0c, 0x43, 0x02, 0x03, 0x9e, 0x06, 0x01, 0x02,
+ 0x01, 0x04, 0x05, 0x00, 0x6c, 0x00, 0x00, 0x1e,
+ 0x01, 0x00, 0x33, 0x01, 0x00, 0x1d, 0x01, 0x00,
+ 0x23, 0x01, 0x00, 0x54, 0x01, 0xe2, 0xce, 0xd6,
+ 0xba, 0xfb, 0x17, 0x93, 0x00, 0xe3, 0xe4, 0xb6,
+ 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0xca, 0x24,
+ 0x01, 0x00, 0xf4, 0xef, 0x05, 0x93, 0x00, 0xf1,
+ 0xed, 0xca, 0xbb, 0x9e, 0xcf, 0xe3, 0xe4, 0xb6,
+ 0x7f, 0x01, 0x00, 0x00, 0x01, 0x00, 0xcb, 0x24,
+ 0x01, 0x00, 0xf4, 0xef, 0x05, 0x94, 0x01, 0xf1,
+ 0xed, 0xca, 0xba, 0xa7, 0xef, 0x33, 0xca, 0xe4,
+ 0xee, 0xa4, 0xef, 0x2d, 0xe5, 0x5e, 0x04, 0x00,
+ 0xfe, 0x0a, 0x5e, 0x04, 0x00, 0xca, 0xcb, 0xd6,
+ 0xf6, 0x0e, 0x29, 0xe4, 0xb6, 0x69, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0xba, 0xca, 0x24, 0x02, 0x00,
+ 0xe4, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xcb, 0x24, 0x01, 0x00, 0x9e, 0xe8, 0xca, 0xe6,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0xa0, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00, 0x9e,
+ 0x06, 0x4c, 0x01, 0xe2, 0xbb, 0xf4, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0xa2, 0x06, 0x00, 0x00, 0x00,
+ 0x03, 0x03, 0x00, 0x21, 0x00, 0xf2, 0x05, 0x1d,
+ 0x01, 0xc8, 0x03, 0x00, 0x0c, 0x9e, 0x06, 0x4c,
+ 0x01, 0xe2, 0xee, 0xba, 0xaa, 0xef, 0x17, 0x66,
+ 0x01, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xc2, 0xfd, 0x28, 0xe4, 0xbb, 0xf4,
+ 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xa4, 0x06,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00,
+ 0x9e, 0x06, 0x4c, 0x01, 0xe2, 0xb9, 0xf4, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0xa6, 0x06, 0x00, 0x01,
+ 0x00, 0x06, 0x02, 0x00, 0x59, 0x00, 0x00, 0x1e,
+ 0x01, 0x00, 0x1d, 0x01, 0xe2, 0xce, 0xe3, 0xee,
+ 0xbb, 0xa6, 0xef, 0x51, 0xca, 0xba, 0xa6, 0xef,
+ 0x4c, 0xca, 0xe3, 0xee, 0xaa, 0xef, 0x03, 0x93,
+ 0x00, 0xe3, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xba, 0xca, 0xbb, 0x9f, 0x24, 0x02, 0x00,
+ 0xe3, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0xca, 0xca, 0xbb, 0x9e, 0x24, 0x02, 0x00, 0x9e,
+ 0xe3, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0xca, 0xbb, 0x9f, 0xca, 0x24, 0x02, 0x00, 0x9e,
+ 0xe3, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xca, 0xbb, 0x9e, 0x24, 0x01, 0x00, 0x9e, 0xe7,
+ 0xca, 0xbb, 0x9e, 0xe6, 0x29, 0x0c, 0x43, 0x02,
+ 0x03, 0xa8, 0x06, 0x00, 0x04, 0x00, 0x05, 0x04,
+ 0x00, 0x5f, 0x00, 0x00, 0x42, 0x01, 0x00, 0x1e,
+ 0x01, 0x00, 0x41, 0x01, 0x00, 0x1d, 0x01, 0xe2,
+ 0xe3, 0xf4, 0xce, 0xe4, 0xca, 0xf4, 0xcf, 0xe4,
+ 0xe3, 0xf4, 0xd0, 0xe2, 0xcc, 0xf4, 0xd1, 0xca,
+ 0xcb, 0xa4, 0xef, 0x4a, 0xcb, 0xe3, 0xa5, 0xef,
+ 0x45, 0xe3, 0xcd, 0xa5, 0xef, 0x40, 0xcd, 0xcc,
+ 0xa4, 0xef, 0x3b, 0xe5, 0xb6, 0x69, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xba, 0xca, 0x24, 0x02, 0x00,
+ 0xe5, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0xcd, 0xcc, 0x24, 0x02, 0x00, 0x9e, 0xe5, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x02, 0x00, 0xcb, 0xcd,
+ 0x24, 0x02, 0x00, 0x9e, 0xe5, 0xb6, 0x69, 0x01,
+ 0x00, 0x00, 0x03, 0x00, 0xca, 0xcb, 0x24, 0x02,
+ 0x00, 0x9e, 0xe9, 0xcc, 0xe7, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0xaa, 0x06, 0x00, 0x01, 0x00, 0x05,
+ 0x03, 0x00, 0x38, 0x00, 0x00, 0x41, 0x01, 0x00,
+ 0x1e, 0x01, 0x00, 0x1d, 0x01, 0xe2, 0xe3, 0xf4,
+ 0xce, 0xe4, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xba, 0xe3, 0x24, 0x02, 0x00, 0xe4, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x01, 0x00, 0xe3, 0xca,
+ 0x24, 0x02, 0x00, 0xb6, 0x96, 0x01, 0x00, 0x00,
+ 0x02, 0x00, 0x24, 0x00, 0x00, 0x9e, 0xe4, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x03, 0x00, 0xca, 0x24,
+ 0x01, 0x00, 0x9e, 0xe8, 0x29, 0x0c, 0x43, 0x02,
+ 0x03, 0xae, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+ 0x00, 0x38, 0x00, 0x00, 0x41, 0x01, 0x00, 0x1e,
+ 0x01, 0x00, 0x1d, 0x01, 0xe2, 0xe3, 0xf4, 0xce,
+ 0xe4, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xba, 0xe3, 0x24, 0x02, 0x00, 0xe4, 0xb6, 0x69,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xe3, 0xca, 0x24,
+ 0x02, 0x00, 0xb6, 0x98, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x24, 0x00, 0x00, 0x9e, 0xe4, 0xb6, 0x69,
+ 0x01, 0x00, 0x00, 0x03, 0x00, 0xca, 0x24, 0x01,
+ 0x00, 0x9e, 0xe8, 0x29, 0x0c, 0x43, 0x02, 0x03,
+ 0xb2, 0x06, 0x03, 0x01, 0x03, 0x04, 0x06, 0x00,
+ 0x61, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x23, 0x01,
+ 0x00, 0x54, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x1e,
+ 0x01, 0x00, 0x22, 0x01, 0xe2, 0xb6, 0x69, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd7, 0x24, 0x02,
+ 0x00, 0xce, 0xe3, 0xe4, 0xad, 0xef, 0x05, 0xca,
+ 0xe9, 0xf1, 0x0f, 0xd8, 0xba, 0xfb, 0x07, 0xca,
+ 0xe5, 0x9e, 0xe9, 0xf1, 0x05, 0xe5, 0xca, 0x9e,
+ 0xe9, 0xe2, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xba, 0xd6, 0x24, 0x02, 0x00, 0xe2, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x02, 0x00, 0xd7, 0x24,
+ 0x01, 0x00, 0x9e, 0xe6, 0x5e, 0x04, 0x00, 0xd7,
+ 0xfd, 0x0d, 0x5e, 0x04, 0x00, 0xd7, 0xd6, 0x9f,
+ 0x9f, 0x5f, 0x04, 0x00, 0xf1, 0x0b, 0x5e, 0x04,
+ 0x00, 0xd6, 0xfd, 0x05, 0xd6, 0x5f, 0x04, 0x00,
+ 0xe4, 0x5f, 0x05, 0x00, 0x29, 0x0c, 0x43, 0x02,
+ 0x03, 0xb4, 0x06, 0x00, 0x00, 0x00, 0x04, 0x03,
+ 0x00, 0x07, 0x00, 0xb2, 0x06, 0x54, 0x01, 0xf4,
+ 0x05, 0x1e, 0x01, 0xf2, 0x05, 0x1d, 0x01, 0xe2,
+ 0xe3, 0xe4, 0xee, 0xbb, 0xf6, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0xb6, 0x06, 0x00, 0x00, 0x00, 0x04,
+ 0x02, 0x00, 0x06, 0x00, 0xb2, 0x06, 0x54, 0x01,
+ 0xf4, 0x05, 0x1e, 0x01, 0xe2, 0xba, 0xe3, 0xb9,
+ 0xf6, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xb8, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x08, 0x00,
+ 0xb2, 0x06, 0x54, 0x01, 0xf4, 0x05, 0x1e, 0x01,
+ 0x82, 0x06, 0x41, 0x01, 0xe2, 0xe3, 0xe4, 0xe3,
+ 0xf4, 0xbb, 0xf6, 0x29, 0x0c, 0x43, 0x02, 0x03,
+ 0xba, 0x06, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00,
+ 0x08, 0x00, 0xb2, 0x06, 0x54, 0x01, 0x84, 0x06,
+ 0x42, 0x01, 0xf4, 0x05, 0x1e, 0x01, 0xe2, 0xe3,
+ 0xe4, 0xf4, 0xe4, 0xb9, 0xf6, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0xbc, 0x06, 0x00, 0x00, 0x00, 0x02,
+ 0x02, 0x00, 0x04, 0x00, 0xea, 0x05, 0x39, 0x01,
+ 0xbe, 0x06, 0x0d, 0x01, 0xe2, 0xe3, 0xf4, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0xc0, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x04, 0x00, 0x3e, 0x00, 0xc2, 0x06,
+ 0x23, 0x01, 0xc0, 0x06, 0x5a, 0x01, 0xc8, 0x03,
+ 0x00, 0x0c, 0xc4, 0x06, 0x65, 0x01, 0xe2, 0xe3,
+ 0xfe, 0x24, 0x66, 0x02, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x66, 0x02, 0x00,
+ 0xb6, 0xa3, 0x01, 0x00, 0x00, 0x01, 0x00, 0xba,
+ 0x24, 0x01, 0x00, 0x0e, 0x29, 0x66, 0x02, 0x00,
+ 0xb6, 0x68, 0x01, 0x00, 0x00, 0x02, 0x00, 0x04,
+ 0xa4, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xe5, 0xf3, 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x03,
+ 0xca, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+ 0x05, 0x00, 0xf2, 0x05, 0x1d, 0x01, 0xf4, 0x05,
+ 0x1e, 0x01, 0xc6, 0xe6, 0xba, 0xe7, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0xcc, 0x06, 0x02, 0x01, 0x02,
+ 0x04, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x31, 0x01,
+ 0xc6, 0xce, 0xd7, 0xba, 0xfd, 0x15, 0xe2, 0xd6,
+ 0xd7, 0xbb, 0x9f, 0x47, 0xf4, 0xef, 0x0c, 0xd7,
+ 0x8f, 0xdb, 0xd6, 0xd7, 0x47, 0xca, 0x9e, 0xce,
+ 0xf1, 0xe9, 0xca, 0x28, 0x0c, 0x43, 0x02, 0x03,
+ 0xce, 0x06, 0x02, 0x06, 0x02, 0x05, 0x7e, 0x02,
+ 0xad, 0x02, 0x08, 0xd0, 0x06, 0x00, 0x01, 0x00,
+ 0xd2, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x06, 0x00,
+ 0x00, 0x00, 0xd6, 0x06, 0x00, 0x01, 0x00, 0xd8,
+ 0x06, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01, 0x00,
+ 0xe4, 0x01, 0x00, 0x01, 0x00, 0x9c, 0x01, 0x00,
+ 0x01, 0x00, 0xda, 0x06, 0x00, 0x03, 0xae, 0x02,
+ 0x00, 0x01, 0xb6, 0x02, 0x01, 0x01, 0xb0, 0x02,
+ 0x02, 0x01, 0xc2, 0x02, 0x03, 0x01, 0xbe, 0x02,
+ 0x04, 0x01, 0xcc, 0x03, 0x05, 0x01, 0xce, 0x03,
+ 0x06, 0x01, 0xdc, 0x06, 0x07, 0x01, 0xde, 0x06,
+ 0x08, 0x01, 0xe0, 0x06, 0x09, 0x01, 0xe2, 0x06,
+ 0x0a, 0x01, 0xe4, 0x06, 0x0b, 0x01, 0x94, 0x06,
+ 0x0c, 0x01, 0xbe, 0x06, 0x0d, 0x01, 0xe6, 0x06,
+ 0x0e, 0x01, 0xe8, 0x06, 0x0f, 0x01, 0xea, 0x06,
+ 0x10, 0x01, 0xec, 0x06, 0x11, 0x01, 0xee, 0x06,
+ 0x12, 0x01, 0xf0, 0x06, 0x13, 0x01, 0xf2, 0x06,
+ 0x14, 0x01, 0xf4, 0x06, 0x15, 0x01, 0xf6, 0x06,
+ 0x16, 0x01, 0xf8, 0x06, 0x17, 0x01, 0xfa, 0x06,
+ 0x18, 0x01, 0xfc, 0x06, 0x19, 0x01, 0xfe, 0x06,
+ 0x1a, 0x01, 0x80, 0x07, 0x1b, 0x01, 0x82, 0x07,
+ 0x1c, 0x01, 0xf2, 0x05, 0x1d, 0x01, 0xf4, 0x05,
+ 0x1e, 0x01, 0x84, 0x07, 0x1f, 0x01, 0x86, 0x07,
+ 0x20, 0x01, 0x92, 0x06, 0x21, 0x01, 0x88, 0x07,
+ 0x22, 0x01, 0xc2, 0x06, 0x23, 0x01, 0xee, 0x05,
+ 0x24, 0x01, 0x8a, 0x07, 0x25, 0x01, 0x8c, 0x07,
+ 0x26, 0x01, 0x8e, 0x07, 0x27, 0x01, 0x90, 0x07,
+ 0x28, 0x01, 0x92, 0x07, 0x29, 0x01, 0x94, 0x07,
+ 0x2a, 0x01, 0x92, 0x05, 0x2b, 0x01, 0xa2, 0x05,
+ 0x2c, 0x01, 0xa6, 0x05, 0x2d, 0x01, 0xa4, 0x05,
+ 0x2e, 0x01, 0xac, 0x05, 0x2f, 0x01, 0xb6, 0x05,
+ 0x30, 0x01, 0xb8, 0x05, 0x31, 0x01, 0xbe, 0x05,
+ 0x32, 0x01, 0xc2, 0x05, 0x33, 0x01, 0xc6, 0x05,
+ 0x34, 0x01, 0xce, 0x05, 0x35, 0x01, 0xd4, 0x05,
+ 0x36, 0x01, 0xd8, 0x05, 0x37, 0x01, 0xe0, 0x05,
+ 0x38, 0x01, 0xea, 0x05, 0x39, 0x01, 0xec, 0x05,
+ 0x3a, 0x01, 0xf0, 0x05, 0x3b, 0x01, 0xf6, 0x05,
+ 0x3c, 0x01, 0xf8, 0x05, 0x3d, 0x01, 0xfa, 0x05,
+ 0x3e, 0x01, 0xfc, 0x05, 0x3f, 0x01, 0x80, 0x06,
+ 0x40, 0x01, 0x82, 0x06, 0x41, 0x01, 0x84, 0x06,
+ 0x42, 0x01, 0x86, 0x06, 0x43, 0x01, 0x88, 0x06,
+ 0x44, 0x01, 0x8a, 0x06, 0x45, 0x01, 0x8c, 0x06,
+ 0x46, 0x01, 0x90, 0x06, 0x47, 0x01, 0x96, 0x06,
+ 0x48, 0x01, 0x98, 0x06, 0x49, 0x01, 0x9a, 0x06,
+ 0x4a, 0x01, 0x9c, 0x06, 0x4b, 0x01, 0x9e, 0x06,
+ 0x4c, 0x01, 0xa0, 0x06, 0x4d, 0x01, 0xa2, 0x06,
+ 0x4e, 0x01, 0xa4, 0x06, 0x4f, 0x01, 0xa6, 0x06,
+ 0x50, 0x01, 0xa8, 0x06, 0x51, 0x01, 0xaa, 0x06,
+ 0x52, 0x01, 0xae, 0x06, 0x53, 0x01, 0xb2, 0x06,
+ 0x54, 0x01, 0xb4, 0x06, 0x55, 0x01, 0xb6, 0x06,
+ 0x56, 0x01, 0xb8, 0x06, 0x57, 0x01, 0xba, 0x06,
+ 0x58, 0x01, 0xbc, 0x06, 0x59, 0x01, 0xc0, 0x06,
+ 0x5a, 0x01, 0xca, 0x06, 0x5b, 0x01, 0xcc, 0x06,
+ 0x5c, 0x01, 0xce, 0x06, 0x5d, 0x01, 0x96, 0x07,
+ 0x5e, 0x01, 0x98, 0x07, 0x5f, 0x01, 0x9a, 0x07,
+ 0x60, 0x01, 0x9c, 0x07, 0x61, 0x01, 0x9e, 0x07,
+ 0x62, 0x01, 0xa0, 0x07, 0x63, 0x01, 0xa2, 0x07,
+ 0x64, 0x01, 0xc4, 0x06, 0x65, 0x01, 0xa4, 0x07,
+ 0x66, 0x01, 0xa6, 0x07, 0x67, 0x01, 0xa8, 0x07,
+ 0x68, 0x01, 0xaa, 0x07, 0x69, 0x01, 0xac, 0x07,
+ 0x6a, 0x01, 0xae, 0x07, 0x6b, 0x01, 0xb0, 0x07,
+ 0x6c, 0x01, 0xb2, 0x07, 0x6d, 0x01, 0xb4, 0x07,
+ 0x6e, 0x01, 0xb6, 0x07, 0x6f, 0x01, 0xb8, 0x07,
+ 0x70, 0x01, 0xba, 0x07, 0x71, 0x01, 0xbc, 0x07,
+ 0x72, 0x01, 0xbe, 0x07, 0x73, 0x01, 0xc0, 0x07,
+ 0x74, 0x01, 0xc2, 0x07, 0x75, 0x01, 0xc4, 0x07,
+ 0x76, 0x01, 0xc6, 0x07, 0x77, 0x01, 0xc8, 0x07,
+ 0x78, 0x01, 0xca, 0x07, 0x79, 0x01, 0xcc, 0x07,
+ 0x7a, 0x01, 0xc8, 0x03, 0x00, 0x0c, 0xca, 0x03,
+ 0x01, 0x0c, 0x0c, 0x03, 0xc8, 0x04, 0x08, 0xd1,
+ 0x0c, 0x00, 0xc8, 0x05, 0xd7, 0xba, 0xa5, 0x11,
+ 0xf0, 0x18, 0x0e, 0x04, 0xe7, 0x01, 0x00, 0x00,
+ 0xb6, 0xe8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd6,
+ 0xd7, 0xbb, 0x9f, 0x47, 0x24, 0x01, 0x00, 0xba,
+ 0xa7, 0xef, 0x03, 0xe2, 0x28, 0xd7, 0xbc, 0xa7,
+ 0x6a, 0xfd, 0x00, 0x00, 0x00, 0xd6, 0xd7, 0xbb,
+ 0x9f, 0x47, 0x04, 0xe9, 0x01, 0x00, 0x00, 0xac,
+ 0x6a, 0xed, 0x00, 0x00, 0x00, 0xd7, 0x8f, 0xdb,
+ 0x0b, 0xce, 0xd6, 0xd7, 0xbb, 0x9f, 0x47, 0xd4,
+ 0x11, 0x04, 0xea, 0x01, 0x00, 0x00, 0xac, 0xf0,
+ 0x09, 0x11, 0x04, 0xeb, 0x01, 0x00, 0x00, 0xfe,
+ 0x07, 0x04, 0x59, 0x01, 0x00, 0x00, 0x28, 0x11,
+ 0x04, 0xec, 0x01, 0x00, 0x00, 0xfe, 0x05, 0x26,
+ 0x00, 0x00, 0x28, 0x11, 0x04, 0xed, 0x01, 0x00,
+ 0x00, 0xfe, 0x03, 0x0b, 0x28, 0x11, 0x04, 0xee,
+ 0x01, 0x00, 0x00, 0xfe, 0x07, 0xc4, 0x00, 0xc4,
+ 0x01, 0x33, 0x28, 0x5e, 0x32, 0x00, 0xcc, 0xf4,
+ 0x6a, 0x9b, 0x00, 0x00, 0x00, 0x5e, 0x5d, 0x00,
+ 0xd6, 0xd7, 0xf5, 0xcf, 0x04, 0x03, 0x00, 0x00,
+ 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x01,
+ 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00,
+ 0x26, 0x04, 0x00, 0xb6, 0xef, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xcb, 0x24, 0x01, 0x00, 0x11, 0xf0,
+ 0x0b, 0x0e, 0x38, 0xf0, 0x01, 0x00, 0x00, 0xcb,
+ 0x8e, 0xf4, 0x97, 0xef, 0x0d, 0x38, 0x3b, 0x00,
+ 0x00, 0x00, 0xcb, 0x31, 0x01, 0x00, 0x00, 0x00,
+ 0x28, 0xd7, 0xcb, 0xee, 0x9f, 0xbd, 0xa7, 0xef,
+ 0x1d, 0xd6, 0xd7, 0xcb, 0xee, 0x9f, 0xbb, 0x9f,
+ 0x47, 0x04, 0xee, 0x01, 0x00, 0x00, 0xac, 0xef,
+ 0x0d, 0x38, 0xa5, 0x00, 0x00, 0x00, 0x11, 0xc6,
+ 0xcb, 0x21, 0x02, 0x00, 0x28, 0x5e, 0x5e, 0x00,
+ 0xd6, 0xd7, 0xcb, 0xee, 0x9f, 0xf5, 0xd2, 0xf8,
+ 0x11, 0xf0, 0x04, 0x0e, 0xca, 0xf7, 0xef, 0x03,
+ 0xca, 0x28, 0xca, 0xe2, 0xfe, 0x13, 0xca, 0xcb,
+ 0x47, 0xf7, 0xef, 0x0d, 0x38, 0x3b, 0x00, 0x00,
+ 0x00, 0xcb, 0x31, 0x01, 0x00, 0x00, 0x00, 0x28,
+ 0xca, 0xcb, 0x47, 0x28, 0x0b, 0x28, 0x29, 0x07,
+ 0x02, 0x20, 0x07, 0x36, 0x00, 0x01, 0x00, 0x13,
+ 0x00, 0x00, 0x00, 0x01, 0x08, 0x06, 0x00, 0x00,
+ 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff, 0xff, 0x0b,
+ 0x00, 0x01, 0x20, 0x00, 0x0c, 0x00, 0x0a, 0x0c,
+ 0x43, 0x02, 0x03, 0x96, 0x07, 0x02, 0x0a, 0x02,
+ 0x04, 0x03, 0x01, 0xee, 0x01, 0x00, 0x00, 0x5c,
+ 0x01, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x01, 0xe2,
+ 0xd6, 0xd7, 0xf5, 0xce, 0xe3, 0xd6, 0xd7, 0xca,
+ 0xee, 0x9f, 0xf5, 0xd0, 0x26, 0x00, 0x00, 0xd1,
+ 0xba, 0xc8, 0x04, 0xcc, 0xcf, 0xc7, 0x04, 0xc2,
+ 0x0a, 0xa4, 0xef, 0x6f, 0xcb, 0xf8, 0xf0, 0x6b,
+ 0xcb, 0x06, 0xad, 0xef, 0x66, 0xe4, 0xb6, 0xf1,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x24, 0x01,
+ 0x00, 0xc8, 0x07, 0xba, 0xc8, 0x05, 0xc7, 0x05,
+ 0xc7, 0x07, 0xee, 0xa4, 0xef, 0x3c, 0xc7, 0x07,
+ 0xc7, 0x05, 0x47, 0xc9, 0x08, 0x98, 0x04, 0x49,
+ 0x00, 0x00, 0x00, 0xaa, 0xef, 0x28, 0xc6, 0xc7,
+ 0x08, 0x8e, 0x9e, 0xc7, 0x08, 0xab, 0xef, 0x1e,
+ 0xc7, 0x08, 0xb6, 0xf2, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xca, 0x24, 0x01, 0x00, 0xef, 0x0f, 0xcd,
+ 0xb6, 0x87, 0x01, 0x00, 0x00, 0x02, 0x00, 0xc7,
+ 0x08, 0x24, 0x01, 0x00, 0x0e, 0x94, 0x05, 0xf1,
+ 0xbe, 0xe4, 0xb6, 0x60, 0x00, 0x00, 0x00, 0x03,
+ 0x00, 0xcb, 0x24, 0x01, 0x00, 0xcf, 0x94, 0x04,
+ 0xf1, 0x8c, 0xcd, 0xee, 0xbb, 0xa6, 0xef, 0x49,
+ 0xc5, 0x00, 0xc8, 0x09, 0xc5, 0x00, 0x0e, 0xcd,
+ 0xb6, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x00, 0x62,
+ 0x09, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xbb, 0xc9,
+ 0x05, 0xc8, 0x04, 0xc7, 0x04, 0xcd, 0xee, 0xfb,
+ 0x1e, 0xcd, 0xc7, 0x04, 0x47, 0xcd, 0xc7, 0x04,
+ 0xbb, 0x9f, 0x47, 0xab, 0xef, 0x0d, 0xcd, 0xc7,
+ 0x05, 0x92, 0xc8, 0x05, 0x73, 0xcd, 0xc7, 0x04,
+ 0x47, 0x49, 0x94, 0x04, 0xf1, 0xde, 0xcd, 0xc7,
+ 0x05, 0xb7, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00,
+ 0x0b, 0xcd, 0x4c, 0xf4, 0x01, 0x00, 0x00, 0xca,
+ 0xee, 0x4c, 0xa9, 0x01, 0x00, 0x00, 0xcc, 0x4c,
+ 0xf5, 0x01, 0x00, 0x00, 0x28, 0x0c, 0x43, 0x02,
+ 0x03, 0xec, 0x07, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x32, 0x00, 0xd6, 0xba, 0x47, 0xd7, 0xba,
+ 0x47, 0xab, 0xef, 0x1b, 0xd6, 0xba, 0x47, 0x04,
+ 0x5d, 0x01, 0x00, 0x00, 0xaa, 0xef, 0x03, 0xbb,
+ 0x28, 0xd7, 0xba, 0x47, 0x04, 0x5d, 0x01, 0x00,
+ 0x00, 0xaa, 0xef, 0x03, 0xb9, 0x28, 0xd6, 0xd7,
+ 0xfb, 0x03, 0xb9, 0x28, 0xd6, 0xd7, 0xfd, 0x04,
+ 0xbb, 0x8e, 0x28, 0xba, 0x28, 0x0c, 0x43, 0x02,
+ 0x03, 0x98, 0x07, 0x00, 0x0d, 0x00, 0x07, 0x0a,
+ 0x00, 0xa1, 0x03, 0x00, 0x00, 0x5e, 0x01, 0x00,
+ 0x1d, 0x01, 0x00, 0x1e, 0x01, 0x00, 0x39, 0x01,
+ 0x00, 0x23, 0x01, 0x00, 0x5f, 0x01, 0x00, 0x04,
+ 0x01, 0x00, 0x29, 0x01, 0x00, 0x00, 0x0c, 0x00,
+ 0x65, 0x01, 0xe2, 0xe3, 0xe4, 0xf5, 0xd3, 0xb5,
+ 0xf4, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xee,
+ 0xba, 0xfe, 0x02, 0x29, 0xca, 0xba, 0x47, 0xd4,
+ 0xee, 0xc8, 0x05, 0xbb, 0xd1, 0xcd, 0xca, 0xee,
+ 0xa4, 0xef, 0x29, 0xca, 0xcd, 0x47, 0xc8, 0x06,
+ 0xba, 0xc8, 0x04, 0xc7, 0x04, 0xc7, 0x05, 0xfb,
+ 0x17, 0xc7, 0x06, 0xc7, 0x04, 0x47, 0xcc, 0xc7,
+ 0x04, 0x47, 0xad, 0xef, 0x07, 0xc7, 0x04, 0xc8,
+ 0x05, 0xf1, 0x05, 0x94, 0x04, 0xf1, 0xe5, 0x94,
+ 0x03, 0xf1, 0xd3, 0xcb, 0xb5, 0xa9, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xd1, 0xcd, 0xc7, 0x05, 0xfb,
+ 0x0b, 0xe5, 0xcc, 0xcd, 0x47, 0xf4, 0x0e, 0x94,
+ 0x03, 0xf1, 0xf2, 0x5e, 0x04, 0x00, 0x5e, 0x05,
+ 0x00, 0xac, 0xef, 0x44, 0xca, 0xee, 0xbb, 0xaa,
+ 0xef, 0x3e, 0xcb, 0xb5, 0xf5, 0x01, 0x00, 0x00,
+ 0x02, 0x00, 0xca, 0xba, 0x47, 0x47, 0xc9, 0x0c,
+ 0xfa, 0xef, 0x1a, 0xe5, 0x04, 0xf7, 0x01, 0x00,
+ 0x00, 0xf4, 0x0e, 0xc7, 0x0c, 0xee, 0xba, 0xaa,
+ 0xef, 0x1e, 0xe5, 0x04, 0xf8, 0x01, 0x00, 0x00,
+ 0xf4, 0x0e, 0xf1, 0x14, 0xc7, 0x0c, 0x98, 0x04,
+ 0x4a, 0x00, 0x00, 0x00, 0xaa, 0xef, 0x09, 0xe5,
+ 0x04, 0xe9, 0x01, 0x00, 0x00, 0xf4, 0x0e, 0x5e,
+ 0x04, 0x00, 0x5e, 0x05, 0x00, 0xac, 0x6a, 0xeb,
+ 0x00, 0x00, 0x00, 0xca, 0xee, 0xbc, 0xa7, 0x6a,
+ 0xe2, 0x00, 0x00, 0x00, 0xba, 0xc8, 0x07, 0xba,
+ 0xd1, 0xcd, 0xca, 0xee, 0xfb, 0x1a, 0x5e, 0x06,
+ 0x00, 0xb6, 0xf9, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xc7, 0x07, 0xca, 0xcd, 0x47, 0xee, 0x24, 0x02,
+ 0x00, 0xc8, 0x07, 0x94, 0x03, 0xf1, 0xe3, 0xbc,
+ 0x95, 0x07, 0x5e, 0x06, 0x00, 0xb6, 0xf9, 0x01,
+ 0x00, 0x00, 0x04, 0x00, 0xbb, 0x5e, 0x06, 0x00,
+ 0xb6, 0xfa, 0x01, 0x00, 0x00, 0x05, 0x00, 0x5e,
+ 0x07, 0x00, 0xbb, 0x9e, 0xc7, 0x07, 0x9c, 0x24,
+ 0x01, 0x00, 0x24, 0x02, 0x00, 0xc8, 0x09, 0x5e,
+ 0x06, 0x00, 0xb6, 0xfb, 0x01, 0x00, 0x00, 0x06,
+ 0x00, 0xca, 0xee, 0xc7, 0x09, 0x9c, 0x24, 0x01,
+ 0x00, 0xc8, 0x0b, 0x66, 0x08, 0x00, 0xb6, 0x68,
+ 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x20, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xba, 0xc8,
+ 0x0a, 0xc7, 0x0a, 0xc7, 0x0b, 0xa4, 0xef, 0x5e,
+ 0xba, 0xc8, 0x08, 0xc7, 0x08, 0xc7, 0x09, 0xa4,
+ 0xef, 0x3d, 0xc7, 0x08, 0xc7, 0x0b, 0x9b, 0xc7,
+ 0x0a, 0x9e, 0xd5, 0xca, 0xee, 0xa7, 0xf0, 0x2f,
+ 0xca, 0xcd, 0x47, 0xd0, 0xc7, 0x08, 0xc7, 0x09,
+ 0xbb, 0x9f, 0xab, 0xef, 0x0f, 0xcc, 0xb6, 0xfc,
+ 0x01, 0x00, 0x00, 0x08, 0x00, 0xc7, 0x07, 0x24,
+ 0x01, 0x00, 0xd0, 0x66, 0x08, 0x00, 0xb6, 0x68,
+ 0x01, 0x00, 0x00, 0x09, 0x00, 0xcc, 0x24, 0x01,
+ 0x00, 0x0e, 0x94, 0x08, 0xf1, 0xbe, 0x66, 0x08,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x0a, 0x00,
+ 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x94, 0x0a, 0xf1, 0x9d, 0x5e, 0x09, 0x00,
+ 0xf3, 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x03, 0x9c,
+ 0x07, 0x02, 0x01, 0x02, 0x02, 0x00, 0x00, 0x0f,
+ 0x00, 0xc6, 0xce, 0xd7, 0x91, 0xdb, 0xba, 0xfd,
+ 0x06, 0xd6, 0x95, 0x00, 0xf1, 0xf6, 0xca, 0x28,
+ 0x0c, 0x43, 0x02, 0x03, 0xc4, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x07, 0x00, 0x20, 0x00, 0xc8, 0x03,
+ 0x00, 0x0c, 0xee, 0x06, 0x12, 0x01, 0x94, 0x07,
+ 0x2a, 0x01, 0xbe, 0x05, 0x32, 0x01, 0x92, 0x07,
+ 0x29, 0x01, 0x84, 0x07, 0x1f, 0x01, 0x86, 0x07,
+ 0x20, 0x01, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xe3, 0x24, 0x01, 0x00,
+ 0x0e, 0xe5, 0xe3, 0xf4, 0x5e, 0x04, 0x00, 0x9d,
+ 0xe8, 0xc6, 0x5f, 0x05, 0x00, 0xba, 0x5f, 0x06,
+ 0x00, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xa4, 0x07,
+ 0x02, 0x01, 0x02, 0x05, 0x11, 0x00, 0x82, 0x01,
+ 0x00, 0x00, 0x1d, 0x01, 0x00, 0x1e, 0x01, 0x00,
+ 0x21, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x64, 0x01,
+ 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x1b,
+ 0x01, 0x00, 0x61, 0x01, 0x00, 0x13, 0x01, 0x00,
+ 0x15, 0x01, 0x00, 0x17, 0x01, 0x00, 0x1a, 0x01,
+ 0x00, 0x14, 0x01, 0x00, 0x65, 0x01, 0x00, 0x38,
+ 0x01, 0x00, 0x63, 0x01, 0xd6, 0x11, 0xf0, 0x03,
+ 0x0e, 0xc6, 0xea, 0xee, 0xe7, 0xe5, 0xee, 0xe8,
+ 0xd7, 0x5f, 0x04, 0x00, 0x5e, 0x06, 0x00, 0x5f,
+ 0x05, 0x00, 0x5e, 0x07, 0x00, 0xef, 0x22, 0x5e,
+ 0x05, 0x00, 0x5e, 0x08, 0x00, 0x04, 0xfd, 0x01,
+ 0x00, 0x00, 0x5e, 0x09, 0x00, 0x5e, 0x05, 0x00,
+ 0xee, 0x9f, 0xf5, 0x9e, 0x60, 0x05, 0x00, 0x5e,
+ 0x0a, 0x00, 0x9e, 0x5f, 0x05, 0x00, 0xf1, 0x38,
+ 0x5e, 0x0b, 0x00, 0xef, 0x22, 0x5e, 0x0c, 0x00,
+ 0xc3, 0xe8, 0x03, 0x9c, 0xce, 0x5e, 0x05, 0x00,
+ 0xca, 0xb6, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xc0, 0x24, 0x01, 0x00, 0x04, 0xfd, 0x01, 0x00,
+ 0x00, 0x9e, 0x9e, 0x5f, 0x05, 0x00, 0x5e, 0x05,
+ 0x00, 0xee, 0x5f, 0x09, 0x00, 0x5e, 0x05, 0x00,
+ 0x5e, 0x0d, 0x00, 0x9e, 0x5f, 0x05, 0x00, 0x5e,
+ 0x0e, 0x00, 0xf3, 0x0e, 0x5e, 0x0f, 0x00, 0xf3,
+ 0x0e, 0xba, 0x5f, 0x10, 0x00, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0xa6, 0x07, 0x01, 0x01, 0x01, 0x03,
+ 0x04, 0x02, 0x8c, 0x01, 0x00, 0x00, 0x01, 0x01,
+ 0x00, 0x63, 0x01, 0x00, 0x62, 0x01, 0x00, 0x68,
+ 0x01, 0xe2, 0xb6, 0xff, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xd6, 0x24, 0x01, 0x00, 0xce, 0xe3, 0x11,
+ 0xba, 0xfe, 0x16, 0xca, 0x04, 0x00, 0x02, 0x00,
+ 0x00, 0xaa, 0xef, 0x07, 0xca, 0xe8, 0xbb, 0xe7,
+ 0xf1, 0x6b, 0xe5, 0xca, 0xf4, 0x0e, 0xf1, 0x65,
+ 0x11, 0xbb, 0xac, 0xef, 0x27, 0xe4, 0xca, 0x9e,
+ 0xe8, 0xca, 0x04, 0x01, 0x02, 0x00, 0x00, 0xaa,
+ 0xef, 0x05, 0xbc, 0xe7, 0xf1, 0x4f, 0xca, 0x04,
+ 0x02, 0x02, 0x00, 0x00, 0xaa, 0xef, 0x05, 0xbd,
+ 0xe7, 0xf1, 0x42, 0xe5, 0xe4, 0xf4, 0x0e, 0xba,
+ 0xe7, 0xf1, 0x3a, 0x11, 0xbc, 0xac, 0xef, 0x27,
+ 0xe4, 0xca, 0x9e, 0xe8, 0xca, 0x04, 0x03, 0x02,
+ 0x00, 0x00, 0xaa, 0x11, 0xf0, 0x0e, 0x0e, 0xca,
+ 0xc4, 0x00, 0xa7, 0x11, 0xef, 0x06, 0x0e, 0xca,
+ 0xc4, 0x01, 0xa5, 0x97, 0xef, 0x17, 0xe5, 0xe4,
+ 0xf4, 0x0e, 0xba, 0xe7, 0xf1, 0x0f, 0x11, 0xbd,
+ 0xfe, 0x0b, 0xe4, 0xca, 0x9e, 0xe8, 0xe5, 0xe4,
+ 0xf4, 0x0e, 0xba, 0xe7, 0x29, 0x07, 0x02, 0x30,
+ 0x07, 0x02, 0x39, 0x0c, 0x43, 0x02, 0x03, 0xa8,
+ 0x07, 0x01, 0x01, 0x01, 0x05, 0x0d, 0x00, 0xaf,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x32, 0x01,
+ 0x00, 0x39, 0x01, 0x00, 0x60, 0x01, 0x00, 0x22,
+ 0x01, 0x00, 0x64, 0x01, 0x00, 0x1d, 0x01, 0x00,
+ 0x01, 0x0c, 0x00, 0x27, 0x01, 0x00, 0x23, 0x01,
+ 0x00, 0x3c, 0x01, 0x00, 0x1e, 0x01, 0x00, 0x38,
+ 0x01, 0xe2, 0xef, 0x0f, 0xe3, 0xd6, 0xf4, 0xbb,
+ 0xfe, 0x05, 0xe4, 0xd6, 0xf4, 0x0e, 0x09, 0xe6,
+ 0xf1, 0x7c, 0xe5, 0xd6, 0x47, 0xd2, 0xef, 0x58,
+ 0xca, 0x5f, 0x04, 0x00, 0xca, 0xd6, 0xf4, 0x11,
+ 0xb9, 0xfe, 0x09, 0x5e, 0x05, 0x00, 0x5e, 0x06,
+ 0x00, 0xf4, 0x29, 0x11, 0xc2, 0xfe, 0xfe, 0x07,
+ 0x5e, 0x05, 0x00, 0x07, 0xf4, 0x29, 0x11, 0xc2,
+ 0xfd, 0xfe, 0x2c, 0x66, 0x07, 0x00, 0xb6, 0x4e,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x66, 0x07, 0x00,
+ 0xb5, 0x4f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07,
+ 0x24, 0x02, 0x00, 0x0e, 0x66, 0x07, 0x00, 0xb6,
+ 0x50, 0x01, 0x00, 0x00, 0x02, 0x00, 0x5e, 0x08,
+ 0x00, 0x07, 0x24, 0x02, 0x00, 0x29, 0x0e, 0x5e,
+ 0x04, 0x00, 0x5f, 0x09, 0x00, 0xf1, 0x1f, 0xe3,
+ 0xd6, 0xf4, 0xbb, 0xfe, 0x14, 0xd6, 0x04, 0xfd,
+ 0x01, 0x00, 0x00, 0xa7, 0xef, 0x0b, 0xe4, 0xd6,
+ 0xf4, 0x0e, 0xe4, 0x5f, 0x09, 0x00, 0xf1, 0x06,
+ 0x5e, 0x0a, 0x00, 0xf3, 0x0e, 0x5e, 0x0b, 0x00,
+ 0xba, 0xfb, 0x04, 0xba, 0xf1, 0x13, 0x5e, 0x0b,
+ 0x00, 0x5e, 0x06, 0x00, 0xee, 0xfd, 0x07, 0x5e,
+ 0x06, 0x00, 0xee, 0xf1, 0x04, 0x5e, 0x0b, 0x00,
+ 0x5f, 0x0b, 0x00, 0x5e, 0x0c, 0x00, 0xf3, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0xae, 0x07, 0x02, 0x01,
+ 0x02, 0x05, 0x02, 0x01, 0x76, 0x00, 0x00, 0x05,
+ 0x01, 0x00, 0x04, 0x01, 0xe2, 0xd6, 0xf4, 0x97,
+ 0xef, 0x0c, 0xd6, 0xb6, 0x38, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0xd6, 0xba, 0xaa,
+ 0xef, 0x14, 0xbb, 0xd6, 0x9c, 0xba, 0xfb, 0x09,
+ 0x04, 0x04, 0x02, 0x00, 0x00, 0xce, 0xf1, 0x51,
+ 0xc4, 0x00, 0xce, 0xf1, 0x4c, 0xd7, 0xc2, 0x10,
+ 0xaa, 0xef, 0x3a, 0xd6, 0xe3, 0xb6, 0xfa, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0xd6, 0x24, 0x01, 0x00,
+ 0xac, 0xef, 0x2a, 0xd6, 0xba, 0xfb, 0x0c, 0xd6,
+ 0x8d, 0xda, 0x04, 0x05, 0x02, 0x00, 0x00, 0xce,
+ 0xf1, 0x03, 0xc6, 0xce, 0xca, 0x04, 0x06, 0x02,
+ 0x00, 0x00, 0xd6, 0xb6, 0x38, 0x00, 0x00, 0x00,
+ 0x02, 0x00, 0xc2, 0x10, 0x24, 0x01, 0x00, 0x9e,
+ 0x9e, 0xce, 0xf1, 0x0d, 0xd6, 0xb6, 0x38, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00, 0xce,
+ 0xca, 0x28, 0x07, 0x02, 0x30, 0x0c, 0x43, 0x02,
+ 0x03, 0xb0, 0x07, 0x02, 0x01, 0x02, 0x05, 0x01,
+ 0x01, 0x8b, 0x02, 0x00, 0x00, 0x6a, 0x01, 0x38,
+ 0xb5, 0x00, 0x00, 0x00, 0xb6, 0xe6, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00, 0x97,
+ 0xef, 0x2d, 0xe2, 0x04, 0x07, 0x02, 0x00, 0x00,
+ 0xad, 0xef, 0x19, 0x04, 0x08, 0x02, 0x00, 0x00,
+ 0xd6, 0xb6, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x24, 0x00, 0x00, 0x9e, 0x04, 0xf8, 0x01, 0x00,
+ 0x00, 0x9e, 0x28, 0xd6, 0xb6, 0x38, 0x00, 0x00,
+ 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0xd6, 0xba,
+ 0xaa, 0xef, 0x14, 0xbb, 0xd6, 0x9c, 0xba, 0xfb,
+ 0x09, 0x04, 0x04, 0x02, 0x00, 0x00, 0xce, 0xf1,
+ 0x41, 0xc4, 0x00, 0xce, 0xf1, 0x3c, 0xd7, 0xc2,
+ 0x10, 0xaa, 0xef, 0x2a, 0xd6, 0xba, 0xfb, 0x0c,
+ 0xd6, 0x8d, 0xda, 0x04, 0x05, 0x02, 0x00, 0x00,
+ 0xce, 0xf1, 0x03, 0xc6, 0xce, 0xca, 0x04, 0x06,
+ 0x02, 0x00, 0x00, 0xd6, 0xb6, 0x38, 0x00, 0x00,
+ 0x00, 0x03, 0x00, 0xc2, 0x10, 0x24, 0x01, 0x00,
+ 0x9e, 0x9e, 0xce, 0xf1, 0x0d, 0xd6, 0xb6, 0x38,
+ 0x00, 0x00, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00,
+ 0xce, 0xd6, 0x98, 0x04, 0x8e, 0x00, 0x00, 0x00,
+ 0xfe, 0x13, 0xe2, 0x04, 0x07, 0x02, 0x00, 0x00,
+ 0xad, 0xef, 0x0a, 0x04, 0x09, 0x02, 0x00, 0x00,
+ 0x95, 0x00, 0xf1, 0x5d, 0xe2, 0x04, 0xe4, 0x00,
+ 0x00, 0x00, 0xad, 0xef, 0x54, 0xca, 0xb6, 0xe8,
+ 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0xe9, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xba, 0xa4, 0xef,
+ 0x40, 0xd7, 0xc2, 0x10, 0xaa, 0x11, 0xef, 0x14,
+ 0x0e, 0xca, 0xb6, 0xe8, 0x01, 0x00, 0x00, 0x06,
+ 0x00, 0x04, 0x0a, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xba, 0xa4, 0x11, 0xf0, 0x1a, 0x0e, 0xd7,
+ 0xc2, 0x0a, 0xaa, 0xef, 0x1c, 0xca, 0xb6, 0xe8,
+ 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x0b, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xba, 0xa4, 0xef,
+ 0x08, 0x04, 0x0c, 0x02, 0x00, 0x00, 0x95, 0x00,
+ 0xca, 0x28, 0x07, 0x02, 0x30, 0x0c, 0x43, 0x02,
+ 0x03, 0xb2, 0x07, 0x02, 0x01, 0x02, 0x05, 0x01,
+ 0x00, 0x4c, 0x00, 0x00, 0x6a, 0x01, 0xd7, 0xc2,
+ 0x10, 0xaa, 0xef, 0x2a, 0xd6, 0xba, 0xfb, 0x0c,
+ 0xd6, 0x8d, 0xda, 0x04, 0x05, 0x02, 0x00, 0x00,
+ 0xce, 0xf1, 0x03, 0xc6, 0xce, 0xca, 0x04, 0x06,
+ 0x02, 0x00, 0x00, 0xd6, 0xb6, 0x38, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0xc2, 0x10, 0x24, 0x01, 0x00,
+ 0x9e, 0x9e, 0xce, 0xf1, 0x0d, 0xd6, 0xb6, 0x38,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00,
+ 0xce, 0xe2, 0x04, 0xe4, 0x00, 0x00, 0x00, 0xfe,
+ 0x08, 0x04, 0x0d, 0x02, 0x00, 0x00, 0x95, 0x00,
+ 0xca, 0x28, 0x0c, 0x43, 0x02, 0x03, 0xb4, 0x07,
+ 0x01, 0x02, 0x01, 0x02, 0x0a, 0x01, 0x0b, 0x00,
+ 0x00, 0x00, 0x0c, 0x00, 0x03, 0x01, 0x00, 0x08,
+ 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0x6b, 0x01, 0x00, 0x69, 0x01, 0x00, 0x6d, 0x01,
+ 0x00, 0x6c, 0x01, 0x00, 0x01, 0x01, 0xc5, 0x00,
+ 0xcf, 0x26, 0x00, 0x00, 0xce, 0xcb, 0xd6, 0xf4,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0x9c, 0x08, 0x01,
+ 0x06, 0x01, 0x05, 0x0c, 0x00, 0xfe, 0x06, 0x00,
+ 0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00,
+ 0x01, 0x01, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00,
+ 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x08,
+ 0x00, 0x00, 0x09, 0x00, 0xd6, 0x98, 0xc9, 0x04,
+ 0x04, 0x4a, 0x00, 0x00, 0x00, 0xac, 0x6a, 0x36,
+ 0x02, 0x00, 0x00, 0xd6, 0xf8, 0xef, 0x11, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xd6, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xe3,
+ 0xb6, 0xe8, 0x01, 0x00, 0x00, 0x01, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0xba, 0xa7, 0xef, 0x15, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x04, 0x0f, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x29, 0xd6, 0xe4, 0xa8, 0xef, 0x2b,
+ 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0x04, 0x10, 0x02, 0x00, 0x00, 0xd6,
+ 0xb6, 0x11, 0x02, 0x00, 0x00, 0x04, 0x00, 0x24,
+ 0x00, 0x00, 0xb6, 0x12, 0x02, 0x00, 0x00, 0x05,
+ 0x00, 0x24, 0x00, 0x00, 0x9e, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0xe5, 0xef, 0x66, 0xd6, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0xa8, 0x11, 0xf0, 0x40, 0x0e,
+ 0xd6, 0x38, 0x13, 0x02, 0x00, 0x00, 0xa8, 0x11,
+ 0xf0, 0x35, 0x0e, 0xd6, 0x38, 0x14, 0x02, 0x00,
+ 0x00, 0xa8, 0x11, 0xf0, 0x2a, 0x0e, 0xd6, 0x38,
+ 0x15, 0x02, 0x00, 0x00, 0xa8, 0x11, 0xf0, 0x1f,
+ 0x0e, 0xd6, 0x38, 0x16, 0x02, 0x00, 0x00, 0xa8,
+ 0x11, 0xf0, 0x14, 0x0e, 0xd6, 0x38, 0x17, 0x02,
+ 0x00, 0x00, 0xa8, 0x11, 0xf0, 0x09, 0x0e, 0xd6,
+ 0x38, 0x18, 0x02, 0x00, 0x00, 0xa8, 0xef, 0x1b,
+ 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0xd6, 0xb6, 0x38, 0x00, 0x00, 0x00,
+ 0x07, 0x00, 0x24, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0xe3, 0xb6, 0x87, 0x01, 0x00, 0x00,
+ 0x08, 0x00, 0xd6, 0x24, 0x01, 0x00, 0x0e, 0x5e,
+ 0x04, 0x00, 0xb6, 0x19, 0x02, 0x00, 0x00, 0x09,
+ 0x00, 0xd6, 0x24, 0x01, 0x00, 0x6a, 0x8f, 0x00,
+ 0x00, 0x00, 0xd6, 0xee, 0xce, 0x66, 0x00, 0x00,
+ 0xb6, 0x68, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x04,
+ 0x1a, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xba, 0xcf, 0xcb, 0xca, 0xa4, 0xef, 0x59, 0xcb,
+ 0xba, 0xad, 0xef, 0x14, 0x66, 0x00, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x04, 0x1b,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xcb,
+ 0xd6, 0xa9, 0xef, 0x0b, 0x5e, 0x05, 0x00, 0xd6,
+ 0xcb, 0x47, 0xf4, 0x0e, 0xf1, 0x14, 0x66, 0x00,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x0c, 0x00,
+ 0x04, 0x1c, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xcb, 0xc2, 0x14, 0xfd, 0x16, 0x66, 0x00,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x0d, 0x00,
+ 0x04, 0x1d, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xf1, 0x05, 0x94, 0x01, 0xf1, 0xa4, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x0e,
+ 0x00, 0x04, 0x1e, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xf2, 0xac, 0x00, 0x5e, 0x06, 0x00,
+ 0xb6, 0x1f, 0x02, 0x00, 0x00, 0x0f, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0x04, 0xa5, 0x00, 0x00, 0x00,
+ 0xfe, 0x1c, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x10, 0x00, 0xd6, 0xb6, 0x38, 0x00,
+ 0x00, 0x00, 0x11, 0x00, 0x24, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xf1, 0x7b, 0x5e, 0x06, 0x00,
+ 0xb6, 0x20, 0x02, 0x00, 0x00, 0x12, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0xd4, 0xee, 0xce, 0x66, 0x00,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x13, 0x00,
+ 0x04, 0x21, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xba, 0xcf, 0xcb, 0xca, 0xa4, 0xef, 0x3d,
+ 0xcb, 0xba, 0xad, 0xef, 0x14, 0x66, 0x00, 0x00,
+ 0xb6, 0x68, 0x01, 0x00, 0x00, 0x14, 0x00, 0x04,
+ 0x1b, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xcc, 0xcb, 0x47, 0xd1, 0x66, 0x00, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x15, 0x00, 0xcd, 0x04,
+ 0x22, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e,
+ 0x5e, 0x05, 0x00, 0xd6, 0xcd, 0x47, 0xf4, 0x0e,
+ 0x94, 0x01, 0xf1, 0xc0, 0x66, 0x00, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x16, 0x00, 0x04, 0x23,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xe3,
+ 0xb6, 0x24, 0x02, 0x00, 0x00, 0x17, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc7, 0x04, 0x04,
+ 0x49, 0x00, 0x00, 0x00, 0xfe, 0x3b, 0xd6, 0xb6,
+ 0x12, 0x02, 0x00, 0x00, 0x18, 0x00, 0x24, 0x00,
+ 0x00, 0xc9, 0x05, 0xee, 0xc2, 0x4f, 0xfd, 0x18,
+ 0xc7, 0x05, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x19,
+ 0x00, 0xba, 0xc2, 0x4b, 0x24, 0x02, 0x00, 0x04,
+ 0x25, 0x02, 0x00, 0x00, 0x9e, 0xc8, 0x05, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x1a,
+ 0x00, 0xc7, 0x05, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc7, 0x04, 0x04, 0x47, 0x00, 0x00, 0x00, 0xfe,
+ 0x20, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00,
+ 0x00, 0x1b, 0x00, 0x5e, 0x07, 0x00, 0xd6, 0x5e,
+ 0x08, 0x00, 0xef, 0x05, 0xc2, 0x10, 0xf1, 0x03,
+ 0xc2, 0x0a, 0xf5, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc7, 0x04, 0x04, 0x8d, 0x00, 0x00, 0x00, 0xfe,
+ 0x20, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00,
+ 0x00, 0x1c, 0x00, 0x5e, 0x09, 0x00, 0xd6, 0x5e,
+ 0x08, 0x00, 0xef, 0x05, 0xc2, 0x10, 0xf1, 0x03,
+ 0xc2, 0x0a, 0xf5, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc7, 0x04, 0x04, 0x8e, 0x00, 0x00, 0x00, 0xfe,
+ 0x20, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00,
+ 0x00, 0x1d, 0x00, 0x5e, 0x0a, 0x00, 0xd6, 0x5e,
+ 0x08, 0x00, 0xef, 0x05, 0xc2, 0x10, 0xf1, 0x03,
+ 0xc2, 0x0a, 0xf5, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc7, 0x04, 0x04, 0x8f, 0x00, 0x00, 0x00, 0xfe,
+ 0x21, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00,
+ 0x00, 0x1e, 0x00, 0xd6, 0xb6, 0x38, 0x00, 0x00,
+ 0x00, 0x1f, 0x00, 0x24, 0x00, 0x00, 0x04, 0x26,
+ 0x02, 0x00, 0x00, 0x9e, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0xc7, 0x04, 0x04, 0x4b, 0x00, 0x00, 0x00,
+ 0xfe, 0x15, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x20, 0x00, 0x5e, 0x0b, 0x00, 0xd6,
+ 0xf4, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc7, 0x04,
+ 0x04, 0x1b, 0x00, 0x00, 0x00, 0xfe, 0x24, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x21,
+ 0x00, 0x04, 0x27, 0x02, 0x00, 0x00, 0xd6, 0xb5,
+ 0x37, 0x00, 0x00, 0x00, 0x22, 0x00, 0x9e, 0x04,
+ 0x64, 0x01, 0x00, 0x00, 0x9e, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x23, 0x00, 0xd6, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xb6, 0x07,
+ 0x01, 0x01, 0x01, 0x04, 0x01, 0x00, 0x2d, 0x00,
+ 0x00, 0x2f, 0x01, 0xd6, 0xba, 0x47, 0x04, 0x28,
+ 0x02, 0x00, 0x00, 0xad, 0xef, 0x03, 0xc6, 0x28,
+ 0xbb, 0xce, 0xca, 0xd6, 0xee, 0xfb, 0x0d, 0xe2,
+ 0xd6, 0xca, 0x47, 0xf4, 0x97, 0xf0, 0x05, 0x94,
+ 0x00, 0xf1, 0xf0, 0xd6, 0xb6, 0x69, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xbb, 0xca, 0x25, 0x02, 0x00,
+ 0x0c, 0x43, 0x02, 0x03, 0xb8, 0x07, 0x02, 0x04,
+ 0x02, 0x07, 0x0c, 0x00, 0xeb, 0x07, 0x00, 0x00,
+ 0x71, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x69, 0x01,
+ 0x00, 0x17, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0e,
+ 0x01, 0x00, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00,
+ 0x0f, 0x01, 0x00, 0x06, 0x01, 0x00, 0x6a, 0x01,
+ 0x00, 0x08, 0x01, 0xd6, 0x04, 0x29, 0x02, 0x00,
+ 0x00, 0xac, 0x11, 0xf0, 0x14, 0x0e, 0xd6, 0x04,
+ 0x2a, 0x02, 0x00, 0x00, 0xac, 0x11, 0xf0, 0x09,
+ 0x0e, 0xd6, 0x04, 0xdd, 0x01, 0x00, 0x00, 0xaa,
+ 0xef, 0x07, 0xe2, 0xf3, 0x0e, 0xf2, 0xc6, 0x03,
+ 0xd6, 0x04, 0x2b, 0x02, 0x00, 0x00, 0xac, 0xef,
+ 0x54, 0xd7, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xd6, 0xee, 0xbb, 0x9e, 0x24, 0x01, 0x00,
+ 0xb6, 0x2c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x24,
+ 0x00, 0x00, 0xd5, 0xb6, 0x2d, 0x02, 0x00, 0x00,
+ 0x02, 0x00, 0x04, 0xe9, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xcd, 0xb6, 0x2d, 0x02, 0x00, 0x00,
+ 0x03, 0x00, 0x04, 0xee, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xfc, 0x08, 0x04, 0x2e, 0x02, 0x00,
+ 0x00, 0x95, 0x03, 0x66, 0x01, 0x00, 0xb6, 0x2f,
+ 0x02, 0x00, 0x00, 0x04, 0x00, 0xcd, 0x24, 0x01,
+ 0x00, 0x0e, 0x09, 0x28, 0xd6, 0x04, 0x30, 0x02,
+ 0x00, 0x00, 0xfe, 0x06, 0x0a, 0xe8, 0xf2, 0x5d,
+ 0x03, 0xd6, 0x04, 0x31, 0x02, 0x00, 0x00, 0xfe,
+ 0x06, 0x09, 0xe8, 0xf2, 0x50, 0x03, 0xd6, 0x04,
+ 0x32, 0x02, 0x00, 0x00, 0xfe, 0x07, 0xe5, 0x97,
+ 0xe9, 0xf2, 0x42, 0x03, 0x5e, 0x04, 0x00, 0x6a,
+ 0xad, 0x01, 0x00, 0x00, 0xd6, 0x04, 0x0a, 0x02,
+ 0x00, 0x00, 0xac, 0x6a, 0xa1, 0x01, 0x00, 0x00,
+ 0xd7, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x05, 0x00,
+ 0xd6, 0xee, 0xbb, 0x9e, 0x24, 0x01, 0x00, 0xb6,
+ 0x2c, 0x02, 0x00, 0x00, 0x06, 0x00, 0x24, 0x00,
+ 0x00, 0xb6, 0x5e, 0x00, 0x00, 0x00, 0x07, 0x00,
+ 0x04, 0xfd, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xd2, 0xee, 0xbb, 0xfe, 0x4d, 0xca, 0xba, 0x47,
+ 0xc6, 0xac, 0xef, 0x46, 0x66, 0x01, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x33,
+ 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x9e, 0x04,
+ 0x34, 0x02, 0x00, 0x00, 0x9e, 0x5e, 0x06, 0x00,
+ 0xb6, 0xfa, 0x01, 0x00, 0x00, 0x09, 0x00, 0x5e,
+ 0x05, 0x00, 0x5e, 0x07, 0x00, 0x9c, 0x24, 0x01,
+ 0x00, 0x9e, 0x04, 0x35, 0x02, 0x00, 0x00, 0x9e,
+ 0x5e, 0x08, 0x00, 0x9e, 0x04, 0x36, 0x02, 0x00,
+ 0x00, 0x9e, 0x24, 0x01, 0x00, 0x0e, 0xf2, 0x24,
+ 0x01, 0xca, 0xba, 0x47, 0x04, 0x37, 0x02, 0x00,
+ 0x00, 0xfe, 0x0d, 0xc2, 0x0b, 0x5f, 0x05, 0x00,
+ 0xbf, 0x5f, 0x08, 0x00, 0xf2, 0x0e, 0x01, 0xca,
+ 0xba, 0x47, 0x04, 0x38, 0x02, 0x00, 0x00, 0xfe,
+ 0x0e, 0xc2, 0x18, 0x5f, 0x05, 0x00, 0xc2, 0x08,
+ 0x5f, 0x08, 0x00, 0xf2, 0xf7, 0x00, 0xca, 0xba,
+ 0x47, 0x04, 0x39, 0x02, 0x00, 0x00, 0xfe, 0x0e,
+ 0xc2, 0x35, 0x5f, 0x05, 0x00, 0xc2, 0x0b, 0x5f,
+ 0x08, 0x00, 0xf2, 0xe0, 0x00, 0xca, 0xba, 0x47,
+ 0x04, 0x3a, 0x02, 0x00, 0x00, 0xfe, 0x0e, 0xc2,
+ 0x71, 0x5f, 0x05, 0x00, 0xc2, 0x0f, 0x5f, 0x08,
+ 0x00, 0xf2, 0xc9, 0x00, 0x38, 0x3b, 0x02, 0x00,
+ 0x00, 0xca, 0xba, 0x47, 0xf4, 0xcf, 0xca, 0xee,
+ 0xbc, 0xa7, 0xef, 0x0d, 0x38, 0x3b, 0x02, 0x00,
+ 0x00, 0xca, 0xbb, 0x47, 0xf4, 0xd0, 0xf1, 0x0e,
+ 0x38, 0xb6, 0x00, 0x00, 0x00, 0xb5, 0x3c, 0x02,
+ 0x00, 0x00, 0x0a, 0x00, 0xd0, 0x38, 0x9a, 0x00,
+ 0x00, 0x00, 0xb6, 0xf0, 0x01, 0x00, 0x00, 0x0b,
+ 0x00, 0xcb, 0x24, 0x01, 0x00, 0x11, 0xf0, 0x22,
+ 0x0e, 0xcb, 0x38, 0xb6, 0x00, 0x00, 0x00, 0xb5,
+ 0x3d, 0x02, 0x00, 0x00, 0x0c, 0x00, 0xa4, 0x11,
+ 0xf0, 0x10, 0x0e, 0xcb, 0x38, 0xb6, 0x00, 0x00,
+ 0x00, 0xb5, 0x3e, 0x02, 0x00, 0x00, 0x0d, 0x00,
+ 0xa6, 0xef, 0x16, 0x66, 0x01, 0x00, 0xb6, 0x68,
+ 0x01, 0x00, 0x00, 0x0e, 0x00, 0x04, 0x3f, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28,
+ 0x38, 0x9a, 0x00, 0x00, 0x00, 0xb6, 0xf0, 0x01,
+ 0x00, 0x00, 0x0f, 0x00, 0xcc, 0x24, 0x01, 0x00,
+ 0x11, 0xf0, 0x22, 0x0e, 0xcc, 0x38, 0xb6, 0x00,
+ 0x00, 0x00, 0xb5, 0x40, 0x02, 0x00, 0x00, 0x10,
+ 0x00, 0xa4, 0x11, 0xf0, 0x10, 0x0e, 0xcc, 0x38,
+ 0xb6, 0x00, 0x00, 0x00, 0xb5, 0x3c, 0x02, 0x00,
+ 0x00, 0x11, 0x00, 0xa6, 0xef, 0x16, 0x66, 0x01,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x12, 0x00,
+ 0x04, 0x41, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x09, 0x28, 0xcb, 0x5f, 0x05, 0x00, 0xcc,
+ 0x5f, 0x08, 0x00, 0x09, 0x28, 0x5e, 0x04, 0x00,
+ 0x6a, 0x89, 0x00, 0x00, 0x00, 0xd6, 0x04, 0x42,
+ 0x02, 0x00, 0x00, 0xac, 0xef, 0x7d, 0xd7, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x13, 0x00, 0xd6, 0xee,
+ 0xbb, 0x9e, 0x24, 0x01, 0x00, 0xb6, 0x2c, 0x02,
+ 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x00, 0xce,
+ 0x5e, 0x06, 0x00, 0xb6, 0xfb, 0x01, 0x00, 0x00,
+ 0x15, 0x00, 0x5e, 0x09, 0x00, 0xca, 0xf4, 0x5e,
+ 0x07, 0x00, 0x9b, 0x24, 0x01, 0x00, 0xd3, 0x38,
+ 0xb6, 0x00, 0x00, 0x00, 0xb5, 0x3d, 0x02, 0x00,
+ 0x00, 0x16, 0x00, 0xa4, 0x11, 0xf0, 0x10, 0x0e,
+ 0xcb, 0x38, 0xb6, 0x00, 0x00, 0x00, 0xb5, 0x3e,
+ 0x02, 0x00, 0x00, 0x17, 0x00, 0xa6, 0xef, 0x16,
+ 0x66, 0x01, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00,
+ 0x18, 0x00, 0x04, 0x3f, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x09, 0x28, 0xcb, 0x5f, 0x05,
+ 0x00, 0x38, 0xb6, 0x00, 0x00, 0x00, 0xb5, 0x3c,
+ 0x02, 0x00, 0x00, 0x19, 0x00, 0x5f, 0x08, 0x00,
+ 0x09, 0x28, 0x5e, 0x04, 0x00, 0xef, 0x75, 0xd6,
+ 0x04, 0x43, 0x02, 0x00, 0x00, 0xac, 0xef, 0x6c,
+ 0xd7, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x1a, 0x00,
+ 0xd6, 0xee, 0xbb, 0x9e, 0x24, 0x01, 0x00, 0xb6,
+ 0x2c, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00,
+ 0x00, 0xd2, 0xc6, 0xfe, 0x20, 0x66, 0x01, 0x00,
+ 0xb6, 0x68, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x04,
+ 0x44, 0x02, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x9e,
+ 0x04, 0x20, 0x01, 0x00, 0x00, 0x9e, 0x24, 0x01,
+ 0x00, 0x0e, 0xf1, 0x2e, 0xca, 0x04, 0xe4, 0x00,
+ 0x00, 0x00, 0xac, 0x11, 0xf0, 0x09, 0x0e, 0xca,
+ 0x04, 0x07, 0x02, 0x00, 0x00, 0xac, 0xef, 0x07,
+ 0xca, 0x5f, 0x0a, 0x00, 0xf1, 0x14, 0x66, 0x01,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x1d, 0x00,
+ 0x04, 0x45, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x09, 0x28, 0xd6, 0x04, 0x46, 0x02, 0x00,
+ 0x00, 0xfe, 0x16, 0x66, 0x01, 0x00, 0xb6, 0x68,
+ 0x01, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x47, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xf1, 0x6d,
+ 0xd6, 0x04, 0x48, 0x02, 0x00, 0x00, 0xfe, 0x12,
+ 0x66, 0x01, 0x00, 0xb6, 0xa3, 0x01, 0x00, 0x00,
+ 0x1f, 0x00, 0xba, 0x24, 0x01, 0x00, 0x0e, 0xf1,
+ 0x54, 0x5e, 0x0b, 0x00, 0xef, 0x17, 0xd6, 0x04,
+ 0x59, 0x01, 0x00, 0x00, 0xac, 0xef, 0x0e, 0x36,
+ 0x49, 0x02, 0x00, 0x00, 0x0a, 0x3b, 0x49, 0x02,
+ 0x00, 0x00, 0xf1, 0x39, 0x5e, 0x0b, 0x00, 0xef,
+ 0x17, 0xd6, 0x04, 0x0d, 0x02, 0x00, 0x00, 0xac,
+ 0xef, 0x0e, 0x36, 0x49, 0x02, 0x00, 0x00, 0x09,
+ 0x3b, 0x49, 0x02, 0x00, 0x00, 0xf1, 0x1e, 0x66,
+ 0x01, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x20,
+ 0x00, 0x04, 0x4a, 0x02, 0x00, 0x00, 0xd6, 0x9e,
+ 0x04, 0x20, 0x01, 0x00, 0x00, 0x9e, 0x24, 0x01,
+ 0x00, 0x0e, 0x09, 0x28, 0x0a, 0x28, 0x0c, 0x43,
+ 0x02, 0x03, 0x00, 0x01, 0x00, 0x01, 0x03, 0x01,
+ 0x00, 0x42, 0x00, 0x00, 0x69, 0x01, 0xd6, 0x11,
+ 0x04, 0x4b, 0x02, 0x00, 0x00, 0xfe, 0x05, 0x09,
+ 0xe6, 0xf1, 0x35, 0x11, 0x04, 0x4c, 0x02, 0x00,
+ 0x00, 0xfe, 0x05, 0x0a, 0xe6, 0xf1, 0x29, 0x11,
+ 0x04, 0x4d, 0x02, 0x00, 0x00, 0xfe, 0x0e, 0x36,
+ 0x49, 0x02, 0x00, 0x00, 0x09, 0x3b, 0x49, 0x02,
+ 0x00, 0x00, 0xf1, 0x14, 0x11, 0x04, 0x4e, 0x02,
+ 0x00, 0x00, 0xfe, 0x0c, 0x36, 0x49, 0x02, 0x00,
+ 0x00, 0x0a, 0x3b, 0x49, 0x02, 0x00, 0x00, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0xba, 0x07, 0x00, 0x01,
+ 0x00, 0x05, 0x07, 0x01, 0xdf, 0x01, 0x00, 0x00,
+ 0x00, 0x0c, 0x00, 0x69, 0x01, 0x00, 0x17, 0x01,
+ 0x00, 0x08, 0x01, 0x00, 0x09, 0x01, 0x00, 0x6a,
+ 0x01, 0x00, 0x07, 0x01, 0xc5, 0x00, 0xce, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x4f, 0x02, 0x00, 0x00, 0x04, 0x50,
+ 0x02, 0x00, 0x00, 0x9e, 0xca, 0xe3, 0xf4, 0x9e,
+ 0x04, 0x51, 0x02, 0x00, 0x00, 0x9e, 0x04, 0x52,
+ 0x02, 0x00, 0x00, 0x9e, 0xca, 0xe3, 0x97, 0xf4,
+ 0x9e, 0x04, 0x53, 0x02, 0x00, 0x00, 0x9e, 0x04,
+ 0x54, 0x02, 0x00, 0x00, 0x9e, 0xca, 0xe4, 0xf4,
+ 0x9e, 0x04, 0x55, 0x02, 0x00, 0x00, 0x9e, 0x04,
+ 0x56, 0x02, 0x00, 0x00, 0x9e, 0x24, 0x01, 0x00,
+ 0x0e, 0xe5, 0xef, 0x37, 0x66, 0x00, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x57,
+ 0x02, 0x00, 0x00, 0xca, 0x38, 0x49, 0x02, 0x00,
+ 0x00, 0xf4, 0x9e, 0x04, 0x58, 0x02, 0x00, 0x00,
+ 0x9e, 0x04, 0x59, 0x02, 0x00, 0x00, 0x9e, 0xca,
+ 0x38, 0x49, 0x02, 0x00, 0x00, 0x97, 0xf4, 0x9e,
+ 0x04, 0x5a, 0x02, 0x00, 0x00, 0x9e, 0x24, 0x01,
+ 0x00, 0x0e, 0x5e, 0x04, 0x00, 0xef, 0x3b, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x04, 0x5b, 0x02, 0x00, 0x00, 0x04, 0x5c,
+ 0x02, 0x00, 0x00, 0x9e, 0x24, 0x01, 0x00, 0x0e,
+ 0xe5, 0x97, 0xef, 0x1e, 0x66, 0x00, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x03, 0x00, 0x04, 0x5d,
+ 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x9e, 0x04,
+ 0x5e, 0x02, 0x00, 0x00, 0x9e, 0x24, 0x01, 0x00,
+ 0x0e, 0x5e, 0x06, 0x00, 0x97, 0xef, 0x14, 0x66,
+ 0x00, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x04,
+ 0x00, 0x04, 0x5f, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xc0,
+ 0x09, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0f,
+ 0x00, 0xd6, 0xef, 0x07, 0x04, 0x7e, 0x00, 0x00,
+ 0x00, 0x28, 0x04, 0xfd, 0x01, 0x00, 0x00, 0x28,
+ 0x0c, 0x43, 0x02, 0x03, 0xbc, 0x07, 0x00, 0x00,
+ 0x00, 0x04, 0x0b, 0x00, 0x78, 0x00, 0xdc, 0x06,
+ 0x07, 0x01, 0xde, 0x06, 0x08, 0x01, 0xc8, 0x03,
+ 0x00, 0x0c, 0xe0, 0x06, 0x09, 0x01, 0xea, 0x06,
+ 0x10, 0x01, 0xbe, 0x02, 0x04, 0x01, 0xe6, 0x06,
+ 0x0e, 0x01, 0xe8, 0x06, 0x0f, 0x01, 0xac, 0x07,
+ 0x6a, 0x01, 0xda, 0x06, 0x00, 0x03, 0xbe, 0x07,
+ 0x73, 0x01, 0xe2, 0x97, 0xef, 0x2c, 0xe3, 0xef,
+ 0x16, 0x66, 0x02, 0x00, 0xb6, 0x68, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x04, 0x61, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xf1, 0x14, 0x66, 0x02,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0x04, 0x62, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xe5, 0xef, 0x42, 0x5e, 0x05, 0x00, 0xb6,
+ 0x63, 0x02, 0x00, 0x00, 0x02, 0x00, 0xc2, 0x0a,
+ 0x24, 0x01, 0x00, 0x5e, 0x05, 0x00, 0xb6, 0x63,
+ 0x02, 0x00, 0x00, 0x03, 0x00, 0xbc, 0x24, 0x01,
+ 0x00, 0x9c, 0x5f, 0x04, 0x00, 0xc2, 0x71, 0x5f,
+ 0x06, 0x00, 0xc2, 0x0f, 0x5f, 0x07, 0x00, 0xe3,
+ 0xef, 0x14, 0x04, 0x07, 0x02, 0x00, 0x00, 0x5f,
+ 0x08, 0x00, 0x5e, 0x09, 0x00, 0xe2, 0xb7, 0x49,
+ 0x02, 0x00, 0x00, 0x04, 0x00, 0x5e, 0x0a, 0x00,
+ 0xf3, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xbe, 0x07,
+ 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x0c, 0x00,
+ 0xa4, 0x07, 0x66, 0x01, 0x9c, 0x07, 0x61, 0x01,
+ 0x82, 0x07, 0x1c, 0x01, 0xc0, 0x07, 0x74, 0x01,
+ 0xe2, 0xe3, 0x04, 0x64, 0x02, 0x00, 0x00, 0xe4,
+ 0xf5, 0xe5, 0xf5, 0x29, 0x0c, 0x43, 0x02, 0x03,
+ 0xc0, 0x07, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00,
+ 0x0a, 0x00, 0x00, 0x75, 0x01, 0x00, 0x73, 0x01,
+ 0xe2, 0xd6, 0xf4, 0x97, 0xef, 0x04, 0xe3, 0xf3,
+ 0x0e, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xc2, 0x07,
+ 0x01, 0x02, 0x01, 0x07, 0x0b, 0x00, 0x9b, 0x01,
+ 0x00, 0x00, 0x71, 0x01, 0x00, 0x6f, 0x01, 0x00,
+ 0x70, 0x01, 0x00, 0x1b, 0x01, 0x00, 0x7a, 0x01,
+ 0x00, 0x11, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x09,
+ 0x01, 0x00, 0x76, 0x01, 0x00, 0x0e, 0x01, 0x00,
+ 0x0f, 0x01, 0xd6, 0xf8, 0xef, 0x05, 0xc6, 0xda,
+ 0x09, 0x28, 0xd6, 0x04, 0x2a, 0x02, 0x00, 0x00,
+ 0xfe, 0x06, 0xe2, 0xf3, 0x0e, 0x09, 0x28, 0xe3,
+ 0xd6, 0xf4, 0xd3, 0xee, 0xba, 0xfd, 0x1a, 0xe4,
+ 0xcb, 0xd6, 0xf5, 0x97, 0xef, 0x03, 0x09, 0x28,
+ 0xd6, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xcb, 0xee, 0xbb, 0x9e, 0x24, 0x01, 0x00, 0xda,
+ 0xd6, 0xc6, 0xfe, 0x03, 0x09, 0x28, 0xe5, 0xef,
+ 0x0b, 0xe5, 0x04, 0x20, 0x01, 0x00, 0x00, 0x9e,
+ 0xd6, 0x9e, 0xda, 0x5e, 0x04, 0x00, 0xd6, 0xf4,
+ 0xd2, 0xba, 0x47, 0x5f, 0x05, 0x00, 0xca, 0xbb,
+ 0x47, 0x5f, 0x06, 0x00, 0x5e, 0x05, 0x00, 0xef,
+ 0x05, 0xd6, 0xe9, 0x09, 0x28, 0xc6, 0xe9, 0x5e,
+ 0x07, 0x00, 0xef, 0x29, 0x38, 0xb6, 0x00, 0x00,
+ 0x00, 0xb6, 0x65, 0x02, 0x00, 0x00, 0x01, 0x00,
+ 0x5e, 0x08, 0x00, 0xb6, 0x66, 0x02, 0x00, 0x00,
+ 0x02, 0x00, 0x07, 0xd6, 0x09, 0x24, 0x03, 0x00,
+ 0x5e, 0x09, 0x00, 0x5e, 0x0a, 0x00, 0x24, 0x03,
+ 0x00, 0x0e, 0xf1, 0x08, 0x5e, 0x08, 0x00, 0xd6,
+ 0x0a, 0xf5, 0x0e, 0x0a, 0x28, 0x0c, 0x43, 0x02,
+ 0x03, 0xc4, 0x07, 0x02, 0x02, 0x02, 0x06, 0x06,
+ 0x00, 0x73, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x19,
+ 0x01, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0c, 0x00,
+ 0x77, 0x01, 0x00, 0x78, 0x01, 0x6d, 0x63, 0x00,
+ 0x00, 0x00, 0xe2, 0x04, 0x07, 0x02, 0x00, 0x00,
+ 0xfe, 0x09, 0x04, 0x67, 0x02, 0x00, 0x00, 0xd6,
+ 0x9e, 0xda, 0x66, 0x02, 0x00, 0xb6, 0x68, 0x02,
+ 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xe7,
+ 0x66, 0x03, 0x00, 0xb6, 0x69, 0x02, 0x00, 0x00,
+ 0x01, 0x00, 0xd6, 0x0b, 0x0a, 0x4c, 0x6a, 0x02,
+ 0x00, 0x00, 0xd7, 0x4c, 0x86, 0x00, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0xce, 0xd7, 0xef, 0x15, 0xca,
+ 0xb6, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5e,
+ 0x04, 0x00, 0x5e, 0x05, 0x00, 0x24, 0x02, 0x00,
+ 0x0e, 0xf1, 0x0d, 0x5e, 0x04, 0x00, 0x0b, 0xca,
+ 0x4c, 0x41, 0x00, 0x00, 0x00, 0xf4, 0x0e, 0x0e,
+ 0x29, 0xcf, 0x6d, 0x0c, 0x00, 0x00, 0x00, 0x5e,
+ 0x05, 0x00, 0xcb, 0xf4, 0x0e, 0x0e, 0x29, 0x2f,
+ 0x0c, 0x43, 0x02, 0x03, 0xc6, 0x07, 0x01, 0x00,
+ 0x01, 0x04, 0x09, 0x00, 0x76, 0x00, 0x00, 0x1a,
+ 0x01, 0x00, 0x01, 0x0c, 0x00, 0x19, 0x01, 0x00,
+ 0x00, 0x0c, 0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01,
+ 0x00, 0x6e, 0x01, 0x00, 0x00, 0x03, 0x00, 0x79,
+ 0x01, 0xd6, 0xb5, 0x41, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0xda, 0x66, 0x01, 0x00, 0xb6, 0x68, 0x02,
+ 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0xe4,
+ 0x9f, 0xe6, 0x66, 0x03, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0x5e, 0x04, 0x00, 0x5e,
+ 0x05, 0x00, 0xb5, 0x13, 0x01, 0x00, 0x00, 0x03,
+ 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0x5e, 0x06,
+ 0x00, 0xd6, 0xf4, 0x0e, 0x66, 0x03, 0x00, 0xb6,
+ 0x68, 0x01, 0x00, 0x00, 0x04, 0x00, 0x04, 0x20,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x66,
+ 0x03, 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x05,
+ 0x00, 0x5e, 0x04, 0x00, 0xb5, 0xeb, 0x00, 0x00,
+ 0x00, 0x06, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x5e,
+ 0x07, 0x00, 0xd6, 0xb7, 0x5d, 0x01, 0x00, 0x00,
+ 0x07, 0x00, 0x5e, 0x08, 0x00, 0xf3, 0x29, 0x0c,
+ 0x43, 0x02, 0x03, 0xc8, 0x07, 0x01, 0x00, 0x01,
+ 0x04, 0x04, 0x00, 0x91, 0x01, 0x00, 0x00, 0x00,
+ 0x0c, 0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01, 0x00,
+ 0x79, 0x01, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe4, 0xb5, 0x14,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0x47, 0x24, 0x01,
+ 0x00, 0x0e, 0xd6, 0x38, 0x99, 0x00, 0x00, 0x00,
+ 0xa8, 0xef, 0x34, 0x38, 0x6b, 0x02, 0x00, 0x00,
+ 0xb6, 0x63, 0x02, 0x00, 0x00, 0x02, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0x0e, 0xd6, 0xb5, 0x36, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0xef, 0x3d, 0x66, 0x00,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0xd6, 0xb5, 0x36, 0x00, 0x00, 0x00, 0x05, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xf1, 0x25, 0x66, 0x00,
+ 0x00, 0xb6, 0x68, 0x01, 0x00, 0x00, 0x06, 0x00,
+ 0x04, 0x6c, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x38, 0x6b, 0x02, 0x00, 0x00, 0xb6, 0x63,
+ 0x02, 0x00, 0x00, 0x07, 0x00, 0xd6, 0x24, 0x01,
+ 0x00, 0x0e, 0x66, 0x00, 0x00, 0xb6, 0x68, 0x01,
+ 0x00, 0x00, 0x08, 0x00, 0xe3, 0xb5, 0xeb, 0x00,
+ 0x00, 0x00, 0x09, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xe5, 0xf3, 0x29, 0x0c, 0x43, 0x02, 0x03, 0xca,
+ 0x07, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x13,
+ 0x00, 0x82, 0x07, 0x1c, 0x01, 0xc8, 0x03, 0x00,
+ 0x0c, 0xbe, 0x07, 0x73, 0x01, 0xba, 0xe6, 0x66,
+ 0x01, 0x00, 0xb6, 0x6d, 0x02, 0x00, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x0e, 0xe4, 0xf3, 0x29,
+ 0x0c, 0x43, 0x02, 0x03, 0xcc, 0x07, 0x01, 0x17,
+ 0x01, 0x04, 0x03, 0x0a, 0x87, 0x04, 0x00, 0x00,
+ 0x31, 0x01, 0x00, 0x34, 0x01, 0x00, 0x30, 0x01,
+ 0xc5, 0x00, 0xc8, 0x0a, 0xc5, 0x01, 0xc8, 0x0b,
+ 0xc5, 0x02, 0xc8, 0x0c, 0xc5, 0x03, 0xc8, 0x0d,
+ 0xc5, 0x04, 0xc8, 0x0e, 0xc5, 0x05, 0xc8, 0x0f,
+ 0xc5, 0x06, 0xc8, 0x10, 0xc5, 0x07, 0xc8, 0x11,
+ 0xc5, 0x08, 0xc8, 0x15, 0xc5, 0x09, 0xc8, 0x16,
+ 0xd6, 0xee, 0xd1, 0xc6, 0xc8, 0x05, 0xba, 0xc8,
+ 0x06, 0xbb, 0xc8, 0x08, 0x26, 0x00, 0x00, 0xc8,
+ 0x09, 0x04, 0x6e, 0x02, 0x00, 0x00, 0x04, 0x6f,
+ 0x02, 0x00, 0x00, 0x9e, 0x04, 0x70, 0x02, 0x00,
+ 0x00, 0x9e, 0x04, 0x71, 0x02, 0x00, 0x00, 0x9e,
+ 0x04, 0x72, 0x02, 0x00, 0x00, 0x9e, 0x04, 0x73,
+ 0x02, 0x00, 0x00, 0x9e, 0x04, 0x74, 0x02, 0x00,
+ 0x00, 0x9e, 0x04, 0x75, 0x02, 0x00, 0x00, 0x9e,
+ 0x04, 0x76, 0x02, 0x00, 0x00, 0x9e, 0x04, 0x77,
+ 0x02, 0x00, 0x00, 0x9e, 0xc8, 0x12, 0x04, 0x78,
+ 0x02, 0x00, 0x00, 0xc8, 0x13, 0x04, 0x79, 0x02,
+ 0x00, 0x00, 0xc8, 0x14, 0xba, 0xce, 0xca, 0xcd,
+ 0xa4, 0x6a, 0x6d, 0x01, 0x00, 0x00, 0x07, 0xc8,
+ 0x04, 0xca, 0xd0, 0xd6, 0xca, 0x92, 0xce, 0x47,
+ 0xd3, 0x11, 0x04, 0xfd, 0x01, 0x00, 0x00, 0xac,
+ 0xf0, 0x1b, 0x11, 0x04, 0x1f, 0x01, 0x00, 0x00,
+ 0xac, 0xf0, 0x12, 0x11, 0x04, 0x22, 0x01, 0x00,
+ 0x00, 0xac, 0xf0, 0x09, 0x11, 0x04, 0x20, 0x01,
+ 0x00, 0x00, 0xfe, 0x04, 0x0e, 0xf1, 0xc8, 0x11,
+ 0x04, 0x7a, 0x02, 0x00, 0x00, 0xac, 0xf0, 0x09,
+ 0x11, 0x04, 0x05, 0x02, 0x00, 0x00, 0xfe, 0x17,
+ 0xca, 0xcd, 0xfb, 0x0d, 0xd6, 0xca, 0x47, 0xcb,
+ 0xaa, 0xef, 0x06, 0x94, 0x00, 0x0e, 0xf1, 0xa7,
+ 0xbb, 0xc8, 0x08, 0x0e, 0xf1, 0xa1, 0x11, 0x04,
+ 0xee, 0x01, 0x00, 0x00, 0xac, 0xef, 0x42, 0xca,
+ 0xcd, 0xfb, 0x13, 0xd6, 0xca, 0x47, 0x04, 0x7e,
+ 0x00, 0x00, 0x00, 0xaa, 0xef, 0x08, 0xc7, 0x0d,
+ 0xf3, 0x0e, 0xf2, 0xe3, 0x00, 0xca, 0xcd, 0xfb,
+ 0x13, 0xd6, 0xca, 0x47, 0x04, 0xee, 0x01, 0x00,
+ 0x00, 0xaa, 0xef, 0x08, 0xc7, 0x0e, 0xf3, 0x0e,
+ 0xf2, 0xcd, 0x00, 0xc7, 0x08, 0xef, 0x0b, 0xc7,
+ 0x10, 0xf3, 0x0e, 0xba, 0xc8, 0x08, 0xf2, 0xbf,
+ 0x00, 0xbb, 0xc8, 0x08, 0x0e, 0xf2, 0x58, 0xff,
+ 0x11, 0x04, 0xea, 0x01, 0x00, 0x00, 0xac, 0xf0,
+ 0x12, 0x11, 0x04, 0xeb, 0x01, 0x00, 0x00, 0xac,
+ 0xf0, 0x09, 0x11, 0x04, 0x7b, 0x02, 0x00, 0x00,
+ 0xfe, 0x0c, 0xc7, 0x0f, 0xcb, 0xf4, 0x0e, 0xba,
+ 0xc8, 0x08, 0xf2, 0x93, 0x00, 0x11, 0x04, 0xf7,
+ 0x01, 0x00, 0x00, 0xac, 0xf0, 0x12, 0x11, 0x04,
+ 0x01, 0x02, 0x00, 0x00, 0xac, 0xf0, 0x09, 0x11,
+ 0x04, 0x7c, 0x02, 0x00, 0x00, 0xfe, 0x0f, 0xbb,
+ 0xc8, 0x08, 0x94, 0x06, 0xc7, 0x0a, 0xcb, 0xf4,
+ 0x0e, 0x0e, 0xf2, 0x0b, 0xff, 0x11, 0x04, 0xf8,
+ 0x01, 0x00, 0x00, 0xac, 0xf0, 0x13, 0x11, 0x04,
+ 0xec, 0x01, 0x00, 0x00, 0xac, 0xf0, 0x0a, 0x11,
+ 0x04, 0xed, 0x01, 0x00, 0x00, 0xac, 0xef, 0x24,
+ 0xba, 0xc8, 0x08, 0xc7, 0x06, 0xba, 0xfd, 0x13,
+ 0xe3, 0xc7, 0x0b, 0xf3, 0xcb, 0xf5, 0xef, 0x0b,
+ 0x93, 0x06, 0xc7, 0x0c, 0xf3, 0x0e, 0x0e, 0xf2,
+ 0xd6, 0xfe, 0x04, 0x12, 0x01, 0x00, 0x00, 0xc8,
+ 0x04, 0xf1, 0x2c, 0xe4, 0xcb, 0xf4, 0xef, 0x0a,
+ 0xc7, 0x11, 0xf3, 0x0e, 0xba, 0xc8, 0x08, 0xf1,
+ 0x1e, 0xe2, 0xcb, 0xf4, 0x11, 0xf0, 0x09, 0x0e,
+ 0xcb, 0x04, 0x5e, 0x01, 0x00, 0x00, 0xaa, 0xef,
+ 0x07, 0xc7, 0x15, 0xf3, 0x0e, 0xf1, 0x08, 0xbb,
+ 0xc8, 0x08, 0x0e, 0xf2, 0xa2, 0xfe, 0x0e, 0xc7,
+ 0x04, 0x6a, 0x9c, 0xfe, 0xff, 0xff, 0xc7, 0x16,
+ 0xcc, 0xca, 0xf5, 0x0e, 0xf2, 0x91, 0xfe, 0xc7,
+ 0x16, 0xcd, 0xcd, 0xf5, 0x0e, 0xc7, 0x05, 0xc7,
+ 0x06, 0xc7, 0x09, 0x26, 0x03, 0x00, 0x28, 0x0c,
+ 0x43, 0x02, 0x03, 0xfa, 0x09, 0x01, 0x00, 0x01,
+ 0x02, 0x01, 0x00, 0x05, 0x00, 0x00, 0x05, 0x01,
+ 0xe2, 0xd6, 0x9e, 0xe6, 0x29, 0x0c, 0x43, 0x02,
+ 0x03, 0xfc, 0x09, 0x01, 0x00, 0x01, 0x04, 0x01,
+ 0x00, 0x0f, 0x00, 0x00, 0x05, 0x01, 0xe2, 0xb6,
+ 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xee,
+ 0xbb, 0x9f, 0x25, 0x01, 0x00, 0x0c, 0x43, 0x02,
+ 0x03, 0xfe, 0x09, 0x01, 0x00, 0x01, 0x05, 0x02,
+ 0x00, 0x16, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x05,
+ 0x01, 0xe2, 0xf3, 0xda, 0xe3, 0xb6, 0x69, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xba, 0xe3, 0xee, 0xbb,
+ 0x9f, 0x24, 0x02, 0x00, 0xe7, 0xd6, 0x28, 0x0c,
+ 0x43, 0x02, 0x03, 0x80, 0x0a, 0x00, 0x00, 0x00,
+ 0x03, 0x06, 0x00, 0x49, 0x00, 0x82, 0x0a, 0x04,
+ 0x01, 0xfa, 0x09, 0x0a, 0x01, 0x84, 0x0a, 0x00,
+ 0x01, 0x9a, 0x08, 0x03, 0x01, 0x86, 0x0a, 0x00,
+ 0x03, 0xfe, 0x09, 0x0c, 0x01, 0x04, 0x0d, 0x01,
+ 0x00, 0x00, 0xe6, 0xe3, 0x04, 0xee, 0x01, 0x00,
+ 0x00, 0xf4, 0x0e, 0xe4, 0x90, 0xe8, 0xe4, 0xe5,
+ 0xbb, 0x9f, 0xa4, 0xef, 0x31, 0x5e, 0x04, 0x00,
+ 0xe4, 0x47, 0x04, 0x7e, 0x00, 0x00, 0x00, 0xaa,
+ 0xef, 0x1f, 0x5e, 0x04, 0x00, 0xe4, 0xbb, 0x9e,
+ 0x47, 0x04, 0xee, 0x01, 0x00, 0x00, 0xaa, 0xef,
+ 0x10, 0xe4, 0xbc, 0x9e, 0xe8, 0x5e, 0x05, 0x00,
+ 0x04, 0xee, 0x01, 0x00, 0x00, 0xf4, 0x0e, 0x29,
+ 0xe4, 0x90, 0xe8, 0xf1, 0xca, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0x88, 0x0a, 0x00, 0x00, 0x00, 0x02,
+ 0x04, 0x00, 0x1e, 0x00, 0x82, 0x0a, 0x04, 0x01,
+ 0x84, 0x0a, 0x00, 0x01, 0x9a, 0x08, 0x03, 0x01,
+ 0x86, 0x0a, 0x00, 0x03, 0x04, 0x0d, 0x01, 0x00,
+ 0x00, 0xe6, 0xe3, 0x90, 0xe7, 0xe3, 0xe4, 0xfb,
+ 0x11, 0xe5, 0xe3, 0x47, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0xaa, 0xf0, 0x06, 0xe3, 0x90, 0xe7, 0xf1,
+ 0xed, 0x29, 0x0c, 0x43, 0x02, 0x03, 0x8a, 0x0a,
+ 0x01, 0x00, 0x01, 0x03, 0x07, 0x00, 0x4c, 0x00,
+ 0x00, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00,
+ 0x00, 0x03, 0x00, 0x0c, 0x01, 0x04, 0x49, 0x00,
+ 0x00, 0x00, 0xe6, 0xe3, 0xd6, 0xf4, 0x0e, 0xe4,
+ 0xe5, 0xa4, 0xef, 0x3d, 0x5e, 0x05, 0x00, 0xe4,
+ 0x92, 0xe8, 0x47, 0x60, 0x04, 0x00, 0x04, 0x20,
+ 0x01, 0x00, 0x00, 0xaa, 0xef, 0x09, 0x04, 0x12,
+ 0x01, 0x00, 0x00, 0xe6, 0xf1, 0xe2, 0x5e, 0x04,
+ 0x00, 0x04, 0x28, 0x02, 0x00, 0x00, 0xaa, 0xef,
+ 0x0b, 0xe4, 0xe5, 0xa7, 0xf0, 0x13, 0xe4, 0x90,
+ 0xe8, 0xf1, 0xcd, 0x5e, 0x04, 0x00, 0xd6, 0xaa,
+ 0xef, 0xc6, 0x5e, 0x06, 0x00, 0xf3, 0x0e, 0x29,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0x8c, 0x0a, 0x00,
+ 0x00, 0x00, 0x03, 0x09, 0x00, 0xc2, 0x01, 0x00,
+ 0x82, 0x0a, 0x04, 0x01, 0xfa, 0x09, 0x0a, 0x01,
+ 0x84, 0x0a, 0x00, 0x01, 0x9a, 0x08, 0x03, 0x01,
+ 0xd8, 0x06, 0x01, 0x01, 0x86, 0x0a, 0x00, 0x03,
+ 0xfc, 0x09, 0x0b, 0x01, 0xfe, 0x09, 0x0c, 0x01,
+ 0xb8, 0x05, 0x00, 0x00, 0x04, 0x0e, 0x01, 0x00,
+ 0x00, 0xe6, 0xe3, 0x04, 0xee, 0x01, 0x00, 0x00,
+ 0xf4, 0x0e, 0xe4, 0xe5, 0xa4, 0x6a, 0xaf, 0x00,
+ 0x00, 0x00, 0x5e, 0x05, 0x00, 0xe4, 0x92, 0xe8,
+ 0x47, 0x60, 0x04, 0x00, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0xaa, 0xef, 0x09, 0x04, 0x12, 0x01, 0x00,
+ 0x00, 0xe6, 0xf1, 0xdf, 0x5e, 0x04, 0x00, 0x04,
+ 0x28, 0x02, 0x00, 0x00, 0xaa, 0xef, 0x0a, 0xe4,
+ 0xe5, 0xfb, 0xd0, 0xe4, 0x90, 0xe8, 0xf1, 0xcb,
+ 0x5e, 0x06, 0x00, 0xf3, 0x04, 0x01, 0x02, 0x00,
+ 0x00, 0xaa, 0xef, 0x13, 0x5e, 0x04, 0x00, 0x04,
+ 0xec, 0x01, 0x00, 0x00, 0xaa, 0xef, 0xb4, 0x5e,
+ 0x07, 0x00, 0xf3, 0x0e, 0xf1, 0xad, 0x5e, 0x04,
+ 0x00, 0x04, 0x01, 0x02, 0x00, 0x00, 0xaa, 0xef,
+ 0x2e, 0xe3, 0x04, 0x01, 0x02, 0x00, 0x00, 0xf4,
+ 0x0e, 0x5e, 0x05, 0x00, 0xe4, 0x47, 0x04, 0x01,
+ 0x02, 0x00, 0x00, 0xaa, 0x11, 0xf0, 0x0d, 0x0e,
+ 0x5e, 0x05, 0x00, 0xe4, 0x47, 0x04, 0xec, 0x01,
+ 0x00, 0x00, 0xaa, 0x6a, 0x7e, 0xff, 0xff, 0xff,
+ 0xe4, 0x90, 0xe8, 0xf2, 0x76, 0xff, 0x5e, 0x04,
+ 0x00, 0x04, 0xee, 0x01, 0x00, 0x00, 0xaa, 0x6a,
+ 0x6a, 0xff, 0xff, 0xff, 0x5e, 0x07, 0x00, 0xf3,
+ 0x0e, 0xe4, 0xe5, 0xfb, 0x11, 0x5e, 0x08, 0x00,
+ 0x5e, 0x05, 0x00, 0xe4, 0x47, 0xf4, 0xef, 0x06,
+ 0xe4, 0x90, 0xe8, 0xf1, 0xed, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0x8e, 0x0a, 0x00, 0x00, 0x00, 0x03,
+ 0x05, 0x00, 0x41, 0x00, 0x82, 0x0a, 0x04, 0x01,
+ 0x84, 0x0a, 0x00, 0x01, 0x9a, 0x08, 0x03, 0x01,
+ 0xb8, 0x05, 0x00, 0x00, 0x86, 0x0a, 0x00, 0x03,
+ 0x04, 0x47, 0x00, 0x00, 0x00, 0xe6, 0xe3, 0xe4,
+ 0xa4, 0xef, 0x36, 0xe5, 0x5e, 0x04, 0x00, 0xe3,
+ 0x47, 0xf4, 0x11, 0xf0, 0x25, 0x0e, 0x5e, 0x04,
+ 0x00, 0xe3, 0x47, 0x04, 0xe9, 0x01, 0x00, 0x00,
+ 0xaa, 0xef, 0x1e, 0xe3, 0xe4, 0xbb, 0x9f, 0xaa,
+ 0x11, 0xf0, 0x0f, 0x0e, 0x5e, 0x04, 0x00, 0xe3,
+ 0xbb, 0x9e, 0x47, 0x04, 0xe9, 0x01, 0x00, 0x00,
+ 0xab, 0xef, 0x06, 0xe3, 0x90, 0xe7, 0xf1, 0xc7,
+ 0x29, 0x0c, 0x43, 0x02, 0x03, 0x90, 0x0a, 0x00,
+ 0x02, 0x00, 0x05, 0x0a, 0x00, 0xb8, 0x01, 0x00,
+ 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0x02, 0x01, 0x00, 0x12, 0x01, 0x00, 0x04, 0x01,
+ 0x00, 0x13, 0x01, 0x00, 0x14, 0x01, 0xbb, 0xe6,
+ 0xe3, 0xe4, 0xfb, 0x0f, 0xe5, 0x5e, 0x04, 0x00,
+ 0xe3, 0x47, 0xf4, 0xef, 0x06, 0xe3, 0x90, 0xe7,
+ 0xf1, 0xef, 0x04, 0x6e, 0x02, 0x00, 0x00, 0x5e,
+ 0x04, 0x00, 0xb6, 0x69, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x5e, 0x05, 0x00, 0xe3, 0x24, 0x02, 0x00,
+ 0x9e, 0x04, 0x6e, 0x02, 0x00, 0x00, 0x9e, 0xce,
+ 0x5e, 0x06, 0x00, 0xb6, 0xe8, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xca, 0x24, 0x01, 0x00, 0xba, 0xa7,
+ 0xef, 0x1e, 0x04, 0x0f, 0x01, 0x00, 0x00, 0x5f,
+ 0x07, 0x00, 0x5e, 0x08, 0x00, 0xb6, 0xe8, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0xca, 0x24, 0x01, 0x00,
+ 0xba, 0xa7, 0xef, 0x03, 0xba, 0xe6, 0x29, 0xe3,
+ 0xcf, 0xcb, 0xe4, 0xfb, 0x12, 0x5e, 0x04, 0x00,
+ 0xcb, 0x47, 0x04, 0xfd, 0x01, 0x00, 0x00, 0xaa,
+ 0xef, 0x05, 0x94, 0x01, 0xf1, 0xec, 0xcb, 0xe4,
+ 0xfb, 0x17, 0x5e, 0x04, 0x00, 0xcb, 0x47, 0x04,
+ 0xf7, 0x01, 0x00, 0x00, 0xaa, 0xef, 0x0a, 0x04,
+ 0x1b, 0x00, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x29,
+ 0x5e, 0x09, 0x00, 0xb6, 0xe8, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0xca, 0x24, 0x01, 0x00, 0xba, 0xa7,
+ 0xef, 0x0a, 0x04, 0x10, 0x01, 0x00, 0x00, 0x5f,
+ 0x07, 0x00, 0x29, 0x04, 0x11, 0x01, 0x00, 0x00,
+ 0x5f, 0x07, 0x00, 0xba, 0xe6, 0x29, 0x0c, 0x43,
+ 0x02, 0x03, 0x92, 0x0a, 0x02, 0x00, 0x02, 0x03,
+ 0x02, 0x00, 0x2d, 0x00, 0x00, 0x09, 0x01, 0x00,
+ 0x04, 0x01, 0xe2, 0xee, 0xd6, 0xfb, 0x14, 0xe2,
+ 0xb6, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04,
+ 0x16, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xf1, 0xe9, 0xe2, 0xee, 0xd7, 0xfb, 0x10, 0xe2,
+ 0xb6, 0x87, 0x01, 0x00, 0x00, 0x01, 0x00, 0xe3,
+ 0x24, 0x01, 0x00, 0x0e, 0xf1, 0xed, 0x29,
+};
+
@@ -34,6 +34,7 @@
 #include <time.h>
 #include <dirent.h>
 #include <ftw.h>
+#include <pthread.h>
 
 #include "cutils.h"
 #include "list.h"
@@ -55,7 +56,10 @@ namelist_t test_list;
 namelist_t exclude_list;
 namelist_t exclude_dir_list;
 
-FILE *outfile;
+/* the output of a test and its result counters are thread local
+   because the tests may run in parallel (-j option) */
+__thread FILE *outfile;
+__thread FILE *message_out; /* stdout or per test buffer */
 enum test_mode_t {
     TEST_DEFAULT_NOSTRICT, /* run tests as nostrict unless test is flagged as strictonly */
     TEST_DEFAULT_STRICT,   /* run tests as strict unless test is flagged as nostrict */
@@ -80,12 +84,14 @@ char *harness_features;
 char *harness_skip_features;
 char *error_filename;
 char *error_file;
-FILE *error_out;
+__thread FILE *error_out;
 char *report_filename;
 int update_errors;
-int test_count, test_failed, test_index, test_skipped, test_excluded;
-int new_errors, changed_errors, fixed_errors;
-int async_done;
+__thread int test_count, test_failed, test_skipped;
+__thread int new_errors, changed_errors, fixed_errors;
+__thread int async_done;
+int test_index, test_excluded;
+int thread_count = 1;
 
 void warning(const char *, ...) __attribute__((__format__(__printf__, 1, 2)));
 void fatal(int, const char *, ...) __attribute__((__format__(__printf__, 2, 3)));
@@ -419,12 +425,33 @@ static JSValue js_evalScript(JSContext *ctx, JSValue this_val,
     return ret;
 }
 
-#ifdef CONFIG_AGENT
+static int64_t get_clock_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+}
 
-#include <pthread.h>
+/* CPU time used by a test. With one thread it is the process CPU time
+   as before, so the time of the agent threads is included. With
+   several threads, only the CPU time of the current thread is counted
+   so that the timings do not depend on the tests running in parallel,
+   hence the agents are not counted. */
+static int64_t get_test_clock_ms(void)
+{
+    struct timespec ts;
+    if (thread_count <= 1)
+        return (int64_t)clock() * 1000 / CLOCKS_PER_SEC;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+}
+
+#ifdef CONFIG_AGENT
 
 typedef struct {
     struct list_head link;
+    JSRuntime *rt; /* runtime of the test which started the agent */
+    FILE *outfile;
     pthread_t tid;
     char *script;
     JSValue broadcast_func;
@@ -437,12 +464,15 @@ typedef struct {
 
 typedef struct {
     struct list_head link;
+    JSRuntime *rt; /* runtime of the test which started the agent */
     char *str;
 } AgentReport;
 
 static JSValue add_helpers1(JSContext *ctx);
 static void add_helpers(JSContext *ctx);
 
+/* the agents of all the tests running in parallel are in the same
+   lists, so they are selected with their 'rt' field */
 static pthread_mutex_t agent_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t agent_cond = PTHREAD_COND_INITIALIZER;
 /* list of Test262Agent.link */
@@ -460,6 +490,7 @@ static void *agent_start(void *arg)
     JSValue ret_val;
     int ret;
 
+    outfile = agent->outfile;
     rt = JS_NewRuntime();
     if (rt == NULL) {
         fatal(1, "JS_NewRuntime failure");
@@ -500,7 +531,8 @@ static void *agent_start(void *arg)
                 }
 
                 agent->broadcast_pending = FALSE;
-                pthread_cond_signal(&agent_cond);
+                /* several tests may wait on agent_cond */
+                pthread_cond_broadcast(&agent_cond);
 
                 pthread_mutex_unlock(&agent_mutex);
 
@@ -542,11 +574,15 @@ static JSValue js_agent_start(JSContext *ctx, JSValue this_val,
         return JS_EXCEPTION;
     agent = malloc(sizeof(*agent));
     memset(agent, 0, sizeof(*agent));
+    agent->rt = JS_GetRuntime(ctx);
+    agent->outfile = outfile;
     agent->broadcast_func = JS_UNDEFINED;
     agent->broadcast_sab = JS_UNDEFINED;
     agent->script = strdup(script);
     JS_FreeCString(ctx, script);
+    pthread_mutex_lock(&agent_mutex);
     list_add_tail(&agent->link, &agent_list);
+    pthread_mutex_unlock(&agent_mutex);
     pthread_attr_init(&attr);
     // musl libc gives threads 80 kb stacks, much smaller than
     // JS_DEFAULT_STACK_SIZE (256 kb)
@@ -558,16 +594,42 @@ static JSValue js_agent_start(JSContext *ctx, JSValue this_val,
 
 static void js_agent_free(JSContext *ctx)
 {
-    struct list_head *el, *el1;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    struct list_head *el, *el1, list;
     Test262Agent *agent;
+    AgentReport *rep;
 
+    /* the agents are joined without the lock because they may use it */
+    init_list_head(&list);
+    pthread_mutex_lock(&agent_mutex);
     list_for_each_safe(el, el1, &agent_list) {
+        agent = list_entry(el, Test262Agent, link);
+        if (agent->rt == rt) {
+            list_del(&agent->link);
+            list_add_tail(&agent->link, &list);
+        }
+    }
+    pthread_mutex_unlock(&agent_mutex);
+
+    list_for_each_safe(el, el1, &list) {
         agent = list_entry(el, Test262Agent, link);
         pthread_join(agent->tid, NULL);
         JS_FreeValue(ctx, agent->broadcast_sab);
         list_del(&agent->link);
         free(agent);
     }
+
+    /* remove the reports which were not read */
+    pthread_mutex_lock(&report_mutex);
+    list_for_each_safe(el, el1, &report_list) {
+        rep = list_entry(el, AgentReport, link);
+        if (rep->rt == rt) {
+            list_del(&rep->link);
+            free(rep->str);
+            free(rep);
+        }
+    }
+    pthread_mutex_unlock(&report_mutex);
 }
 
 static JSValue js_agent_leaving(JSContext *ctx, JSValue this_val,
@@ -580,13 +642,13 @@ static JSValue js_agent_leaving(JSContext *ctx, JSValue this_val,
     return JS_UNDEFINED;
 }
 
-static BOOL is_broadcast_pending(void)
+static BOOL is_broadcast_pending(JSRuntime *rt)
 {
     struct list_head *el;
     Test262Agent *agent;
     list_for_each(el, &agent_list) {
         agent = list_entry(el, Test262Agent, link);
-        if (agent->broadcast_pending)
+        if (agent->rt == rt && agent->broadcast_pending)
             return TRUE;
     }
     return FALSE;
@@ -616,6 +678,8 @@ static JSValue js_agent_broadcast(JSContext *ctx, JSValue this_val,
     pthread_mutex_lock(&agent_mutex);
     list_for_each(el, &agent_list) {
         agent = list_entry(el, Test262Agent, link);
+        if (agent->rt != JS_GetRuntime(ctx))
+            continue;
         agent->broadcast_pending = TRUE;
         /* the shared array buffer is used by the thread, so increment
            its refcount */
@@ -626,7 +690,7 @@ static JSValue js_agent_broadcast(JSContext *ctx, JSValue this_val,
     }
     pthread_cond_broadcast(&agent_cond);
 
-    while (is_broadcast_pending()) {
+    while (is_broadcast_pending(JS_GetRuntime(ctx))) {
         pthread_cond_wait(&agent_cond, &agent_mutex);
     }
     pthread_mutex_unlock(&agent_mutex);
@@ -656,13 +720,6 @@ static JSValue js_agent_sleep(JSContext *ctx, JSValue this_val,
     return JS_UNDEFINED;
 }
 
-static int64_t get_clock_ms(void)
-{
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
-}
-
 static JSValue js_agent_monotonicNow(JSContext *ctx, JSValue this_val,
                                      int argc, JSValue *argv)
 {
@@ -672,15 +729,19 @@ static JSValue js_agent_monotonicNow(JSContext *ctx, JSValue this_val,
 static JSValue js_agent_getReport(JSContext *ctx, JSValue this_val,
                                   int argc, JSValue *argv)
 {
+    struct list_head *el;
     AgentReport *rep;
     JSValue ret;
 
+    rep = NULL;
     pthread_mutex_lock(&report_mutex);
-    if (list_empty(&report_list)) {
+    list_for_each(el, &report_list) {
+        rep = list_entry(el, AgentReport, link);
+        if (rep->rt == JS_GetRuntime(ctx)) {
+            list_del(&rep->link);
+            break;
+        }
         rep = NULL;
-    } else {
-        rep = list_entry(report_list.next, AgentReport, link);
-        list_del(&rep->link);
     }
     pthread_mutex_unlock(&report_mutex);
     if (rep) {
@@ -696,13 +757,17 @@ static JSValue js_agent_getReport(JSContext *ctx, JSValue this_val,
 static JSValue js_agent_report(JSContext *ctx, JSValue this_val,
                                int argc, JSValue *argv)
 {
+    Test262Agent *agent = JS_GetContextOpaque(ctx);
     const char *str;
     AgentReport *rep;
 
+    if (!agent)
+        return JS_ThrowTypeError(ctx, "must be called inside an agent");
     str = JS_ToCString(ctx, argv[0]);
     if (!str)
         return JS_EXCEPTION;
     rep = malloc(sizeof(*rep));
+    rep->rt = agent->rt;
     rep->str = strdup(str);
     JS_FreeCString(ctx, str);
 
@@ -1332,8 +1397,8 @@ static int eval_buf(JSContext *ctx, const char *buf, size_t buf_len,
                     if (!has_error_line) {
                         longest_match(buf, msg, pos, &pos, pos_line, &error_line);
                     }
-                    printf("%s:%d: %sOK, now has error %s\n",
-                           filename, error_line, strict_mode, msg);
+                    fprintf(message_out, "%s:%d: %sOK, now has error %s\n",
+                            filename, error_line, strict_mode, msg);
                     fixed_errors++;
                 }
             } else {
@@ -1363,7 +1428,7 @@ static int eval_buf(JSContext *ctx, const char *buf, size_t buf_len,
                             error_file ? "unexpected error: " : "", msg);
 
                     if (s && (!str_equal(s, msg) || error_line != s_line)) {
-                        printf("%s:%d: %sprevious error: %s\n", filename, s_line, strict_mode, s);
+                        fprintf(message_out, "%s:%d: %sprevious error: %s\n", filename, s_line, strict_mode, s);
                         changed_errors++;
                     } else {
                         new_errors++;
@@ -1371,7 +1436,7 @@ static int eval_buf(JSContext *ctx, const char *buf, size_t buf_len,
                 }
             } else {
                 if (s) {
-                    printf("%s:%d: %sOK, fixed error: %s\n", filename, s_line, strict_mode, s);
+                    fprintf(message_out, "%s:%d: %sOK, fixed error: %s\n", filename, s_line, strict_mode, s);
                     fixed_errors++;
                 }
             }
@@ -1495,9 +1560,12 @@ static char *get_option(char **pp, int *state)
     return option;
 }
 
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 void update_stats(JSRuntime *rt, const char *filename) {
     JSMemoryUsage stats;
     JS_ComputeMemoryUsage(rt, &stats);
+    pthread_mutex_lock(&stats_mutex);
     if (stats_count++ == 0) {
         stats_avg = stats_all = stats_min = stats_max = stats;
         stats_min_filename = strdup(filename);
@@ -1540,6 +1608,7 @@ void update_stats(JSRuntime *rt, const char *filename) {
         update(fast_array_elements);
     }
 #undef update
+    pthread_mutex_unlock(&stats_mutex);
 }
 
 int run_test_buf(const char *filename, const char *harness, namelist_t *ip,
@@ -1697,7 +1766,7 @@ int run_test(const char *filename, int index)
                         skip |= 1;
                     } else {
                         /* feature is not listed: skip and warn */
-                        printf("%s:%d: unknown feature: %s\n", filename, 1, option);
+                        fprintf(message_out, "%s:%d: unknown feature: %s\n", filename, 1, option);
                         skip |= 1;
                     }
                     free(option);
@@ -1806,14 +1875,14 @@ int run_test(const char *filename, int index)
         test_skipped++;
         ret = -2;
     } else {
-        clock_t clocks;
+        int64_t clocks;
 
         if (is_module) {
             eval_flags = JS_EVAL_TYPE_MODULE;
         } else {
             eval_flags = JS_EVAL_TYPE_GLOBAL;
         }
-        clocks = clock();
+        clocks = get_test_clock_ms();
         ret = 0;
         if (use_nostrict) {
             ret = run_test_buf(filename, harness, ip, buf, buf_len,
@@ -1825,10 +1894,10 @@ int run_test(const char *filename, int index)
                                 error_type, eval_flags | JS_EVAL_FLAG_STRICT,
                                 is_negative, is_async, can_block);
         }
-        clocks = clock() - clocks;
-        if (outfile && index >= 0 && clocks >= CLOCKS_PER_SEC / 10) {
+        clocks = get_test_clock_ms() - clocks;
+        if (outfile && index >= 0 && clocks >= 100) {
             /* output timings for tests that take more than 100 ms */
-            fprintf(outfile, " time: %d ms\n", (int)(clocks * 1000LL / CLOCKS_PER_SEC));
+            fprintf(outfile, " time: %d ms\n", (int)clocks);
         }
     }
     namelist_free(&include_list);
@@ -1952,6 +2021,165 @@ void show_progress(int force) {
 
 static int slow_test_threshold;
 
+/* test run by the -j option. The output of each test is buffered and
+   written in the test order, so it is the same as with a single
+   thread. */
+typedef struct {
+    const char *filename;
+    int index;
+    char *message_buf;
+    size_t message_len;
+    char *error_buf;
+    size_t error_len;
+    char *report_buf;
+    size_t report_len;
+    int test_count, test_failed, test_skipped;
+    int new_errors, changed_errors, fixed_errors;
+    int time_ms;
+    BOOL done;
+} TestJob;
+
+static pthread_mutex_t test_job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t test_job_cond = PTHREAD_COND_INITIALIZER;
+static TestJob *test_jobs;
+static int test_job_count, test_job_size, test_job_next;
+/* outputs of the main thread */
+static FILE *main_outfile, *main_error_out;
+
+static void add_test_job(const char *filename, int index)
+{
+    TestJob *job;
+
+    if (test_job_count >= test_job_size) {
+        size_t new_size = test_job_size + (test_job_size >> 1) + 4;
+        TestJob *new_jobs = realloc(test_jobs, new_size * sizeof(*test_jobs));
+        if (!new_jobs)
+            fatal(1, "no memory");
+        test_jobs = new_jobs;
+        test_job_size = new_size;
+    }
+    job = &test_jobs[test_job_count++];
+    memset(job, 0, sizeof(*job));
+    job->filename = filename;
+    job->index = index;
+}
+
+static void *test_job_thread(void *arg)
+{
+    TestJob *job;
+    int64_t ti;
+
+    for(;;) {
+        pthread_mutex_lock(&test_job_mutex);
+        if (test_job_next >= test_job_count) {
+            pthread_mutex_unlock(&test_job_mutex);
+            break;
+        }
+        job = &test_jobs[test_job_next++];
+        pthread_mutex_unlock(&test_job_mutex);
+
+        message_out = open_memstream(&job->message_buf, &job->message_len);
+        if (main_error_out == stdout)
+            error_out = message_out;
+        else
+            error_out = open_memstream(&job->error_buf, &job->error_len);
+        if (!main_outfile)
+            outfile = NULL;
+        else if (main_outfile == stdout)
+            outfile = message_out;
+        else
+            outfile = open_memstream(&job->report_buf, &job->report_len);
+        if (!message_out || !error_out || (main_outfile && !outfile))
+            fatal(1, "no memory");
+        test_count = test_failed = test_skipped = 0;
+        new_errors = changed_errors = fixed_errors = 0;
+
+        ti = get_clock_ms();
+        run_test(job->filename, job->index);
+        job->time_ms = get_clock_ms() - ti;
+
+        if (outfile && outfile != message_out)
+            fclose(outfile);
+        if (error_out != message_out)
+            fclose(error_out);
+        fclose(message_out);
+        outfile = error_out = message_out = NULL;
+        job->test_count = test_count;
+        job->test_failed = test_failed;
+        job->test_skipped = test_skipped;
+        job->new_errors = new_errors;
+        job->changed_errors = changed_errors;
+        job->fixed_errors = fixed_errors;
+
+        pthread_mutex_lock(&test_job_mutex);
+        job->done = TRUE;
+        pthread_cond_signal(&test_job_cond);
+        pthread_mutex_unlock(&test_job_mutex);
+    }
+    return NULL;
+}
+
+static void write_test_output(FILE *f, char *buf, size_t len)
+{
+    if (f && len != 0)
+        fwrite(buf, 1, len, f);
+    free(buf);
+}
+
+/* run the test jobs in 'thread_count' threads */
+static void run_test_jobs(void)
+{
+    pthread_t *tids;
+    pthread_attr_t attr;
+    TestJob *job;
+    int i, n;
+
+    main_outfile = outfile;
+    main_error_out = error_out;
+    n = min_int(thread_count, test_job_count);
+    tids = malloc(sizeof(tids[0]) * n);
+    if (!tids)
+        fatal(1, "no memory");
+    pthread_attr_init(&attr);
+    /* same as the usual stack size of the main thread */
+    pthread_attr_setstacksize(&attr, 8 << 20);
+    for(i = 0; i < n; i++) {
+        if (pthread_create(&tids[i], &attr, test_job_thread, NULL))
+            fatal(1, "cannot create thread");
+    }
+    pthread_attr_destroy(&attr);
+
+    for(i = 0; i < test_job_count; i++) {
+        job = &test_jobs[i];
+        pthread_mutex_lock(&test_job_mutex);
+        while (!job->done)
+            pthread_cond_wait(&test_job_cond, &test_job_mutex);
+        pthread_mutex_unlock(&test_job_mutex);
+
+        write_test_output(stdout, job->message_buf, job->message_len);
+        write_test_output(main_error_out, job->error_buf, job->error_len);
+        write_test_output(main_outfile, job->report_buf, job->report_len);
+        if (outfile)
+            fflush(outfile);
+        test_count += job->test_count;
+        test_failed += job->test_failed;
+        test_skipped += job->test_skipped;
+        new_errors += job->new_errors;
+        changed_errors += job->changed_errors;
+        fixed_errors += job->fixed_errors;
+        if (slow_test_threshold != 0 && job->time_ms >= slow_test_threshold)
+            fprintf(stderr, "\n%s (%d ms)\n", job->filename, job->time_ms);
+        show_progress(FALSE);
+    }
+
+    for(i = 0; i < n; i++)
+        pthread_join(tids[i], NULL);
+    free(tids);
+    free(test_jobs);
+    test_jobs = NULL;
+    test_job_count = test_job_size = test_job_next = 0;
+}
+
 void run_test_dir_list(namelist_t *lp, int start_index, int stop_index)
 {
     int i;
@@ -1965,6 +2193,8 @@ void run_test_dir_list(namelist_t *lp, int start_index, int stop_index)
             test_skipped++;
         } else if (stop_index >= 0 && test_index > stop_index) {
             test_skipped++;
+        } else if (thread_count > 1) {
+            add_test_job(p, test_index);
         } else {
             int ti;
             if (slow_test_threshold != 0) {
@@ -1982,6 +2212,8 @@ void run_test_dir_list(namelist_t *lp, int start_index, int stop_index)
         }
         test_index++;
     }
+    if (test_job_count != 0)
+        run_test_jobs();
     show_progress(TRUE);
 }
 
@@ -1996,6 +2228,8 @@ void help(void)
            "-N             run test prepared by test262-harness+eshost\n"
            "-s             run tests in strict mode, skip @nostrict tests\n"
            "-E             only run tests from the error file\n"
+           "-j n           run the tests in 'n' threads (the test timings then\n"
+           "               exclude the agent threads)\n"
            "-C             use compact progress indicator\n"
            "-t             show timings\n"
            "-u             update error file\n"
@@ -2041,7 +2275,7 @@ int main(int argc, char **argv)
         if (*arg != '-')
             break;
         optind++;
-        if (strstr("-c -d -e -x -f -r -E -T", arg))
+        if (strstr("-c -d -e -x -f -r -E -T -j", arg))
             optind++;
         if (strstr("-d -f", arg))
             ignore = "testdir"; // run only the tests from -d or -f
@@ -2090,6 +2324,8 @@ int main(int argc, char **argv)
             only_check_errors = TRUE;
         } else if (str_equal(arg, "-T")) {
             slow_test_threshold = atoi(get_opt_arg(arg, argv[optind++]));
+        } else if (str_equal(arg, "-j")) {
+            thread_count = max_int(1, atoi(get_opt_arg(arg, argv[optind++])));
         } else if (str_equal(arg, "-N")) {
             is_test262_harness = TRUE;
         } else if (str_equal(arg, "--module")) {
@@ -2107,6 +2343,7 @@ int main(int argc, char **argv)
         return run_test262_harness_test(argv[optind], is_module);
     }
 
+    message_out = stdout;
     error_out = stdout;
     if (error_filename) {
         error_file = load_file(error_filename, NULL);
@@ -0,0 +1,856 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include "quickjs-libc.h"
+
+#include <math.h>
+
+const uint32_t qjsc_test_aot_size = 2307;
+
+const uint8_t qjsc_test_aot[2307] = {
+ 0x45, 0x24, 0x0c, 0x61, 0x73, 0x73, 0x65, 0x72,
+ 0x74, 0x06, 0x66, 0x69, 0x62, 0x10, 0x73, 0x75,
+ 0x6d, 0x5f, 0x6c, 0x6f, 0x6f, 0x70, 0x08, 0x62,
+ 0x69, 0x74, 0x73, 0x06, 0x73, 0x68, 0x72, 0x06,
+ 0x63, 0x6d, 0x70, 0x08, 0x63, 0x6f, 0x6e, 0x64,
+ 0x08, 0x73, 0x61, 0x6d, 0x65, 0x0e, 0x6e, 0x65,
+ 0x67, 0x5f, 0x6d, 0x6f, 0x64, 0x1e, 0x75, 0x73,
+ 0x65, 0x5f, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+ 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x1a, 0x75, 0x6e,
+ 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x5f,
+ 0x76, 0x61, 0x72, 0x14, 0x77, 0x72, 0x69, 0x74,
+ 0x65, 0x5f, 0x6f, 0x6e, 0x6c, 0x79, 0x12, 0x6e,
+ 0x6f, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+ 0x18, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x6e, 0x75,
+ 0x6d, 0x62, 0x65, 0x72, 0x73, 0x1a, 0x74, 0x65,
+ 0x73, 0x74, 0x5f, 0x66, 0x61, 0x6c, 0x6c, 0x62,
+ 0x61, 0x63, 0x6b, 0x22, 0x74, 0x65, 0x73, 0x74,
+ 0x73, 0x2f, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x61,
+ 0x6f, 0x74, 0x2e, 0x6a, 0x73, 0x0c, 0x61, 0x63,
+ 0x74, 0x75, 0x61, 0x6c, 0x10, 0x65, 0x78, 0x70,
+ 0x65, 0x63, 0x74, 0x65, 0x64, 0x04, 0x69, 0x73,
+ 0x2e, 0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69,
+ 0x6f, 0x6e, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65,
+ 0x64, 0x3a, 0x20, 0x67, 0x6f, 0x74, 0x20, 0x7c,
+ 0x02, 0x7c, 0x18, 0x2c, 0x20, 0x65, 0x78, 0x70,
+ 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x7c, 0x04,
+ 0x20, 0x28, 0x02, 0x29, 0x02, 0x61, 0x02, 0x62,
+ 0x02, 0x6e, 0x02, 0x74, 0x02, 0x69, 0x02, 0x73,
+ 0x02, 0x78, 0x06, 0x4e, 0x61, 0x4e, 0x10, 0x49,
+ 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x06,
+ 0x65, 0x72, 0x72, 0x02, 0x65, 0x04, 0x61, 0x31,
+ 0x0c, 0x00, 0x06, 0x00, 0xa2, 0x01, 0x00, 0x01,
+ 0x00, 0x01, 0x00, 0x10, 0xef, 0x01, 0x01, 0xa4,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0xe3, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0x69, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xe4, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xe5,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0xe6, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0xe7, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xe8, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xe9,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0xea, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0xeb, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xec, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xed,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0xee, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0xef, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xf1,
+ 0x00, 0x00, 0x00, 0x40, 0xc5, 0x00, 0x40, 0xe3,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x01, 0x40, 0x69,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x02, 0x40, 0xe4,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x03, 0x40, 0xe5,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x04, 0x40, 0xe6,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x05, 0x40, 0xe7,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x06, 0x40, 0xe8,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x07, 0x40, 0xe9,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x08, 0x40, 0xea,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x09, 0x40, 0xeb,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0a, 0x40, 0xec,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0b, 0x40, 0xed,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0c, 0x40, 0xee,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0d, 0x40, 0xef,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0e, 0x40, 0xf0,
+ 0x00, 0x00, 0x00, 0x00, 0xc5, 0x0f, 0x40, 0xf1,
+ 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0x00, 0x00,
+ 0x00, 0xf3, 0xce, 0x38, 0xf1, 0x00, 0x00, 0x00,
+ 0xf3, 0xd2, 0x28, 0xe4, 0x03, 0x01, 0x09, 0x00,
+ 0x60, 0x01, 0x00, 0x80, 0x01, 0xc0, 0x02, 0x26,
+ 0x0c, 0x43, 0x06, 0x00, 0xc6, 0x03, 0x03, 0x01,
+ 0x03, 0x04, 0x00, 0x00, 0x55, 0x04, 0xe6, 0x03,
+ 0x00, 0x01, 0x00, 0xe8, 0x03, 0x00, 0x01, 0x00,
+ 0x66, 0x00, 0x01, 0x00, 0x9c, 0x01, 0x00, 0x01,
+ 0x00, 0x0c, 0x01, 0xce, 0xca, 0xee, 0xbb, 0xaa,
+ 0xef, 0x03, 0x0a, 0xdb, 0x38, 0x97, 0x00, 0x00,
+ 0x00, 0xb6, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0xd6, 0xd7, 0x24, 0x02, 0x00, 0xef, 0x02, 0x29,
+ 0x38, 0x99, 0x00, 0x00, 0x00, 0x04, 0xf6, 0x00,
+ 0x00, 0x00, 0xd6, 0x9e, 0x04, 0xf7, 0x00, 0x00,
+ 0x00, 0x9e, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x9e,
+ 0xd7, 0x9e, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x9e,
+ 0xd8, 0xef, 0x10, 0x04, 0xf9, 0x00, 0x00, 0x00,
+ 0xd8, 0x9e, 0x04, 0xfa, 0x00, 0x00, 0x00, 0x9e,
+ 0xf1, 0x02, 0xc6, 0x9e, 0xf4, 0x2f, 0xe4, 0x03,
+ 0x03, 0x07, 0x12, 0x21, 0x0e, 0x62, 0x09, 0x76,
+ 0x30, 0x0c, 0x43, 0x06, 0x00, 0xd2, 0x01, 0x02,
+ 0x00, 0x02, 0x02, 0x00, 0x00, 0x04, 0x02, 0xf6,
+ 0x03, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x01,
+ 0x00, 0xd6, 0xd7, 0x9e, 0x28, 0xe4, 0x03, 0x0f,
+ 0x01, 0x04, 0x0c, 0x43, 0x06, 0x00, 0xc8, 0x03,
+ 0x01, 0x04, 0x01, 0x02, 0x00, 0x00, 0x18, 0x05,
+ 0xfa, 0x03, 0x00, 0x01, 0x00, 0xf6, 0x03, 0x00,
+ 0x00, 0x00, 0xf8, 0x03, 0x00, 0x01, 0x00, 0xfc,
+ 0x03, 0x00, 0x02, 0x00, 0xfe, 0x03, 0x00, 0x03,
+ 0x00, 0xba, 0xce, 0xbb, 0xcf, 0xba, 0xd1, 0xcd,
+ 0xd6, 0xfb, 0x0d, 0xca, 0xcb, 0x9e, 0xd0, 0xcb,
+ 0xce, 0xcc, 0xcf, 0x94, 0x03, 0xf1, 0xf1, 0xca,
+ 0x28, 0xe4, 0x03, 0x14, 0x07, 0x04, 0x17, 0x21,
+ 0x17, 0x0d, 0x0d, 0x17, 0x0c, 0x43, 0x06, 0x00,
+ 0xca, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00,
+ 0x3e, 0x03, 0xfa, 0x03, 0x00, 0x01, 0x00, 0x80,
+ 0x04, 0x01, 0x00, 0x20, 0xfe, 0x03, 0x02, 0x01,
+ 0x20, 0x61, 0x00, 0x00, 0xba, 0xce, 0x61, 0x01,
+ 0x00, 0xbb, 0xcf, 0x62, 0x01, 0x00, 0xd6, 0xfc,
+ 0x2b, 0x62, 0x01, 0x00, 0xbd, 0x9d, 0xba, 0xaa,
+ 0x11, 0xf0, 0x09, 0x0e, 0x62, 0x01, 0x00, 0xbf,
+ 0x9d, 0xba, 0xaa, 0xef, 0x0d, 0x62, 0x00, 0x00,
+ 0x62, 0x01, 0x00, 0x9e, 0x11, 0x63, 0x00, 0x00,
+ 0x0e, 0x62, 0x01, 0x00, 0x92, 0x63, 0x01, 0x00,
+ 0x0e, 0xf1, 0xd1, 0x62, 0x00, 0x00, 0x28, 0xe4,
+ 0x03, 0x1f, 0x06, 0x13, 0x0d, 0x3a, 0x67, 0x3f,
+ 0x35, 0x0c, 0x43, 0x06, 0x00, 0xcc, 0x03, 0x02,
+ 0x00, 0x02, 0x03, 0x00, 0x00, 0x0f, 0x02, 0xf6,
+ 0x03, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x01,
+ 0x00, 0xd6, 0xd7, 0xa1, 0xd6, 0xbb, 0xa2, 0xaf,
+ 0xd6, 0xd7, 0xa3, 0xb0, 0xd7, 0x96, 0xae, 0x28,
+ 0xe4, 0x03, 0x29, 0x01, 0x04, 0x0c, 0x43, 0x06,
+ 0x00, 0xce, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00,
+ 0x00, 0x04, 0x01, 0xf6, 0x03, 0x00, 0x01, 0x00,
+ 0xd6, 0xba, 0xa3, 0x28, 0xe4, 0x03, 0x2e, 0x01,
+ 0x04, 0x0c, 0x43, 0x06, 0x00, 0xd0, 0x03, 0x02,
+ 0x00, 0x02, 0x02, 0x00, 0x00, 0x04, 0x02, 0xf6,
+ 0x03, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x00, 0x01,
+ 0x00, 0xd6, 0xd7, 0xa4, 0x28, 0xe4, 0x03, 0x33,
+ 0x01, 0x04, 0x0c, 0x43, 0x06, 0x00, 0xd2, 0x03,
+ 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x0f, 0x02,
+ 0xf6, 0x03, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x00,
+ 0x01, 0x00, 0xd6, 0xd7, 0xfd, 0x05, 0xd6, 0xd7,
+ 0x9f, 0x28, 0xd6, 0xef, 0x03, 0xd7, 0x28, 0xb9,
+ 0x28, 0xe4, 0x03, 0x38, 0x01, 0x04, 0x0c, 0x43,
+ 0x06, 0x00, 0xd4, 0x03, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x10, 0x02, 0xf6, 0x03, 0x00, 0x01,
+ 0x00, 0xf8, 0x03, 0x00, 0x01, 0x00, 0xd6, 0xd7,
+ 0xac, 0xd6, 0xd7, 0xad, 0xbc, 0x9b, 0x9e, 0xd6,
+ 0xd7, 0xaa, 0xbe, 0x9b, 0x9e, 0x28, 0xe4, 0x03,
+ 0x3d, 0x01, 0x04, 0x0c, 0x43, 0x06, 0x00, 0xd6,
+ 0x03, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x05,
+ 0x02, 0xf6, 0x03, 0x00, 0x01, 0x00, 0xf8, 0x03,
+ 0x00, 0x01, 0x00, 0xd6, 0xd7, 0x9d, 0x8d, 0x28,
+ 0xe4, 0x03, 0x42, 0x01, 0x04, 0x0c, 0x43, 0x06,
+ 0x00, 0xd8, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00,
+ 0x00, 0x10, 0x02, 0xf6, 0x03, 0x00, 0x01, 0x00,
+ 0x82, 0x04, 0x01, 0x00, 0x20, 0x61, 0x00, 0x00,
+ 0xd6, 0xef, 0x05, 0x62, 0x00, 0x00, 0x28, 0xbb,
+ 0xce, 0x62, 0x00, 0x00, 0x28, 0xe4, 0x03, 0x47,
+ 0x04, 0x13, 0x12, 0x17, 0x0d, 0x0c, 0x43, 0x06,
+ 0x00, 0xda, 0x03, 0x01, 0x01, 0x01, 0x02, 0x00,
+ 0x00, 0x09, 0x02, 0xf6, 0x03, 0x00, 0x01, 0x00,
+ 0x82, 0x04, 0x00, 0x00, 0x00, 0xd6, 0xef, 0x03,
+ 0xbc, 0xce, 0xca, 0xbd, 0x9b, 0x28, 0xe4, 0x03,
+ 0x4f, 0x03, 0x05, 0x12, 0x0d, 0x0c, 0x43, 0x06,
+ 0x00, 0xdc, 0x03, 0x01, 0x01, 0x01, 0x02, 0x00,
+ 0x00, 0x0d, 0x02, 0xf6, 0x03, 0x00, 0x01, 0x00,
+ 0x82, 0x04, 0x01, 0x00, 0x20, 0x61, 0x00, 0x00,
+ 0xd6, 0xce, 0xbc, 0x11, 0x63, 0x00, 0x00, 0x0e,
+ 0xd6, 0x28, 0xe4, 0x03, 0x57, 0x03, 0x13, 0x0d,
+ 0x21, 0x0c, 0x43, 0x06, 0x00, 0xde, 0x03, 0x01,
+ 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0xf6,
+ 0x03, 0x00, 0x01, 0x00, 0xd6, 0x90, 0xda, 0x29,
+ 0xe4, 0x03, 0x5e, 0x02, 0x04, 0x12, 0x0c, 0x43,
+ 0x06, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x04,
+ 0x00, 0x08, 0xd1, 0x04, 0x00, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x69, 0x00, 0x00, 0x00, 0xbb,
+ 0xbc, 0xf5, 0xbd, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x69, 0x00, 0x00, 0x00, 0x01,
+ 0xff, 0xff, 0xff, 0x7f, 0xbb, 0xf5, 0xc4, 0x00,
+ 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0x69, 0x00, 0x00, 0x00, 0xc4, 0x01, 0xc4, 0x02,
+ 0xf5, 0xc4, 0x03, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x69, 0x00, 0x00, 0x00, 0xba,
+ 0x8d, 0xba, 0x8d, 0xf5, 0xba, 0x8d, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x69, 0x00,
+ 0x00, 0x00, 0x38, 0x02, 0x01, 0x00, 0x00, 0xbb,
+ 0xf5, 0x38, 0x02, 0x01, 0x00, 0x00, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x69, 0x00,
+ 0x00, 0x00, 0x38, 0x03, 0x01, 0x00, 0x00, 0x38,
+ 0x03, 0x01, 0x00, 0x00, 0x8d, 0xf5, 0x38, 0x02,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xc2,
+ 0x0a, 0xf4, 0xc2, 0x37, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0xc2, 0x4e, 0xf4, 0xc4, 0x04, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00,
+ 0x00, 0xba, 0xf4, 0xba, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xe5, 0x00, 0x00, 0x00,
+ 0xc3, 0xe7, 0x03, 0xf4, 0x01, 0xd0, 0x8e, 0x03,
+ 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0xbf, 0xbc, 0xf5,
+ 0xc2, 0x15, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xb9, 0xc2,
+ 0x21, 0xf5, 0x01, 0xde, 0xff, 0xff, 0x7f, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0xbc, 0xc2, 0x28, 0xa0, 0xbd,
+ 0x9e, 0xbb, 0xf5, 0xc0, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xb9, 0xf4, 0xc4, 0x05, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xbc, 0xc2, 0x20, 0xa0, 0xbf, 0x9e, 0xf4, 0xbf,
+ 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xc4, 0x06, 0x8d, 0xf4,
+ 0xc4, 0x07, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xbb, 0xbc,
+ 0xf5, 0x0a, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0x38, 0x02,
+ 0x01, 0x00, 0x00, 0xbc, 0xf5, 0x09, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xbf, 0xbd, 0xf5, 0xbc, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xba, 0xbd, 0xf5, 0xb9, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x38, 0x02, 0x01, 0x00, 0x00, 0xbd,
+ 0xf5, 0xb9, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xb9, 0xbd,
+ 0xf5, 0xbd, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0xbb, 0xbb,
+ 0xf5, 0xbf, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0xbb, 0xbc,
+ 0xf5, 0xbc, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x38, 0x02,
+ 0x01, 0x00, 0x00, 0x38, 0x02, 0x01, 0x00, 0x00,
+ 0xf5, 0xbc, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0xba, 0xba,
+ 0x8d, 0xf5, 0xbf, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xbf,
+ 0xbd, 0xf5, 0xc2, 0xfe, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xc2, 0xfc, 0xbc, 0xf5, 0xba, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0xbe, 0xbc, 0xf5, 0xba, 0x8d, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0xbb, 0xba, 0xf5, 0x38, 0x02, 0x01,
+ 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xee, 0x00, 0x00, 0x00, 0xbd, 0xf4,
+ 0xbd, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xef, 0x00, 0x00, 0x00, 0xbb, 0xf4, 0x38,
+ 0x46, 0x00, 0x00, 0x00, 0xf5, 0x29, 0xe4, 0x03,
+ 0x63, 0x21, 0x04, 0x53, 0x6c, 0x62, 0x62, 0x7b,
+ 0x94, 0x58, 0x58, 0x4e, 0x6c, 0x58, 0x6c, 0x6c,
+ 0x53, 0x67, 0x5d, 0x53, 0x67, 0x53, 0x53, 0x67,
+ 0x53, 0x53, 0x53, 0x7b, 0x58, 0x58, 0x58, 0x58,
+ 0x67, 0x4e, 0x5d, 0x06, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0xe0, 0x41, 0x06, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0xe0, 0x3f, 0x06, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0xd0, 0x3f, 0x06, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x3f, 0x06,
+ 0x68, 0x8e, 0x66, 0x16, 0xe1, 0xc6, 0x3f, 0x43,
+ 0x06, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xef,
+ 0x41, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x04, 0x40, 0x06, 0x00, 0x00, 0xc0, 0xff, 0xff,
+ 0xff, 0xef, 0x41, 0x0c, 0x43, 0x06, 0x00, 0xe2,
+ 0x03, 0x00, 0x02, 0x00, 0x05, 0x00, 0x05, 0x83,
+ 0x02, 0x02, 0x88, 0x04, 0x00, 0x00, 0x00, 0x8a,
+ 0x04, 0x03, 0x00, 0x03, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x69, 0x00, 0x00, 0x00, 0x04, 0xfb,
+ 0x00, 0x00, 0x00, 0xbb, 0xf5, 0x04, 0x06, 0x01,
+ 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x69, 0x00, 0x00, 0x00, 0xbb, 0xf4,
+ 0x38, 0x02, 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x69, 0x00, 0x00,
+ 0x00, 0x0a, 0xbb, 0xf5, 0xbc, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x69, 0x00, 0x00,
+ 0x00, 0xc4, 0x00, 0xc4, 0x01, 0xf5, 0xc4, 0x02,
+ 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0x69, 0x00, 0x00, 0x00, 0x0b, 0xc5, 0x03, 0x54,
+ 0x3a, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xf5, 0xbf,
+ 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0xe4, 0x00, 0x00, 0x00, 0xc4, 0x04, 0xf4, 0xc2,
+ 0x37, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xec, 0x00, 0x00, 0x00, 0xba, 0xf4, 0xbb,
+ 0xf5, 0x0e, 0x07, 0xce, 0x6d, 0x0f, 0x00, 0x00,
+ 0x00, 0x38, 0xec, 0x00, 0x00, 0x00, 0xbb, 0xf4,
+ 0x0e, 0x0e, 0xf1, 0x0d, 0xcf, 0x6d, 0x09, 0x00,
+ 0x00, 0x00, 0xcb, 0xce, 0x0e, 0xf1, 0x02, 0x2f,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xca, 0x38, 0xcf,
+ 0x00, 0x00, 0x00, 0xa8, 0xf4, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xee, 0x00, 0x00, 0x00,
+ 0x04, 0xfb, 0x00, 0x00, 0x00, 0xf4, 0x04, 0xfb,
+ 0x00, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0xbb,
+ 0xf4, 0xc0, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xed, 0x00, 0x00, 0x00, 0xba, 0xf4,
+ 0x38, 0x02, 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x69, 0x00, 0x00,
+ 0x00, 0x11, 0xbb, 0xbc, 0x21, 0x02, 0x00, 0x38,
+ 0x69, 0x00, 0x00, 0x00, 0xa8, 0xf4, 0x29, 0xe4,
+ 0x03, 0x89, 0x01, 0x13, 0x05, 0x7b, 0x62, 0x53,
+ 0x62, 0x7b, 0x58, 0x4e, 0x0d, 0x1c, 0x2b, 0x30,
+ 0x0d, 0x17, 0x49, 0x76, 0x4e, 0x62, 0x76, 0x0a,
+ 0x10, 0x01, 0x80, 0x0a, 0x14, 0x01, 0x80, 0x0a,
+ 0x14, 0x01, 0xc0, 0x0c, 0x42, 0x07, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0xbe, 0x28, 0xe4, 0x03, 0x90, 0x01, 0x00, 0x07,
+ 0x04, 0x31, 0x30,
+};
+
+#ifndef AOT_HELPERS_DEFINED
+#define AOT_HELPERS_DEFINED
+
+static inline int aot_get_number(double *pres, JSValueConst val)
+{
+  int tag = JS_VALUE_GET_TAG(val);
+  if (tag == JS_TAG_INT)
+    *pres = JS_VALUE_GET_INT(val);
+  else if (JS_TAG_IS_FLOAT64(tag))
+    *pres = JS_VALUE_GET_FLOAT64(val);
+  else
+    return 0;
+  return 1;
+}
+
+static inline int32_t aot_toint32(double d)
+{
+  if (d >= -2147483648.0 && d <= 2147483647.0)
+    return (int32_t)d;
+  if (!isfinite(d))
+    return 0;
+  d = fmod(trunc(d), 4294967296.0);
+  if (d < 0)
+    d += 4294967296.0;
+  return (int32_t)(uint32_t)d;
+}
+
+static inline double aot_mod(double a, double b)
+{
+  /* the sign of a null result is the sign of 'a' */
+  if (a >= 1 && a <= 2147483647.0 && a == (int32_t)a &&
+      b >= 1 && b <= 2147483647.0 && b == (int32_t)b)
+    return (int32_t)a % (int32_t)b;
+  return fmod(a, b);
+}
+
+#endif
+
+/* add, line 15 */
+static int qjsc_test_aot_f2(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double a1;
+  double s0 = 0;
+  double s1 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  if (argc <= 1 || !aot_get_number(&a1, argv[1]))
+    return 0;
+  s0 = a0;
+  s1 = a1;
+  s0 = s0 + s1;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* fib, line 20 */
+static int qjsc_test_aot_f3(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double l0 = 0;
+  int l0_ok = 0;
+  double l1 = 0;
+  int l1_ok = 0;
+  double l2 = 0;
+  int l2_ok = 0;
+  double l3 = 0;
+  int l3_ok = 0;
+  double s0 = 0;
+  double s1 = 0;
+  int poll_count = 10000;
+  (void)s0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  s0 = 0;
+  l0 = s0;
+  l0_ok = 1;
+  s0 = 1;
+  l1 = s0;
+  l1_ok = 1;
+  s0 = 0;
+  l3 = s0;
+  l3_ok = 1;
+ L6:
+  if (!l3_ok)
+    return 0;
+  s0 = l3;
+  s1 = a0;
+  if (!(s0 < s1)) {
+    goto L22;
+  }
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  if (!l1_ok)
+    return 0;
+  s1 = l1;
+  s0 = s0 + s1;
+  l2 = s0;
+  l2_ok = 1;
+  if (!l1_ok)
+    return 0;
+  s0 = l1;
+  l0 = s0;
+  l0_ok = 1;
+  if (!l2_ok)
+    return 0;
+  s0 = l2;
+  l1 = s0;
+  l1_ok = 1;
+  if (!l3_ok)
+    return 0;
+  l3 += 1;
+  {
+    if (--poll_count <= 0) {
+      poll_count = 10000;
+      if (JS_PollInterrupts(ctx))
+        return -1;
+    }
+    goto L6;
+  }
+ L22:
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* sum_loop, line 31 */
+static int qjsc_test_aot_f4(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double l0 = 0;
+  int l0_ok = 0;
+  double l1 = 0;
+  int l1_ok = 0;
+  double s0 = 0;
+  double s1 = 0;
+  int poll_count = 10000;
+  (void)s0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  l0_ok = 0;
+  s0 = 0;
+  l0 = s0;
+  l0_ok = 1;
+  l1_ok = 0;
+  s0 = 1;
+  l1 = s0;
+  l1_ok = 1;
+ L10:
+  if (!l1_ok)
+    return 0;
+  s0 = l1;
+  s1 = a0;
+  if (!(s0 <= s1)) {
+    goto L58;
+  }
+  if (!l1_ok)
+    return 0;
+  s0 = l1;
+  s1 = 3;
+  s0 = aot_mod(s0, s1);
+  s1 = 0;
+  s0 = (s0 == s1);
+  {
+    double t0 = s0;
+    s0 = t0;
+    s1 = t0;
+  }
+  if ((s1 != 0)) {
+    goto L34;
+  }
+  if (!l1_ok)
+    return 0;
+  s0 = l1;
+  s1 = 5;
+  s0 = aot_mod(s0, s1);
+  s1 = 0;
+  s0 = (s0 == s1);
+ L34:
+  if (!(s0 != 0)) {
+    goto L48;
+  }
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  if (!l1_ok)
+    return 0;
+  s1 = l1;
+  s0 = s0 + s1;
+  {
+    double t0 = s0;
+    s0 = t0;
+    s1 = t0;
+  }
+  if (!l0_ok)
+    return 0;
+  l0 = s1;
+  l0_ok = 1;
+ L48:
+  if (!l1_ok)
+    return 0;
+  s0 = l1;
+  s1 = s0 + 1;
+  if (!l1_ok)
+    return 0;
+  l1 = s1;
+  l1_ok = 1;
+  {
+    if (--poll_count <= 0) {
+      poll_count = 10000;
+      if (JS_PollInterrupts(ctx))
+        return -1;
+    }
+    goto L10;
+  }
+ L58:
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* bits, line 41 */
+static int qjsc_test_aot_f5(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double a1;
+  double s0 = 0;
+  double s1 = 0;
+  double s2 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  if (argc <= 1 || !aot_get_number(&a1, argv[1]))
+    return 0;
+  s0 = a0;
+  s1 = a1;
+  s0 = (int32_t)((uint32_t)aot_toint32(s0) << (aot_toint32(s1) & 31));
+  s1 = a0;
+  s2 = 1;
+  s1 = aot_toint32(s1) >> (aot_toint32(s2) & 31);
+  s0 = aot_toint32(s0) ^ aot_toint32(s1);
+  s1 = a0;
+  s2 = a1;
+  s1 = (uint32_t)aot_toint32(s1) >> (aot_toint32(s2) & 31);
+  s0 = aot_toint32(s0) | aot_toint32(s1);
+  s1 = a1;
+  s1 = ~aot_toint32(s1);
+  s0 = aot_toint32(s0) & aot_toint32(s1);
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* shr, line 46 */
+static int qjsc_test_aot_f6(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double s0 = 0;
+  double s1 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  s0 = a0;
+  s1 = 0;
+  s0 = (uint32_t)aot_toint32(s0) >> (aot_toint32(s1) & 31);
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* cmp, line 51 */
+static int qjsc_test_aot_f7(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double a1;
+  double s0 = 0;
+  double s1 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  if (argc <= 1 || !aot_get_number(&a1, argv[1]))
+    return 0;
+  s0 = a0;
+  s1 = a1;
+  s0 = (s0 < s1);
+  *pret = JS_NewBool(ctx, s0 != 0);
+  return 1;
+}
+
+/* cond, line 56 */
+static int qjsc_test_aot_f8(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double a1;
+  double s0 = 0;
+  double s1 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  if (argc <= 1 || !aot_get_number(&a1, argv[1]))
+    return 0;
+  s0 = a0;
+  s1 = a1;
+  if (!(s0 > s1)) {
+    goto L8;
+  }
+  s0 = a0;
+  s1 = a1;
+  s0 = s0 - s1;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+ L8:
+  s0 = a0;
+  if (!(s0 != 0 && s0 == s0)) {
+    goto L13;
+  }
+  s0 = a1;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+ L13:
+  s0 = -1;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* same, line 61 */
+static int qjsc_test_aot_f9(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double a1;
+  double s0 = 0;
+  double s1 = 0;
+  double s2 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  if (argc <= 1 || !aot_get_number(&a1, argv[1]))
+    return 0;
+  s0 = a0;
+  s1 = a1;
+  s0 = (s0 == s1);
+  s1 = a0;
+  s2 = a1;
+  s1 = (s1 != s2);
+  s2 = 2;
+  s1 = s1 * s2;
+  s0 = s0 + s1;
+  s1 = a0;
+  s2 = a1;
+  s1 = (s1 == s2);
+  s2 = 4;
+  s1 = s1 * s2;
+  s0 = s0 + s1;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* neg_mod, line 66 */
+static int qjsc_test_aot_f10(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double a1;
+  double s0 = 0;
+  double s1 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  if (argc <= 1 || !aot_get_number(&a1, argv[1]))
+    return 0;
+  s0 = a0;
+  s1 = a1;
+  s0 = aot_mod(s0, s1);
+  s0 = -s0;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* use_before_init, line 71 */
+static int qjsc_test_aot_f11(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double l0 = 0;
+  int l0_ok = 0;
+  double s0 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  l0_ok = 0;
+  s0 = a0;
+  if (!(s0 != 0 && s0 == s0)) {
+    goto L10;
+  }
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+ L10:
+  s0 = 1;
+  l0 = s0;
+  l0_ok = 1;
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* undefined_var, line 79 */
+static int qjsc_test_aot_f12(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double l0 = 0;
+  int l0_ok = 0;
+  double s0 = 0;
+  double s1 = 0;
+  (void)s0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  s0 = a0;
+  if (!(s0 != 0 && s0 == s0)) {
+    goto L5;
+  }
+  s0 = 2;
+  l0 = s0;
+  l0_ok = 1;
+ L5:
+  if (!l0_ok)
+    return 0;
+  s0 = l0;
+  s1 = 3;
+  s0 = s0 * s1;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* write_only, line 87 */
+static int qjsc_test_aot_f13(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  int l0_ok = 0;
+  double s0 = 0;
+  double s1 = 0;
+  (void)s0;
+  (void)s1;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  l0_ok = 0;
+  s0 = a0;
+  l0_ok = 1;
+  s0 = 2;
+  {
+    double t0 = s0;
+    s0 = t0;
+    s1 = t0;
+  }
+  if (!l0_ok)
+    return 0;
+  l0_ok = 1;
+  s0 = a0;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+/* no_result, line 94 */
+static int qjsc_test_aot_f14(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double a0;
+  double s0 = 0;
+
+  if (argc <= 0 || !aot_get_number(&a0, argv[0]))
+    return 0;
+  s0 = a0;
+  s0 += 1;
+  a0 = s0;
+  *pret = JS_UNDEFINED;
+  return 1;
+}
+
+/* <null>, line 144 */
+static int qjsc_test_aot_f17(JSContext *ctx, JSValue *pret, int argc, JSValueConst *argv)
+{
+  double s0 = 0;
+
+  s0 = 4;
+  *pret = JS_NewFloat64(ctx, s0);
+  return 1;
+}
+
+JSAOTFunction * const qjsc_test_aot_aot[18] = {
+  NULL,
+  NULL,
+  qjsc_test_aot_f2,
+  qjsc_test_aot_f3,
+  qjsc_test_aot_f4,
+  qjsc_test_aot_f5,
+  qjsc_test_aot_f6,
+  qjsc_test_aot_f7,
+  qjsc_test_aot_f8,
+  qjsc_test_aot_f9,
+  qjsc_test_aot_f10,
+  qjsc_test_aot_f11,
+  qjsc_test_aot_f12,
+  qjsc_test_aot_f13,
+  qjsc_test_aot_f14,
+  NULL,
+  NULL,
+  qjsc_test_aot_f17,
+};
+
+const int qjsc_test_aot_aot_count = 18;
+
+static JSContext *JS_NewCustomContext(JSRuntime *rt)
+{
+  JSContext *ctx = JS_NewContextRaw(rt);
+  if (!ctx)
+    return NULL;
+  JS_AddIntrinsicBaseObjects(ctx);
+  JS_AddIntrinsicDate(ctx);
+  JS_AddIntrinsicEval(ctx);
+  JS_AddIntrinsicStringNormalize(ctx);
+  JS_AddIntrinsicRegExp(ctx);
+  JS_AddIntrinsicJSON(ctx);
+  JS_AddIntrinsicProxy(ctx);
+  JS_AddIntrinsicMapSet(ctx);
+  JS_AddIntrinsicTypedArrays(ctx);
+  JS_AddIntrinsicPromise(ctx);
+  JS_AddIntrinsicBigInt(ctx);
+  return ctx;
+}
+
+int main(int argc, char **argv)
+{
+  JSRuntime *rt;
+  JSContext *ctx;
+  rt = JS_NewRuntime();
+  js_std_set_worker_new_context_func(JS_NewCustomContext);
+  js_std_init_handlers(rt);
+  JS_SetModuleLoaderFunc(rt, NULL, js_module_loader, NULL);
+  ctx = JS_NewCustomContext(rt);
+  js_std_add_helpers(ctx, argc, argv);
+  js_std_eval_binary2(ctx, qjsc_test_aot, qjsc_test_aot_size, 0, qjsc_test_aot_aot, qjsc_test_aot_aot_count);
+  js_std_loop(ctx);
+  js_std_free_handlers(rt);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(rt);
+  return 0;
+}
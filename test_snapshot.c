@@ -0,0 +1,678 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include "quickjs-libc.h"
+
+const uint32_t qjsc_test_snapshot_size = 2751;
+
+const uint8_t qjsc_test_snapshot[2751] = {
+ 0x45, 0x58, 0x0c, 0x61, 0x73, 0x73, 0x65, 0x72,
+ 0x74, 0x18, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x63,
+ 0x6c, 0x6f, 0x73, 0x75, 0x72, 0x65, 0x14, 0x74,
+ 0x65, 0x73, 0x74, 0x5f, 0x63, 0x6c, 0x61, 0x73,
+ 0x73, 0x18, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x70,
+ 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x18, 0x74,
+ 0x65, 0x73, 0x74, 0x5f, 0x73, 0x79, 0x6d, 0x62,
+ 0x6f, 0x6c, 0x73, 0x18, 0x74, 0x65, 0x73, 0x74,
+ 0x5f, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73,
+ 0x18, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x67, 0x6c,
+ 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2c, 0x74, 0x65,
+ 0x73, 0x74, 0x73, 0x2f, 0x74, 0x65, 0x73, 0x74,
+ 0x5f, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f,
+ 0x74, 0x2e, 0x6a, 0x73, 0x0c, 0x61, 0x63, 0x74,
+ 0x75, 0x61, 0x6c, 0x10, 0x65, 0x78, 0x70, 0x65,
+ 0x63, 0x74, 0x65, 0x64, 0x2e, 0x61, 0x73, 0x73,
+ 0x65, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66,
+ 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a, 0x20, 0x67,
+ 0x6f, 0x74, 0x20, 0x7c, 0x02, 0x7c, 0x18, 0x2c,
+ 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+ 0x64, 0x20, 0x7c, 0x04, 0x20, 0x28, 0x02, 0x29,
+ 0x0e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+ 0x08, 0x69, 0x6e, 0x63, 0x72, 0x02, 0x70, 0x0c,
+ 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x33, 0x0a, 0x6e,
+ 0x6f, 0x72, 0x6d, 0x32, 0x0a, 0x50, 0x6f, 0x69,
+ 0x6e, 0x74, 0x0c, 0x6f, 0x72, 0x69, 0x67, 0x69,
+ 0x6e, 0x12, 0x67, 0x65, 0x6e, 0x5f, 0x72, 0x61,
+ 0x6e, 0x67, 0x65, 0x0a, 0x30, 0x2c, 0x31, 0x2c,
+ 0x32, 0x02, 0x63, 0x10, 0x63, 0x6f, 0x75, 0x6e,
+ 0x74, 0x65, 0x72, 0x32, 0x0e, 0x43, 0x6f, 0x75,
+ 0x6e, 0x74, 0x65, 0x72, 0x12, 0x69, 0x6e, 0x73,
+ 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x0e, 0x73,
+ 0x79, 0x6d, 0x5f, 0x6f, 0x62, 0x6a, 0x06, 0x73,
+ 0x79, 0x6d, 0x16, 0x64, 0x65, 0x73, 0x63, 0x72,
+ 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x12, 0x73,
+ 0x79, 0x6d, 0x5f, 0x75, 0x6e, 0x64, 0x65, 0x66,
+ 0x14, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65,
+ 0x72, 0x65, 0x64, 0x2a, 0x67, 0x65, 0x74, 0x4f,
+ 0x77, 0x6e, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72,
+ 0x74, 0x79, 0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
+ 0x73, 0x10, 0x77, 0x65, 0x61, 0x6b, 0x5f, 0x6d,
+ 0x61, 0x70, 0x10, 0x77, 0x65, 0x61, 0x6b, 0x5f,
+ 0x6b, 0x65, 0x79, 0x08, 0x77, 0x65, 0x61, 0x6b,
+ 0x12, 0x77, 0x65, 0x61, 0x6b, 0x5f, 0x6d, 0x61,
+ 0x70, 0x32, 0x12, 0x77, 0x65, 0x61, 0x6b, 0x5f,
+ 0x6b, 0x65, 0x79, 0x32, 0x0a, 0x77, 0x65, 0x61,
+ 0x6b, 0x32, 0x14, 0x77, 0x65, 0x61, 0x6b, 0x5f,
+ 0x6c, 0x61, 0x74, 0x65, 0x72, 0x02, 0x78, 0x10,
+ 0x77, 0x65, 0x61, 0x6b, 0x5f, 0x73, 0x65, 0x74,
+ 0x08, 0x76, 0x69, 0x65, 0x77, 0x14, 0x62, 0x79,
+ 0x74, 0x65, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74,
+ 0x14, 0x62, 0x79, 0x74, 0x65, 0x4c, 0x65, 0x6e,
+ 0x67, 0x74, 0x68, 0x12, 0x67, 0x65, 0x74, 0x55,
+ 0x69, 0x6e, 0x74, 0x31, 0x36, 0x0c, 0x62, 0x75,
+ 0x66, 0x66, 0x65, 0x72, 0x0a, 0x74, 0x61, 0x62,
+ 0x6c, 0x65, 0x02, 0x61, 0x02, 0x62, 0x08, 0x73,
+ 0x69, 0x7a, 0x65, 0x0a, 0x6e, 0x61, 0x6d, 0x65,
+ 0x73, 0x02, 0x79, 0x04, 0x72, 0x65, 0x16, 0x28,
+ 0x5c, 0x64, 0x2b, 0x29, 0x2d, 0x28, 0x5c, 0x64,
+ 0x2b, 0x29, 0x02, 0x67, 0x0e, 0x61, 0x20, 0x31,
+ 0x32, 0x2d, 0x33, 0x34, 0x0e, 0x72, 0x65, 0x70,
+ 0x6c, 0x61, 0x63, 0x65, 0x0a, 0x24, 0x32, 0x2d,
+ 0x24, 0x31, 0x0e, 0x61, 0x20, 0x33, 0x34, 0x2d,
+ 0x31, 0x32, 0x08, 0x64, 0x61, 0x74, 0x65, 0x0e,
+ 0x67, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x0a,
+ 0x62, 0x6f, 0x78, 0x65, 0x64, 0x08, 0x6c, 0x69,
+ 0x73, 0x74, 0x06, 0x74, 0x77, 0x6f, 0x0a, 0x74,
+ 0x68, 0x72, 0x65, 0x65, 0x08, 0x73, 0x65, 0x6c,
+ 0x66, 0x0c, 0x73, 0x70, 0x61, 0x72, 0x73, 0x65,
+ 0x06, 0x66, 0x61, 0x72, 0x0a, 0x62, 0x79, 0x74,
+ 0x65, 0x73, 0x0a, 0x31, 0x2c, 0x32, 0x2c, 0x33,
+ 0x10, 0x69, 0x73, 0x46, 0x72, 0x6f, 0x7a, 0x65,
+ 0x6e, 0x0c, 0x66, 0x72, 0x6f, 0x7a, 0x65, 0x6e,
+ 0x08, 0x61, 0x64, 0x64, 0x31, 0x0e, 0x6c, 0x65,
+ 0x78, 0x69, 0x63, 0x61, 0x6c, 0x10, 0x43, 0x4f,
+ 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x54, 0x06, 0x73,
+ 0x75, 0x6d, 0x0c, 0x68, 0x69, 0x64, 0x64, 0x65,
+ 0x6e, 0x08, 0x6b, 0x65, 0x79, 0x73, 0x0e, 0x69,
+ 0x6e, 0x64, 0x65, 0x78, 0x4f, 0x66, 0x0c, 0x65,
+ 0x73, 0x63, 0x61, 0x70, 0x65, 0x06, 0x50, 0x49,
+ 0x32, 0x04, 0x50, 0x49, 0x18, 0x61, 0x73, 0x79,
+ 0x6e, 0x63, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+ 0x74, 0x0a, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x12,
+ 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x69, 0x66,
+ 0x79, 0x12, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x5b,
+ 0x31, 0x5d, 0x7d, 0x0c, 0x00, 0x06, 0x00, 0xa2,
+ 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x8d,
+ 0x01, 0x01, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x3f,
+ 0xe3, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xe4, 0x00,
+ 0x00, 0x00, 0x40, 0x3f, 0xe5, 0x00, 0x00, 0x00,
+ 0x40, 0x3f, 0xe6, 0x00, 0x00, 0x00, 0x40, 0x3f,
+ 0xe7, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xe8, 0x00,
+ 0x00, 0x00, 0x40, 0x3f, 0xe9, 0x00, 0x00, 0x00,
+ 0x40, 0xc5, 0x00, 0x40, 0xe3, 0x00, 0x00, 0x00,
+ 0x00, 0xc5, 0x01, 0x40, 0xe4, 0x00, 0x00, 0x00,
+ 0x00, 0xc5, 0x02, 0x40, 0xe5, 0x00, 0x00, 0x00,
+ 0x00, 0xc5, 0x03, 0x40, 0xe6, 0x00, 0x00, 0x00,
+ 0x00, 0xc5, 0x04, 0x40, 0xe7, 0x00, 0x00, 0x00,
+ 0x00, 0xc5, 0x05, 0x40, 0xe8, 0x00, 0x00, 0x00,
+ 0x00, 0xc5, 0x06, 0x40, 0xe9, 0x00, 0x00, 0x00,
+ 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xf3, 0xce,
+ 0x38, 0xe5, 0x00, 0x00, 0x00, 0xf3, 0xce, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0xf3, 0xce, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xf3, 0xce, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0xf3, 0xce, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0xf3, 0xd2, 0x28, 0xd4, 0x03, 0x01, 0x0a,
+ 0xd3, 0x00, 0x38, 0xe0, 0x01, 0x26, 0x26, 0x26,
+ 0x26, 0x26, 0x0c, 0x43, 0x06, 0x00, 0xc6, 0x03,
+ 0x03, 0x01, 0x03, 0x04, 0x00, 0x00, 0x7c, 0x04,
+ 0xd6, 0x03, 0x00, 0x01, 0x00, 0xd8, 0x03, 0x00,
+ 0x01, 0x00, 0x66, 0x00, 0x01, 0x00, 0x9c, 0x01,
+ 0x00, 0x01, 0x00, 0x0c, 0x01, 0xce, 0xca, 0xee,
+ 0xbb, 0xaa, 0xef, 0x03, 0x0a, 0xdb, 0xd6, 0xd7,
+ 0xfe, 0x02, 0x29, 0xd6, 0xf8, 0xf0, 0x33, 0xd7,
+ 0xf8, 0xf0, 0x2f, 0xd6, 0x98, 0x04, 0x4a, 0x00,
+ 0x00, 0x00, 0xaa, 0xef, 0x25, 0xd7, 0x98, 0x04,
+ 0x4a, 0x00, 0x00, 0x00, 0xaa, 0xef, 0x1b, 0xd6,
+ 0xb6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xd7, 0xb6, 0x38, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x24, 0x00, 0x00, 0xac, 0xef, 0x02,
+ 0x29, 0x38, 0x99, 0x00, 0x00, 0x00, 0x04, 0xed,
+ 0x00, 0x00, 0x00, 0xd6, 0x9e, 0x04, 0xee, 0x00,
+ 0x00, 0x00, 0x9e, 0x04, 0xef, 0x00, 0x00, 0x00,
+ 0x9e, 0xd7, 0x9e, 0x04, 0xee, 0x00, 0x00, 0x00,
+ 0x9e, 0xd8, 0xef, 0x10, 0x04, 0xf0, 0x00, 0x00,
+ 0x00, 0xd8, 0x9e, 0x04, 0xf1, 0x00, 0x00, 0x00,
+ 0x9e, 0xf1, 0x02, 0xc6, 0x9e, 0xf4, 0x2f, 0xd4,
+ 0x03, 0x03, 0x0b, 0x12, 0x21, 0x0e, 0x17, 0x09,
+ 0x1c, 0x6c, 0x8a, 0x09, 0x76, 0x30, 0x0c, 0x43,
+ 0x06, 0x00, 0xc8, 0x03, 0x00, 0x00, 0x00, 0x03,
+ 0x00, 0x00, 0x3f, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xf2, 0x00, 0x00, 0x00, 0xb5, 0x41,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xf2, 0x00,
+ 0x00, 0x00, 0xb6, 0xf3, 0x00, 0x00, 0x00, 0x01,
+ 0x00, 0x24, 0x00, 0x00, 0xbd, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xf2, 0x00, 0x00,
+ 0x00, 0xb5, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00,
+ 0xbd, 0xf5, 0x29, 0xd4, 0x03, 0x14, 0x04, 0x04,
+ 0x67, 0x76, 0x62, 0x0c, 0x43, 0x06, 0x00, 0xca,
+ 0x03, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0xd9,
+ 0x01, 0x01, 0xe8, 0x03, 0x00, 0x00, 0x00, 0x38,
+ 0xf5, 0x00, 0x00, 0x00, 0x11, 0xbb, 0xbc, 0xbd,
+ 0x21, 0x03, 0x00, 0xce, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0xca, 0xb6, 0xf6, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xc2, 0x0e, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xca, 0x38, 0xf7,
+ 0x00, 0x00, 0x00, 0xa8, 0xf4, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xf7, 0x00, 0x00, 0x00,
+ 0xb6, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x24,
+ 0x00, 0x00, 0xb6, 0xf6, 0x00, 0x00, 0x00, 0x02,
+ 0x00, 0x24, 0x00, 0x00, 0xba, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00,
+ 0x00, 0xb6, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0x38, 0xf5, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x38, 0xf7, 0x00, 0x00, 0x00, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x00, 0x00,
+ 0x00, 0xb5, 0x3c, 0x00, 0x00, 0x00, 0x04, 0x00,
+ 0xb5, 0xf6, 0x00, 0x00, 0x00, 0x05, 0x00, 0x98,
+ 0x04, 0x1b, 0x00, 0x00, 0x00, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x00, 0x00,
+ 0x00, 0xb5, 0x37, 0x00, 0x00, 0x00, 0x06, 0x00,
+ 0x04, 0xf7, 0x00, 0x00, 0x00, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xf5, 0x00, 0x00,
+ 0x00, 0xee, 0xbd, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x26, 0x00, 0x00, 0xba, 0x38, 0xf9,
+ 0x00, 0x00, 0x00, 0xbd, 0xf4, 0x52, 0x0e, 0xb6,
+ 0x5c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x24, 0x00,
+ 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00, 0xf5, 0x29,
+ 0xd4, 0x03, 0x1b, 0x0a, 0x05, 0x44, 0x67, 0x49,
+ 0xa8, 0xa3, 0xa3, 0x7b, 0x49, 0xad, 0x0c, 0x43,
+ 0x06, 0x00, 0xcc, 0x03, 0x00, 0x01, 0x00, 0x04,
+ 0x00, 0x00, 0x95, 0x01, 0x01, 0xf6, 0x03, 0x00,
+ 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0xfc, 0x00, 0x00, 0x00, 0xb6, 0xf3, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xbc, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xfd,
+ 0x00, 0x00, 0x00, 0xb6, 0x64, 0x00, 0x00, 0x00,
+ 0x01, 0x00, 0x38, 0xfc, 0x00, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xf4, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xfd, 0x00, 0x00, 0x00, 0xb6, 0xfe,
+ 0x00, 0x00, 0x00, 0x02, 0x00, 0x24, 0x00, 0x00,
+ 0xbb, 0xf5, 0x0e, 0x38, 0xfd, 0x00, 0x00, 0x00,
+ 0x11, 0x21, 0x00, 0x00, 0xce, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0xca, 0xb6, 0xf3, 0x00, 0x00, 0x00,
+ 0x03, 0x00, 0x24, 0x00, 0x00, 0xbb, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00,
+ 0x00, 0x00, 0xb6, 0xfe, 0x00, 0x00, 0x00, 0x04,
+ 0x00, 0x24, 0x00, 0x00, 0xbc, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00,
+ 0x00, 0xb6, 0x64, 0x00, 0x00, 0x00, 0x05, 0x00,
+ 0x0b, 0x24, 0x01, 0x00, 0x09, 0xf5, 0x29, 0xd4,
+ 0x03, 0x29, 0x08, 0x05, 0x76, 0x8a, 0x76, 0x35,
+ 0x62, 0x76, 0x76, 0x0c, 0x43, 0x06, 0x00, 0xce,
+ 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xb1,
+ 0x03, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0xff, 0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0x00,
+ 0x00, 0x47, 0xbb, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xff, 0x00, 0x00, 0x00, 0xb5,
+ 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0xb5,
+ 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x02, 0x01, 0x00, 0x00, 0xb5,
+ 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x38, 0x46,
+ 0x00, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xff, 0x00, 0x00, 0x00, 0x38,
+ 0x9d, 0x00, 0x00, 0x00, 0xb6, 0x11, 0x00, 0x00,
+ 0x00, 0x03, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x47, 0xbc, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00,
+ 0x00, 0xb6, 0x04, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0x38, 0xff, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xee, 0xbc, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x05, 0x01, 0x00, 0x00, 0xb6, 0x42,
+ 0x00, 0x00, 0x00, 0x05, 0x00, 0x38, 0x06, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x07, 0x01,
+ 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x05, 0x01, 0x00, 0x00, 0xb6, 0x64,
+ 0x00, 0x00, 0x00, 0x06, 0x00, 0x0b, 0x24, 0x01,
+ 0x00, 0x09, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x08, 0x01, 0x00, 0x00, 0xb6, 0x42,
+ 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x09, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x0a, 0x01,
+ 0x00, 0x00, 0xf5, 0x0e, 0x38, 0x09, 0x01, 0x00,
+ 0x00, 0x38, 0x0b, 0x01, 0x00, 0x00, 0xb7, 0x0c,
+ 0x01, 0x00, 0x00, 0x08, 0x00, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x08, 0x01, 0x00, 0x00, 0xb6,
+ 0x42, 0x00, 0x00, 0x00, 0x09, 0x00, 0x38, 0x09,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x04, 0x0a,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0x0d, 0x01,
+ 0x00, 0x00, 0xb6, 0x69, 0x00, 0x00, 0x00, 0x0a,
+ 0x00, 0x38, 0x06, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0x0d, 0x01, 0x00, 0x00, 0xb6, 0x64, 0x00, 0x00,
+ 0x00, 0x0b, 0x00, 0x38, 0x06, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xf4, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x0e, 0x01, 0x00, 0x00, 0xb5,
+ 0x0f, 0x01, 0x00, 0x00, 0x0c, 0x00, 0xbc, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x0e,
+ 0x01, 0x00, 0x00, 0xb5, 0x10, 0x01, 0x00, 0x00,
+ 0x0d, 0x00, 0xbe, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x0e, 0x01, 0x00, 0x00, 0xb6,
+ 0x11, 0x01, 0x00, 0x00, 0x0e, 0x00, 0xba, 0x24,
+ 0x01, 0x00, 0xc3, 0x34, 0x12, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x0e, 0x01, 0x00,
+ 0x00, 0xb5, 0x12, 0x01, 0x00, 0x00, 0x0f, 0x00,
+ 0xb5, 0x10, 0x01, 0x00, 0x00, 0x10, 0x00, 0xc2,
+ 0x08, 0xf5, 0x29, 0xd4, 0x03, 0x35, 0x12, 0x04,
+ 0x62, 0x7b, 0x7b, 0x7b, 0xad, 0x94, 0xa3, 0x7b,
+ 0xa3, 0x58, 0xa3, 0x6c, 0x8a, 0x67, 0x67, 0x85,
+ 0x8a, 0x0c, 0x43, 0x06, 0x00, 0xd0, 0x03, 0x00,
+ 0x00, 0x00, 0x05, 0x00, 0x00, 0xaf, 0x03, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x13, 0x01,
+ 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x14, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xbb, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x13, 0x01, 0x00, 0x00, 0xb6, 0x42,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x15, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xbb, 0x47, 0xbd,
+ 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0x13, 0x01, 0x00, 0x00, 0xb5, 0x16, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0xbc, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0x17, 0x01, 0x00, 0x00,
+ 0xb6, 0x64, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04,
+ 0x18, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xf4,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x19,
+ 0x01, 0x00, 0x00, 0xb5, 0x6d, 0x00, 0x00, 0x00,
+ 0x04, 0x00, 0x04, 0x1a, 0x01, 0x00, 0x00, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x19,
+ 0x01, 0x00, 0x00, 0xb5, 0x6e, 0x00, 0x00, 0x00,
+ 0x05, 0x00, 0x04, 0x1b, 0x01, 0x00, 0x00, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x04, 0x1c,
+ 0x01, 0x00, 0x00, 0xb6, 0x1d, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0x38, 0x19, 0x01, 0x00, 0x00, 0x04,
+ 0x1e, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0x04,
+ 0x1f, 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0x20, 0x01, 0x00, 0x00,
+ 0xb6, 0x21, 0x01, 0x00, 0x00, 0x07, 0x00, 0x24,
+ 0x00, 0x00, 0xc3, 0xe8, 0x03, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x22, 0x01, 0x00,
+ 0x00, 0xbb, 0x9e, 0xc2, 0x2b, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x23, 0x01, 0x00,
+ 0x00, 0xee, 0xbf, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x23, 0x01, 0x00, 0x00, 0xbb,
+ 0x47, 0x04, 0x24, 0x01, 0x00, 0x00, 0xf5, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x23, 0x01,
+ 0x00, 0x00, 0xbc, 0x47, 0xb5, 0x25, 0x01, 0x00,
+ 0x00, 0x08, 0x00, 0xbd, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0xbd, 0x38, 0x23, 0x01, 0x00,
+ 0x00, 0xa9, 0x09, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x23, 0x01, 0x00, 0x00, 0xb5,
+ 0x26, 0x01, 0x00, 0x00, 0x09, 0x00, 0x38, 0x23,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x27, 0x01, 0x00, 0x00, 0xee,
+ 0xc3, 0xe9, 0x03, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x27, 0x01, 0x00, 0x00, 0xc3,
+ 0xe8, 0x03, 0x47, 0x04, 0x28, 0x01, 0x00, 0x00,
+ 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38,
+ 0x29, 0x01, 0x00, 0x00, 0xb6, 0x5c, 0x00, 0x00,
+ 0x00, 0x0a, 0x00, 0x24, 0x00, 0x00, 0x04, 0x2a,
+ 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00, 0xb6,
+ 0x2b, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x38, 0x2c,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xf4, 0x0e,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0x2d, 0x01,
+ 0x00, 0x00, 0xbc, 0xf4, 0xbd, 0xf5, 0x29, 0xd4,
+ 0x03, 0x4a, 0x14, 0x04, 0x8f, 0x99, 0x67, 0x8a,
+ 0x7b, 0x7b, 0xbc, 0x80, 0x53, 0x49, 0x62, 0x71,
+ 0x4e, 0x7b, 0x53, 0x6c, 0x8a, 0x8a, 0x49, 0x0c,
+ 0x43, 0x06, 0x00, 0xd2, 0x03, 0x00, 0x00, 0x00,
+ 0x05, 0x00, 0x00, 0xea, 0x01, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0x2e, 0x01, 0x00, 0x00,
+ 0x04, 0x27, 0x00, 0x00, 0x00, 0xf5, 0x0e, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0x2f, 0x01, 0x00,
+ 0x00, 0xc2, 0x7b, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0xbb, 0xbc, 0xbd, 0x26, 0x03, 0x00,
+ 0xb6, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xc0, 0xf5, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0x31, 0x01, 0x00, 0x00, 0x04,
+ 0x31, 0x01, 0x00, 0x00, 0xf5, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00,
+ 0xb6, 0x32, 0x01, 0x00, 0x00, 0x01, 0x00, 0x38,
+ 0x8c, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0xb6,
+ 0x33, 0x01, 0x00, 0x00, 0x02, 0x00, 0x04, 0x31,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xb9, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x37, 0x34,
+ 0x01, 0x00, 0x00, 0x98, 0x04, 0x46, 0x00, 0x00,
+ 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0x9f, 0x00, 0x00, 0x00, 0xb5, 0x35, 0x01,
+ 0x00, 0x00, 0x03, 0x00, 0x38, 0x9f, 0x00, 0x00,
+ 0x00, 0xb5, 0x36, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0xbc, 0x9b, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0x37, 0x01, 0x00, 0x00, 0xc1, 0xf5,
+ 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x37, 0x38,
+ 0x01, 0x00, 0x00, 0x98, 0x04, 0x1b, 0x00, 0x00,
+ 0x00, 0xf5, 0x0e, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xa0, 0x00, 0x00, 0x00, 0xb6, 0x39, 0x01,
+ 0x00, 0x00, 0x05, 0x00, 0x0b, 0xbb, 0x26, 0x01,
+ 0x00, 0x4c, 0x14, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x04, 0x3a, 0x01, 0x00, 0x00, 0xf5, 0x29,
+ 0xd4, 0x03, 0x61, 0x0b, 0x04, 0x58, 0x49, 0x7b,
+ 0x58, 0xda, 0x5d, 0xa8, 0x45, 0x5d, 0xb7,
+};
+
+const uint32_t qjsc_snapshot_size = 2257;
+
+const uint8_t qjsc_snapshot[2257] = {
+ 0x45, 0x3a, 0x01, 0x0c, 0x65, 0x73, 0x63, 0x61,
+ 0x70, 0x65, 0x01, 0x0e, 0x63, 0x6f, 0x75, 0x6e,
+ 0x74, 0x65, 0x72, 0x01, 0x08, 0x69, 0x6e, 0x63,
+ 0x72, 0x01, 0x02, 0x6e, 0x01, 0x2c, 0x74, 0x65,
+ 0x73, 0x74, 0x73, 0x2f, 0x73, 0x6e, 0x61, 0x70,
+ 0x73, 0x68, 0x6f, 0x74, 0x5f, 0x69, 0x6e, 0x69,
+ 0x74, 0x2e, 0x6a, 0x73, 0x01, 0x10, 0x63, 0x6f,
+ 0x75, 0x6e, 0x74, 0x65, 0x72, 0x32, 0x01, 0x0e,
+ 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x01,
+ 0x14, 0x23, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+ 0x63, 0x65, 0x73, 0x01, 0x0c, 0x23, 0x63, 0x6f,
+ 0x75, 0x6e, 0x74, 0x03, 0x0c, 0x23, 0x63, 0x6f,
+ 0x75, 0x6e, 0x74, 0x03, 0x14, 0x23, 0x69, 0x6e,
+ 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x01,
+ 0x12, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
+ 0x65, 0x73, 0x01, 0x06, 0x6f, 0x62, 0x6a, 0x01,
+ 0x0a, 0x23, 0x73, 0x74, 0x65, 0x70, 0x03, 0x0e,
+ 0x3c, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x3e, 0x01,
+ 0x06, 0x73, 0x79, 0x6d, 0x03, 0x06, 0x73, 0x79,
+ 0x6d, 0x01, 0x12, 0x73, 0x79, 0x6d, 0x5f, 0x75,
+ 0x6e, 0x64, 0x65, 0x66, 0x03, 0x01, 0x01, 0x0e,
+ 0x73, 0x79, 0x6d, 0x5f, 0x6f, 0x62, 0x6a, 0x02,
+ 0x14, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65,
+ 0x72, 0x65, 0x64, 0x01, 0x10, 0x77, 0x65, 0x61,
+ 0x6b, 0x5f, 0x6b, 0x65, 0x79, 0x01, 0x10, 0x77,
+ 0x65, 0x61, 0x6b, 0x5f, 0x6d, 0x61, 0x70, 0x01,
+ 0x10, 0x77, 0x65, 0x61, 0x6b, 0x5f, 0x73, 0x65,
+ 0x74, 0x01, 0x12, 0x77, 0x65, 0x61, 0x6b, 0x5f,
+ 0x6d, 0x61, 0x70, 0x32, 0x01, 0x12, 0x77, 0x65,
+ 0x61, 0x6b, 0x5f, 0x6b, 0x65, 0x79, 0x32, 0x01,
+ 0x14, 0x77, 0x65, 0x61, 0x6b, 0x5f, 0x6c, 0x61,
+ 0x74, 0x65, 0x72, 0x01, 0x08, 0x76, 0x69, 0x65,
+ 0x77, 0x01, 0x0a, 0x74, 0x61, 0x62, 0x6c, 0x65,
+ 0x01, 0x0a, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x01,
+ 0x04, 0x72, 0x65, 0x01, 0x08, 0x64, 0x61, 0x74,
+ 0x65, 0x01, 0x0a, 0x62, 0x6f, 0x78, 0x65, 0x64,
+ 0x01, 0x08, 0x6c, 0x69, 0x73, 0x74, 0x01, 0x0a,
+ 0x74, 0x68, 0x72, 0x65, 0x65, 0x01, 0x08, 0x73,
+ 0x65, 0x6c, 0x66, 0x01, 0x0c, 0x73, 0x70, 0x61,
+ 0x72, 0x73, 0x65, 0x01, 0x0a, 0x62, 0x79, 0x74,
+ 0x65, 0x73, 0x01, 0x0c, 0x66, 0x72, 0x6f, 0x7a,
+ 0x65, 0x6e, 0x01, 0x02, 0x61, 0x01, 0x08, 0x61,
+ 0x64, 0x64, 0x31, 0x01, 0x02, 0x62, 0x01, 0x12,
+ 0x67, 0x65, 0x6e, 0x5f, 0x72, 0x61, 0x6e, 0x67,
+ 0x65, 0x01, 0x02, 0x69, 0x01, 0x18, 0x61, 0x73,
+ 0x79, 0x6e, 0x63, 0x5f, 0x72, 0x65, 0x73, 0x75,
+ 0x6c, 0x74, 0x01, 0x0c, 0x68, 0x69, 0x64, 0x64,
+ 0x65, 0x6e, 0x01, 0x0a, 0x50, 0x6f, 0x69, 0x6e,
+ 0x74, 0x01, 0x02, 0x78, 0x01, 0x02, 0x79, 0x01,
+ 0x0a, 0x6e, 0x6f, 0x72, 0x6d, 0x32, 0x01, 0x0c,
+ 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x01, 0x0c,
+ 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x33, 0x01, 0x02,
+ 0x7a, 0x01, 0x0e, 0x6c, 0x65, 0x78, 0x69, 0x63,
+ 0x61, 0x6c, 0x01, 0x10, 0x43, 0x4f, 0x4e, 0x53,
+ 0x54, 0x41, 0x4e, 0x54, 0x01, 0x06, 0x73, 0x75,
+ 0x6d, 0x01, 0x0c, 0x72, 0x65, 0x64, 0x75, 0x63,
+ 0x65, 0x01, 0x06, 0x50, 0x49, 0x32, 0x10, 0x00,
+ 0x00, 0x00, 0x15, 0x00, 0x02, 0x00, 0x3c, 0x00,
+ 0x3d, 0x00, 0x34, 0x00, 0x16, 0x00, 0x3a, 0x00,
+ 0x3b, 0x00, 0x26, 0x00, 0x1e, 0x00, 0x18, 0x00,
+ 0x24, 0x00, 0x43, 0x00, 0x01, 0x01, 0x01, 0xbe,
+ 0x02, 0x01, 0x00, 0x01, 0xc6, 0x03, 0x19, 0xc8,
+ 0x03, 0x06, 0x18, 0x01, 0x17, 0x01, 0x02, 0xca,
+ 0x03, 0x07, 0x18, 0x0d, 0x00, 0x0c, 0x42, 0x07,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+ 0x04, 0x00, 0xcc, 0x03, 0x00, 0x01, 0xe2, 0x90,
+ 0xea, 0x28, 0xce, 0x03, 0x08, 0x00, 0x00, 0x05,
+ 0x04, 0x01, 0x17, 0x02, 0x02, 0x60, 0x01, 0x05,
+ 0x00, 0x6e, 0x01, 0x07, 0x08, 0x69, 0x6e, 0x63,
+ 0x72, 0x01, 0x82, 0x01, 0x15, 0x18, 0x0d, 0x01,
+ 0x0c, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x01, 0x01, 0x00, 0x02, 0x00, 0xcc, 0x03, 0x00,
+ 0x01, 0xe2, 0x28, 0xce, 0x03, 0x09, 0x00, 0x00,
+ 0x01, 0x17, 0x02, 0x02, 0x60, 0x01, 0x05, 0x00,
+ 0x6e, 0x01, 0x07, 0x12, 0x67, 0x65, 0x74, 0x20,
+ 0x76, 0x61, 0x6c, 0x75, 0x65, 0x01, 0x02, 0x01,
+ 0xd0, 0x03, 0x06, 0x18, 0x01, 0x18, 0x01, 0x17,
+ 0x01, 0x03, 0x7a, 0x03, 0x18, 0x0d, 0x02, 0x0c,
+ 0x42, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04,
+ 0x03, 0x00, 0x1a, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0xee, 0x01, 0x09, 0x0d, 0xd2, 0x03, 0x05, 0x0d,
+ 0xd4, 0x03, 0x07, 0x0d, 0x08, 0xce, 0x2b, 0x66,
+ 0x00, 0x00, 0x11, 0xef, 0x06, 0xca, 0x1b, 0x24,
+ 0x00, 0x00, 0x0e, 0x66, 0x01, 0x00, 0x11, 0xe4,
+ 0x44, 0x92, 0x18, 0xe4, 0x45, 0x29, 0xce, 0x03,
+ 0x27, 0x02, 0x4e, 0x35, 0x01, 0x18, 0x0d, 0x03,
+ 0x0c, 0x48, 0x05, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0x03, 0x01, 0x00, 0x0f, 0x02, 0x10, 0x00, 0x01,
+ 0x00, 0xe8, 0x01, 0x00, 0x01, 0x00, 0xd6, 0x03,
+ 0x06, 0x5d, 0x0c, 0x04, 0xcf, 0x08, 0xce, 0xca,
+ 0xcb, 0x2d, 0xca, 0x66, 0x00, 0x00, 0xba, 0x46,
+ 0x29, 0xce, 0x03, 0x00, 0x06, 0x00, 0x05, 0x4a,
+ 0x00, 0x09, 0x24, 0x02, 0x19, 0xd8, 0x03, 0x13,
+ 0x04, 0x17, 0x02, 0x02, 0x60, 0x01, 0x05, 0x00,
+ 0x6e, 0x01, 0x07, 0x00, 0x01, 0x03, 0x13, 0x05,
+ 0x04, 0x19, 0xda, 0x03, 0x01, 0x17, 0x02, 0x06,
+ 0x60, 0x01, 0x05, 0x00, 0x6e, 0x01, 0x07, 0x0e,
+ 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x78,
+ 0x00, 0x13, 0x04, 0xdc, 0x03, 0x03, 0x18, 0x0d,
+ 0x04, 0x0c, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x02, 0x02, 0x00, 0x06, 0x00, 0xd2, 0x03,
+ 0x05, 0x0d, 0xd4, 0x03, 0x07, 0x0d, 0x66, 0x00,
+ 0x00, 0xe3, 0x44, 0x28, 0xce, 0x03, 0x31, 0x01,
+ 0x03, 0x03, 0x04, 0x01, 0x17, 0x02, 0x02, 0x60,
+ 0x01, 0x05, 0x00, 0x6e, 0x01, 0x07, 0x12, 0x69,
+ 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73,
+ 0x01, 0xc8, 0x01, 0x03, 0x18, 0x0d, 0x05, 0x0c,
+ 0x42, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02,
+ 0x01, 0x00, 0x04, 0x01, 0xde, 0x03, 0x00, 0x01,
+ 0x00, 0xd6, 0x03, 0x06, 0x0d, 0xd6, 0xe2, 0xb2,
+ 0x28, 0xce, 0x03, 0x34, 0x01, 0x03, 0x02, 0x01,
+ 0x17, 0x02, 0x02, 0x60, 0x01, 0x05, 0x02, 0x6e,
+ 0x01, 0x07, 0x06, 0x68, 0x61, 0x73, 0x01, 0xda,
+ 0x03, 0x07, 0x05, 0x02, 0x03, 0xca, 0x03, 0x03,
+ 0x18, 0x0d, 0x06, 0x0c, 0x42, 0x07, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0x04, 0x02, 0x00, 0x15, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0xd6, 0x03, 0x06, 0x0d,
+ 0xe0, 0x03, 0x08, 0x0d, 0x08, 0xce, 0xca, 0x11,
+ 0xe2, 0x44, 0xca, 0xe3, 0x2c, 0x24, 0x00, 0x00,
+ 0x9e, 0x15, 0xe2, 0x45, 0x0e, 0xca, 0xe2, 0x44,
+ 0x28, 0xce, 0x03, 0x2d, 0x02, 0x0d, 0x4e, 0x02,
+ 0x05, 0x18, 0x0d, 0x07, 0x0c, 0x4a, 0x07, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0xbb, 0x28, 0xce, 0x03, 0x2a, 0x01, 0x03,
+ 0x13, 0x04, 0x17, 0x02, 0x02, 0x60, 0x01, 0x05,
+ 0x00, 0x6e, 0x01, 0x07, 0x0a, 0x23, 0x73, 0x74,
+ 0x65, 0x70, 0x01, 0x01, 0x17, 0x02, 0x02, 0x60,
+ 0x01, 0x05, 0x00, 0x6e, 0x01, 0x07, 0x08, 0x69,
+ 0x6e, 0x63, 0x72, 0x01, 0xa8, 0x03, 0x07, 0x19,
+ 0xe2, 0x03, 0x01, 0x02, 0xe2, 0x03, 0x07, 0x02,
+ 0xd8, 0x03, 0x07, 0x05, 0x02, 0x01, 0xe4, 0x03,
+ 0x06, 0x19, 0xe6, 0x03, 0xe8, 0x03, 0x06, 0x19,
+ 0xea, 0x03, 0xec, 0x03, 0x06, 0x18, 0x01, 0x17,
+ 0x01, 0x03, 0xe6, 0x03, 0x07, 0x05, 0x02, 0xee,
+ 0x03, 0x07, 0x05, 0x04, 0xe4, 0x03, 0x07, 0x19,
+ 0xe6, 0x03, 0x01, 0xf0, 0x03, 0x06, 0x18, 0x01,
+ 0x17, 0x01, 0x00, 0x01, 0xf2, 0x03, 0x06, 0x18,
+ 0x28, 0x01, 0x13, 0x0c, 0x07, 0x08, 0x77, 0x65,
+ 0x61, 0x6b, 0x17, 0x03, 0x00, 0x01, 0xf4, 0x03,
+ 0x06, 0x18, 0x29, 0x00, 0x17, 0x04, 0x00, 0x01,
+ 0xf6, 0x03, 0x06, 0x18, 0x28, 0x01, 0x18, 0x01,
+ 0x17, 0x01, 0x00, 0x01, 0x07, 0x0a, 0x77, 0x65,
+ 0x61, 0x6b, 0x32, 0x17, 0x03, 0x00, 0x01, 0xf8,
+ 0x03, 0x06, 0x13, 0x10, 0xfa, 0x03, 0x06, 0x18,
+ 0x01, 0x17, 0x01, 0x00, 0x01, 0xfc, 0x03, 0x06,
+ 0x18, 0x20, 0x0f, 0x08, 0x00, 0x00, 0x12, 0x34,
+ 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x17, 0x05,
+ 0x00, 0x01, 0xfe, 0x03, 0x06, 0x18, 0x26, 0x02,
+ 0x07, 0x02, 0x61, 0x05, 0x02, 0x07, 0x02, 0x62,
+ 0x18, 0x02, 0x02, 0x05, 0x04, 0x05, 0x06, 0x17,
+ 0x06, 0x01, 0x60, 0x02, 0x05, 0x04, 0x01, 0x17,
+ 0x07, 0x00, 0x01, 0x80, 0x04, 0x06, 0x18, 0x27,
+ 0x02, 0x07, 0x02, 0x78, 0x07, 0x02, 0x79, 0x17,
+ 0x08, 0x00, 0x01, 0x82, 0x04, 0x06, 0x18, 0x12,
+ 0x16, 0x28, 0x5c, 0x64, 0x2b, 0x29, 0x2d, 0x28,
+ 0x5c, 0x64, 0x2b, 0x29, 0xaa, 0x01, 0x01, 0x03,
+ 0x00, 0x4d, 0x00, 0x00, 0x00, 0xff, 0x08, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff,
+ 0xff, 0x0b, 0x00, 0x0b, 0x01, 0x1c, 0x08, 0x00,
+ 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff,
+ 0xff, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x15, 0x01,
+ 0x00, 0x30, 0x00, 0x39, 0x00, 0x0a, 0x0c, 0x01,
+ 0x01, 0x2d, 0x00, 0x0b, 0x02, 0x1c, 0x08, 0x00,
+ 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff,
+ 0xff, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x15, 0x01,
+ 0x00, 0x30, 0x00, 0x39, 0x00, 0x0a, 0x0c, 0x02,
+ 0x0c, 0x00, 0x0a, 0x17, 0x09, 0x01, 0xac, 0x01,
+ 0x02, 0x05, 0x00, 0x01, 0x84, 0x04, 0x06, 0x18,
+ 0x0a, 0x05, 0xd0, 0x0f, 0x17, 0x0a, 0x00, 0x01,
+ 0x86, 0x04, 0x06, 0x18, 0x04, 0x05, 0x54, 0x17,
+ 0x0b, 0x00, 0x01, 0x88, 0x04, 0x06, 0x18, 0x02,
+ 0x00, 0x17, 0x06, 0x06, 0x60, 0x02, 0x05, 0x0a,
+ 0x01, 0x07, 0x05, 0x02, 0x03, 0x07, 0x07, 0x06,
+ 0x74, 0x77, 0x6f, 0x05, 0x07, 0x18, 0x01, 0x17,
+ 0x01, 0x01, 0x8a, 0x04, 0x07, 0x05, 0x06, 0x01,
+ 0x09, 0x07, 0x05, 0x0a, 0x8c, 0x04, 0x07, 0x13,
+ 0x1a, 0x01, 0x8e, 0x04, 0x06, 0x18, 0x02, 0x00,
+ 0x17, 0x06, 0x02, 0x60, 0x02, 0x05, 0xd2, 0x0f,
+ 0xd1, 0x0f, 0x07, 0x07, 0x06, 0x66, 0x61, 0x72,
+ 0x01, 0x90, 0x04, 0x06, 0x0e, 0x02, 0x03, 0x00,
+ 0x0f, 0x03, 0x01, 0x02, 0x03, 0x92, 0x04, 0x06,
+ 0x18, 0x01, 0x17, 0x01, 0x01, 0x94, 0x04, 0x04,
+ 0x05, 0x02, 0x00, 0x96, 0x04, 0x06, 0x18, 0x0e,
+ 0x18, 0x0d, 0x08, 0x0c, 0x43, 0x06, 0x01, 0x00,
+ 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x04, 0x02,
+ 0x94, 0x04, 0x00, 0x01, 0x00, 0x98, 0x04, 0x00,
+ 0x01, 0x00, 0xd6, 0xd7, 0x9e, 0x28, 0xce, 0x03,
+ 0x55, 0x00, 0x01, 0x17, 0x02, 0x03, 0x60, 0x01,
+ 0x05, 0x04, 0x6e, 0x01, 0x07, 0x00, 0x78, 0x32,
+ 0x03, 0x01, 0x01, 0x05, 0x02, 0x17, 0x02, 0x02,
+ 0x60, 0x01, 0x05, 0x02, 0x6e, 0x01, 0x07, 0x0c,
+ 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x03, 0x9a,
+ 0x04, 0x06, 0x18, 0x10, 0x09, 0x0c, 0x52, 0x06,
+ 0x01, 0x9a, 0x04, 0x01, 0x01, 0x01, 0x02, 0x00,
+ 0x00, 0x13, 0x02, 0xcc, 0x03, 0x00, 0x01, 0x00,
+ 0x9c, 0x04, 0x00, 0x00, 0x00, 0x88, 0xba, 0xce,
+ 0xca, 0xd6, 0xfb, 0x0b, 0xca, 0x89, 0xef, 0x02,
+ 0x2e, 0x0e, 0x94, 0x00, 0xf1, 0xf3, 0x06, 0x2e,
+ 0xce, 0x03, 0x57, 0x03, 0x08, 0x21, 0x35, 0x01,
+ 0x17, 0x0c, 0x03, 0x60, 0x01, 0x05, 0x02, 0x6e,
+ 0x01, 0x07, 0x12, 0x67, 0x65, 0x6e, 0x5f, 0x72,
+ 0x61, 0x6e, 0x67, 0x65, 0x78, 0x02, 0x18, 0x01,
+ 0x17, 0x0d, 0x00, 0x01, 0x01, 0x9e, 0x04, 0x06,
+ 0x05, 0x0e, 0xa0, 0x04, 0x00, 0x07, 0x0c, 0x68,
+ 0x69, 0x64, 0x64, 0x65, 0x6e, 0x0f, 0x00, 0x00,
+ 0x05, 0xa2, 0x04, 0x07, 0x18, 0x0d, 0x0a, 0x0c,
+ 0x42, 0x07, 0x01, 0x00, 0x02, 0x01, 0x02, 0x02,
+ 0x01, 0x00, 0x22, 0x03, 0xa4, 0x04, 0x00, 0x01,
+ 0x00, 0xa6, 0x04, 0x00, 0x01, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0xee, 0x01, 0x02, 0x0d, 0x08, 0xce,
+ 0x2b, 0x66, 0x00, 0x00, 0x11, 0xef, 0x06, 0xca,
+ 0x1b, 0x24, 0x00, 0x00, 0x0e, 0xca, 0xd6, 0xb7,
+ 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0xca, 0xd7,
+ 0xb7, 0x13, 0x01, 0x00, 0x00, 0x01, 0x00, 0x29,
+ 0xce, 0x03, 0x0e, 0x03, 0x4e, 0x30, 0x30, 0x06,
+ 0x02, 0x01, 0x17, 0x02, 0x04, 0x60, 0x01, 0x05,
+ 0x04, 0x6e, 0x01, 0x07, 0x0a, 0x50, 0x6f, 0x69,
+ 0x6e, 0x74, 0x78, 0x00, 0x18, 0x01, 0x17, 0x01,
+ 0x02, 0x7a, 0x03, 0x13, 0x24, 0xa8, 0x04, 0x03,
+ 0x18, 0x0d, 0x0b, 0x0c, 0x42, 0x07, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x26, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xce, 0xca, 0xb5,
+ 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0xca, 0xb5,
+ 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x9b, 0xca,
+ 0xb5, 0x13, 0x01, 0x00, 0x00, 0x02, 0x00, 0xca,
+ 0xb5, 0x13, 0x01, 0x00, 0x00, 0x03, 0x00, 0x9b,
+ 0x9e, 0x28, 0xce, 0x03, 0x12, 0x01, 0x0d, 0x01,
+ 0x17, 0x02, 0x02, 0x60, 0x01, 0x05, 0x00, 0x6e,
+ 0x01, 0x07, 0x0a, 0x6e, 0x6f, 0x72, 0x6d, 0x32,
+ 0x01, 0x01, 0xaa, 0x04, 0x03, 0x18, 0x0d, 0x0c,
+ 0x0c, 0x42, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x04, 0x01, 0x00, 0x0a, 0x00, 0xa2, 0x04, 0x01,
+ 0x0d, 0x66, 0x00, 0x00, 0x11, 0xba, 0xba, 0x21,
+ 0x02, 0x00, 0x28, 0xce, 0x03, 0x15, 0x01, 0x03,
+ 0x07, 0x13, 0x24, 0x01, 0x17, 0x02, 0x02, 0x60,
+ 0x01, 0x05, 0x00, 0x6e, 0x01, 0x07, 0x0c, 0x6f,
+ 0x72, 0x69, 0x67, 0x69, 0x6e, 0x01, 0x03, 0xac,
+ 0x04, 0x07, 0x18, 0x0d, 0x0d, 0x0c, 0xc6, 0x07,
+ 0x01, 0x00, 0x03, 0x03, 0x03, 0x04, 0x01, 0x00,
+ 0x34, 0x06, 0xa4, 0x04, 0x00, 0x01, 0x00, 0xa6,
+ 0x04, 0x00, 0x01, 0x00, 0xae, 0x04, 0x00, 0x01,
+ 0x00, 0xe6, 0x01, 0x00, 0x01, 0x00, 0xe4, 0x01,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x20, 0xee,
+ 0x01, 0x04, 0x0d, 0x0c, 0x02, 0xce, 0x0c, 0x03,
+ 0xcf, 0x61, 0x02, 0x00, 0x2b, 0xca, 0x34, 0xcb,
+ 0xd6, 0xd7, 0x21, 0x02, 0x00, 0x11, 0x64, 0x02,
+ 0x00, 0x66, 0x00, 0x00, 0x11, 0xef, 0x08, 0x62,
+ 0x02, 0x00, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x0e,
+ 0x62, 0x02, 0x00, 0xd8, 0xb7, 0x17, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x65, 0x02, 0x00, 0x28, 0xce,
+ 0x03, 0x1b, 0x03, 0x35, 0x8a, 0x3a, 0x08, 0x02,
+ 0x01, 0x13, 0x24, 0x03, 0x60, 0x01, 0x05, 0x06,
+ 0x6e, 0x01, 0x07, 0x0c, 0x50, 0x6f, 0x69, 0x6e,
+ 0x74, 0x33, 0x78, 0x00, 0x18, 0x01, 0x13, 0x25,
+ 0x02, 0x7a, 0x03, 0x13, 0x28, 0xa8, 0x04, 0x03,
+ 0x18, 0x0d, 0x0e, 0x0c, 0x4a, 0x07, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x24, 0x02,
+ 0x10, 0x00, 0x01, 0x00, 0xe8, 0x01, 0x00, 0x01,
+ 0x00, 0x0c, 0x04, 0xcf, 0x08, 0xce, 0xca, 0xcb,
+ 0x34, 0x04, 0x14, 0x01, 0x00, 0x00, 0x47, 0x24,
+ 0x00, 0x00, 0xca, 0xb5, 0x17, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xca, 0xb5, 0x17, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x9b, 0x9e, 0x28, 0xce, 0x03, 0x1f,
+ 0x01, 0x1c, 0x13, 0x29, 0x17, 0x02, 0x02, 0x60,
+ 0x01, 0x05, 0x00, 0x6e, 0x01, 0x07, 0x0a, 0x6e,
+ 0x6f, 0x72, 0x6d, 0x32, 0x01, 0x01, 0x03, 0xd2,
+ 0x03, 0x07, 0x13, 0x05, 0xb0, 0x04, 0x07, 0x07,
+ 0x06, 0x6c, 0x65, 0x74, 0xb2, 0x04, 0x05, 0x05,
+ 0xf6, 0x01, 0x07, 0x00, 0x00, 0x01, 0xb4, 0x04,
+ 0x07, 0x18, 0x0d, 0x0f, 0x0c, 0x43, 0x06, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x10,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xce, 0xca,
+ 0xb6, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc5,
+ 0x00, 0xba, 0x25, 0x02, 0x00, 0xce, 0x03, 0x5f,
+ 0x01, 0x0d, 0x0c, 0x42, 0x06, 0x01, 0x00, 0x02,
+ 0x00, 0x02, 0x02, 0x00, 0x00, 0x04, 0x02, 0x94,
+ 0x04, 0x00, 0x01, 0x00, 0x98, 0x04, 0x00, 0x01,
+ 0x00, 0xd6, 0xd7, 0x9e, 0x28, 0xce, 0x03, 0x60,
+ 0x00, 0x01, 0x17, 0x02, 0x03, 0x60, 0x01, 0x05,
+ 0x00, 0x6e, 0x01, 0x07, 0x00, 0x78, 0x32, 0x03,
+ 0x10, 0x00, 0x00, 0x01, 0xb8, 0x04, 0x07, 0x06,
+ 0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x19, 0x40,
+ 0x00,
+};
+
+static JSContext *JS_NewCustomContext(JSRuntime *rt)
+{
+  JSContext *ctx = JS_NewContextRaw(rt);
+  if (!ctx)
+    return NULL;
+  JS_AddIntrinsicBaseObjects(ctx);
+  JS_AddIntrinsicDate(ctx);
+  JS_AddIntrinsicEval(ctx);
+  JS_AddIntrinsicStringNormalize(ctx);
+  JS_AddIntrinsicRegExp(ctx);
+  JS_AddIntrinsicJSON(ctx);
+  JS_AddIntrinsicProxy(ctx);
+  JS_AddIntrinsicMapSet(ctx);
+  JS_AddIntrinsicTypedArrays(ctx);
+  JS_AddIntrinsicPromise(ctx);
+  JS_AddIntrinsicBigInt(ctx);
+  return ctx;
+}
+
+int main(int argc, char **argv)
+{
+  JSRuntime *rt;
+  JSContext *ctx;
+  rt = JS_NewRuntime();
+  js_std_set_worker_new_context_func(JS_NewCustomContext);
+  js_std_init_handlers(rt);
+  JS_SetModuleLoaderFunc(rt, NULL, js_module_loader, NULL);
+  ctx = JS_NewCustomContext(rt);
+  js_std_add_helpers(ctx, argc, argv);
+  js_std_read_snapshot(ctx, qjsc_snapshot, qjsc_snapshot_size);
+  js_std_eval_binary(ctx, qjsc_test_snapshot, qjsc_test_snapshot_size, 0);
+  js_std_loop(ctx);
+  js_std_free_handlers(rt);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(rt);
+  return 0;
+}
@@ -0,0 +1,673 @@
+/*
+ * QuickJS embedding benchmark
+ *
+ * Copyright (c) 2024 the QuickJS authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* Measure the cost of the embedding API: runtime and context creation,
+   calls between C and JS, compilation and bytecode loading. The JSON
+   output (-j) has the same format as the one of tests/microbench.js so
+   that it can be compared to a baseline with:
+
+   qjs --std tests/microbench.js -c base.json -i new.json
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "../cutils.h"
+#include "../quickjs.h"
+#include "../quickjs-libc.h"
+
+typedef struct {
+    const char *name;
+    /* execute the benchmark 'n' times, return the number of operations
+       or -1 if error */
+    int64_t (*func)(int64_t n);
+} BenchTest;
+
+static JSRuntime *rt;
+static JSContext *ctx;
+
+/* synthetic script of 'script_func_count' functions */
+static char *script_buf;
+static size_t script_len;
+static uint8_t *script_bc, *module_bc;
+static size_t script_bc_len, module_bc_len;
+
+static int script_func_count = 200;
+
+static int64_t get_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void dump_error(JSContext *ctx)
+{
+    JSValue exception_val;
+    const char *str;
+
+    exception_val = JS_GetException(ctx);
+    str = JS_ToCString(ctx, exception_val);
+    if (str) {
+        fprintf(stderr, "embedbench: %s\n", str);
+        JS_FreeCString(ctx, str);
+    }
+    JS_FreeValue(ctx, exception_val);
+}
+
+static JSValue eval_str(JSContext *ctx, const char *str, int flags)
+{
+    JSValue val;
+    val = JS_Eval(ctx, str, strlen(str), "<bench>", flags);
+    if (JS_IsException(val))
+        dump_error(ctx);
+    return val;
+}
+
+static int64_t run_pending_jobs(JSRuntime *rt)
+{
+    JSContext *ctx1;
+    int64_t n = 0;
+    int ret;
+
+    for(;;) {
+        ret = JS_ExecutePendingJob(rt, &ctx1);
+        if (ret <= 0) {
+            if (ret < 0) {
+                dump_error(ctx1);
+                return -1;
+            }
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+static int64_t bench_runtime_new(int64_t n)
+{
+    JSRuntime *rt1;
+    int64_t i;
+
+    for(i = 0; i < n; i++) {
+        rt1 = JS_NewRuntime();
+        if (!rt1)
+            return -1;
+        JS_FreeRuntime(rt1);
+    }
+    return n;
+}
+
+static int64_t bench_context_new(int64_t n)
+{
+    JSContext *ctx1;
+    int64_t i;
+
+    for(i = 0; i < n; i++) {
+        ctx1 = JS_NewContext(rt);
+        if (!ctx1)
+            return -1;
+        JS_FreeContext(ctx1);
+    }
+    return n;
+}
+
+static int64_t bench_eval_small(int64_t n)
+{
+    JSValue val;
+    int64_t i;
+
+    for(i = 0; i < n; i++) {
+        val = eval_str(ctx, "1 + 2", JS_EVAL_TYPE_GLOBAL);
+        if (JS_IsException(val))
+            return -1;
+        JS_FreeValue(ctx, val);
+    }
+    return n;
+}
+
+static int64_t bench_call_js(int64_t n)
+{
+    JSValue func, val;
+    int64_t i;
+
+    func = eval_str(ctx, "(function () { })", JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(func))
+        return -1;
+    for(i = 0; i < n; i++) {
+        val = JS_Call(ctx, func, JS_UNDEFINED, 0, NULL);
+        JS_FreeValue(ctx, val);
+    }
+    JS_FreeValue(ctx, func);
+    return n;
+}
+
+static int64_t bench_call_js_args(int64_t n)
+{
+    JSValue func, val, args[2];
+    int64_t i;
+
+    func = eval_str(ctx, "(function (a, b) { return a + b; })",
+                    JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(func))
+        return -1;
+    for(i = 0; i < n; i++) {
+        args[0] = JS_NewInt32(ctx, i);
+        args[1] = JS_NewFloat64(ctx, 0.5);
+        val = JS_Call(ctx, func, JS_UNDEFINED, 2, (JSValueConst *)args);
+        JS_FreeValue(ctx, val);
+    }
+    JS_FreeValue(ctx, func);
+    return n;
+}
+
+static JSValue js_bench_add(JSContext *ctx, JSValueConst this_val,
+                            int argc, JSValueConst *argv)
+{
+    int a, b;
+    if (JS_ToInt32(ctx, &a, argv[0]) || JS_ToInt32(ctx, &b, argv[1]))
+        return JS_EXCEPTION;
+    return JS_NewInt32(ctx, a + b);
+}
+
+/* call 'cfunc' n times from a JS loop */
+static int64_t call_c_loop(JSValue cfunc, int64_t n)
+{
+    JSValue func, val, args[2];
+
+    func = eval_str(ctx, "(function (f, n) { var i, s = 0;"
+                    " for(i = 0; i < n; i++) s = f(s, 1); return s; })",
+                    JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(func)) {
+        JS_FreeValue(ctx, cfunc);
+        return -1;
+    }
+    args[0] = cfunc;
+    args[1] = JS_NewInt64(ctx, n);
+    val = JS_Call(ctx, func, JS_UNDEFINED, 2, (JSValueConst *)args);
+    JS_FreeValue(ctx, func);
+    JS_FreeValue(ctx, cfunc);
+    if (JS_IsException(val)) {
+        dump_error(ctx);
+        return -1;
+    }
+    JS_FreeValue(ctx, val);
+    return n;
+}
+
+static int64_t bench_call_c(int64_t n)
+{
+    return call_c_loop(JS_NewCFunction(ctx, js_bench_add, "add", 2), n);
+}
+
+static int64_t bench_call_c_leaf(int64_t n)
+{
+    return call_c_loop(JS_NewCFunctionLeaf(ctx, js_bench_add, "add", 2), n);
+}
+
+static int64_t bench_get_property(int64_t n)
+{
+    JSValue obj, val;
+    JSAtom atom;
+    int64_t i;
+
+    obj = eval_str(ctx, "({ a: 1, b: 2, x: 3 })", JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(obj))
+        return -1;
+    atom = JS_NewAtom(ctx, "x");
+    for(i = 0; i < n; i++) {
+        val = JS_GetProperty(ctx, obj, atom);
+        JS_FreeValue(ctx, val);
+    }
+    JS_FreeAtom(ctx, atom);
+    JS_FreeValue(ctx, obj);
+    return n;
+}
+
+static int64_t bench_compile_script(int64_t n)
+{
+    JSValue val;
+    int64_t i;
+
+    for(i = 0; i < n; i++) {
+        val = JS_Eval(ctx, script_buf, script_len, "<script>",
+                      JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+        if (JS_IsException(val)) {
+            dump_error(ctx);
+            return -1;
+        }
+        JS_FreeValue(ctx, val);
+    }
+    return n;
+}
+
+static int64_t bench_read_object(int64_t n)
+{
+    JSValue val;
+    int64_t i;
+
+    for(i = 0; i < n; i++) {
+        val = JS_ReadObject(ctx, script_bc, script_bc_len,
+                            JS_READ_OBJ_BYTECODE);
+        if (JS_IsException(val)) {
+            dump_error(ctx);
+            return -1;
+        }
+        JS_FreeValue(ctx, val);
+    }
+    return n;
+}
+
+/* a module can only be evaluated once per context, so the creation of
+   the context is included */
+static int64_t bench_module_load(int64_t n)
+{
+    JSContext *ctx1;
+    JSValue val;
+    int64_t i;
+
+    for(i = 0; i < n; i++) {
+        ctx1 = JS_NewContext(rt);
+        if (!ctx1)
+            return -1;
+        val = JS_ReadObject(ctx1, module_bc, module_bc_len,
+                            JS_READ_OBJ_BYTECODE);
+        if (!JS_IsException(val))
+            val = JS_EvalFunction(ctx1, val);
+        if (JS_IsException(val)) {
+            dump_error(ctx1);
+            JS_FreeContext(ctx1);
+            return -1;
+        }
+        JS_FreeValue(ctx1, val);
+        if (run_pending_jobs(rt) < 0) {
+            JS_FreeContext(ctx1);
+            return -1;
+        }
+        JS_FreeContext(ctx1);
+    }
+    return n;
+}
+
+static int64_t bench_promise_jobs(int64_t n)
+{
+    JSValue func, val, arg;
+    int64_t ret;
+
+    func = eval_str(ctx, "(function (n) { var i, f = function (x) { };"
+                    " for(i = 0; i < n; i++) Promise.resolve(i).then(f); })",
+                    JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(func))
+        return -1;
+    arg = JS_NewInt64(ctx, n);
+    val = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst *)&arg);
+    JS_FreeValue(ctx, func);
+    if (JS_IsException(val)) {
+        dump_error(ctx);
+        return -1;
+    }
+    JS_FreeValue(ctx, val);
+    ret = run_pending_jobs(rt);
+    if (ret < 0)
+        return -1;
+    return n;
+}
+
+static int64_t bench_await(int64_t n)
+{
+    JSValue func, val, arg;
+
+    func = eval_str(ctx, "(async function (n) { var i, s = 0;"
+                    " for(i = 0; i < n; i++) s += await i; return s; })",
+                    JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(func))
+        return -1;
+    arg = JS_NewInt64(ctx, n);
+    val = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst *)&arg);
+    JS_FreeValue(ctx, func);
+    if (JS_IsException(val)) {
+        dump_error(ctx);
+        return -1;
+    }
+    JS_FreeValue(ctx, val);
+    if (run_pending_jobs(rt) < 0)
+        return -1;
+    return n;
+}
+
+/* short request modifying the global object and the intrinsics */
+static const char request_script[] =
+    "let a = [1, 2, 3].map((v) => v * 2);\n"
+    "var o = { a }; o.self = o;\n"
+    "globalThis.leak = o;\n"
+    "Array.prototype.first = function () { return this[0]; };\n"
+    "Math.max = null;\n"
+    "delete JSON.stringify;\n"
+    "Object.freeze(Object.prototype.toString);\n"
+    "Array.prototype.push(1);\n"
+    "Promise.resolve().then(() => { globalThis.job = 1; });\n"
+    "a.first();\n";
+
+/* true if the context is in its initial state */
+static const char request_check_script[] =
+    "typeof a == 'undefined' && typeof o == 'undefined' &&"
+    " typeof leak == 'undefined' && !('first' in Array.prototype) &&"
+    " Array.prototype.length == 0 && typeof Math.max == 'function' &&"
+    " typeof JSON.stringify == 'function' &&"
+    " Object.isExtensible(Object.prototype.toString)";
+
+static JSContext *new_request_context(JSRuntime *rt1, void *opaque)
+{
+    JSContext *ctx1;
+    ctx1 = JS_NewContext(rt1);
+    if (ctx1)
+        js_std_add_helpers(ctx1, -1, NULL);
+    return ctx1;
+}
+
+static int run_request(JSContext *ctx1)
+{
+    JSValue val;
+    val = eval_str(ctx1, request_script, JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(val))
+        return -1;
+    JS_FreeValue(ctx1, val);
+    return 0;
+}
+
+/* one runtime per request */
+static int64_t bench_request_new(int64_t n)
+{
+    JSRuntime *rt1;
+    JSContext *ctx1;
+    int64_t i;
+    int ret;
+
+    for(i = 0; i < n; i++) {
+        rt1 = JS_NewRuntime();
+        if (!rt1)
+            return -1;
+        js_std_init_handlers(rt1);
+        ctx1 = new_request_context(rt1, NULL);
+        ret = ctx1 ? run_request(ctx1) : -1;
+        js_std_free_handlers(rt1);
+        JS_FreeContext(ctx1);
+        JS_FreeRuntime(rt1);
+        if (ret < 0)
+            return -1;
+    }
+    return n;
+}
+
+/* the runtime is reset after each request */
+static int64_t bench_request_reset(int64_t n)
+{
+    JSRuntimePool *pool;
+    JSContext *ctx1;
+    JSValue val;
+    int64_t i;
+    int ret;
+
+    pool = js_std_pool_new(1, new_request_context, NULL);
+    if (!pool)
+        return -1;
+    for(i = 0; i < n; i++) {
+        ctx1 = js_std_pool_get(pool);
+        if (!ctx1 || run_request(ctx1) < 0)
+            goto fail;
+        js_std_pool_put(pool, ctx1);
+    }
+    ctx1 = js_std_pool_get(pool);
+    if (!ctx1)
+        goto fail;
+    val = eval_str(ctx1, request_check_script, JS_EVAL_TYPE_GLOBAL);
+    ret = JS_ToBool(ctx1, val);
+    JS_FreeValue(ctx1, val);
+    js_std_pool_put(pool, ctx1);
+    if (ret != TRUE) {
+        fprintf(stderr, "embedbench: the context was not reset\n");
+        goto fail;
+    }
+    js_std_pool_free(pool);
+    return n;
+ fail:
+    js_std_pool_free(pool);
+    return -1;
+}
+
+static const BenchTest bench_list[] = {
+    { "runtime_new", bench_runtime_new },
+    { "context_new", bench_context_new },
+    { "eval_small", bench_eval_small },
+    { "call_js", bench_call_js },
+    { "call_js_args", bench_call_js_args },
+    { "call_c", bench_call_c },
+    { "call_c_leaf", bench_call_c_leaf },
+    { "get_property", bench_get_property },
+    { "compile_script", bench_compile_script },
+    { "read_object", bench_read_object },
+    { "module_load", bench_module_load },
+    { "promise_jobs", bench_promise_jobs },
+    { "await", bench_await },
+    { "request_new", bench_request_new },
+    { "request_reset", bench_request_reset },
+};
+
+static int init_scripts(void)
+{
+    DynBuf dbuf;
+    JSValue val;
+    int i;
+
+    dbuf_init(&dbuf);
+    for(i = 0; i < script_func_count; i++) {
+        dbuf_printf(&dbuf,
+                    "function f%d(a, b) {\n"
+                    "    var x = a + b * %d;\n"
+                    "    if (x > 10)\n"
+                    "        return x - 1;\n"
+                    "    return [ x, \"str%d\", { key: x, f: (y) => y + %d } ];\n"
+                    "}\n", i, i, i, i);
+    }
+    dbuf_putc(&dbuf, '\0');
+    if (dbuf.error)
+        return -1;
+    script_buf = (char *)dbuf.buf;
+    script_len = dbuf.size - 1;
+
+    val = JS_Eval(ctx, script_buf, script_len, "<script>",
+                  JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(val))
+        goto fail;
+    script_bc = JS_WriteObject(ctx, &script_bc_len, val, JS_WRITE_OBJ_BYTECODE);
+    JS_FreeValue(ctx, val);
+    if (!script_bc)
+        goto fail;
+
+    val = JS_Eval(ctx, script_buf, script_len, "<module>",
+                  JS_EVAL_TYPE_MODULE | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(val))
+        goto fail;
+    module_bc = JS_WriteObject(ctx, &module_bc_len, val, JS_WRITE_OBJ_BYTECODE);
+    JS_FreeValue(ctx, val);
+    if (!module_bc)
+        goto fail;
+    return 0;
+ fail:
+    dump_error(ctx);
+    return -1;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void help(void)
+{
+    printf("usage: embedbench [options] [test...]\n"
+           "-h          list options\n"
+           "-w n        number of warmup runs (default = 1)\n"
+           "-R n        number of measured runs (default = 5)\n"
+           "-t ms       minimum duration of a run (default = 20)\n"
+           "-j file     write the results in JSON format\n"
+           "-l          list the tests\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int warmup_count = 1, repeat_count = 5, min_time_ms = 20;
+    const char *json_file = NULL;
+    int64_t n, nb_ops, t, min_time;
+    double *tab, sum, sum2, mean, median, stddev;
+    int optind, i, j, k, nb_failed;
+    FILE *f = NULL;
+    BOOL selected, first;
+
+    optind = 1;
+    while (optind < argc && *argv[optind] == '-') {
+        char *arg = argv[optind++];
+        if (!strcmp(arg, "-h")) {
+            help();
+        } else if (!strcmp(arg, "-w") && optind < argc) {
+            warmup_count = max_int(atoi(argv[optind++]), 0);
+        } else if (!strcmp(arg, "-R") && optind < argc) {
+            repeat_count = max_int(atoi(argv[optind++]), 1);
+        } else if (!strcmp(arg, "-t") && optind < argc) {
+            min_time_ms = max_int(atoi(argv[optind++]), 1);
+        } else if (!strcmp(arg, "-j") && optind < argc) {
+            json_file = argv[optind++];
+        } else if (!strcmp(arg, "-l")) {
+            for(i = 0; i < countof(bench_list); i++)
+                printf("%s\n", bench_list[i].name);
+            exit(0);
+        } else {
+            help();
+        }
+    }
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    if (!rt || !ctx || init_scripts()) {
+        fprintf(stderr, "embedbench: initialization failed\n");
+        exit(1);
+    }
+    if (json_file) {
+        f = fopen(json_file, "w");
+        if (!f) {
+            perror(json_file);
+            exit(1);
+        }
+        fprintf(f, "{\n  \"warmup\": %d,\n  \"repeat\": %d,\n  \"results\": {",
+                warmup_count, repeat_count);
+    }
+    tab = malloc(sizeof(tab[0]) * repeat_count);
+    if (!tab)
+        exit(1);
+    min_time = (int64_t)min_time_ms * 1000000;
+
+    printf("%22s %10s %9s %9s\n", "TEST", "N", "TIME (ns)", "STDDEV");
+    nb_failed = 0;
+    first = TRUE;
+    for(i = 0; i < countof(bench_list); i++) {
+        const BenchTest *bt = &bench_list[i];
+        selected = (optind >= argc);
+        for(j = optind; j < argc; j++) {
+            if (strstart(bt->name, argv[j], NULL))
+                selected = TRUE;
+        }
+        if (!selected)
+            continue;
+
+        /* find the number of iterations of a run */
+        n = 1;
+        for(;;) {
+            t = get_time_ns();
+            nb_ops = bt->func(n);
+            t = get_time_ns() - t;
+            if (nb_ops < 0 || t >= min_time || n >= ((int64_t)1 << 40))
+                break;
+            n *= 2;
+        }
+        if (nb_ops < 0) {
+            printf("%22s failed\n", bt->name);
+            nb_failed++;
+            continue;
+        }
+
+        for(k = 0; k < warmup_count + repeat_count; k++) {
+            t = get_time_ns();
+            nb_ops = bt->func(n);
+            t = get_time_ns() - t;
+            if (nb_ops <= 0)
+                break;
+            if (k >= warmup_count)
+                tab[k - warmup_count] = (double)t / nb_ops;
+        }
+        if (nb_ops <= 0) {
+            printf("%22s failed\n", bt->name);
+            nb_failed++;
+            continue;
+        }
+        qsort(tab, repeat_count, sizeof(tab[0]), cmp_double);
+        sum = 0;
+        for(k = 0; k < repeat_count; k++)
+            sum += tab[k];
+        mean = sum / repeat_count;
+        sum2 = 0;
+        for(k = 0; k < repeat_count; k++)
+            sum2 += (tab[k] - mean) * (tab[k] - mean);
+        stddev = repeat_count > 1 ? sqrt(sum2 / (repeat_count - 1)) : 0;
+        if (repeat_count & 1)
+            median = tab[repeat_count / 2];
+        else
+            median = (tab[repeat_count / 2 - 1] + tab[repeat_count / 2]) / 2;
+        printf("%22s %10" PRId64 " %9.2f %9.2f\n",
+               bt->name, nb_ops, median, stddev);
+        if (f) {
+            fprintf(f, "%s\n    \"%s\": { \"n\": %" PRId64 ", \"runs\": %d, "
+                    "\"min\": %.2f, \"median\": %.2f, \"mean\": %.2f, "
+                    "\"stddev\": %.2f, \"max\": %.2f }",
+                    first ? "" : ",", bt->name, nb_ops, repeat_count,
+                    tab[0], median, mean, stddev, tab[repeat_count - 1]);
+        }
+        first = FALSE;
+    }
+    if (f) {
+        fprintf(f, "\n  }\n}\n");
+        fclose(f);
+    }
+    free(tab);
+    js_free(ctx, script_bc);
+    js_free(ctx, module_bc);
+    free(script_buf);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+    return nb_failed != 0;
+}
@@ -66,6 +66,9 @@ function toPrec(n, prec) {
 
 var ref_data;
 var log_data;
+var result_data; /* statistics of each test for the JSON output */
+var warmup_count = 0;
+var repeat_count = 1;
 
 var heads  = [ "TEST", "N", "TIME (ns)", "REF (ns)", "SCORE (1000)" ];
 var widths = [    22,   10,          9,     9,       9 ];
@@ -137,9 +140,11 @@ function log_one(text, n, ti) {
     }
 }
 
-function bench(f, text)
+/* return the shortest time of an iteration of 'f' in clock units and
+   the argument n which was used to measure it */
+function measure(f, text)
 {
-    var i, j, n, t, ti, nb_its, ref, ti_n, ti_n1;
+    var i, j, n, t, ti, nb_its, ti_n, ti_n1;
 
     nb_its = n = 1;
     if (f.bench) {
@@ -155,7 +160,7 @@ function bench(f, text)
                 nb_its = f(n);
                 t = get_clock() - t;
                 if (nb_its < 0)
-                    return; // test failure
+                    return null; // test failure
                 if (ti > t)
                     ti = t;
             }
@@ -172,8 +177,52 @@ function bench(f, text)
         // to use only the best timing from the last loop, uncomment below
         //ti_n = ti / nb_its;
     }
-    /* nano seconds per iteration */
-    log_one(text, n, ti_n * 1e9 / clocks_per_sec);
+    return { n: n, ti: ti_n };
+}
+
+function compute_stats(tab)
+{
+    var i, n = tab.length, sum = 0, sum2 = 0, mean, a;
+    a = tab.slice().sort((x, y) => x - y);
+    for (i = 0; i < n; i++)
+        sum += a[i];
+    mean = sum / n;
+    for (i = 0; i < n; i++)
+        sum2 += (a[i] - mean) * (a[i] - mean);
+    return {
+        min: a[0],
+        max: a[n - 1],
+        median: (n & 1) ? a[n >> 1] : (a[(n >> 1) - 1] + a[n >> 1]) / 2,
+        mean: mean,
+        stddev: n > 1 ? Math.sqrt(sum2 / (n - 1)) : 0,
+    };
+}
+
+function round2(x) {
+    return Math.round(x * 100) / 100;
+}
+
+function bench(f, text)
+{
+    var i, r, st, tab = [];
+
+    /* the warmup runs are not measured */
+    for (i = 0; i < warmup_count + repeat_count; i++) {
+        r = measure(f, text);
+        if (!r)
+            return;
+        if (i >= warmup_count) {
+            /* nano seconds per iteration */
+            tab.push(r.ti * 1e9 / clocks_per_sec);
+        }
+    }
+    st = compute_stats(tab);
+    if (result_data) {
+        result_data[text] = { n: r.n, runs: tab.length, min: round2(st.min),
+                              median: round2(st.median), mean: round2(st.mean),
+                              stddev: round2(st.stddev), max: round2(st.max) };
+    }
+    log_one(text, r.n, repeat_count > 1 ? st.median : st.min);
 }
 
 var global_res; /* to be sure the code is not optimized */
@@ -766,6 +815,66 @@ function set_collection_add(n)
     return n * len;
 }
 
+function map_set_get(n)
+{
+    var m, i, j, sum, len = 100;
+    for(j = 0; j < n; j++) {
+        m = new Map();
+        for(i = 0; i < len; i++)
+            m.set(i, i);
+        sum = 0;
+        for(i = 0; i < len; i++)
+            sum += m.get(i);
+        if (sum != len * (len - 1) / 2)
+            throw Error("bug in Map");
+    }
+    return n * len * 2;
+}
+
+function map_string_keys(n)
+{
+    var m, i, j, keys = [], len = 100;
+    for(i = 0; i < len; i++)
+        keys.push("key" + i);
+    for(j = 0; j < n; j++) {
+        m = new Map();
+        for(i = 0; i < len; i++)
+            m.set(keys[i], i);
+        for(i = 0; i < len; i++) {
+            if (m.get(keys[i]) !== i)
+                throw Error("bug in Map");
+        }
+    }
+    return n * len * 2;
+}
+
+var json_data = {
+    id: 12345, name: "benchmark", active: true, ratio: 0.75,
+    tags: [ "a", "bb", "ccc", "dddd" ],
+    items: [ { x: 1, y: 2.5, s: "one" }, { x: 2, y: -3.25, s: "two" },
+             { x: 3, y: 1e10, s: "three" }, { x: 4, y: null, s: "four" } ],
+    nested: { a: { b: { c: [ 1, 2, 3 ] } } },
+};
+var json_str = JSON.stringify(json_data);
+
+function json_parse(n)
+{
+    var j, r;
+    for(j = 0; j < n; j++)
+        r = JSON.parse(json_str);
+    global_res = r;
+    return n;
+}
+
+function json_stringify(n)
+{
+    var j, r;
+    for(j = 0; j < n; j++)
+        r = JSON.stringify(json_data);
+    global_res = r;
+    return n;
+}
+
 function array_for(n)
 {
     var r, i, j, sum, len = 100;
@@ -850,6 +959,37 @@ function regexp_utf16(n)
     return n * 1000;
 }
 
+function regexp_replace(n)
+{
+    var j, r, s;
+    s = "user1@example.com, user2@example.org, user3@example.net";
+    for(j = 0; j < n; j++)
+        r = s.replace(/(\w+)@(\w+)\.(\w+)/g, "$2 $1 $3");
+    global_res = r;
+    return n * 3;
+}
+
+function regexp_split(n)
+{
+    var j, r, s;
+    s = "2024-01-01T12:00:00 INFO  [main] request=42 status=200 time=3.5ms";
+    for(j = 0; j < n; j++)
+        r = s.split(/[\s=\[\]]+/);
+    global_res = r;
+    return n * r.length;
+}
+
+function string_split(n)
+{
+    var j, r, s;
+    s = "2024-01-01,12345,foo bar baz,some longer text field here,3.14159";
+    s = (s + "\n").repeat(100);
+    for(j = 0; j < n; j++)
+        r = s.split(",");
+    global_res = r;
+    return n * r.length;
+}
+
 /* incremental string contruction as local var */
 function string_build1(n)
 {
@@ -1183,6 +1323,52 @@ function save_result(filename, obj)
         console.log("cannot save " + filename);
 }
 
+/* return the time of 'name' in a result file written with -j or -s */
+function result_time(res, name)
+{
+    var r;
+    if (res.results) {
+        r = res.results[name];
+        return r ? r.median : undefined;
+    }
+    return res[name];
+}
+
+/* compare the results 'cur' to 'base' and return the number of
+   regressions. A test regresses if its time increased by more than
+   'threshold' percent and if its fastest run is slower than the
+   median of the base. */
+function compare_results(base, cur, threshold)
+{
+    var names, i, name, t0, t1, min1, change, is_regression;
+    var nb_regressions = 0;
+
+    function line(name, t0, t1, change, status) {
+        console.log(pad_left(name, widths[0]) + " " + pad_left(t0, 10) + " " +
+                    pad_left(t1, 10) + " " + pad_left(change, 9) + status);
+    }
+
+    names = Object.keys(cur.results || cur);
+    line("TEST", "BASE (ns)", "NEW (ns)", "CHANGE", "");
+    for (i = 0; i < names.length; i++) {
+        name = names[i];
+        t0 = result_time(base, name);
+        t1 = result_time(cur, name);
+        if (typeof t0 !== "number" || typeof t1 !== "number" || t0 <= 0)
+            continue;
+        min1 = cur.results ? cur.results[name].min : t1;
+        change = (t1 - t0) * 100 / t0;
+        is_regression = (change > threshold && min1 > t0);
+        if (is_regression)
+            nb_regressions++;
+        line(name, toPrec(t0, 2), toPrec(t1, 2),
+             (change >= 0 ? "+" : "-") + toPrec(Math.abs(change), 1) + "%",
+             is_regression ? "  REGRESSION" : "");
+    }
+    console.log(nb_regressions + " regression(s) above " + threshold + "%");
+    return nb_regressions;
+}
+
 function main(argc, argv, g)
 {
     var test_list = [
@@ -1220,12 +1406,19 @@ function main(argc, argv, g)
         int_arith,
         float_arith,
         set_collection_add,
+        map_set_get,
+        map_string_keys,
+        json_parse,
+        json_stringify,
         array_for,
         array_for_in,
         array_for_of,
         math_min,
         regexp_ascii,
         regexp_utf16,
+        regexp_replace,
+        regexp_split,
+        string_split,
         string_build1,
         string_build1x,
         string_build2c,
@@ -1240,6 +1433,7 @@ function main(argc, argv, g)
     var tests = [];
     var i, j, n, f, name, found;
     var ref_file, new_ref_file = "microbench-new.txt";
+    var json_file, base_file, input_file, base_data, threshold = 10;
 
     if (typeof BigInt === "function") {
         /* BigInt test */
@@ -1279,6 +1473,30 @@ function main(argc, argv, g)
             new_ref_file = argv[i++];
             continue;
         }
+        if (name == "-w") {
+            warmup_count = +argv[i++];
+            continue;
+        }
+        if (name == "-R") {
+            repeat_count = Math.max(+argv[i++], 1);
+            continue;
+        }
+        if (name == "-j") {
+            json_file = argv[i++];
+            continue;
+        }
+        if (name == "-c") {
+            base_file = argv[i++];
+            continue;
+        }
+        if (name == "-i") {
+            input_file = argv[i++];
+            continue;
+        }
+        if (name == "-T") {
+            threshold = +argv[i++];
+            continue;
+        }
         for (j = 0, found = false; j < test_list.length; j++) {
             f = test_list[j];
             if (f.name.startsWith(name)) {
@@ -1294,7 +1512,22 @@ function main(argc, argv, g)
     if (tests.length == 0)
         tests = test_list;
 
+    if (base_file) {
+        base_data = load_result(base_file);
+        if (!base_data)
+            return 1;
+    }
+    if (input_file) {
+        /* compare existing results */
+        result_data = load_result(input_file);
+        if (!result_data || !base_data)
+            return 1;
+        return compare_results(base_data, result_data, threshold) ? 2 : 0;
+    }
+
     ref_data = load_result(ref_file);
+    if (json_file || base_data)
+        result_data = {};
     log_data = {};
     log_line.apply(null, heads);
     n = 0;
@@ -1312,6 +1545,16 @@ function main(argc, argv, g)
 
     if (tests == test_list && new_ref_file)
         save_result(new_ref_file, log_data);
+    if (json_file) {
+        save_result(json_file, { warmup: warmup_count, repeat: repeat_count,
+                                 results: result_data });
+    }
+    if (base_data) {
+        console.log("");
+        if (compare_results(base_data, { results: result_data }, threshold))
+            return 2;
+    }
+    return 0;
 }
 
 if (typeof scriptArgs === "undefined") {
@@ -1319,4 +1562,10 @@ if (typeof scriptArgs === "undefined") {
     if (typeof process.argv === "object")
         scriptArgs = process.argv.slice(1);
 }
-main(scriptArgs.length, scriptArgs, this);
+var exit_code = main(scriptArgs.length, scriptArgs, this);
+if (exit_code) {
+    if (typeof std !== "undefined")
+        std.exit(exit_code);
+    else if (typeof process !== "undefined")
+        process.exit(exit_code);
+}
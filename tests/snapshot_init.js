@@ -0,0 +1,107 @@
+/* evaluated by qjsc at compile time, see test_snapshot.js */
+
+"use strict";
+
+var counter = (function () {
+    var n = 0;
+    return {
+        incr() { return ++n; },
+        get value() { return n; },
+    };
+})();
+
+class Point {
+    constructor(x, y) {
+        this.x = x;
+        this.y = y;
+    }
+    norm2() {
+        return this.x * this.x + this.y * this.y;
+    }
+    static origin() {
+        return new Point(0, 0);
+    }
+}
+
+class Point3 extends Point {
+    constructor(x, y, z) {
+        super(x, y);
+        this.z = z;
+    }
+    norm2() {
+        return super.norm2() + this.z * this.z;
+    }
+}
+
+class Counter {
+    #count = 0;
+    static #instances = 0;
+    constructor() {
+        Counter.#instances++;
+    }
+    #step() {
+        return 1;
+    }
+    incr() {
+        this.#count += this.#step();
+        return this.#count;
+    }
+    static instances() {
+        return Counter.#instances;
+    }
+    static has(obj) {
+        return #count in obj;
+    }
+}
+
+var counter2 = new Counter();
+counter2.incr();
+
+var sym = Symbol("sym");
+var sym_undef = Symbol();
+var sym_obj = { [sym]: 1, [Symbol.for("registered")]: 2, sym: sym };
+var weak_key = {};
+var weak_map = new WeakMap([[weak_key, "weak"]]);
+var weak_set = new WeakSet();
+/* the key is first serialized in the weak map */
+var weak_map2 = new WeakMap();
+var weak_key2 = {};
+weak_map2.set(weak_key2, "weak2");
+var weak_later = {};
+var view = new DataView(new ArrayBuffer(8), 2, 4);
+view.setUint16(0, 0x1234);
+
+var table = new Map([["a", 1], ["b", [2, 3]]]);
+var names = new Set(["x", "y"]);
+var re = /(\d+)-(\d+)/g;
+var date = new Date(1000);
+var boxed = new Number(42);
+var list = [1, "two", { three: 3 }, , 5];
+list.self = list;
+var sparse = [];
+sparse[1000] = "far";
+var bytes = new Uint8Array([1, 2, 3]);
+var frozen = Object.freeze({ a: 1 });
+var add1 = function (a, b) { return a + b; }.bind(null, 1);
+
+function* gen_range(n) {
+    for (var i = 0; i < n; i++)
+        yield i;
+}
+
+let lexical = "let";
+const CONSTANT = 123;
+
+Array.prototype.sum = function () {
+    return this.reduce((a, b) => a + b, 0);
+};
+Object.defineProperty(globalThis, "hidden", { value: "hidden",
+                                              enumerable: false });
+delete globalThis.escape;
+Math.PI2 = Math.PI * 2;
+
+counter.incr();
+counter.incr();
+
+var async_result;
+Promise.resolve(7).then((v) => { async_result = v; });
@@ -0,0 +1,161 @@
+/* compiled with qjsc -a: the numeric functions are translated to C */
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (Object.is(actual, expected))
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+function add(a, b)
+{
+    return a + b;
+}
+
+function fib(n)
+{
+    var a = 0, b = 1, t, i;
+    for(i = 0; i < n; i++) {
+        t = a + b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+function sum_loop(n)
+{
+    let s = 0;
+    for(let i = 1; i <= n; i++) {
+        if (i % 3 == 0 || i % 5 == 0)
+            s += i;
+    }
+    return s;
+}
+
+function bits(a, b)
+{
+    return ((a << b) ^ (a >> 1) | (a >>> b)) & ~b;
+}
+
+function shr(a)
+{
+    return a >>> 0;
+}
+
+function cmp(a, b)
+{
+    return a < b;
+}
+
+function cond(a, b)
+{
+    return a > b ? a - b : a ? b : -1;
+}
+
+function same(a, b)
+{
+    return (a === b) + (a !== b) * 2 + (a == b) * 4;
+}
+
+function neg_mod(a, b)
+{
+    return -(a % b);
+}
+
+function use_before_init(a)
+{
+    if (a)
+        return x;
+    let x = 1;
+    return x;
+}
+
+function undefined_var(a)
+{
+    var x;
+    if (a)
+        x = 2;
+    return x * 3;
+}
+
+function write_only(a)
+{
+    let x = a;
+    x = 2;
+    return a;
+}
+
+function no_result(a)
+{
+    a++;
+}
+
+function test_numbers()
+{
+    assert(add(1, 2), 3);
+    assert(add(0x7fffffff, 1), 2147483648);
+    assert(add(0.5, 0.25), 0.75);
+    assert(add(-0, -0), -0);
+    assert(add(NaN, 1), NaN);
+    assert(add(Infinity, -Infinity), NaN);
+    assert(fib(10), 55);
+    assert(fib(78), 8944394323791464);
+    assert(fib(0), 0);
+    assert(sum_loop(999), 233168);
+    assert(bits(5, 2), 21);
+    assert(bits(-1, 33), 2147483614);
+    assert(bits(2 ** 40 + 3, 1), 6);
+    assert(shr(-1), 4294967295);
+    assert(shr(2 ** 32 + 5), 5);
+    assert(shr(-2.5), 4294967294);
+    assert(cmp(1, 2), true);
+    assert(cmp(NaN, 2), false);
+    assert(cond(5, 3), 2);
+    assert(cond(0, 3), -1);
+    assert(cond(NaN, 3), -1);
+    assert(cond(-1, 3), 3);
+    assert(same(1, 1), 5);
+    assert(same(1, 2), 2);
+    assert(same(NaN, NaN), 2);
+    assert(same(0, -0), 5);
+    assert(neg_mod(5, 3), -2);
+    assert(neg_mod(-4, 2), 0);
+    assert(neg_mod(4, 2), -0);
+    assert(neg_mod(1, 0), NaN);
+    assert(write_only(3), 3);
+    assert(no_result(1), undefined);
+}
+
+/* the calls which are not handled by the C code are executed by the
+   interpreter */
+function test_fallback()
+{
+    var err;
+    assert(add("a", 1), "a1");
+    assert(add(1), NaN);
+    assert(add(true, 1), 2);
+    assert(add(1n, 2n), 3n);
+    assert(add({ valueOf() { return 4; } }, 1), 5);
+    assert(fib("10"), 55);
+    assert(use_before_init(0), 1);
+    err = null;
+    try {
+        use_before_init(1);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof ReferenceError);
+    assert(write_only("a"), "a");
+    assert(undefined_var(1), 6);
+    assert(undefined_var(0), NaN);
+    assert(new add(1, 2) instanceof add);
+}
+
+test_numbers();
+test_fallback();
@@ -0,0 +1,693 @@
+/*
+ * QuickJS C API test
+ *
+ * Copyright (c) 2024 the QuickJS authors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+/* Test of the parts of the C API which cannot be reached from
+   JavaScript. Run by "make test". */
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "../cutils.h"
+#include "../quickjs.h"
+#include "../quickjs-libc.h"
+
+static void assert_fail(const char *expr, const char *file, int line)
+{
+    fprintf(stderr, "%s:%d: assertion failed: %s\n", file, line, expr);
+    exit(1);
+}
+
+#define assert_true(expr) \
+    do { if (!(expr)) assert_fail(#expr, __FILE__, __LINE__); } while (0)
+
+static JSValue eval_str(JSContext *ctx, const char *str, int flags)
+{
+    JSValue val;
+    val = JS_Eval(ctx, str, strlen(str), "<test>", flags);
+    if (JS_IsException(val))
+        js_std_dump_error(ctx);
+    return val;
+}
+
+/* evaluate 'str' and return its value converted to int32 */
+static int eval_int(JSContext *ctx, const char *str)
+{
+    JSValue val;
+    int32_t v;
+
+    val = eval_str(ctx, str, JS_EVAL_TYPE_GLOBAL);
+    assert_true(!JS_IsException(val));
+    assert_true(JS_ToInt32(ctx, &v, val) == 0);
+    JS_FreeValue(ctx, val);
+    return v;
+}
+
+/* JS_ResetContext() */
+
+static const char reset_module[] =
+    "let n = 0;\n"
+    "export function inc() { return ++n; }\n"
+    "globalThis.inc = inc;\n";
+
+static const char reset_script[] =
+    "var counter = (function () {\n"
+    "    var n = 0, state = { count: 0 };\n"
+    "    return { incr() { state.count++; return ++n; },\n"
+    "             get count() { return state.count; } };\n"
+    "})();\n"
+    "var cache = new Map([['a', 1]]), seen = new Set(),\n"
+    "    wkey = {}, wmap = new WeakMap(), start = new Date(0),\n"
+    "    buf = new ArrayBuffer(4), bytes = new Uint8Array(8);\n"
+    "wmap.set(wkey, 1);\n";
+
+static JSContext *new_reset_context(JSRuntime *rt, void *opaque)
+{
+    JSContext *ctx;
+    JSValue val;
+
+    ctx = JS_NewContext(rt);
+    if (!ctx)
+        return NULL;
+    val = eval_str(ctx, reset_module, JS_EVAL_TYPE_MODULE);
+    assert_true(!JS_IsException(val));
+    JS_FreeValue(ctx, val);
+    val = eval_str(ctx, reset_script, JS_EVAL_TYPE_GLOBAL);
+    assert_true(!JS_IsException(val));
+    JS_FreeValue(ctx, val);
+    return ctx;
+}
+
+static void test_reset_context(void)
+{
+    JSRuntimePool *pool;
+    JSContext *ctx;
+    JSValue val;
+    int i;
+
+    pool = js_std_pool_new(1, new_reset_context, NULL);
+    assert_true(pool != NULL);
+    for(i = 0; i < 3; i++) {
+        ctx = js_std_pool_get(pool);
+        assert_true(ctx != NULL);
+        /* the closure and module variables are reset */
+        assert_true(eval_int(ctx, "inc() + inc() + inc()") == 6);
+        assert_true(eval_int(ctx, "counter.incr(), counter.incr()") == 2);
+        assert_true(eval_int(ctx, "counter.count") == 2);
+        assert_true(eval_int(ctx, "globalThis.leak = 1, Math.max = null, 0") == 0);
+        /* the internal state of the base objects is reset */
+        assert_true(eval_int(ctx,
+                             "cache.size == 1 && cache.get('a') == 1 && "
+                             "[...cache.keys()].join() == 'a' && "
+                             "seen.size == 0 && wmap.get(wkey) == 1 && "
+                             "start.getTime() == 0 && "
+                             "new Uint8Array(buf).join() == '0,0,0,0' && "
+                             "bytes.join() == '0,0,0,0,0,0,0,0'") == 1);
+        assert_true(eval_int(ctx,
+                             "cache.delete('a'); cache.set('b', 2).set('a', 3);"
+                             "seen.add('secret'); wmap.set(wkey, 2);"
+                             "start.setTime(1000); new Uint8Array(buf)[1] = 7;"
+                             "bytes.fill(9); 0") == 0);
+        js_std_pool_put(pool, ctx);
+    }
+    ctx = js_std_pool_get(pool);
+    assert_true(eval_int(ctx, "typeof leak == 'undefined' && "
+                         "typeof Math.max == 'function'") == 1);
+    /* a detached base buffer cannot be restored: the context is
+       not reused */
+    val = eval_str(ctx, "buf", JS_EVAL_TYPE_GLOBAL);
+    JS_DetachArrayBuffer(ctx, val);
+    JS_FreeValue(ctx, val);
+    js_std_pool_put(pool, ctx);
+    ctx = js_std_pool_get(pool);
+    assert_true(eval_int(ctx, "buf.byteLength") == 4);
+    js_std_pool_put(pool, ctx);
+    js_std_pool_free(pool);
+}
+
+/* JS_ReserveAtoms() and JS_READ_OBJ_ROM_DATA */
+
+static const char rom_script[] =
+    "function fib(n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }\n"
+    "function rom_fail() {\n"
+    "    throw Error('rom_error');\n"
+    "}\n"
+    "var rom_name = 'rom_' + 'name';\n"
+    "fib(15);\n";
+
+#define ROM_THREAD_COUNT 4
+
+static uint8_t *rom_buf;
+static size_t rom_len;
+
+/* read the image 'rom_buf', which is read-only, and check that its
+   code and line numbers can be used. 'in_place' is TRUE if they must
+   not be copied. */
+static void rom_run(JSContext *ctx, BOOL in_place)
+{
+    JSMemoryUsage mu;
+    JSValue obj, val;
+    const char *str;
+
+    obj = JS_ReadObject(ctx, rom_buf, rom_len,
+                        JS_READ_OBJ_BYTECODE | JS_READ_OBJ_ROM_DATA);
+    assert_true(!JS_IsException(obj));
+    val = JS_EvalFunction(ctx, obj);
+    assert_true(!JS_IsException(val));
+    JS_FreeValue(ctx, val);
+    /* the line number tables of the image are counted if copied */
+    JS_ComputeMemoryUsage(JS_GetRuntime(ctx), &mu);
+    assert_true((mu.js_func_pc2line_count == 0) == in_place);
+    assert_true(eval_int(ctx, "fib(15)") == 610);
+    assert_true(eval_int(ctx, "rom_name == 'rom_name'") == 1);
+
+    val = eval_str(ctx, "try { rom_fail(); } catch(e) { e.stack }",
+                   JS_EVAL_TYPE_GLOBAL);
+    str = JS_ToCString(ctx, val);
+    assert_true(str != NULL);
+    assert_true(strstr(str, "at rom_fail (rom.js:3)") != NULL);
+    JS_FreeCString(ctx, str);
+    JS_FreeValue(ctx, val);
+}
+
+static void *rom_thread(void *arg)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    int i;
+
+    for(i = 0; i < 20; i++) {
+        rt = JS_NewRuntime();
+        assert_true(rt != NULL);
+        assert_true(JS_ReserveAtoms(rt, rom_buf, rom_len) == 0);
+        ctx = JS_NewContext(rt);
+        assert_true(ctx != NULL);
+        rom_run(ctx, TRUE);
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+    return NULL;
+}
+
+static void test_rom_data(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue obj;
+    uint8_t *buf;
+    size_t len;
+    pthread_t tab[ROM_THREAD_COUNT];
+    int i;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    obj = JS_Eval(ctx, rom_script, strlen(rom_script), "rom.js",
+                  JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    assert_true(!JS_IsException(obj));
+    buf = JS_WriteObject(ctx, &len, obj, JS_WRITE_OBJ_BYTECODE);
+    assert_true(buf != NULL);
+    JS_FreeValue(ctx, obj);
+
+    /* any write to the image would crash */
+    rom_len = len;
+    rom_buf = mmap(NULL, rom_len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    assert_true(rom_buf != MAP_FAILED);
+    memcpy(rom_buf, buf, len);
+    assert_true(mprotect(rom_buf, rom_len, PROT_READ) == 0);
+    js_free(ctx, buf);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+
+    for(i = 0; i < ROM_THREAD_COUNT; i++)
+        assert_true(pthread_create(&tab[i], NULL, rom_thread, NULL) == 0);
+    for(i = 0; i < ROM_THREAD_COUNT; i++)
+        pthread_join(tab[i], NULL);
+
+    /* the atoms cannot be reserved once other atoms exist: the image
+       is copied */
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    assert_true(eval_int(ctx, "globalThis.rom_other_atom = 1") == 1);
+    assert_true(JS_ReserveAtoms(rt, rom_buf, rom_len) < 0);
+    rom_run(ctx, FALSE);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+
+    munmap(rom_buf, rom_len);
+}
+
+/* JS_SetBignumThreads() */
+
+/* the factors are large enough to use the parallel NTT convolutions */
+static const char bignum_script[] =
+    "var a = 3n ** 4000000n, b = 7n ** 3000000n, p = a * b;\n"
+    "var c = 5n ** 600000n, q = c * (c + 1n);\n"
+    "p.toString(16) + ',' + (p % 1000000007n) + ',' + q.toString(16);\n";
+
+#define BIGNUM_THREAD_COUNT 2
+
+static char *bignum_ref;
+
+static char *bignum_run(int thread_count)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+    const char *str;
+    char *res;
+
+    rt = JS_NewRuntime();
+    assert_true(rt != NULL);
+    JS_SetBignumThreads(rt, thread_count);
+    ctx = JS_NewContext(rt);
+    assert_true(ctx != NULL);
+    val = eval_str(ctx, bignum_script, JS_EVAL_TYPE_GLOBAL);
+    assert_true(!JS_IsException(val));
+    str = JS_ToCString(ctx, val);
+    assert_true(str != NULL);
+    res = strdup(str);
+    assert_true(res != NULL);
+    JS_FreeCString(ctx, str);
+    JS_FreeValue(ctx, val);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+    return res;
+}
+
+static void *bignum_thread(void *arg)
+{
+    char *res;
+
+    res = bignum_run(4);
+    assert_true(strcmp(res, bignum_ref) == 0);
+    free(res);
+    return NULL;
+}
+
+static void test_bignum_threads(void)
+{
+    pthread_t tab[BIGNUM_THREAD_COUNT];
+    char *res;
+    int i;
+
+    bignum_ref = bignum_run(1);
+    for(i = 2; i <= 64; i = i * 2 + 1) {
+        res = bignum_run(i);
+        assert_true(strcmp(res, bignum_ref) == 0);
+        free(res);
+    }
+
+    /* several runtimes share the thread pool */
+    for(i = 0; i < BIGNUM_THREAD_COUNT; i++)
+        assert_true(pthread_create(&tab[i], NULL, bignum_thread, NULL) == 0);
+    for(i = 0; i < BIGNUM_THREAD_COUNT; i++)
+        pthread_join(tab[i], NULL);
+    free(bignum_ref);
+}
+
+/* JS_RunGCStep() and JS_SetGCStepBudget() */
+
+#define GC_CYCLE_COUNT 1000
+#define GC_STEP_BUDGET 100
+
+static int64_t gc_obj_count(JSRuntime *rt, int64_t *pold_count)
+{
+    JSMemoryUsage mu;
+
+    JS_ComputeMemoryUsage(rt, &mu);
+    if (pold_count)
+        *pold_count = mu.gc_old_obj_count;
+    return mu.obj_count;
+}
+
+static void test_gc_step(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSMemoryUsage mu;
+    int64_t count0, count, prev_count, old_count, full_count;
+    int i, n;
+
+    rt = JS_NewRuntime();
+    /* only the explicit collections are run */
+    JS_SetGCThreshold(rt, (size_t)-1);
+    ctx = JS_NewContext(rt);
+    JS_RunGC(rt);
+    count0 = gc_obj_count(rt, NULL);
+
+    /* young cycles: freed by a step without old objects */
+    assert_true(eval_int(ctx, "(function() {\n"
+                         "    for(var i = 0; i < 1000; i++) {\n"
+                         "        var a = {}, b = { a };\n"
+                         "        a.b = b;\n"
+                         "    }\n"
+                         "    return 1;\n"
+                         "})()") == 1);
+    assert_true(gc_obj_count(rt, NULL) >= count0 + 2 * GC_CYCLE_COUNT);
+    JS_RunGCStep(rt, 0);
+    assert_true(gc_obj_count(rt, NULL) == count0);
+
+    /* old cycles: each step frees at most 'budget' of them */
+    assert_true(eval_int(ctx, "globalThis.gc_tab = [];\n"
+                         "for(var i = 0; i < 1000; i++) {\n"
+                         "    var o = {};\n"
+                         "    o.self = o;\n"
+                         "    gc_tab.push(o);\n"
+                         "}\n"
+                         "1") == 1);
+    JS_RunGC(rt);
+    assert_true(eval_int(ctx, "gc_tab = null; o = null; 1") == 1);
+    JS_RunGCStep(rt, 0);
+    count = gc_obj_count(rt, &old_count);
+    count0 = count - GC_CYCLE_COUNT;
+    n = (old_count + GC_STEP_BUDGET - 1) / GC_STEP_BUDGET;
+    for(i = 0; i < n; i++) {
+        prev_count = count;
+        JS_RunGCStep(rt, GC_STEP_BUDGET);
+        count = gc_obj_count(rt, NULL);
+        assert_true(count <= prev_count &&
+                    prev_count - count <= GC_STEP_BUDGET);
+    }
+    assert_true(count == count0);
+    JS_RunGC(rt);
+    assert_true(gc_obj_count(rt, NULL) == count0);
+
+    /* a cycle larger than a step is only freed by JS_RunGC() */
+    assert_true(eval_int(ctx, "globalThis.gc_ring = { };\n"
+                         "var p = gc_ring;\n"
+                         "for(var i = 1; i < 1000; i++)\n"
+                         "    p = { next: p };\n"
+                         "gc_ring.next = p;\n"
+                         "p = null;\n"
+                         "1") == 1);
+    JS_RunGC(rt);
+    assert_true(eval_int(ctx, "gc_ring = null; 1") == 1);
+    for(i = 0; i < 4 * n; i++)
+        JS_RunGCStep(rt, GC_STEP_BUDGET);
+    assert_true(gc_obj_count(rt, NULL) == count0 + GC_CYCLE_COUNT);
+    JS_RunGC(rt);
+    assert_true(gc_obj_count(rt, NULL) == count0);
+
+    /* the automatic GC only does steps when a budget is set */
+    JS_ComputeMemoryUsage(rt, &mu);
+    full_count = mu.gc_full_count;
+    JS_SetGCStepBudget(rt, GC_STEP_BUDGET);
+    JS_SetGCThreshold(rt, 256 * 1024);
+    assert_true(eval_int(ctx, "for(var i = 0; i < 100000; i++) {\n"
+                         "    var a = {}, b = { a };\n"
+                         "    a.b = b;\n"
+                         "}\n"
+                         "a = b = null;\n"
+                         "1") == 1);
+    JS_ComputeMemoryUsage(rt, &mu);
+    assert_true(mu.gc_full_count == full_count);
+    /* most of the 200000 objects were freed by the steps */
+    assert_true(mu.obj_count < count0 + 20000);
+    JS_RunGC(rt);
+    assert_true(gc_obj_count(rt, NULL) == count0);
+
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+/* JS_NewCFunctionLeaf() */
+
+/* return 100 * argc + the sum of the arguments. Throw an exception if
+   the first argument is negative. */
+static JSValue leaf_sum(JSContext *ctx, JSValueConst this_val,
+                        int argc, JSValueConst *argv)
+{
+    int i, sum;
+
+    /* the missing arguments are undefined */
+    if (argc < 2 && !JS_IsUndefined(argv[1]))
+        return JS_ThrowTypeError(ctx, "leaf_sum: invalid argv");
+    sum = 100 * argc;
+    for(i = 0; i < argc; i++) {
+        if (!JS_IsNumber(argv[i]))
+            continue;
+        if (i == 0 && JS_VALUE_GET_INT(argv[i]) < 0)
+            return JS_ThrowRangeError(ctx, "leaf_error");
+        sum += JS_VALUE_GET_INT(argv[i]);
+    }
+    return JS_NewInt32(ctx, sum);
+}
+
+static const char leaf_script[] =
+    "function leaf_caller(a, b, c) {\n"
+    "    return leaf_sum(a, b, c) + 0;\n"
+    "}\n"
+    "function leaf_stack(f) {\n"
+    "    try { f(); } catch(e) { return e.stack; }\n"
+    "}\n";
+
+static void test_cfunction_leaf(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue global, val;
+    const char *str;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    global = JS_GetGlobalObject(ctx);
+    JS_SetPropertyStr(ctx, global, "leaf_sum",
+                      JS_NewCFunctionLeaf(ctx, leaf_sum, "leaf_sum", 2));
+    JS_FreeValue(ctx, global);
+    val = JS_Eval(ctx, leaf_script, strlen(leaf_script), "leaf.js",
+                  JS_EVAL_TYPE_GLOBAL);
+    assert_true(!JS_IsException(val));
+    JS_FreeValue(ctx, val);
+
+    /* fewer arguments than 'length': called with a stack frame */
+    assert_true(eval_int(ctx, "leaf_sum(5)") == 105);
+    /* more arguments than 'length' */
+    assert_true(eval_int(ctx, "leaf_caller(1, 2, 3)") == 306);
+    assert_true(eval_int(ctx, "var o = { f: leaf_sum }; o.f(1, 2, 3, 4)") ==
+                410);
+
+    /* no frame for the leaf function: the backtrace starts at the
+       caller */
+    val = eval_str(ctx, "leaf_stack(() => leaf_caller(-1, 2, 3))",
+                   JS_EVAL_TYPE_GLOBAL);
+    str = JS_ToCString(ctx, val);
+    assert_true(str != NULL);
+    assert_true(strstart(str, "    at leaf_caller (leaf.js:2)\n", NULL));
+    assert_true(strstr(str, "leaf_sum") == NULL);
+    JS_FreeCString(ctx, str);
+    JS_FreeValue(ctx, val);
+
+    /* with a frame otherwise */
+    val = eval_str(ctx, "leaf_stack(() => leaf_sum(-1))",
+                   JS_EVAL_TYPE_GLOBAL);
+    str = JS_ToCString(ctx, val);
+    assert_true(str != NULL);
+    assert_true(strstart(str, "    at leaf_sum (native)\n", NULL));
+    JS_FreeCString(ctx, str);
+    JS_FreeValue(ctx, val);
+
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+/* JS_StartHeapProfiler() and JS_WriteHeapProfile() */
+
+static const char heap_script[] =
+    "class HeapSite {}\n"
+    "function heap_alloc() {\n"
+    "    var t = [];\n"
+    "    for(var i = 0; i < 10; i++) t.push(new HeapSite());\n"
+    "    return t;\n"
+    "}\n"
+    "var heap_tab = heap_alloc();\n"
+    "class HeapRope {\n"
+    "    constructor() { this.s = 'a'.repeat(1000) + 'b'.repeat(1000); }\n"
+    "}\n"
+    "var heap_rope = new HeapRope();\n";
+
+/* find the line of the heap profile ending with 'name' and return its
+   first two numbers */
+static BOOL heap_profile_find(const char *buf, const char *name,
+                              int64_t *pcount, int64_t *psize)
+{
+    const char *p, *line;
+    size_t len;
+
+    len = strlen(name);
+    for(line = buf; *line != '\0'; line = p + 1) {
+        p = strchr(line, '\n');
+        if (!p)
+            break;
+        if (p - line >= len && !memcmp(p - len, name, len) &&
+            p[-len - 1] == ' ') {
+            return sscanf(line, "%" SCNd64 " %" SCNd64, pcount, psize) == 2;
+        }
+    }
+    return FALSE;
+}
+
+static void test_heap_profile(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+    FILE *f;
+    char buf[16384];
+    size_t len;
+    int64_t count, size;
+
+    rt = JS_NewRuntime();
+    /* record the allocation site of every object */
+    assert_true(JS_StartHeapProfiler(rt, 1) == 0);
+    ctx = JS_NewContext(rt);
+    val = JS_Eval(ctx, heap_script, strlen(heap_script), "heap.js",
+                  JS_EVAL_TYPE_GLOBAL);
+    assert_true(!JS_IsException(val));
+    JS_FreeValue(ctx, val);
+    JS_RunGC(rt);
+
+    f = tmpfile();
+    assert_true(f != NULL);
+    assert_true(JS_WriteHeapProfile(rt, f) == 0);
+    rewind(f);
+    len = fread(buf, 1, sizeof(buf) - 1, f);
+    buf[len] = '\0';
+    fclose(f);
+
+    assert_true(heap_profile_find(buf, "Object HeapSite", &count, &size));
+    assert_true(count == 10);
+    /* the nodes and leaves of the rope are only referenced by the
+       object */
+    assert_true(heap_profile_find(buf, "Object HeapRope", &count, &size));
+    assert_true(count == 1 && size > 2000);
+    /* allocation sites of the array elements and of the rope holder */
+    assert_true(heap_profile_find(buf, "heap_alloc (heap.js:4)",
+                                  &count, &size));
+    assert_true(count == 10);
+    assert_true(heap_profile_find(buf, "<eval> (heap.js:11)",
+                                  &count, &size));
+    assert_true(count == 1 && size > 2000);
+
+    JS_StopHeapProfiler(rt);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+/* JS_NewSlabRuntime(): the blocks have the alignment of malloc() */
+
+static void test_slab_align(void)
+{
+    JSRuntime *rt;
+    void *tab[64];
+    int i;
+
+    rt = JS_NewSlabRuntime();
+    assert_true(rt != NULL);
+    for(i = 0; i < countof(tab); i++) {
+        /* small and large blocks */
+        tab[i] = js_malloc_rt(rt, 1 + i * 37);
+        assert_true(tab[i] != NULL);
+        assert_true(((uintptr_t)tab[i] & 15) == 0);
+    }
+    for(i = 0; i < countof(tab); i++) {
+        tab[i] = js_realloc_rt(rt, tab[i], 3000 - i * 41);
+        assert_true(tab[i] != NULL);
+        assert_true(((uintptr_t)tab[i] & 15) == 0);
+    }
+    for(i = 0; i < countof(tab); i++)
+        js_free_rt(rt, tab[i]);
+    JS_FreeRuntime(rt);
+}
+
+/* JS_FreeRuntime() with the slab allocator: the finalizers releasing
+   external resources are called */
+
+static int slab_finalizer_count;
+static JSClassID slab_class_id;
+
+static void slab_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSValue *pval = JS_GetOpaque(val, slab_class_id);
+    /* the referenced object is released with the runtime */
+    JS_FreeValueRT(rt, *pval);
+    js_free_rt(rt, pval);
+    slab_finalizer_count++;
+}
+
+static void slab_free_buffer(JSRuntime *rt, void *opaque, void *ptr)
+{
+    free(ptr);
+    slab_finalizer_count++;
+}
+
+static void test_slab_teardown(void)
+{
+    JSClassDef class_def = { "Slab", .finalizer = slab_finalizer };
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue global_obj, obj, *pval;
+
+    rt = JS_NewSlabRuntime();
+    assert_true(rt != NULL);
+    ctx = JS_NewContext(rt);
+    assert_true(ctx != NULL);
+    JS_NewClassID(&slab_class_id);
+    assert_true(JS_NewClass(rt, slab_class_id, &class_def) == 0);
+
+    obj = JS_NewObjectClass(ctx, slab_class_id);
+    pval = js_malloc(ctx, sizeof(*pval));
+    assert_true(pval != NULL);
+    *pval = eval_str(ctx, "var o = { a: 'x'.repeat(5000) }; o.self = o; o",
+                     JS_EVAL_TYPE_GLOBAL);
+    JS_SetOpaque(obj, pval);
+    global_obj = JS_GetGlobalObject(ctx);
+    JS_SetPropertyStr(ctx, global_obj, "slab_obj", obj);
+    JS_SetPropertyStr(ctx, global_obj, "slab_buf",
+                      JS_NewArrayBuffer(ctx, malloc(16), 16, slab_free_buffer,
+                                        NULL, FALSE));
+    JS_FreeValue(ctx, global_obj);
+    assert_true(eval_int(ctx, "var a = []; for(var i = 0; i < 1000; i++) "
+                         "a.push({ i, next: a }); a.length") == 1000);
+    slab_finalizer_count = 0;
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+    assert_true(slab_finalizer_count == 2);
+}
+
+int main(int argc, char **argv)
+{
+    test_reset_context();
+    test_rom_data();
+    test_bignum_threads();
+    test_gc_step();
+    test_cfunction_leaf();
+    test_heap_profile();
+    test_slab_align();
+    test_slab_teardown();
+    return 0;
+}
@@ -341,6 +341,78 @@ function test_string()
     assert("abc".padStart(Infinity, ""), "abc");
 }
 
+function test_string_search()
+{
+    var a, b, w;
+
+    /* long strings, short and long needles, 8 and 16 bit characters */
+    a = "x".repeat(100) + "abcd" + "x".repeat(100);
+    assert(a.indexOf("abcd"), 100);
+    assert(a.indexOf("abcd", 101), -1);
+    assert(a.indexOf("xab"), 99);
+    assert(a.includes("dx"), true);
+    assert(a.includes("dy"), false);
+    assert(a.indexOf("x".repeat(100) + "a"), 0);
+    assert(a.indexOf("x".repeat(100) + "a", 1), -1);
+    assert(a.indexOf("d" + "x".repeat(100)), 103);
+    assert(a.indexOf("d" + "x".repeat(101)), -1);
+
+    /* periodic needles */
+    b = "ab".repeat(50);
+    assert(("ab".repeat(200) + "abb").indexOf(b + "b"), 302);
+    assert(("aab".repeat(100) + "aaab").indexOf("aab".repeat(20) + "aa"), 0);
+    assert(("aab".repeat(100)).indexOf("aab".repeat(20) + "aaab"), -1);
+    assert(("a".repeat(1000) + "b").indexOf("a".repeat(40) + "b"), 960);
+
+    w = "Ā".repeat(50) + "abc" + "ā".repeat(50);
+    assert(w.indexOf("abc"), 50);
+    assert(w.indexOf("Āabcā"), 49);
+    assert(w.indexOf("ā".repeat(40)), 53);
+    assert(a.indexOf("abĀ"), -1);
+    assert((a + "Ā").indexOf("xĀ"), 203);
+    assert(w.indexOf("Ā"), 0);
+    assert(w.indexOf("ā"), 53);
+    assert(w.indexOf("Ă"), -1);
+
+    assert(a.split("abcd"), [ "x".repeat(100), "x".repeat(100) ]);
+    assert(w.replaceAll("ā".repeat(25), "-"), "Ā".repeat(50) + "abc--");
+}
+
+function test_string_rope()
+{
+    var a, b, c, i, tab, m, o;
+
+    /* long concatenations are represented as ropes */
+    a = "";
+    c = "";
+    tab = [];
+    for(i = 0; i < 2000; i++) {
+        a += "a" + i;
+        c = "\u1234" + i + c;
+        tab.push("a" + i);
+    }
+    b = tab.join("");
+    assert(a.length, b.length);
+    assert(a === b, true);
+    assert(a < b + "0", true);
+    assert(a > b.slice(0, -1), true);
+    assert(a[5000], b[5000]);
+    assert(a.indexOf("a1999"), b.indexOf("a1999"));
+    assert(typeof a, "string");
+    assert(c.slice(0, 5), "\u12341999");
+    assert(c.length, b.length);
+    assert(c.charCodeAt(c.length - 2), 0x1234);
+
+    m = new Map();
+    m.set(b, 1);
+    assert(m.get(a), 1);
+    o = {};
+    o[a] = 2;
+    assert(o[b], 2);
+    assert(JSON.stringify([a]), JSON.stringify([b]));
+    assert(Object(a).length, b.length);
+}
+
 function test_math()
 {
     var a;
@@ -359,6 +431,37 @@ function test_math()
     assert(Math.abs(Math.hypot(3, 4, 5) - 7.0710678118654755) <= 1e-15);
 }
 
+/* the fixed arity C functions have a fast path for number arguments */
+function test_math_fast_call()
+{
+    var a, i, s, log, o;
+    a = [ 3, 2**32 + 5, -1.5, NaN, Infinity ];
+    s = 0;
+    for(i = 0; i < a.length; i++)
+        s = s + Math.imul(a[i], 7) + Math.clz32(a[i]);
+    assert(s, (21 + 30) + (35 + 29) + (-7 + 0) + 32 + 32);
+    assert(Math.imul(3), 0);
+    assert(Math.clz32(), 32);
+    assert(Math.imul("6", 7), 42);
+    assert(Math.sqrt(4, 1), 2);
+    assert(Math.pow(2, 10), 1024);
+    assert(Math.pow(2), NaN);
+
+    /* the conversions are done in order when an argument is not a number */
+    log = [];
+    o = { valueOf() { log.push("o"); return 3; } };
+    assert(Math.imul(o, { valueOf() { log.push("p"); return 5; } }), 15);
+    assert(Math.atan2(o, 1) > 1.24);
+    assert(log.join(), "o,p,o");
+    assert_throws(TypeError, () => Math.imul(Symbol(), 1));
+    assert_throws(TypeError, () => Math.clz32(1n));
+
+    /* 'this' and extra arguments are ignored */
+    assert(Math.imul.call(null, 6, 7, 8), 42);
+    var imul = Math.imul;
+    assert(imul(-6, 7), -42);
+}
+
 function test_number()
 {
     assert(parseInt("123"), 123);
@@ -381,6 +484,26 @@ function test_number()
     assert(Number.isNaN(Number("-")));
     assert(Number.isNaN(Number("\x00a")));
 
+    assert((0.1).toString(), "0.1");
+    assert((0.1 + 0.2).toString(), "0.30000000000000004");
+    assert((1/3).toString(), "0.3333333333333333");
+    assert((5e-324).toString(), "5e-324");
+    assert((1.7976931348623157e308).toString(), "1.7976931348623157e+308");
+    assert((2.2250738585072014e-308).toString(), "2.2250738585072014e-308");
+    assert((123.456).toString(), "123.456");
+    assert((1e21).toString(), "1e+21");
+    assert((1.5e-7).toString(), "1.5e-7");
+    assert((0.000001).toString(), "0.000001");
+    assert(JSON.stringify([0.1, -0, 1e300, -2.5]), "[0.1,0,1e+300,-2.5]");
+    assert((123.456).toFixed(2), "123.46");
+    assert((0.5).toFixed(0), "1");
+    assert((9.9999).toFixed(3), "10.000");
+    assert((0.000123).toFixed(5), "0.00012");
+    assert((1.005).toFixed(2), "1.00");
+    assert((123.456).toPrecision(4), "123.5");
+    assert((0.000123456).toPrecision(2), "0.00012");
+    assert((123456).toExponential(2), "1.23e+5");
+
     // TODO: Fix rounding errors on Windows/Cygwin.
     if (typeof os !== 'undefined' && ['win32', 'cygwin'].includes(os.platform)) {
         return;
@@ -504,6 +627,101 @@ function test_typed_array()
     assert(a.toString(), "1,2,10,11");
 }
 
+/* the long typed arrays use specialized code */
+function test_typed_array_long()
+{
+    var a, b, i, n, f;
+
+    n = 100;
+    a = new Int16Array(n);
+    for(i = 0; i < n; i++)
+        a[i] = (i * 7919) % 201 - 100;
+    a.sort();
+    for(i = 1; i < n; i++)
+        assert(a[i - 1] <= a[i]);
+
+    a = new Int8Array(n);
+    for(i = 0; i < n; i++)
+        a[i] = n - 2 * i;
+    a.sort();
+    assert(a[0], -98);
+    assert(a[n - 1], 100);
+
+    a = new Float64Array(n);
+    for(i = 0; i < n; i++)
+        a[i] = [NaN, 0, -0, -Infinity, 2.5, -1e-300, Infinity][i % 7];
+    a.sort();
+    assert(a[0], -Infinity);
+    assert(a[13], -Infinity);
+    assert(a[14], -1e-300);
+    assert(a[27], -1e-300);
+    assert(a[28], -0);
+    assert(a[41], -0);
+    assert(a[42], 0);
+    assert(a[56], 0);
+    assert(a[57], 2.5);
+    assert(a[84], Infinity);
+    assert(isNaN(a[85]) && isNaN(a[99]));
+
+    a = new BigInt64Array(n);
+    for(i = 0; i < n; i++)
+        a[i] = BigInt(n - i) * (i & 1 ? -1n : 1n) << 40n;
+    a.sort();
+    assert(a[0], -99n << 40n);
+    assert(a[n - 1], 100n << 40n);
+
+    a = new Float32Array(n);
+    a[37] = -0;
+    a[70] = 3;
+    a[90] = 3;
+    assert(a.indexOf(3), 70);
+    assert(a.indexOf(3, 71), 90);
+    assert(a.lastIndexOf(3), 90);
+    assert(a.lastIndexOf(3, 89), 70);
+    assert(a.lastIndexOf(3, 69), -1);
+    assert(a.indexOf(-0), 0);
+    assert(a.includes(4), false);
+
+    a = new Uint16Array(n);
+    a[17] = 5;
+    a[n - 1] = 5;
+    assert(a.indexOf(5), 17);
+    assert(a.indexOf(5, 18), n - 1);
+    assert(a.lastIndexOf(5), n - 1);
+    assert(a.lastIndexOf(5, -2), 17);
+    assert(new Uint8Array(n).lastIndexOf(0), n - 1);
+
+    /* conversions between elements types */
+    f = new Float64Array(n);
+    for(i = 0; i < n; i++)
+        f[i] = [1.5, -1, 300, NaN, 2.5, 2 ** 32 + 7, -0.7][i % 7];
+    a = new Uint8ClampedArray(n);
+    a.set(f);
+    assert(a.slice(0, 7).toString(), "2,0,255,0,2,255,0");
+    a = new Int8Array(n);
+    a.set(f);
+    assert(a.slice(0, 7).toString(), "1,-1,44,0,2,7,0");
+    a = new Uint32Array(n);
+    a.set(f);
+    assert(a.slice(0, 7).toString(), "1,4294967295,300,0,2,7,0");
+    b = new Float32Array(n);
+    b.set(new Int32Array([16777217, -3]), 1);
+    assert(b[1], 16777216);
+    assert(b[2], -3);
+
+    /* overlapping arrays */
+    b = new ArrayBuffer(16);
+    a = new Uint8Array(b);
+    a.set([1, 2, 3, 4, 5, 6, 7, 8]);
+    new Uint16Array(b, 2).set(a.subarray(0, 4));
+    assert(a.slice(0, 10).toString(), "1,2,1,0,2,0,3,0,4,0");
+
+    a = new BigUint64Array(2);
+    a.set(new BigInt64Array([-1n, 2n]));
+    assert(a[0], 2n ** 64n - 1n);
+    assert_throws(TypeError, () => a.set(new Int32Array(1)));
+}
+
 function test_json()
 {
     var a, s;
@@ -514,6 +732,28 @@ function test_json()
     assert(a.z, null);
     assert(JSON.stringify(a), s);
 
+    /* objects with the same keys, duplicate keys */
+    a = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4},{"a":5,"b":6,"a":7}]');
+    a[1].c = 1;
+    assert(a[0].c, undefined);
+    assert(JSON.stringify(a), '[{"a":1,"b":2},{"a":3,"b":4,"c":1},{"a":7,"b":6}]');
+    assert(JSON.parse('"\\u00e9\\ud83d\\ude00\\t\\/é"'), "é😀\t/é");
+    assert(1 / JSON.parse("-0"), -Infinity);
+    assert(JSON.parse("0.1"), 0.1);
+    assert(JSON.parse("1e400"), Infinity);
+    assert(JSON.parse("9007199254740993"), 9007199254740992);
+    assert(JSON.parse("2.2250738585072014e-308"), 2.2250738585072014e-308);
+    assert_throws(SyntaxError, () => JSON.parse("[1,]"));
+    assert_throws(SyntaxError, () => JSON.parse("01"));
+
+    assert(JSON.stringify({ b: 1, 1: 2, a: [undefined, "\"\n"], c: undefined }),
+           '{"1":2,"b":1,"a":[null,"\\"\\n"]}');
+    a = { x: 1, y: { toJSON: function(k) { delete a.z; return k; } }, z: 2 };
+    assert(JSON.stringify(a), '{"x":1,"y":"y"}');
+    a = { x: 1 };
+    a.y = [a];
+    assert_throws(TypeError, () => JSON.stringify(a));
+
     /* indentation test */
     assert(JSON.stringify([[{x:1,y:{},z:[]},2,3]],undefined,1),
 `[
@@ -680,6 +920,19 @@ function test_regexp()
     assert(a, ["123a23", "3"]);
     a = /()*?a/.exec(",");
     assert(a, null);
+
+    /* start position search */
+    a = /(ab)c/.exec("xabxabcab");
+    assert(a.index === 4 && a[1] === "ab");
+    a = /[0-9]+x/.exec("a1b22x");
+    assert(a.index === 3 && a[0] === "22x");
+    a = /bሴ/.exec("abሳbሴ");
+    assert(a.index, 3);
+    a = /\udc00/u.exec("𐀀\udc00");
+    assert(a.index, 2);
+    a = /ab/g;
+    a.lastIndex = 1;
+    assert(a.test("abab") && a.lastIndex === 4);
 }
 
 function test_symbol()
@@ -755,6 +1008,21 @@ function test_map()
     });
 
     assert(a.size, 0);
+
+    /* iteration while the records are deleted and compacted */
+    a = new Set();
+    for(i = 0; i < n; i++)
+        a.add(i);
+    o = a.values();
+    assert(o.next().value, 0);
+    for(i = 0; i < n - 2; i++)
+        a.delete(i);
+    a.add("x");
+    assert([...o].join(), (n - 2) + "," + (n - 1) + ",x");
+    o = a.values();
+    a.clear();
+    a.add("y");
+    assert([...o].join(), "y");
 }
 
 function test_weak_map()
@@ -845,10 +1113,14 @@ test_function();
 test_enum();
 test_array();
 test_string();
+test_string_search();
+test_string_rope();
 test_math();
+test_math_fast_call();
 test_number();
 test_eval();
 test_typed_array();
+test_typed_array_long();
 test_json();
 test_date();
 test_regexp();
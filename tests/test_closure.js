@@ -212,6 +212,29 @@ function test_eval_const()
     assert(success);
 }
 
+/* with qjs --lazy, the bodies of the inner functions are only
+   scanned at load time */
+function test_lazy_scan()
+{
+    var n = 8, self = {};
+    function f(s) {
+        var r = [];
+        if (s) /[/}]/.test(s) ? r.push("re") : r.push("no");
+        r.push((n + 2) / 2 / 5, `<${ {a: n}.a }${ `${s}` }>`);
+        r.push([/}/g][0].source, n /= 2);
+        return r.join(",");
+    }
+    function g() {
+        var h = () => {
+            var k = () => [this === self, new.target === undefined];
+            return k().join(",") + " " + arguments.length + " " + n;
+        };
+        return h();
+    }
+    assert(f("a}"), "re,1,<8a}>,},4");
+    assert(g.call(self, 1, 2), "true,true 2 4");
+}
+
 test_closure1();
 test_closure2();
 test_closure3();
@@ -219,3 +242,4 @@ test_arrow_function();
 test_with();
 test_eval_closure();
 test_eval_const();
+test_lazy_scan();
@@ -0,0 +1,32 @@
+/* run with 'qjs --cpu-profile file': the Makefile checks the output */
+
+function busy(ms)
+{
+    var t0 = Date.now(), n = 0;
+    while (Date.now() - t0 < ms)
+        n++;
+    return n;
+}
+
+function profile_hot()
+{
+    return busy(100);
+}
+
+/* ';' and the newlines must not break the collapsed stack format */
+var profile_odd = function () { return busy(100); };
+Object.defineProperty(profile_odd, "name", { value: "odd;name\nfunc\r" });
+
+/* the name is a string rope */
+var profile_rope = function () { return busy(100); };
+Object.defineProperty(profile_rope, "name",
+                      { value: "r".repeat(600) + "s".repeat(600) });
+
+function profile_main()
+{
+    profile_hot();
+    profile_odd();
+    profile_rope();
+}
+
+profile_main();
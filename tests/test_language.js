@@ -604,6 +604,77 @@ function test_optional_chaining()
     assert((a?.["b"])().c, 42);
 }
 
+function test_inline_cache()
+{
+    var i, r, o, p, tab;
+
+    function get_a(o) { return o.a; }
+    function set_a(o, v) { o.a = v; }
+
+    /* polymorphic accesses */
+    tab = [ { a: 1 }, { b: 0, a: 2 }, { c: 0, b: 0, a: 3 },
+            { d: 0, c: 0, b: 0, a: 4 }, { e: 0, a: 5 }, Object.create({ a: 6 }) ];
+    for(i = 0; i < 3; i++) {
+        r = 0;
+        tab.forEach(function(o) { r += get_a(o); });
+        assert(r, 21);
+    }
+
+    /* shape changes of the receiver */
+    o = { a: 1, b: 2 };
+    for(i = 0; i < 3; i++)
+        assert(get_a(o), 1);
+    delete o.b;
+    assert(get_a(o), 1);
+    delete o.a;
+    assert(get_a(o), undefined);
+    o.a = 3;
+    assert(get_a(o), 3);
+    Object.defineProperty(o, "a", { get: function() { return 4; } });
+    assert(get_a(o), 4);
+
+    /* non writable properties */
+    o = { a: 1 };
+    set_a(o, 2);
+    set_a(o, 3);
+    assert(o.a, 3);
+    Object.freeze(o);
+    set_a(o, 4);
+    assert(o.a, 3);
+    assert_throws(TypeError, function() { "use strict"; o.a = 5; });
+
+    /* prototype properties */
+    p = { a: 1 };
+    o = Object.create(p);
+    for(i = 0; i < 3; i++)
+        assert(get_a(o), 1);
+    p.a = 2;
+    assert(get_a(o), 2);
+    p.b = 0;
+    assert(get_a(o), 2);
+    o.a = 3;
+    assert(get_a(o), 3);
+    delete o.a;
+    assert(get_a(o), 2);
+    Object.setPrototypeOf(o, { a: 4 });
+    assert(get_a(o), 4);
+    set_a(o, 5);
+    assert(p.a, 2);
+    assert(get_a(o), 5);
+
+    /* an exotic object may have the same shape as an ordinary one */
+    function get_inf(o) { return o.Infinity; }
+    Uint8Array.prototype.Infinity = 5;
+    try {
+        o = Object.create(Uint8Array.prototype);
+        for(i = 0; i < 3; i++)
+            assert(get_inf(o), 5);
+        assert(get_inf(new Uint8Array(1)), undefined);
+    } finally {
+        delete Uint8Array.prototype.Infinity;
+    }
+}
+
 test_op1();
 test_cvt();
 test_eq();
@@ -626,3 +697,4 @@ test_function_expr_name();
 test_parse_semicolon();
 test_optional_chaining();
 test_parse_arrow_function();
+test_inline_cache();
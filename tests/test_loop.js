@@ -190,6 +190,102 @@ function test_for_in_proxy() {
     assert(str == " a c");
 }
 
+function test_for_of_array()
+{
+    var a, v, tab, next, iter;
+
+    /* elements added or removed during the iteration */
+    a = [1, 2, 3];
+    tab = [];
+    for(v of a) {
+        tab.push(v);
+        if (v == 1)
+            a.push(4);
+        if (v == 3)
+            a.length = 3;
+    }
+    assert(tab.toString(), "1,2,3");
+
+    /* length larger than the fast array elements */
+    a = [1, 2];
+    a.length = 4;
+    Array.prototype[3] = "p";
+    tab = [];
+    for(v of a)
+        tab.push(v);
+    delete Array.prototype[3];
+    assert(tab.toString(), "1,2,,p");
+
+    /* array becoming a non fast array */
+    a = [1, 2, 3];
+    tab = [];
+    for(v of a) {
+        tab.push(v);
+        if (v == 1)
+            Object.defineProperty(a, 1, { get: function() { return "g"; } });
+    }
+    assert(tab.toString(), "1,g,3");
+
+    /* user defined 'next' method and iterator */
+    iter = Object.getPrototypeOf([][Symbol.iterator]());
+    next = iter.next;
+    iter.next = function() {
+        var r = next.call(this);
+        if (!r.done)
+            r.value *= 10;
+        return r;
+    };
+    tab = [];
+    for(v of [1, 2])
+        tab.push(v);
+    iter.next = next;
+    assert(tab.toString(), "10,20");
+
+    a = [1, 2];
+    a[Symbol.iterator] = function* () { yield "x"; };
+    tab = [];
+    for(v of a)
+        tab.push(v);
+    assert(tab.toString(), "x");
+
+    tab = [];
+    for(v of [1, 2].entries())
+        tab.push(v.join(":"));
+    assert(tab.toString(), "0:1,1:2");
+}
+
+function test_for_cmp()
+{
+    var i, c, a, o, err;
+    /* non integer operands of the comparisons in the loop tests */
+    c = 0;
+    for(i = 0.5; i < 3; i++)
+        c++;
+    assert(c === 3);
+    c = 0;
+    for(i = "a"; i <= "c"; i = String.fromCharCode(i.charCodeAt(0) + 1))
+        c++;
+    assert(c === 3);
+    c = 0;
+    for(i = 3n; i > 0n; i--)
+        c++;
+    assert(c === 3);
+    a = [ 1, "1", 1.0, 2 ];
+    c = 0;
+    for(i = 0; i < a.length; i++) {
+        if (a[i] === 1)
+            c++;
+    }
+    assert(c === 2);
+    o = { valueOf() { throw "x"; } };
+    try {
+        for(i = 0; i < o; i++);
+    } catch(e) {
+        err = e;
+    }
+    assert(err === "x");
+}
+
 function test_for_break()
 {
     var i, c;
@@ -375,12 +471,14 @@ test_while();
 test_while_break();
 test_do_while();
 test_for();
+test_for_cmp();
 test_for_break();
 test_switch1();
 test_switch2();
 test_for_in();
 test_for_in2();
 test_for_in_proxy();
+test_for_of_array();
 
 test_try_catch1();
 test_try_catch2();
@@ -0,0 +1,117 @@
+/* run after loading the snapshot of snapshot_init.js */
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+function test_closure()
+{
+    assert(counter.value, 2);
+    assert(counter.incr(), 3);
+    assert(counter.value, 3);
+}
+
+function test_class()
+{
+    var p;
+    p = new Point3(1, 2, 3);
+    assert(p.norm2(), 14);
+    assert(p instanceof Point);
+    assert(Point.origin().norm2(), 0);
+    assert(Object.getPrototypeOf(Point3), Point);
+    assert(typeof Point.prototype.norm2, "function");
+    assert(Point.name, "Point");
+    assert(Point3.length, 3);
+    assert([...gen_range(3)].join(), "0,1,2");
+}
+
+function test_private()
+{
+    var c;
+    assert(counter2.incr(), 2);
+    assert(Counter.has(counter2));
+    assert(Counter.instances(), 1);
+    c = new Counter();
+    assert(c.incr(), 1);
+    assert(Counter.instances(), 2);
+    assert(Counter.has({}), false);
+}
+
+function test_symbols()
+{
+    assert(sym_obj[sym], 1);
+    assert(sym_obj.sym, sym);
+    assert(sym.description, "sym");
+    assert(sym_undef.description, undefined);
+    assert(sym_obj[Symbol.for("registered")], 2);
+    assert(Object.getOwnPropertySymbols(sym_obj).length, 2);
+    assert(weak_map.get(weak_key), "weak");
+    assert(weak_map.has({}), false);
+    assert(weak_map2.get(weak_key2), "weak2");
+    weak_key2.x = weak_later;
+    assert(weak_map2.get(weak_key2), "weak2");
+    weak_set.add(weak_key);
+    assert(weak_set.has(weak_key));
+    assert(view.byteOffset, 2);
+    assert(view.byteLength, 4);
+    assert(view.getUint16(0), 0x1234);
+    assert(view.buffer.byteLength, 8);
+}
+
+function test_objects()
+{
+    assert(table.get("a"), 1);
+    assert(table.get("b")[1], 3);
+    assert(table.size, 2);
+    assert(names.has("y"));
+    assert(re.source, "(\\d+)-(\\d+)");
+    assert(re.flags, "g");
+    assert("a 12-34".replace(re, "$2-$1"), "a 34-12");
+    assert(date.getTime(), 1000);
+    assert(boxed + 1, 43);
+    assert(list.length, 5);
+    assert(list[1], "two");
+    assert(list[2].three, 3);
+    assert(3 in list, false);
+    assert(list.self, list);
+    assert(sparse.length, 1001);
+    assert(sparse[1000], "far");
+    assert(bytes.join(), "1,2,3");
+    assert(Object.isFrozen(frozen));
+    assert(add1(2), 3);
+}
+
+function test_globals()
+{
+    assert(lexical, "let");
+    assert(CONSTANT, 123);
+    assert([1, 2, 3].sum(), 6);
+    assert(hidden, "hidden");
+    assert(Object.keys(globalThis).indexOf("hidden"), -1);
+    assert(typeof escape, "undefined");
+    assert(Math.PI2, Math.PI * 2);
+    assert(async_result, 7);
+    /* the context keeps working as usual */
+    assert(typeof print, "function");
+    assert(JSON.stringify({ a: [1] }), '{"a":[1]}');
+}
+
+test_closure();
+test_class();
+test_private();
+test_symbols();
+test_objects();
+test_globals();
@@ -126,6 +126,53 @@ function test_popen()
     os.remove(fname);
 }
 
+function test_mapFile()
+{
+    var f, buf, tab, err, fname = "tmp_file.txt";
+
+    f = std.open(fname, "w");
+    f.puts("hello");
+    f.close();
+
+    buf = std.mapFile(fname);
+    assert(buf.byteLength, 5);
+    tab = new Uint8Array(buf);
+    assert(String.fromCharCode.apply(null, tab), "hello");
+    /* the modifications are private */
+    tab[0] = 0x48;
+    assert(std.loadFile(fname), "hello");
+
+    /* the modifications are written to the file */
+    tab = new Uint8Array(std.mapFile(fname, "r+"));
+    tab[4] = 0x4f;
+    assert(std.loadFile(fname), "hellO");
+
+    err = {};
+    assert(std.mapFile("/non/existent/file", "r", err), null);
+    assert(err.errno, std.Error.ENOENT);
+
+    os.remove(fname);
+}
+
+function test_heap_profile()
+{
+    var tab, fname = "tmp_heap_profile.txt", r, i;
+
+    class HeapTest {
+        constructor(i) { this.i = i; }
+    }
+    tab = [];
+    for(i = 0; i < 100; i++)
+        tab.push(new HeapTest(i));
+    std.gc();
+    assert(std.writeHeapProfile(fname), 0);
+    r = std.loadFile(fname);
+    assert(/^ +100 +[0-9]+ Object HeapTest$/m.test(r), true);
+    os.remove(fname);
+
+    assert(std.writeHeapProfile("/non/existent/file"), -std.Error.ENOENT);
+}
+
 function test_ext_json()
 {
     var expected, input, obj;
@@ -274,6 +321,175 @@ function test_timer()
         os.clearTimeout(th[i]);
 }
 
+function test_timer_order()
+{
+    var log, th;
+
+    /* the timers are run by timeout, then by creation order */
+    log = [];
+    os.setTimeout(function () { log.push(3); }, 20);
+    os.setTimeout(function () { log.push(1); }, 0);
+    th = os.setTimeout(function () { log.push(-1); }, 10);
+    os.setTimeout(function () { log.push(2); }, 0);
+    os.setTimeout(function () { log.push(4); }, 20);
+    os.clearTimeout(th);
+    os.setTimeout(function () {
+        assert(log.join(), "1,2,3,4");
+    }, 30);
+}
+
+function test_timer_clear()
+{
+    var th, i, n;
+
+    /* enough timers to resize the table of the timer ids */
+    th = [];
+    n = 0;
+    for(i = 0; i < 100; i++)
+        th[i] = os.setTimeout(function () { n++; }, 0);
+    for(i = 99; i >= 0; i -= 2)
+        os.clearTimeout(th[i]);
+    os.clearTimeout(th[99]);
+    os.clearTimeout(-1);
+    os.setTimeout(function () {
+        assert(n, 50);
+    }, 10);
+}
+
+function test_rw_handler()
+{
+    var fds, buf, n_write;
+
+    fds = os.pipe();
+    buf = new Uint8Array(1);
+    n_write = 0;
+    os.setWriteHandler(fds[1], function () {
+        buf[0] = 65 + n_write;
+        assert(os.write(fds[1], buf.buffer, 0, 1), 1);
+        if (++n_write == 3) {
+            os.setWriteHandler(fds[1], null);
+            os.close(fds[1]);
+        }
+    });
+    os.setReadHandler(fds[0], function () {
+        var r = new Uint8Array(16), n;
+        n = os.read(fds[0], r.buffer, 0, r.length);
+        if (n == 0) {
+            /* end of file */
+            os.setReadHandler(fds[0], null);
+            os.close(fds[0]);
+            assert(n_write, 3);
+        }
+    });
+}
+
+function test_async_io()
+{
+    var fname = "test_async_io.txt";
+
+    (async function () {
+        var fd, buf, buf2, i, st, err, files, fds;
+
+        fd = os.open(fname, os.O_RDWR | os.O_CREAT | os.O_TRUNC);
+        assert(fd >= 0);
+        buf = new Uint8Array(10);
+        for(i = 0; i < buf.length; i++)
+            buf[i] = i;
+        assert(await os.writeAsync(fd, buf.buffer, 0, buf.length), buf.length);
+        assert(os.seek(fd, 0, std.SEEK_SET), 0);
+        buf2 = new Uint8Array(buf.length);
+        assert(await os.readAsync(fd, buf2.buffer, 2, 5), 5);
+        assert(buf2.join(), "0,0,0,1,2,3,4,0,0,0");
+        assert(os.close(fd), 0);
+
+        [st, err] = await os.statAsync(fname);
+        assert(err, 0);
+        assert(st.mode & os.S_IFMT, os.S_IFREG);
+        assert(st.size, buf.length);
+        [st, err] = await os.lstatAsync(fname);
+        assert(st.size, buf.length);
+        [st, err] = await os.statAsync(fname + ".none");
+        assert(st, null);
+        assert(err, std.Error.ENOENT);
+
+        [files, err] = await os.readdirAsync(".");
+        assert(err, 0);
+        assert(files.indexOf(fname) >= 0);
+        [files, err] = await os.readdirAsync(fname + ".none");
+        assert(err, std.Error.ENOENT);
+        assert(os.remove(fname), 0);
+
+        /* the read completes after the data is written */
+        fds = os.pipe();
+        os.setTimeout(function () {
+            buf[0] = 65;
+            os.write(fds[1], buf.buffer, 0, 1);
+        }, 10);
+        buf2 = new Uint8Array(4);
+        assert(await os.readAsync(fds[0], buf2.buffer, 0, 4), 1);
+        assert(buf2[0], 65);
+        os.close(fds[0]);
+        os.close(fds[1]);
+
+        /* the reads pending on pipes do not block the I/O threads */
+        var pipes = [], reads = [];
+        for(i = 0; i < 8; i++) {
+            fds = os.pipe();
+            pipes.push(fds);
+            reads.push(os.readAsync(fds[0], buf2.buffer, i % 4, 1));
+        }
+        [st, err] = await os.statAsync(".");
+        assert(err, 0);
+        for(i = 0; i < pipes.length; i++) {
+            buf[0] = i;
+            assert(await os.writeAsync(pipes[i][1], buf.buffer, 0, 1), 1);
+        }
+        assert((await Promise.all(reads)).join(), "1,1,1,1,1,1,1,1");
+        assert(buf2.join(), "4,5,6,7");
+        for(i = 0; i < pipes.length; i++) {
+            os.close(pipes[i][0]);
+            os.close(pipes[i][1]);
+        }
+    })().catch(function (e) {
+        std.err.puts(e + "\n" + e.stack);
+        std.exit(1);
+    });
+}
+
+function test_await_order()
+{
+    var log = [], p;
+
+    class MyPromise extends Promise {}
+
+    async function f1() {
+        log.push("f1");
+        log.push(await 1);
+        log.push(await Promise.resolve(2));
+        try {
+            await Promise.reject(3);
+        } catch(e) {
+            log.push("c" + e);
+        }
+    }
+    async function f2() {
+        /* the modified promises and the thenables take more jobs */
+        p = Promise.resolve(4);
+        p.constructor = function () {};
+        log.push(await p);
+        log.push(await { then(resolve) { resolve(5); } });
+        log.push(await MyPromise.resolve(6));
+    }
+    Promise.resolve().then(() => log.push("a")).then(() => log.push("b"))
+        .then(() => log.push("c")).then(() => log.push("d"))
+        .then(() => log.push("e"));
+    f1();
+    f2();
+    os.setTimeout(function () {
+        assert(log.join(), "f1,a,1,b,2,c,c3,4,d,e,5,6");
+    }, 0);
+}
+
 /* test closure variable handling when freeing asynchronous
    function */
 function test_async_gc()
@@ -299,9 +515,16 @@ test_file1();
 test_file2();
 test_getline();
 test_popen();
+test_mapFile();
+test_heap_profile();
 test_os();
 test_os_exec();
 test_timer();
+test_timer_order();
+test_timer_clear();
+test_rw_handler();
+test_async_io();
 test_ext_json();
+test_await_order();
 test_async_gc();
 
@@ -47,6 +47,15 @@ function test_worker()
                 let buf = ev.buf;
                 /* check that the SharedArrayBuffer was modified */
                 assert(buf[2], 10);
+                test_transfer();
+            }
+            break;
+        case "transfer_done":
+            {
+                let buf = ev.buf;
+                assert(buf.length, 1024);
+                assert(buf[0], 1);
+                assert(buf[1023], 2);
                 worker.postMessage({ type: "abort" });
             }
             break;
@@ -59,4 +68,25 @@ function test_worker()
 }
 
 
+function test_transfer()
+{
+    var ab, buf, err;
+
+    ab = new ArrayBuffer(1024);
+    buf = new Uint8Array(ab);
+    buf[0] = 1;
+    /* the ArrayBuffer is moved to the worker */
+    worker.postMessage({ type: "transfer", buf: buf }, [ab]);
+    assert(ab.byteLength, 0);
+    assert(buf.length, 0);
+
+    err = null;
+    try {
+        worker.postMessage({}, [new SharedArrayBuffer(8)]);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof TypeError);
+}
+
 test_worker();
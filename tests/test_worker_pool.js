@@ -0,0 +1,137 @@
+/* os.WorkerPool API test */
+import * as std from "std";
+import * as os from "os";
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+async function test_tasks(pool)
+{
+    var tab, res, i;
+
+    tab = [];
+    for(i = 0; i < 16; i++)
+        tab.push(pool.submit({ type: "sleep", id: i, delay: i % 3 }));
+    res = await Promise.all(tab);
+    for(i = 0; i < 16; i++)
+        assert(res[i], i);
+}
+
+async function test_steal(pool)
+{
+    var tab, st, stolen, i;
+
+    /* the threads which have no more tasks steal the tasks queued
+       after the long one */
+    st = pool.stats();
+    stolen = 0;
+    for(i = 0; i < st.workers.length; i++)
+        stolen += st.workers[i].stolen;
+    tab = [ pool.submit({ type: "sleep", id: 0, delay: 200 }) ];
+    for(i = 1; i < 4 * pool.size; i++)
+        tab.push(pool.submit({ type: "sleep", id: i, delay: 0 }));
+    await Promise.all(tab);
+    st = pool.stats();
+    for(i = 0; i < st.workers.length; i++)
+        stolen -= st.workers[i].stolen;
+    assert(stolen < 0, true, "no stolen task");
+}
+
+async function test_transfer(pool)
+{
+    var ab, buf, res, sab, tab, i;
+
+    ab = new ArrayBuffer(1024);
+    buf = new Uint8Array(ab);
+    buf.fill(2);
+    /* the ArrayBuffer is moved to the pool thread */
+    res = pool.submit({ type: "sum", buf: buf }, [ab]);
+    assert(ab.byteLength, 0);
+    assert(buf.length, 0);
+    res = await res;
+    assert(res.sum, 2048);
+    assert(res.length, 1024);
+
+    /* the SharedArrayBuffers are shared with the pool threads */
+    sab = new SharedArrayBuffer(8);
+    buf = new Uint8Array(sab);
+    tab = [];
+    for(i = 0; i < buf.length; i++)
+        tab.push(pool.submit({ type: "sab", buf: buf, index: i }));
+    await Promise.all(tab);
+    for(i = 0; i < buf.length; i++)
+        assert(buf[i], i + 1);
+}
+
+async function test_error(pool)
+{
+    var err = null;
+    try {
+        await pool.submit({ type: "throw" });
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof Error);
+    assert(err.message, "task error");
+}
+
+function test_stats(pool)
+{
+    var st, w, i, completed;
+
+    st = pool.stats();
+    assert(st.queued, 0);
+    assert(st.running, 0);
+    assert(st.workers.length, pool.size);
+    completed = 0;
+    for(i = 0; i < st.workers.length; i++) {
+        w = st.workers[i];
+        assert(w.queued, 0);
+        assert(w.running, false);
+        assert(w.utilization >= 0 && w.utilization <= 1);
+        completed += w.completed;
+    }
+    assert(st.completed, completed);
+    assert(completed >= 16 + 4 * pool.size + 1 + 8 + 1);
+}
+
+async function test_worker_pool()
+{
+    var pool, err;
+
+    pool = new os.WorkerPool("./test_worker_pool_module.js", 4);
+    assert(pool.size, 4);
+    await test_tasks(pool);
+    await test_steal(pool);
+    await test_transfer(pool);
+    await test_error(pool);
+    test_stats(pool);
+
+    pool.close();
+    err = null;
+    try {
+        pool.submit({ type: "sleep", id: 0, delay: 0 });
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof TypeError);
+}
+
+test_worker_pool().catch(function (e) {
+    std.err.puts(e + "\n" + (e.stack || ""));
+    std.exit(1);
+});
@@ -0,0 +1,23 @@
+/* Task handler for test_worker_pool.js */
+import * as os from "os";
+
+function handle_task(task) {
+    var i, sum;
+    switch(task.type) {
+    case "sum":
+        sum = 0;
+        for(i = 0; i < task.buf.length; i++)
+            sum += task.buf[i];
+        return { sum: sum, length: task.buf.length };
+    case "sab":
+        /* modify the SharedArrayBuffer */
+        task.buf[task.index] = task.index + 1;
+        return task.index;
+    case "sleep":
+        return os.sleepAsync(task.delay).then(() => task.id);
+    case "throw":
+        throw Error("task error");
+    }
+}
+
+os.setTaskHandler(handle_task);